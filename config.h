@@ -21,6 +21,18 @@
 #define CLOCK_SCL 21 
 #define CLOCK_I2C_BAUD 100000
 
+// The GPIO connected to the DS3231's INT/SQW pin. If it's connected, the 
+//   clock ticks from the RTC's interrupt, and the RTC is read over I2C 
+//   only every CLOCK_RESYNC_SECS. If it's not connected, set this to
+//   -1, although the program will notice, and fall back to the Pico's
+//   timer after a few seconds.
+#define CLOCK_INT_GPIO 18
+// DS3231_INT_SQW_1HZ to interrupt every second, or 
+//   DS3231_INT_ALARM_MINUTE to interrupt every minute, with the seconds
+//   counted by the Pico's timer in between
+#define CLOCK_INT_MODE DS3231_INT_SQW_1HZ
+#define CLOCK_RESYNC_SECS 3600
+
 /*======================== LCD settings =================================== */
 
 #define WSLCD_SPI         1 
@@ -44,17 +56,153 @@
 #define SD_MOSI            11
 #define SD_SCK             10 
 #define SD_BAUD            (20000 * 1000)
+// If the card supports high-speed mode, it's switched to it, and the 
+//   clock raised to this. The Pico's SPI can only divide its clock by
+//   even numbers, so with the default 125MHz clock, this gives 31.25MHz. 
+//   Set it to SD_BAUD to leave the card in default-speed mode.
+#define SD_HIGH_SPEED_BAUD (50000 * 1000)
+
+// Set to 1 to have the RP2040's DMA sniffer calculate the CRC16 of each
+//   SD data block while it is transferred, or 0 to calculate it in
+//   software afterwards. The 'sdcrc' command switches at run time.
+#define SD_HW_CRC 1
+
+// Host builds only. The SD card is an image file. If HOST_SD_EMULATOR is 0,
+//   FatFs reads the image directly. If it is 1, the image is wrapped in 
+//   an emulated SD card (drivers/sdcard/sdemu.h), and read through the 
+//   real SD driver. The emulated card's latencies and faults can be set
+//   using the environment variable PPC_SDEMU, e.g., 
+//   PPC_SDEMU=read_latency=300,crc_error=50
+// The environment variable PPC_SDIMAGE, if set, overrides HOST_SD_IMAGE,
+//   so that images made by tools/ppcimage can be used without a rebuild.
+#define HOST_SD_EMULATOR 0
+#define HOST_SD_IMAGE "/tmp/fatfs_loopback.img"
+// Host builds only. The file that stands in for the Pico's flash, for
+//   the flash cache (FLASH_CACHE_KB)
+#define HOST_FLASH_IMAGE "/tmp/ppc_flash.img"
+
+// Number of 512-byte sectors to keep in RAM, to save reading the FAT and
+//   directories over and over again. The metadata policy applies to
+//   sectors before the data area, which are the FATs and, on FAT16, the 
+//   root directory. The data policy applies to the rest, which are files 
+//   and, on FAT32 and exFAT, directories. DISKCACHE_WINDOW caches only 
+//   sectors that FatFs reads into its window, which are directories; 
+//   file contents go into the file's own buffer, and are not cached. 
+//   (DISKCACHE_SINGLE, which caches all single-sector reads, would also
+//   cache every sector of a photo that is decoded through that buffer.)
+//   A directory that is bigger than the cache gets no benefit from it,
+//   since reading it from start to end evicts its own first sectors. 
+//   Set DISK_CACHE_SECTORS to 0 for no cache.
+#define DISK_CACHE_SECTORS     16
+#define DISK_CACHE_META_POLICY DISKCACHE_ALWAYS
+#define DISK_CACHE_DATA_POLICY DISKCACHE_WINDOW
 
 /*==================== General settings =================================== */
 
-// Specify the location of the JPEG files, and the pattern to match
+// Specify the location of the JPEG files, and the pattern to match.
+//   Directories inside JPEG_DIR, and inside them, are searched too.
 #define JPEG_DIR "/"
 #define JPEG_PATTERN "*.jpg"
 
+// Packs, made by tools/ppcpack, hold many photos in one file, and are
+//   found in the same directories. Define as NULL to ignore them.
+#define PACK_PATTERN "*.ppk"
+
+// Each photo's header is read as it's added to the catalog, and photos
+//   that can't be shown -- progressive JPEGs, for example -- are left
+//   out. So are photos wider or taller than JPEG_MAX_SIZE, which would
+//   take a long time to decode, only for their middles to be shown; 
+//   set it to 0 for no limit. With CATALOG_CHECK_HEADERS set to 0, the
+//   catalog is built faster, but such photos are only found when it's
+//   time to show them.
+#define CATALOG_CHECK_HEADERS 1
+#define JPEG_MAX_SIZE 2048
+
+// At start-up, the search for photos stops when it has found 
+//   CATALOG_START_PHOTOS, so they can be shown without waiting for the
+//   rest, which are found in idle time, CATALOG_SLICE_US microseconds
+//   at a time. 
+#define CATALOG_START_PHOTOS 4
+#define CATALOG_SLICE_US 10000
+
+// The most photos that will be catalogued. Each takes 14 bytes of RAM
+//   (10 without JPEG_PREVIEW), and more while the catalog grows, when
+//   its arrays are copied. With 6000 photos, tools/ppcbench measures a
+//   peak heap of 120 kB, which leaves room for a photo of 
+//   PREFETCH_MAX_KB in the Pico's 264 kB. Much more than that won't fit.
+#define CATALOG_MAX_PHOTOS 6000
+
+// Images that only fit the screen on their side, like 320x480 portraits, 
+//   are rotated by the panel by this amount. Use WSLCD_ROTATE_270 if 
+//   they come out upside-down, or 0 to crop them instead. Rotation 
+//   specified by EXIF orientation is always applied, when the image fits.
+#define PORTRAIT_ROTATION WSLCD_ROTATE_90
+
 // Default position of the clock -- top left corner
 #define CLOCK_DEFAULT_X 5
 #define CLOCK_DEFAULT_Y 5
 
+// Photos are drawn in slices of about this many microseconds, between
+//   which the clock is updated, and commands are handled
+#define RENDER_SLICE_US 20000
+
+// When the background has been drawn, the next photo is read into
+//   memory, so it can be decoded without waiting for the SD card. 
+//   Photos larger than this (in kB) are read from the card when they 
+//   are needed. This can be changed in the settings file. Each idle
+//   slice reads at most PREFETCH_CHUNK_BYTES, which should be a 
+//   multiple of 512.
+#define PREFETCH_MAX_KB 96
+#define PREFETCH_CHUNK_BYTES 8192
+
+// Each photo that is opened gets a map of where its clusters are on
+//   the card, of FILES_CLMT_ITEMS 32-bit words, so FatFs doesn't have
+//   to follow the FAT to find them. The map holds 
+//   (FILES_CLMT_ITEMS - 2) / 2 fragments; a photo in more pieces than
+//   that is read in the ordinary way. A photo in one piece -- which
+//   is usual on a freshly-formatted card -- is read into memory 
+//   straight from the card, without going through FatFs.
+#define FILES_CLMT_ITEMS 16
+
+// Set to 1 to have the JPEG decoder read its input where it is -- in 
+//   FatFs's sector buffer, or in the prefetched photo -- or 0 to have
+//   it copied to the decoder's own buffer first. The 'jpegcopy' command
+//   switches at run time, and 'stats' shows the decoding times.
+#define JPEG_ZERO_COPY 1
+
+// Set to 1 to draw the thumbnail that cameras put in the EXIF block, 
+//   scaled up, before decoding each photo, so something appears on
+//   the display much sooner. The catalog remembers where each 
+//   thumbnail is. The 'preview' command switches at run time.
+#define JPEG_PREVIEW 1
+
+// Decoded photos can be kept in a directory on the SD card, so that
+//   they can be drawn again without decoding. Each is the size of the
+//   display, 300kB for 480x320. The number of photos kept can be set
+//   in the settings file; the default of zero turns the cache off. 
+//   When it's full, the photo used least recently is dropped; a photo's
+//   frame is written to once after each start-up, the first time it's
+//   used, so that this survives a restart. Cached photos are read in 
+//   strips of FRAME_CACHE_STRIP_ROWS rows, 
+//   which needs a buffer of 2 bytes per pixel.
+#define FRAME_CACHE_DIR "/ppc-cache"
+#define FRAME_CACHE_MAX_FRAMES 0
+#define FRAME_CACHE_STRIP_ROWS 16
+
+// Photos can also be copied into the Pico's own flash, in the last
+//   FLASH_CACHE_KB kilobytes, which the program must not reach into. 
+//   They are then shown without reading the card, and can still be 
+//   shown if the card can't be read. Only photos that have been read 
+//   ahead (see PREFETCH_MAX_KB) are copied. The number kept can be set
+//   in the settings file; the default of zero copies none. Once the
+//   cache is full, no more are copied, until a cached photo changes on
+//   the card. A flash sector that has been erased FLASH_CACHE_MAX_ERASES
+//   times -- a tenth of what the flash is made to take -- isn't used 
+//   again. Set FLASH_CACHE_KB to 0 to leave the feature out.
+#define FLASH_CACHE_KB 1024
+#define FLASH_CACHE_MAX_PHOTOS 0
+#define FLASH_CACHE_MAX_ERASES 10000
+
 // How long in minutes to show a particular photo
 #define DEFAULT_MINS_PER_PHOTO 3
 
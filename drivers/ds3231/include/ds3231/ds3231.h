@@ -12,6 +12,13 @@
 
   ds3231_destroy (ds3231);
 
+  If the chip's INT/SQW pin is wired to a GPIO, ds3231_enable_interrupt
+  makes the chip interrupt once a second, or once a minute. The driver
+  then keeps the date and time in software, advancing it on each 
+  interrupt, and ds3231_get_datetime no longer needs an I2C transaction.
+  The chip is read only when the interrupt is enabled, and every so 
+  often after that, to check for drift.
+
   Copyright (2)2022 Kevin Boone, GPLv3.0 
 
 ===========================================================================*/
@@ -26,6 +33,28 @@
 struct _DS3231;
 typedef struct _DS3231 DS3231;
 
+// What the INT/SQW pin does
+typedef enum 
+  {
+  // No interrupts; every ds3231_get_datetime reads the chip
+  DS3231_INT_NONE = 0,
+  // 1Hz square wave, whose falling edge is the start of each second
+  DS3231_INT_SQW_1HZ = 1,
+  // Alarm 2, which pulls the pin low at the start of each minute
+  DS3231_INT_ALARM_MINUTE = 2
+  } DS3231IntMode;
+
+// Called in interrupt context, after the software clock has been 
+//   advanced. Must be brief, and must not use I2C. 
+typedef void (*DS3231IntFn) (void *data);
+
+typedef struct _DS3231Stats
+  {
+  unsigned int interrupts;
+  unsigned int resyncs;
+  int last_drift; // Seconds the software clock was ahead at last resync
+  } DS3231Stats;
+
 #ifdef __cplusplus
 extern "C" { 
 #endif
@@ -55,7 +84,8 @@ extern int ds3231_set_datetime (DS3231 *self, int year, int month, int day,
 
 /** Get the date and time. This operation always succeeds, although the
       results might be meaningless if, for example, no DS3231 is 
-      connected. */
+      connected. If interrupts are enabled, this reads the software 
+      clock, and is cheap enough to call as often as needed. */
 extern void ds3231_get_datetime (const DS3231 *self, int *year, 
         int *month, int *day, int *hour, int *min, int *sec);
 
@@ -64,6 +94,28 @@ extern void ds3231_get_datetime (const DS3231 *self, int *year,
       floating-point math support. */
 extern int ds3231_get_temp (const DS3231 *self);
 
+/** Configure the chip's INT/SQW output, and take a falling-edge interrupt
+      from it on the specified GPIO. The chip is read, to set the software
+      clock, and read again every resync_secs seconds (rounded up to a 
+      whole number of interrupts). fn, if not NULL, is called in interrupt
+      context on every interrupt. There can only be one DS3231 with 
+      interrupts enabled. Use DS3231_INT_NONE to turn interrupts off
+      again. Returns 0, or ENOTSUP on the host. */
+extern int ds3231_enable_interrupt (DS3231 *self, int gpio, 
+        DS3231IntMode mode, unsigned int resync_secs, DS3231IntFn fn,
+        void *data);
+
+/** Do the work that can't be done in interrupt context. Call this from 
+      the main thread after each interrupt -- it acknowledges the alarm, 
+      and resynchronizes the software clock when that is due. */
+extern void ds3231_service (DS3231 *self);
+
+/** Read the chip, and set the software clock from it. Returns the
+      number of seconds by which the software clock was ahead. */
+extern int ds3231_resync (DS3231 *self);
+
+extern void ds3231_get_stats (const DS3231 *self, DS3231Stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
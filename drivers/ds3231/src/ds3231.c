@@ -14,18 +14,57 @@
 #if PICO_ON_DEVICE
 #include <hardware/i2c.h>
 #include <hardware/gpio.h>
+#include <hardware/sync.h>
+#include <pico/time.h>
 #endif
 
 #include <ds3231/ds3231.h>
 
+// Registers used for the interrupt output
+#define DS3231_REG_ALARM2 0x0B // Three registers: minute, hour, day
+#define DS3231_REG_CONTROL 0x0E
+#define DS3231_REG_STATUS 0x0F
+
+#define DS3231_CONTROL_INTCN 0x04
+#define DS3231_CONTROL_A2IE 0x02
+#define DS3231_STATUS_A2F 0x02
+// Set in all three alarm 2 registers, the alarm fires whenever the 
+//   seconds are zero
+#define DS3231_ALARM_MASK 0x80
+
+/*===========================================================================
+  DS3231Calendar 
+===========================================================================*/
+typedef struct _DS3231Calendar
+  {
+  int year, month, day, hour, min, sec;
+  } DS3231Calendar;
+
 /*===========================================================================
   ds3231 opaque structure
 ===========================================================================*/
 struct _DS3231
   {
   int i2c_dev; // 0 or 1
+  // The remaining fields are used only when interrupts are enabled.
+  //   Those marked * are changed by the interrupt handler.
+  DS3231IntMode int_mode;
+  int int_gpio;
+  DS3231IntFn int_fn;
+  void *int_data;
+  DS3231Calendar cal; // * The software clock
+  uint64_t last_int_us; // * When cal was last changed
+  unsigned int resync_ints; // Interrupts between resyncs
+  unsigned int ints_since_sync; // *
+  DS3231Stats stats; // *
   };
 
+#if PICO_ON_DEVICE
+// The GPIO interrupt callback is global, so it needs a global to find
+//   the DS3231
+static DS3231 *ds3231_int_instance = NULL;
+#endif
+
 /*===========================================================================
   ds3231_new
 ===========================================================================*/
@@ -108,6 +147,11 @@ int ds3231_set_datetime (DS3231 *self, int year, int month, int day,
 
     i2c_write_blocking (self->i2c_dev == 0 ? i2c0 : i2c1, DS3231_ADDRESS, 
       b, 8, false);
+    // Writing the seconds restarts the chip's countdown, so the next
+    //   interrupt is a whole second away, and the software clock 
+    //   must start again from the new time
+    if (self->int_mode != DS3231_INT_NONE)
+      ds3231_resync (self);
 #else
    (void)self; (void)year; (void)month; (void)year; (void)day;
    (void)hour; (void)min; (void)sec;
@@ -118,10 +162,10 @@ int ds3231_set_datetime (DS3231 *self, int year, int month, int day,
   }
 
 /*===========================================================================
-  ds3231_get_datetime
+  ds3231_read_chip
+  Read the date and time registers over I2C
 ===========================================================================*/
-void ds3231_get_datetime (const DS3231 *self, int *year, int *month, int *day, 
-        int *hour, int *min, int *sec)
+static void ds3231_read_chip (const DS3231 *self, DS3231Calendar *cal)
   {
 #if PICO_ON_DEVICE
   unsigned char b[7];
@@ -132,28 +176,57 @@ void ds3231_get_datetime (const DS3231 *self, int *year, int *month, int *day,
        &reg, 1,  true);
   i2c_read_blocking (self->i2c_dev == 0 ? i2c0 : i2c1, DS3231_ADDRESS, 
        b, 7, false);
-  *sec = bcd_to_dec (b[0] & 0x7F);
-  *min = bcd_to_dec (b[1] & 0x7F);
-  *hour = bcd_to_dec (b[2] & 0x3F);
+  cal->sec = bcd_to_dec (b[0] & 0x7F);
+  cal->min = bcd_to_dec (b[1] & 0x7F);
+  cal->hour = bcd_to_dec (b[2] & 0x3F);
   // We aren't using the day-of-week register which would be b[3]
-  *day = bcd_to_dec (b[4] & 0x3F);
-  *month = bcd_to_dec (b[5] & 0x1F);
-  *year = bcd_to_dec (b[6]);
+  cal->day = bcd_to_dec (b[4] & 0x3F);
+  cal->month = bcd_to_dec (b[5] & 0x1F);
+  cal->year = bcd_to_dec (b[6]);
 #else
-  *sec = *min = *hour = *day = *month = *year = 0;
+  cal->sec = cal->min = cal->hour = cal->day = cal->month = cal->year = 0;
   (void)self;
 #endif
 
-  *year += 2000;
-/*
-  for (int i = 0; i < 7; i++)
+  cal->year += 2000;
+  }
+
+/*===========================================================================
+  ds3231_get_datetime
+===========================================================================*/
+void ds3231_get_datetime (const DS3231 *self, int *year, int *month, int *day, 
+        int *hour, int *min, int *sec)
+  {
+  DS3231Calendar cal;
+  if (self->int_mode == DS3231_INT_NONE)
+    ds3231_read_chip (self, &cal);
+  else
     {
-    printf ("i=%d v=%02x\n", i, buff[i]);
+#if PICO_ON_DEVICE
+    uint32_t irq = save_and_disable_interrupts ();
+    cal = self->cal;
+    uint64_t last_int_us = self->last_int_us;
+    restore_interrupts (irq);
+    if (self->int_mode == DS3231_INT_ALARM_MINUTE)
+      {
+      // We only hear from the chip once a minute, so the seconds come
+      //   from the microsecond timer
+      uint64_t elapsed = (time_us_64() - last_int_us) / 1000000;
+      cal.sec += elapsed > 59 ? 59 : (int)elapsed;
+      if (cal.sec > 59) cal.sec = 59;
+      }
+#else
+    cal = self->cal;
+#endif
     }
-*/
+  *year = cal.year;
+  *month = cal.month;
+  *day = cal.day;
+  *hour = cal.hour;
+  *min = cal.min;
+  *sec = cal.sec;
   }
 
-
 /*===========================================================================
   ds3231_get_temp
 ===========================================================================*/
@@ -183,4 +256,222 @@ int ds3231_get_temp (const DS3231 *self)
   return t;
   }
 
+/*===========================================================================
+  ds3231_days_in_month
+  Good for 2000-2099, which is all the chip supports
+===========================================================================*/
+static int ds3231_days_in_month (int year, int month)
+  {
+  static const int days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  if (month < 1 || month > 12) return 31;
+  if (month == 2 && year % 4 == 0) return 29;
+  return days[month - 1];
+  }
+
+/*===========================================================================
+  ds3231_calendar_add
+  Add secs seconds to the calendar. secs will be 1 or 60, so this 
+    doesn't need to be clever.
+===========================================================================*/
+#if PICO_ON_DEVICE
+static void ds3231_calendar_add (DS3231Calendar *cal, int secs)
+  {
+  cal->sec += secs;
+  while (cal->sec >= 60) { cal->sec -= 60; cal->min++; }
+  while (cal->min >= 60) { cal->min -= 60; cal->hour++; }
+  while (cal->hour >= 24) 
+    { 
+    cal->hour -= 24; 
+    cal->day++; 
+    if (cal->day > ds3231_days_in_month (cal->year, cal->month))
+      {
+      cal->day = 1;
+      cal->month++;
+      if (cal->month > 12)
+        {
+        cal->month = 1;
+        cal->year++;
+        }
+      }
+    }
+  }
+#endif
+
+/*===========================================================================
+  ds3231_calendar_to_secs
+  Seconds since the start of 2000, for working out drift
+===========================================================================*/
+static int64_t ds3231_calendar_to_secs (const DS3231Calendar *cal)
+  {
+  int64_t days = 0;
+  for (int y = 2000; y < cal->year; y++)
+    days += (y % 4 == 0) ? 366 : 365;
+  for (int m = 1; m < cal->month; m++)
+    days += ds3231_days_in_month (cal->year, m);
+  days += cal->day - 1;
+  return ((days * 24 + cal->hour) * 60 + cal->min) * 60 + cal->sec;
+  }
+
+#if PICO_ON_DEVICE
+/*===========================================================================
+  ds3231_write_reg, ds3231_read_reg
+===========================================================================*/
+static void ds3231_write_reg (const DS3231 *self, uint8_t reg, uint8_t val)
+  {
+  uint8_t b[2] = { reg, val };
+  i2c_write_blocking (self->i2c_dev == 0 ? i2c0 : i2c1, DS3231_ADDRESS, 
+      b, 2, false);
+  }
+
+static uint8_t ds3231_read_reg (const DS3231 *self, uint8_t reg)
+  {
+  uint8_t val = 0;
+  i2c_write_blocking (self->i2c_dev == 0 ? i2c0 : i2c1,  DS3231_ADDRESS, 
+       &reg, 1,  true);
+  i2c_read_blocking (self->i2c_dev == 0 ? i2c0 : i2c1, DS3231_ADDRESS, 
+       &val, 1, false);
+  return val;
+  }
+
+/*===========================================================================
+  ds3231_gpio_irq
+  Advance the software clock by a second or a minute.
+===========================================================================*/
+static void ds3231_gpio_irq (uint gpio, uint32_t events)
+  {
+  (void)events;
+  DS3231 *self = ds3231_int_instance;
+  if (!self || (int)gpio != self->int_gpio) return;
+  if (self->int_mode == DS3231_INT_ALARM_MINUTE)
+    {
+    // The alarm fires as the seconds become zero
+    self->cal.sec = 0;
+    ds3231_calendar_add (&self->cal, 60);
+    }
+  else
+    ds3231_calendar_add (&self->cal, 1);
+  self->last_int_us = time_us_64();
+  self->ints_since_sync++;
+  self->stats.interrupts++;
+  if (self->int_fn) self->int_fn (self->int_data);
+  }
+#endif
+
+/*===========================================================================
+  ds3231_resync
+===========================================================================*/
+int ds3231_resync (DS3231 *self)
+  {
+  DS3231Calendar chip;
+  ds3231_read_chip (self, &chip);
+#if PICO_ON_DEVICE
+  uint32_t irq = save_and_disable_interrupts ();
+#endif
+  int drift = (int)(ds3231_calendar_to_secs (&self->cal) 
+    - ds3231_calendar_to_secs (&chip));
+  if (self->int_mode == DS3231_INT_ALARM_MINUTE)
+    drift = 0; // The software clock has no seconds of its own to compare 
+  self->cal = chip;
+#if PICO_ON_DEVICE
+  self->last_int_us = time_us_64();
+#endif
+  self->ints_since_sync = 0;
+  self->stats.resyncs++;
+  self->stats.last_drift = drift;
+#if PICO_ON_DEVICE
+  restore_interrupts (irq);
+#endif
+  return drift;
+  }
+
+/*===========================================================================
+  ds3231_enable_interrupt
+===========================================================================*/
+int ds3231_enable_interrupt (DS3231 *self, int gpio, DS3231IntMode mode, 
+        unsigned int resync_secs, DS3231IntFn fn, void *data)
+  {
+#if PICO_ON_DEVICE
+  if (self->int_mode != DS3231_INT_NONE)
+    {
+    gpio_set_irq_enabled ((uint)self->int_gpio, GPIO_IRQ_EDGE_FALL, false);
+    ds3231_int_instance = NULL;
+    }
+
+  self->int_gpio = gpio;
+  self->int_fn = fn;
+  self->int_data = data;
+
+  switch (mode)
+    {
+    case DS3231_INT_SQW_1HZ:
+      // INTCN clear selects the square wave; RS1/RS2 clear select 1Hz
+      ds3231_write_reg (self, DS3231_REG_CONTROL, 0x00);
+      self->resync_ints = resync_secs > 0 ? resync_secs : 1;
+      break;
+    case DS3231_INT_ALARM_MINUTE:
+      ds3231_write_reg (self, DS3231_REG_ALARM2, DS3231_ALARM_MASK);
+      ds3231_write_reg (self, DS3231_REG_ALARM2 + 1, DS3231_ALARM_MASK);
+      ds3231_write_reg (self, DS3231_REG_ALARM2 + 2, DS3231_ALARM_MASK);
+      ds3231_write_reg (self, DS3231_REG_CONTROL, 
+        DS3231_CONTROL_INTCN | DS3231_CONTROL_A2IE);
+      ds3231_write_reg (self, DS3231_REG_STATUS, (uint8_t)
+        (ds3231_read_reg (self, DS3231_REG_STATUS) & ~DS3231_STATUS_A2F));
+      self->resync_ints = (resync_secs + 59) / 60;
+      if (self->resync_ints == 0) self->resync_ints = 1;
+      break;
+    default:
+      // Interrupt mode, with no alarms enabled, leaves the pin high
+      ds3231_write_reg (self, DS3231_REG_CONTROL, DS3231_CONTROL_INTCN);
+      self->int_mode = DS3231_INT_NONE;
+      return 0;
+    }
+
+  // Set the software clock before the first interrupt can arrive
+  self->int_mode = mode;
+  ds3231_resync (self);
+  self->stats.resyncs = 0;
+
+  // INT/SQW is open-drain
+  gpio_init ((uint)gpio);
+  gpio_set_dir ((uint)gpio, GPIO_IN);
+  gpio_pull_up ((uint)gpio);
+  ds3231_int_instance = self;
+  gpio_set_irq_enabled_with_callback ((uint)gpio, GPIO_IRQ_EDGE_FALL, 
+    true, ds3231_gpio_irq);
+  return 0;
+#else
+  (void)self; (void)gpio; (void)mode; (void)resync_secs; (void)fn; 
+  (void)data;
+  return ENOTSUP;
+#endif
+  }
+
+/*===========================================================================
+  ds3231_service
+===========================================================================*/
+void ds3231_service (DS3231 *self)
+  {
+#if PICO_ON_DEVICE
+  if (self->int_mode == DS3231_INT_ALARM_MINUTE)
+    {
+    // The pin stays low until the alarm flag is cleared, so there will
+    //   be no more falling edges until we do this
+    ds3231_write_reg (self, DS3231_REG_STATUS, (uint8_t)
+      (ds3231_read_reg (self, DS3231_REG_STATUS) & ~DS3231_STATUS_A2F));
+    }
+  if (self->int_mode != DS3231_INT_NONE 
+       && self->ints_since_sync >= self->resync_ints)
+    ds3231_resync (self);
+#else
+  (void)self;
+#endif
+  }
+
+/*===========================================================================
+  ds3231_get_stats
+===========================================================================*/
+void ds3231_get_stats (const DS3231 *self, DS3231Stats *stats)
+  {
+  *stats = self->stats;
+  }
 
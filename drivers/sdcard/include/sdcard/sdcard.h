@@ -15,10 +15,14 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #if PICO_ON_DEVICE
 #include <hardware/gpio.h>
 #include <hardware/spi.h>
+#else
+#include <pico/types.h>
+#include <sdcard/sdemu.h>
 #endif
 
 /*============================================================================
@@ -43,10 +47,15 @@ typedef int SDError;
 // Card has not been initialized
 #define SD_ERR_UNINIT_CARD     -1012
 #define SD_ERR_SEC_RANGE       -1013
+// Not an error: an asynchronous read has not got that far yet
+#define SD_ERR_BUSY            -1014
 
 // We will always use 512-byte reads and writes
 #define SD_BLOCK_SIZE 512
 
+// The number of buffers that can be queued for an asynchronous read
+#define SDCARD_READ_QUEUE 2
+
 /** SD/MMC card types  */
 typedef enum 
   {
@@ -63,6 +72,23 @@ typedef enum
 
 typedef struct _SDCard SDCard;
 
+/** What the driver has found out about the card, and how it's going */
+typedef struct _SDCardInfo
+  {
+  SDCardType type;
+  uint64_t sectors;
+  bool high_speed; // The card was switched to high-speed mode by CMD6
+  int baud_rate; // The SPI clock rate requested
+  int actual_baud_rate; // What the SPI hardware could actually manage
+  unsigned int fallbacks; // Times the clock was lowered after errors
+  unsigned int crc_errors;
+  unsigned int timeouts;
+  bool hw_crc; // Data block CRCs are calculated by the DMA sniffer
+  unsigned int crc_blocks; // Data blocks whose CRC was calculated
+  unsigned int crc_hw_blocks; // ... of which, by the DMA sniffer
+  uint64_t crc_us; // Total CPU time spent on those CRCs
+  } SDCardInfo;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -77,6 +103,21 @@ extern "C" {
 extern SDCard *sdcard_new (int spi, int drive_strength, uint gpio_cs,
           uint gpio_miso, uint gpio_mosi, uint gpio_sck, int baud_rate);
 
+/** Set the SPI clock rate to use if the card can be switched to 
+      high-speed mode, which allows up to 50MHz. This must be called 
+      before sdcard_insert_card, and only has an effect if it's higher 
+      than the rate given to sdcard_new, which is used for cards that 
+      can't switch. If reads or writes fail with CRC errors or 
+      timeouts, the driver lowers the rate, and tries again. */
+extern void sdcard_set_high_speed_baud (SDCard *self, int baud_rate);
+
+/** Choose whether the CRC16 of each data block is calculated by the 
+      DMA sniffer, while the block is being transferred, or afterwards
+      in software. The sniffer is the default; the software is used 
+      anyway if something else has the sniffer. This also resets the 
+      CRC counts in SDCardInfo, so the two can be compared. */
+extern void sdcard_set_hw_crc (SDCard *self, bool hw_crc);
+
 /** Clean up the SDCard driver. Note that we can free the memory used,
       but we can't uninitalize the low-level hardware settings, because we
       don't know what they were. */
@@ -106,16 +147,54 @@ extern uint64_t sdcard_get_sectors (const SDCard *self);
 
 /** Read one or more sectors from the card into memory. The card and
      the driver must first have been initialized. The caller _must_
-     check the return value to see whether the read succeeded. */
+     check the return value to see whether the read succeeded. Each 
+     sector's CRC is checked while the next sector is arriving, but the
+     call doesn't return until the whole read is done. */
 extern SDError sdcard_read_sectors (SDCard *self, uint8_t *buffer, 
           uint32_t start, uint32_t count);
 
+/** Start an asynchronous read of count sectors, starting at sector
+     start. The card and the driver must first have been initialized.
+     Buffers for the sectors are then supplied, in order, using 
+     sdcard_read_queue, and collected using sdcard_read_wait. Finally,
+     sdcard_read_end must be called, even if something failed. The
+     SPI bus belongs to the card until then, so nothing else on the same 
+     bus -- the display, for example -- can be used. So the time that
+     can be overlapped with the reads is for computation, not other I/O.
+     Unlike sdcard_read_sectors, nothing is retried if a read fails.
+     Returns an SD_ERR_XXX value if the read can't be started. */
+extern SDError sdcard_read_begin (SDCard *self, uint32_t start, 
+         uint32_t count);
+
+/** Supply a buffer of SD_BLOCK_SIZE bytes for the next sector of an 
+     asynchronous read. At most SDCARD_READ_QUEUE buffers can be queued
+     at once. Transfers are started by sdcard_read_wait, not here. */
+extern SDError sdcard_read_queue (SDCard *self, uint8_t *buffer);
+
+/** Collect the oldest queued sector, without waiting for it. If it has
+     arrived, set buffer to the buffer that was supplied for it, which then
+     belongs to the caller again, and return 0. The transfer of the next 
+     queued sector is started, if the card is ready to send it. 
+     If the sector has not arrived yet, return SD_ERR_BUSY, and the caller 
+     should do something else and call again. Each call polls the card
+     for a few bytes, so the caller's work between calls determines how
+     quickly the sectors follow one another. Returns SD_ERR_CRC if the data
+     is corrupt, or another SD_ERR_XXX value if it didn't arrive. */
+extern SDError sdcard_read_wait (SDCard *self, uint8_t **buffer);
+
+/** Finish an asynchronous read, and release the bus. This can be called
+     before all the sectors have been collected, to abandon the read. */
+extern SDError sdcard_read_end (SDCard *self);
+
 /** Write one or more sectors to the card from memory. The card and
      the driver must first have been initialized. The caller _must_
      check the return value to see whether the read succeeded. */
 extern SDError sdcard_write_sectors (SDCard *self, const uint8_t *buffer, 
          uint32_t start, uint32_t count);
 
+/** Get the card's mode and clock rate, and error counts. */
+extern void sdcard_get_info (const SDCard *self, SDCardInfo *info);
+
 /** Get a human-readable string representing the result from get_card_type. */
 extern const char *sdcard_type_to_string (SDCardType type);
 
@@ -123,6 +202,17 @@ extern const char *sdcard_type_to_string (SDCardType type);
      specified error code (one of the SD_ERR_XXX values) */
 extern const char *sdcard_perror (SDError error);
 
+#if PICO_ON_DEVICE
+#else
+/** Host builds only: use an emulated card in place of the hardware. This
+      must be called before sdcard_init. Without an emulated card, the
+      driver does nothing, and the host build reads the card image 
+      directly. */
+extern void sdcard_attach_emulator (SDCard *self, SDEmu *emu);
+
+extern SDEmu *sdcard_get_emulator (const SDCard *self);
+#endif
+
 /** Get the SDCard instance that represents a particular drive. Note that,
     at present, only one drive is supported, and the drive_num argument
     is ignore. */
@@ -0,0 +1,109 @@
+/*============================================================================
+ *
+ * sdcard/sdemu.h
+ *
+ * An emulation of an SDHC card in SPI mode, for host builds only. The card's
+ * sectors are kept in an image file. The emulator is driven a byte at a
+ * time, just as the card would be by the SPI bus, so the SD driver can run
+ * unchanged on top of it.
+ *
+ * The card can be made slow -- each command, read, and write can be given
+ * a latency -- and it can be made to fail, at intervals, in the ways that
+ * real cards do. The emulator counts the bytes that cross the bus, and works
+ * out how long they would have taken at the clock rate the driver set, so
+ * the effect of changes to the driver can be estimated without hardware.
+ *
+ * Copyright (c)2023 Kevin Boone, GPL v3.0
+ *
+ * ==========================================================================*/
+
+#pragma once
+
+#if PICO_ON_DEVICE
+#else
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Commands are numbered 0-63
+#define SDEMU_COMMANDS 64
+
+struct _SDEmu;
+typedef struct _SDEmu SDEmu;
+
+/** How the emulated card behaves. Latencies are in microseconds, and
+      are converted to bytes on the bus at the current clock rate. A
+      fault setting of N means that every Nth occasion fails; zero means
+      never. */
+typedef struct _SDEmuConfig
+  {
+  uint32_t sectors; // Card size; zero to use the size of the image
+  bool high_speed; // The card can be switched to high-speed mode by CMD6
+  int max_baud; // Above this clock rate data is corrupted; zero for no limit
+  unsigned int init_polls; // Number of ACMD41s before the card is ready
+  unsigned int response_bytes; // Delay before each response, 1-8 bytes
+  unsigned int cmd_latency_us[SDEMU_COMMANDS]; // Extra time per command
+  unsigned int read_latency_us; // Time to find each sector that is read
+  unsigned int write_busy_us; // Time to program each sector that is written
+  unsigned int no_response_every; // Commands that get no response
+  unsigned int crc_error_every; // Sectors read with a bad CRC
+  unsigned int read_timeout_every; // Sectors read that never arrive
+  unsigned int write_reject_every; // Sectors written that are rejected
+  } SDEmuConfig;
+
+typedef struct _SDEmuStats
+  {
+  unsigned int commands;
+  unsigned int sectors_read;
+  unsigned int sectors_written;
+  unsigned int faults; // Faults injected
+  uint64_t bytes; // Bytes exchanged while the card was selected
+  uint64_t busy_bytes; // ... of which the card was busy or finding data
+  uint64_t bus_us; // Estimated time those bytes would take
+  } SDEmuStats;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Fill in a configuration that is typical of a reasonable card. */
+extern void sdemu_config_defaults (SDEmuConfig *config);
+
+/** Change a configuration according to a string of the form
+      "name=value,name=value...". The names are those of the fields of
+      SDEmuConfig, but without the _us or _every; the latency of
+      command N is "cmdN". A NULL or empty string changes nothing.
+      Returns EINVAL if the string can't be understood. */
+extern int sdemu_config_parse (SDEmuConfig *config, const char *spec);
+
+/** Create an emulated card backed by the specified image file, which must
+      exist. config may be NULL, to use the defaults. Returns NULL if the
+      image can't be opened. */
+extern SDEmu *sdemu_new (const char *image, const SDEmuConfig *config);
+
+extern void sdemu_destroy (SDEmu *self);
+
+/** Set the card's chip select line; the card only listens when it is
+      selected. */
+extern void sdemu_select (SDEmu *self, bool selected);
+
+extern bool sdemu_is_selected (const SDEmu *self);
+
+/** Tell the card the SPI clock rate, which affects timing estimates
+      and, if max_baud is set, data integrity. */
+extern void sdemu_set_baud (SDEmu *self, unsigned int baud);
+
+extern unsigned int sdemu_get_baud (const SDEmu *self);
+
+/** Clock one byte across the bus: the host sends mosi, and gets back
+      whatever the card sends at the same time. */
+extern uint8_t sdemu_exchange (SDEmu *self, uint8_t mosi);
+
+extern const SDEmuStats *sdemu_get_stats (const SDEmu *self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PICO_ON_DEVICE
+
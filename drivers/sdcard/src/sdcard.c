@@ -27,6 +27,7 @@
 #include <hardware/gpio.h>
 #include <hardware/spi.h>
 #include <hardware/dma.h>
+#include <hardware/regs/dma.h>
 #endif
 
 //#define TRACE SYSLOG_TRACE
@@ -73,6 +74,8 @@
 #define SPI_DATA_RESPONSE_MASK 0x1F
 // Card has accepted data 
 #define SPI_DATA_ACCEPTED 0x05
+// Card has rejected data, because the CRC was wrong
+#define SPI_DATA_CRC_ERROR 0x0B
 
 /* SPI control tokens */
 
@@ -80,6 +83,8 @@
 #define SPI_START_BLOCK_MULTIPLE 0xFC
 // Single-block read/write and multi-block read
 #define SPI_START_BLOCK 0xFE
+// End of multiple block write
+#define SPI_STOP_TRAN 0xFD
 
 /* ===== SD protocol tuning paramters ====== */
 
@@ -90,6 +95,10 @@
 // Command timeout in msec
 #define SD_COMMAND_TIMEOUT 2000
 
+// The number of bytes sdcard_read_wait reads from the card, looking for
+//   a start token, before giving up and returning SD_ERR_BUSY
+#define SDCARD_TOKEN_POLL 16
+
 /* =====  R1 response ====== */
 
 /* "R1" is the one-byte response received after most
@@ -113,6 +122,18 @@
 //   the command at all. 
 #define R1_NO_RESPONSE 0xFF
 
+// CMD6 arguments for function group 1 (access mode), leaving the other
+//   groups unchanged. Mode 0 checks, mode 1 switches.
+#define CMD6_CHECK_HIGH_SPEED  0x00FFFFF1
+#define CMD6_SWITCH_HIGH_SPEED 0x80FFFFF1
+
+// The size of the status block that CMD6 returns
+#define CMD6_STATUS_SIZE 64
+
+// If reads or writes fail at the configured rate, the SPI clock is 
+//   halved, but not below this
+#define SDCARD_MIN_FALLBACK_BAUD (1000 * 1000)
+
 /* =====  SD commands ====== */
 /* Note that this list is kind-of exhaustive, to allow for future
    expansion; but only a few of these commands are actually used in the
@@ -122,7 +143,7 @@ typedef enum
   {
   CMD0_RESET = 0,                 /* Reset card to idle */
   CMD1_SEND_OP_COND = 1,          /* Not used */
-  CMD6_SWITCH_FUNC = 6,           /* Not used */
+  CMD6_SWITCH_FUNC = 6,           /* Check/switch to high-speed mode */
   CMD8_SEND_IF_COND = 8,          /* Get supply voltage, etc */
   CMD9_SEND_CSD = 9,              /* Get Card Specific Data block */
   CMD10_SEND_CID = 10,            /* Not used */
@@ -164,17 +185,43 @@ struct _SDCard
   uint gpio_sck; // The GPIO pin for the clock
   int tx_dma; // Transmit DMA channel
   int rx_dma; // Receive DMA channel
-  int baud_rate; // SPI baud rate
+  int baud_rate; // SPI baud rate for default-speed cards
+  int high_speed_baud; // SPI baud rate if the card is in high-speed mode
+  int current_baud; // The rate we are using now
+  int actual_baud; // The rate we actually got, which may be lower
+  bool high_speed; // The card has been switched to high-speed mode
+  unsigned int fallbacks; // Number of times the rate was lowered
+  bool rate_ok; // A transfer has succeeded at current_baud
+  unsigned int crc_errors;
+  unsigned int timeouts;
+  uint saved_baud; // The bus's rate before sdcard_acquire
+  bool hw_crc; // Use the DMA sniffer to calculate data block CRCs
+  bool sniffing; // The sniffer was set up for the current transfer
+  unsigned int crc_blocks; // Data blocks whose CRC was calculated
+  unsigned int crc_hw_blocks; // ... of which, by the DMA sniffer
+  uint64_t crc_us; // Time spent on data block CRCs
   SDCardType card_type; // Card type is determined during initialization
   uint64_t sectors; // Number of 512-byte sectors on the card
   bool driver_initialized; // Set when the driver is initialized 
   bool card_initialized; // Set when card is initialized 
+  // State of a read in progress (sdcard_read_begin, etc)
+  bool read_active; // Between sdcard_read_begin and sdcard_read_end
+  bool read_multi; // CMD18 was used, so CMD12 is needed to finish
+  bool read_inflight; // A sector is being transferred to the oldest buffer
+  SDError read_error; // Failure to start the next sector, if any
+  uint32_t read_to_start; // Sectors whose transfer has not started
+  uint8_t *read_queue[SDCARD_READ_QUEUE]; // Buffers, oldest first
+  int read_head; // Index of the oldest buffer in read_queue
+  int read_queued; // Number of buffers in read_queue
+  absolute_time_t read_deadline; // When the next start token is overdue
 #if PICO_ON_DEVICE
   mutex_t mutex; // A mutex for locking this object against mutliple threads
   semaphore_t sem; // Semaphore that is asserted when a DMA operation completes
   spi_inst_t *spi; // The selected Pico SPI interface (0 or 1)
   dma_channel_config tx_dma_config; // Transit DMA config
   dma_channel_config rx_dma_config; // Receive DMA configu
+#else
+  SDEmu *emu; // The emulated card that stands in for the hardware
 #endif
   };
 
@@ -188,30 +235,6 @@ SDCard *global_sdcard;
 
 #if PICO_ON_DEVICE
 
-/*============================================================================
- * sdcard_extract_bits
- * Helper function for extracting a word value that is buried in a group
- * of bits embedded in a record returned from an SD card command. The
- * msb and lsb arguments specify the starting and ending positions of the
- * relevant bits in the array 'data'. In general, except for specific
- * data transfers, data send by the SD card is not neatly aligned on
- * byte boundaries -- presumably this is to use bandwidth better.
- * ==========================================================================*/
-static uint32_t sdcard_extract_bits (uint8_t *data, int msb, int lsb) 
-  {
-  uint32_t bits = 0;
-  uint32_t size = 1 + (uint)msb - (uint)lsb;
-  for (uint32_t i = 0; i < size; i++) 
-    {
-    uint32_t position = (uint32_t) lsb + i;
-    uint32_t byte = 15 - (position >> 3);
-    uint32_t bit = position & 0x7;
-    uint32_t value = (data[byte] >> bit) & 1;
-    bits |= value << i;
-    }
-  return bits;
-  }
-
 /*============================================================================
  * sdcard_lock
  * Lock a mutex to prevent concurrent access
@@ -260,45 +283,64 @@ static void sdcard_global_irq (void)
   }  
 
 /*============================================================================
- * sdcard_spi_slow
- * Set a safe, low SPI baudrate when starting initialization
+ * sdcard_set_cs
+ * Set the chip select line; the card is selected when it is low
  * ==========================================================================*/
-static void sdcard_spi_slow (SDCard *self)
+static void sdcard_set_cs (SDCard *self, bool level)
   {
-#ifdef DEBUG 
-  uint actual = spi_set_baudrate (self->spi, 400 * 1000);
-  DEBUG ("Actual frequency: %lu", (long)actual);
-#else
-  spi_set_baudrate (self->spi, 400 * 1000);
-#endif
+  gpio_put (self->gpio_cs, level);
   }
 
 /*============================================================================
- * sdcard_spi_fast
- * After initialization, we can switch to the (usually) higher baud rate
- *   specified when the SDCard object was created. 
+ * sdcard_get_cs
  * ==========================================================================*/
-static void sdcard_spi_fast (SDCard *self)
+static bool sdcard_get_cs (const SDCard *self)
   {
-#ifdef DEBUG 
-  uint actual = spi_set_baudrate (self->spi, (uint)self->baud_rate);
-  DEBUG ("Actual frequency: %lu", (long)actual);
-#else
-  spi_set_baudrate (self->spi, (uint)self->baud_rate);
-#endif
+  return gpio_get (self->gpio_cs);
   }
 
 /*============================================================================
- * sdcard_spi_transfer
+ * sdcard_set_baudrate
+ * Set the SPI clock, and return the rate the hardware actually managed
+ * ==========================================================================*/
+static uint sdcard_set_baudrate (SDCard *self, uint baud)
+  {
+  return spi_set_baudrate (self->spi, baud);
+  }
+
+/*============================================================================
+ * sdcard_get_baudrate
+ * ==========================================================================*/
+static uint sdcard_get_baudrate (const SDCard *self)
+  {
+  return spi_get_baudrate (self->spi);
+  }
+
+/*============================================================================
+ * sdcard_spi_fill
+ * Send a single fill byte, ignoring whatever comes back, without using DMA
+ * ==========================================================================*/
+static void sdcard_spi_fill (SDCard *self)
+  {
+  uint8_t fill = SPI_FILL_CHAR;
+  spi_write_blocking (self->spi, &fill, 1);
+  }
+
+/*============================================================================
+ * sdcard_spi_transfer_start
  * Initiate an SPI transfer of length bytes, sending the data from tx and
- *   reading the response into rx. The transfer is actually done using DMA,
- *   even for one byte. The DMA process will send an interrupt when it is
- *   finished, which will release a semaphone that this function monitors. 
+ *   reading the response into rx, and return without waiting for it. The 
+ *   transfer is actually done using DMA, even for one byte. The DMA 
+ *   process will send an interrupt when it is finished, which will 
+ *   release a semaphone that sdcard_spi_transfer_wait monitors. 
  * Either of tx and rx can be NULL, in which case dummy values will be
  *   filled in.
+ * If crc is true, and the DMA sniffer is free, the sniffer calculates
+ *   the CRC16 of the data block -- rx if it's given, otherwise tx -- as 
+ *   it goes past. sdcard_spi_transfer_crc gets the result.
  * ==========================================================================*/
-static bool sdcard_spi_transfer (SDCard *self, const uint8_t *tx, uint8_t *rx, 
-        size_t length)
+static void sdcard_spi_transfer_start (SDCard *self, const uint8_t *tx, 
+        uint8_t *rx, size_t length, bool crc)
   {
 #ifdef TRACE
   // Usually too much logging, even in trace mode :)
@@ -328,6 +370,15 @@ static bool sdcard_spi_transfer (SDCard *self, const uint8_t *tx, uint8_t *rx,
     channel_config_set_write_increment (&self->rx_dma_config, false);
     }
 
+  // There is only one sniffer, shared by all the DMA channels. If 
+  //   something else has it, the CRC will be calculated in software.
+  self->sniffing = crc && self->hw_crc 
+    && !(dma_hw->sniff_ctrl & DMA_SNIFF_CTRL_EN_BITS);
+  channel_config_set_sniff_enable (&self->tx_dma_config, 
+    self->sniffing && !rx);
+  channel_config_set_sniff_enable (&self->rx_dma_config, 
+    self->sniffing && rx);
+
   // Clear the interrupt flag for DMA -- we don't want any spurious
   //   interrupts. 
   dma_hw->ints0 = 1u << self->rx_dma;
@@ -340,11 +391,26 @@ static bool sdcard_spi_transfer (SDCard *self, const uint8_t *tx, uint8_t *rx,
   dma_channel_configure ((uint)self->rx_dma, &self->rx_dma_config,
       rx, &spi_get_hw (self->spi)->dr, length,  false);  
 
+  if (self->sniffing)
+    {
+    dma_sniffer_enable ((uint)(rx ? self->rx_dma : self->tx_dma), 
+      DMA_SNIFF_CTRL_CALC_VALUE_CRC16, false);
+    dma_hw->sniff_data = 0;
+    }
+
   // It seems that we need to wait and start both SMA channels at the
   //   same time to avoid shift-register overruns (at least, this is
   //   what the Pico examples do). 
   dma_start_channel_mask ((1u << self->tx_dma) | (1u << self->rx_dma));
+  }
 
+/*============================================================================
+ * sdcard_spi_transfer_wait
+ * Wait for a transfer started by sdcard_spi_transfer_start to finish. 
+ *   Returns false if it times out.
+ * ==========================================================================*/
+static bool sdcard_spi_transfer_wait (SDCard *self)
+  {
   // Wait up to one second to acquire the semaphore, indicating
   //   that the interrupt service routine has finished, and the
   //   DMA transfer is complete.
@@ -369,6 +435,231 @@ static bool sdcard_spi_transfer (SDCard *self, const uint8_t *tx, uint8_t *rx,
   return true;
   }
 
+/*============================================================================
+ * sdcard_spi_busy
+ * Returns true if a transfer started by sdcard_spi_transfer_start has not
+ *   finished yet, so that sdcard_spi_transfer_wait would have to wait.
+ * ==========================================================================*/
+static bool sdcard_spi_busy (const SDCard *self)
+  {
+  return dma_channel_is_busy ((uint)self->rx_dma);
+  }
+
+
+/*============================================================================
+ * sdcard_sniffer_release
+ * Stop the DMA sniffer, so something else can use it, and return the CRC 
+ *   it calculated
+ * ==========================================================================*/
+static uint16_t sdcard_sniffer_release (SDCard *self)
+  {
+  uint16_t crc = (uint16_t)dma_hw->sniff_data;
+  dma_sniffer_disable ();
+  self->sniffing = false;
+  return crc;
+  }
+
+#else
+
+/* Host builds talk to an emulated card (see sdemu.h), a byte at a time.
+   There is only one thread, and no DMA, so there's nothing to lock, 
+   and a transfer is finished as soon as it is started. */
+
+static void sdcard_lock (SDCard *self)
+  {
+  (void)self;
+  }
+
+static void sdcard_unlock (SDCard *self)
+  {
+  (void)self;
+  }
+
+static void sdcard_set_cs (SDCard *self, bool level)
+  {
+  sdemu_select (self->emu, !level);
+  }
+
+static bool sdcard_get_cs (const SDCard *self)
+  {
+  return !sdemu_is_selected (self->emu);
+  }
+
+static uint sdcard_set_baudrate (SDCard *self, uint baud)
+  {
+  sdemu_set_baud (self->emu, baud);
+  return baud;
+  }
+
+static uint sdcard_get_baudrate (const SDCard *self)
+  {
+  return sdemu_get_baud (self->emu);
+  }
+
+static void sdcard_spi_fill (SDCard *self)
+  {
+  sdemu_exchange (self->emu, SPI_FILL_CHAR);
+  }
+
+static void sdcard_spi_transfer_start (SDCard *self, const uint8_t *tx, 
+        uint8_t *rx, size_t length, bool crc)
+  {
+  (void)crc;
+  self->sniffing = false;
+  for (size_t i = 0; i < length; i++)
+    {
+    uint8_t in = sdemu_exchange (self->emu, tx ? tx[i] : SPI_FILL_CHAR);
+    if (rx) rx[i] = in;
+    }
+  }
+
+static bool sdcard_spi_transfer_wait (SDCard *self)
+  {
+  (void)self;
+  return true;
+  }
+
+static bool sdcard_spi_busy (const SDCard *self)
+  {
+  (void)self;
+  return false;
+  }
+
+static uint16_t sdcard_sniffer_release (SDCard *self)
+  {
+  self->sniffing = false;
+  return 0;
+  }
+
+#endif // PICO_ON_DEVICE
+
+/*============================================================================
+ * sdcard_extract_bits
+ * Helper function for extracting a word value that is buried in a group
+ * of bits embedded in a record returned from an SD card command. The
+ * msb and lsb arguments specify the starting and ending positions of the
+ * relevant bits in the array 'data'. In general, except for specific
+ * data transfers, data send by the SD card is not neatly aligned on
+ * byte boundaries -- presumably this is to use bandwidth better.
+ * ==========================================================================*/
+static uint32_t sdcard_extract_bits (uint8_t *data, int msb, int lsb) 
+  {
+  uint32_t bits = 0;
+  uint32_t size = 1 + (uint)msb - (uint)lsb;
+  for (uint32_t i = 0; i < size; i++) 
+    {
+    uint32_t position = (uint32_t) lsb + i;
+    uint32_t byte = 15 - (position >> 3);
+    uint32_t bit = position & 0x7;
+    uint32_t value = (data[byte] >> bit) & 1;
+    bits |= value << i;
+    }
+  return bits;
+  }
+
+/*============================================================================
+ * sdcard_spi_slow
+ * Set a safe, low SPI baudrate when starting initialization
+ * ==========================================================================*/
+static void sdcard_spi_slow (SDCard *self)
+  {
+  self->current_baud = 400 * 1000;
+  uint actual = sdcard_set_baudrate (self, (uint)self->current_baud);
+#ifdef DEBUG 
+  DEBUG ("Actual frequency: %lu", (long)actual);
+#endif
+  self->actual_baud = (int)actual;
+  }
+
+/*============================================================================
+ * sdcard_spi_fast
+ * After initialization, we can switch to the (usually) higher baud rate
+ *   specified when the SDCard object was created. 
+ * ==========================================================================*/
+static void sdcard_spi_fast (SDCard *self)
+  {
+  self->current_baud = self->high_speed 
+    ? self->high_speed_baud : self->baud_rate;
+  self->rate_ok = false;
+  uint actual = sdcard_set_baudrate (self, (uint)self->current_baud);
+#ifdef DEBUG 
+  DEBUG ("Actual frequency: %lu", (long)actual);
+#endif
+  self->actual_baud = (int)actual;
+  }
+
+/*============================================================================
+ * sdcard_spi_fall_back
+ * Lower the SPI clock after a failure: first to the default-speed rate,
+ *   if we were using the high-speed rate, and then by halves. Returns
+ *   false if the rate is already as low as we're prepared to go.
+ * ==========================================================================*/
+static bool sdcard_spi_fall_back (SDCard *self)
+  {
+  int baud;
+  if (self->current_baud > self->baud_rate)
+    baud = self->baud_rate;
+  else
+    baud = self->current_baud / 2;
+  if (baud < SDCARD_MIN_FALLBACK_BAUD) return false;
+#ifdef WARN
+  WARN ("Lowering SPI clock to %d", baud);
+#endif
+  self->current_baud = baud;
+  self->rate_ok = false;
+  // The new rate is set on the bus by the next sdcard_acquire
+  self->actual_baud = 0;
+  self->fallbacks++;
+  return true;
+  }
+
+/*============================================================================
+ * sdcard_reset_rate
+ * Go back to the rate set when the SDCard object was created, forgetting
+ *   any fall-backs. The high-speed rate, if the card supports it, is
+ *   restored when the card is next initialized.
+ * ==========================================================================*/
+static void sdcard_reset_rate (SDCard *self)
+  {
+  self->current_baud = self->baud_rate;
+  self->rate_ok = false;
+  self->actual_baud = 0;
+  }
+
+/*============================================================================
+ * sdcard_spi_transfer
+ * As sdcard_spi_transfer_start, but wait for the transfer to finish. 
+ * ==========================================================================*/
+static bool sdcard_spi_transfer (SDCard *self, const uint8_t *tx, uint8_t *rx, 
+        size_t length)
+  {
+  sdcard_spi_transfer_start (self, tx, rx, length, false);
+  return sdcard_spi_transfer_wait (self);
+  }
+
+/*============================================================================
+ * sdcard_spi_transfer_crc
+ * Get the CRC16 of the data block that has just been transferred, from 
+ *   the DMA sniffer if it was watching, or by calculating it. This must
+ *   be called before the next transfer is started.
+ * ==========================================================================*/
+static uint16_t sdcard_spi_transfer_crc (SDCard *self, const uint8_t *data,
+        size_t length)
+  {
+  uint32_t start = time_us_32 ();
+  uint16_t crc;
+  if (self->sniffing)
+    {
+    crc = sdcard_sniffer_release (self);
+    self->crc_hw_blocks++;
+    }
+  else
+    crc = crc16 ((const char *)data, (int)length);
+  self->crc_us += time_us_32 () - start;
+  self->crc_blocks++;
+  return crc;
+  }
+
 /*============================================================================
  * sdcard_send_initializing_sequence
  * See README.md for details of the card initialization sequence
@@ -379,10 +670,10 @@ static void sdcard_send_initializing_sequence (SDCard *self)
   TRACE ("start");
 #endif
 
-  bool old_ss = gpio_get (self->gpio_cs);
+  bool old_ss = sdcard_get_cs (self);
   // Set DI and CS high and apply "74 or more" clock pulses to SCLK.
   // In practice, we will do this by sending ten 0xFF bytes (= 80 bits).
-  gpio_put(self->gpio_cs, 1);
+  sdcard_set_cs (self, 1);
   uint8_t ones[10];
   memset (ones, 0xFF, sizeof ones);
   absolute_time_t timeout_time = make_timeout_time_ms(1);
@@ -391,7 +682,7 @@ static void sdcard_send_initializing_sequence (SDCard *self)
     sdcard_spi_transfer (self, ones, NULL, sizeof ones);
     } while (0 < absolute_time_diff_us (get_absolute_time(), timeout_time));
 
-  gpio_put (self->gpio_cs, old_ss);
+  sdcard_set_cs (self, old_ss);
 #ifdef TRACE
   TRACE ("end");
 #endif
@@ -744,10 +1035,15 @@ static int sdcard_cmd (SDCard *self, const SDCmd cmd, uint32_t arg,
 static void sdcard_acquire (SDCard *self)
   {
   sdcard_lock (self);
-  gpio_put (self->gpio_cs, 0);
+  // The bus may be shared with a device that runs at a different
+  //   rate -- the display, for example.
+  self->saved_baud = sdcard_get_baudrate (self);
+  if (self->saved_baud != (uint)self->actual_baud)
+    self->actual_baud = 
+      (int)sdcard_set_baudrate (self, (uint)self->current_baud);
+  sdcard_set_cs (self, 0);
   // A fill byte seems sometimes to be necessary. Not sure why.
-  uint8_t fill = SPI_FILL_CHAR;
-  spi_write_blocking (self->spi, &fill, 1);
+  sdcard_spi_fill (self);
   }
 
 /*============================================================================
@@ -757,9 +1053,10 @@ static void sdcard_acquire (SDCard *self)
  * ==========================================================================*/
 static void sdcard_release (SDCard *self)
   {
-  gpio_put (self->gpio_cs, 1);
-  uint8_t fill = SPI_FILL_CHAR;
-  spi_write_blocking (self->spi, &fill, 1);
+  sdcard_set_cs (self, 1);
+  sdcard_spi_fill (self);
+  if (self->saved_baud != (uint)self->actual_baud)
+    sdcard_set_baudrate (self, self->saved_baud);
   sdcard_unlock (self);
   }
 
@@ -992,6 +1289,87 @@ static SDError sdcard_init_sector_count (SDCard *self)
   return 0;
   }
 
+/*============================================================================
+ * sdcard_switch_function
+ * Send CMD6 with the specified argument, and read the status block 
+ *   that the card sends back
+ * ==========================================================================*/
+static SDError sdcard_switch_function (SDCard *self, uint32_t arg, 
+        uint8_t *status)
+  {
+  SDError ret = sdcard_cmd (self, CMD6_SWITCH_FUNC, arg, false, 0);
+  if (ret != 0)
+    return ret;
+  return sdcard_read_bytes (self, status, CMD6_STATUS_SIZE);
+  }
+
+/*============================================================================
+ * sdcard_enable_high_speed
+ * Ask the card whether it supports high-speed mode and, if it does,
+ *   switch to it. Returns true if the card is now in high-speed mode,
+ *   and can be clocked at up to 50MHz. Cards before version 1.10 of 
+ *   the spec don't understand CMD6 at all; that's not an error.
+ * ==========================================================================*/
+static bool sdcard_enable_high_speed (SDCard *self)
+  {
+  uint8_t status[CMD6_STATUS_SIZE];
+
+  // Bits 415:400 of the status are the functions supported in group
+  //   1; bit 401 is high-speed. The status is sent MSB first, so that's 
+  //   in byte 13.
+  if (sdcard_switch_function (self, CMD6_CHECK_HIGH_SPEED, status) != 0)
+    return false;
+  if ((status[13] & 0x02) == 0)
+    {
+#ifdef INFO
+    INFO ("Card does not support high-speed mode");
+#endif
+    return false;
+    }
+
+  // Bits 379:376 are the function that group 1 has switched to, or 0xF
+  //   if it couldn't
+  if (sdcard_switch_function (self, CMD6_SWITCH_HIGH_SPEED, status) != 0)
+    return false;
+  if ((status[16] & 0x0F) != 1)
+    {
+#ifdef WARN
+    WARN ("Card could not switch to high-speed mode");
+#endif
+    return false;
+    }
+
+  // The card is allowed 8 clocks to make the switch
+  sdcard_spi_fill (self);
+  return true;
+  }
+
+/*============================================================================
+ * sdcard_count_error
+ * Keep count of the errors that suggest the clock is too fast, and 
+ *   return true if the operation is worth retrying at a lower rate.
+ *   A CRC error always is. A timeout is more likely to mean that the
+ *   card has gone, so it only counts against the high-speed rate, and
+ *   only once a transfer has worked at that rate -- otherwise a missing 
+ *   card would cost a timeout at every rate down to the slowest, and
+ *   leave the clock there.
+ * ==========================================================================*/
+static bool sdcard_count_error (SDCard *self, SDError err)
+  {
+  if (err == SD_ERR_CRC)
+    {
+    self->crc_errors++;
+    return sdcard_spi_fall_back (self);
+    }
+  if (err == SD_ERR_NO_RESPONSE)
+    {
+    self->timeouts++;
+    if (self->rate_ok && self->current_baud > self->baud_rate)
+      return sdcard_spi_fall_back (self);
+    }
+  return false;
+  }
+
 /*============================================================================
  * sdcard_pulse_deselect
  * When sending multiple sectors in the same card write, it has been 
@@ -1000,11 +1378,10 @@ static SDError sdcard_init_sector_count (SDCard *self)
  * ==========================================================================*/
 static void sdcard_pulse_deselect (SDCard *self)
   {
-  uint8_t fill = SPI_FILL_CHAR;
-  gpio_put (self->gpio_cs, 1);
-  spi_write_blocking (self->spi, &fill, 1);
-  gpio_put (self->gpio_cs, 0);
-  spi_write_blocking (self->spi, &fill, 1);
+  sdcard_set_cs (self, 1);
+  sdcard_spi_fill (self);
+  sdcard_set_cs (self, 0);
+  sdcard_spi_fill (self);
   }
 
 /*============================================================================
@@ -1019,7 +1396,9 @@ static uint8_t sdcard_write_block (SDCard *self, const uint8_t *buffer,
   sdcard_spi_write (self, token);
 
   // Write the data
-  bool ret = sdcard_spi_transfer (self, buffer, NULL, length);
+  sdcard_spi_transfer_start (self, buffer, NULL, length, true);
+  bool ret = sdcard_spi_transfer_wait (self);
+  uint16_t crc = sdcard_spi_transfer_crc (self, buffer, length);
   if (!ret)
     {
 #ifdef WARN
@@ -1028,8 +1407,6 @@ static uint8_t sdcard_write_block (SDCard *self, const uint8_t *buffer,
     return 0;
     }
 
-  uint16_t crc = crc16 ((void *)buffer, (int)length);
-
   // write the CRC 
   sdcard_spi_write (self, (uint8_t)(crc >> 8));
   sdcard_spi_write (self, (uint8_t)crc);
@@ -1053,46 +1430,41 @@ static uint8_t sdcard_write_block (SDCard *self, const uint8_t *buffer,
 
 
 /*============================================================================
- * sdcard_read_block
- * Having initiated a sector read, read the data using DMA
+ * sdcard_read_start_block
+ * Poll the card, for at most SDCARD_TOKEN_POLL bytes, for the start token
+ *   of the next sector, and if it comes, start transferring the sector by 
+ *   DMA into the oldest queued buffer. Returns SD_ERR_BUSY if the token
+ *   has not come yet, or SD_ERR_NO_RESPONSE if it is overdue.
  * ==========================================================================*/
-static SDError sdcard_read_block (SDCard *self, uint8_t *buffer)
+static SDError sdcard_read_start_block (SDCard *self)
   {
-  if (!sdcard_wait_start_token (self))
+  for (int i = 0; i < SDCARD_TOKEN_POLL; i++)
     {
-#ifdef WARN
-    WARN ("Failed");
-#endif
-    return SD_ERR_NO_RESPONSE;
+    if (sdcard_spi_write (self, SPI_FILL_CHAR) == SPI_START_BLOCK) 
+      {
+      sdcard_spi_transfer_start (self, NULL, 
+        self->read_queue[self->read_head], SD_BLOCK_SIZE, true);
+      self->read_inflight = true;
+      self->read_to_start--;
+      return 0;
+      }
     }
 
- if (!sdcard_spi_transfer (self, NULL, buffer, SD_BLOCK_SIZE)) 
-   {
-   return SD_ERR_NO_RESPONSE;
-   }
-
-  // The data is always followed by a two-byte CRC, which we 
-  //   will check.
-  uint16_t rx_crc = (sdcard_spi_write (self, SPI_FILL_CHAR) << 8);
-  rx_crc |= sdcard_spi_write (self, SPI_FILL_CHAR);
-
-  uint16_t calc_crc = crc16 ((void *)buffer, SD_BLOCK_SIZE);
-  if (calc_crc != rx_crc) 
+  if (absolute_time_diff_us (get_absolute_time(), self->read_deadline) <= 0)
     {
 #ifdef WARN
-    WARN ("CRC error");
+    WARN ("Timed out waiting for start token");
 #endif
-    return SD_ERR_CRC;
+    return SD_ERR_NO_RESPONSE;
     }
-
-  return 0;
+  return SD_ERR_BUSY;
   }
 
 /*============================================================================
- * sdcard_write_sectors
+ * _sdcard_write_sectors
  * Write a number of card sectors from memory
  * ==========================================================================*/
-SDError sdcard_write_sectors (SDCard *self, const uint8_t *buffer, 
+static SDError _sdcard_write_sectors (SDCard *self, const uint8_t *buffer, 
          uint32_t start, uint32_t count)
   {
 #ifdef TRACE
@@ -1163,10 +1535,9 @@ SDError sdcard_write_sectors (SDCard *self, const uint8_t *buffer,
       WARN ("Write_block failed: response=%04X", response);
 #endif
       sdcard_release (self);
-      // Perhaps we ought to parse the response, and check for specific
-      //   errors? Still, the user probably won't be able to make any
-      //   use of the details. 
-      return SD_ERR_WRITE;
+      // A CRC error is worth retrying at a lower clock rate; other
+      //   errors probably aren't.
+      return response == SPI_DATA_CRC_ERROR ? SD_ERR_CRC : SD_ERR_WRITE;
       }
     }
   else
@@ -1204,14 +1575,20 @@ SDError sdcard_write_sectors (SDCard *self, const uint8_t *buffer,
 #ifdef WARN
         WARN ("Write_block failed");
 #endif
+        sdcard_spi_write (self, SPI_STOP_TRAN);
+        sdcard_wait_for_ready (self, SD_COMMAND_TIMEOUT);
         sdcard_release (self);
-        return SD_ERR_WRITE;
+        return response == SPI_DATA_CRC_ERROR ? SD_ERR_CRC : SD_ERR_WRITE;
         }
 
       block_count--;
       buffer += SD_BLOCK_SIZE;
       } while (block_count > 0);
 
+    // The card won't accept a command until it has been told that there
+    //   are no more blocks
+    sdcard_spi_write (self, SPI_STOP_TRAN);
+    sdcard_wait_for_ready (self, SD_COMMAND_TIMEOUT);
     }
 
   // Again, it's not entirely clear to me whether the following operations
@@ -1231,13 +1608,34 @@ SDError sdcard_write_sectors (SDCard *self, const uint8_t *buffer,
   }
 
 /*============================================================================
- * sdcard_read_sectors
- * Read a number of card sectors into memory.
+ * sdcard_write_sectors
+ * Write sectors, retrying at a lower clock rate if the card doesn't
+ *   respond properly
  * ==========================================================================*/
-SDError sdcard_read_sectors (SDCard *self, uint8_t *buffer, uint32_t start, 
-                              uint32_t count)
+SDError sdcard_write_sectors (SDCard *self, const uint8_t *buffer, 
+         uint32_t start, uint32_t count)
+  {
+  SDError ret;
+  do
+    ret = _sdcard_write_sectors (self, buffer, start, count);
+  while (ret != 0 && sdcard_count_error (self, ret));
+  if (ret == 0) self->rate_ok = true;
+  return ret;
+  }
+
+/*============================================================================
+ * sdcard_read_begin
+ * Start a read of count sectors, at sector start. Buffers for the sectors
+ *   are then supplied, in order, with sdcard_read_queue -- at most
+ *   SDCARD_READ_QUEUE at once -- and collected with sdcard_read_wait. 
+ *   sdcard_read_end must be called, even if something failed. 
+ * Nothing here waits for the card: sdcard_read_wait polls for each 
+ *   sector's start token, and starts its DMA transfer when it comes, 
+ *   so the caller can work between calls while the card gets the data
+ *   ready, and while it is transferred.
+ * ==========================================================================*/
+SDError sdcard_read_begin (SDCard *self, uint32_t start, uint32_t count)
   {
-  //printf ("Start=%lu count=%lu\n", start, count);
 #ifdef TRACE
     TRACE ("Start=%lu count=%lu", start, count);
 #endif
@@ -1258,8 +1656,10 @@ SDError sdcard_read_sectors (SDCard *self, uint8_t *buffer, uint32_t start,
     return SD_ERR_UNINIT_CARD;
     }
 
-  uint32_t block_count = count;
-  if (start + block_count > self->sectors)
+  if (self->read_active || count == 0)
+    return SD_ERR_PARAMETER;
+
+  if (start + count > self->sectors)
     {
 #ifdef WARN
     WARN ("Sector address out of range");
@@ -1286,7 +1686,7 @@ SDError sdcard_read_sectors (SDCard *self, uint8_t *buffer, uint32_t start,
   sdcard_acquire (self);
   SDError ret = 0;
 
-  if (block_count > 1)
+  if (count > 1)
     ret = sdcard_cmd (self, CMD18_READ_MULTIPLE_BLOCK, addr, false, 0);
   else
     ret = sdcard_cmd (self, CMD17_READ_SINGLE_BLOCK, addr, false, 0);
@@ -1300,34 +1700,198 @@ SDError sdcard_read_sectors (SDCard *self, uint8_t *buffer, uint32_t start,
     return ret;
     }
 
-  while (block_count && (ret == 0))
+  self->read_active = true;
+  self->read_multi = count > 1;
+  self->read_inflight = false;
+  self->read_error = 0;
+  self->read_to_start = count;
+  self->read_head = 0;
+  self->read_queued = 0;
+  self->read_deadline = make_timeout_time_ms (SD_COMMAND_TIMEOUT);
+  return 0;
+  }
+
+/*============================================================================
+ * sdcard_read_queue
+ * Supply a buffer of SD_BLOCK_SIZE bytes for the next sector. 
+ * ==========================================================================*/
+SDError sdcard_read_queue (SDCard *self, uint8_t *buffer)
+  {
+  if (!self->read_active || self->read_queued == SDCARD_READ_QUEUE
+       || (uint32_t)self->read_queued >= self->read_to_start 
+          + (self->read_inflight ? 1 : 0))
+    return SD_ERR_PARAMETER;
+
+  int slot = (self->read_head + self->read_queued) % SDCARD_READ_QUEUE;
+  self->read_queue[slot] = buffer;
+  self->read_queued++;
+  return 0;
+  }
+
+/*============================================================================
+ * sdcard_read_wait
+ * Collect the oldest queued sector, if it has arrived, and set buffer to 
+ *   the buffer that was supplied for it. If its transfer has not started,
+ *   poll for its start token; if the token hasn't come, or the DMA 
+ *   transfer is still running, return SD_ERR_BUSY. 
+ * If the sector's CRC has to be calculated in software, that is done 
+ *   after the transfer of the next one has been started -- if the card is
+ *   ready to send it -- so the two overlap. The sniffer's result has to 
+ *   be collected before that.
+ * ==========================================================================*/
+SDError sdcard_read_wait (SDCard *self, uint8_t **buffer)
+  {
+  if (!self->read_active || self->read_queued == 0)
+    return SD_ERR_PARAMETER;
+  if (self->read_error != 0)
+    return self->read_error;
+
+  if (!self->read_inflight)
     {
-    ret = sdcard_read_block (self, buffer); 
+    SDError ret = sdcard_read_start_block (self);
     if (ret != 0)
       {
+      if (ret != SD_ERR_BUSY) self->read_error = ret;
+      return ret;
+      }
+    }
+  if (sdcard_spi_busy (self)) 
+    return SD_ERR_BUSY;
+
+  uint8_t *done = self->read_queue[self->read_head];
+  self->read_inflight = false;
+  self->read_head = (self->read_head + 1) % SDCARD_READ_QUEUE;
+  self->read_queued--;
+  *buffer = done;
+
+  if (!sdcard_spi_transfer_wait (self))
+    {
+    if (self->sniffing) sdcard_sniffer_release (self);
+    return SD_ERR_NO_RESPONSE;
+    }
+
+  bool sniffed = self->sniffing;
+  uint16_t calc_crc = sniffed 
+    ? sdcard_spi_transfer_crc (self, done, SD_BLOCK_SIZE) : 0;
+
+  // The data is always followed by a two-byte CRC, which we 
+  //   will check.
+  uint16_t rx_crc = (uint16_t)(sdcard_spi_write (self, SPI_FILL_CHAR) << 8);
+  rx_crc |= sdcard_spi_write (self, SPI_FILL_CHAR);
+
+  // One look for the next sector's start token, without waiting for it
+  self->read_deadline = make_timeout_time_ms (SD_COMMAND_TIMEOUT);
+  if (self->read_queued > 0 && self->read_to_start > 0)
+    {
+    SDError next = sdcard_read_start_block (self);
+    if (next != SD_ERR_BUSY) self->read_error = next;
+    }
+
+  if (!sniffed) 
+    calc_crc = sdcard_spi_transfer_crc (self, done, SD_BLOCK_SIZE);
+  if (calc_crc != rx_crc) 
+    {
 #ifdef WARN
-    WARN ("sdcard_read_block failed: %d", ret);
+    WARN ("CRC error");
 #endif
-      }
-    buffer += SD_BLOCK_SIZE;
-    block_count --;
+    return SD_ERR_CRC;
     }
 
-  // Whether the block read succeeded or failed, we need to terminate a
-  //   multi-block transfer cleanly
+  return 0;
+  }
 
-  if (count > 1)
+/*============================================================================
+ * sdcard_read_end
+ * Finish a read, and release the bus. This can be called before all the
+ *   sectors have been collected, to abandon the read.
+ * ==========================================================================*/
+SDError sdcard_read_end (SDCard *self)
+  {
+  if (!self->read_active) return SD_ERR_PARAMETER;
+
+  // A transfer can't be stopped part-way through a sector
+  if (self->read_inflight)
+    sdcard_spi_transfer_wait (self);
+  if (self->sniffing)
+    sdcard_sniffer_release (self);
+
+  // Whether the block reads succeeded or failed, we need to terminate a
+  //   multi-block transfer cleanly
+  SDError ret = 0;
+  if (self->read_multi)
     {
     // What can we do if this fails? Probably nothing.
     ret = sdcard_cmd (self, CMD12_STOP_TRANSMISSION, 0, false, 0);
     }
 
+  self->read_active = false;
+  self->read_inflight = false;
+  self->read_queued = 0;
   sdcard_release (self);
 
 #ifdef TRACE
   TRACE ("Done");
 #endif
+  return ret;
+  }
+
+/*============================================================================
+ * _sdcard_read_sectors
+ * Read a number of card sectors into memory. This is a wrapper around 
+ *   the read queue functions above, which keeps two sectors queued, so
+ *   that each sector's CRC is checked while the next is arriving.
+ * ==========================================================================*/
+static SDError _sdcard_read_sectors (SDCard *self, uint8_t *buffer, 
+         uint32_t start, uint32_t count)
+  {
+  //printf ("Start=%lu count=%lu\n", start, count);
+  SDError ret = sdcard_read_begin (self, start, count);
+  if (ret != 0) return ret;
+
+  uint32_t queued = 0;
+  while (queued < count && queued < SDCARD_READ_QUEUE && ret == 0)
+    {
+    ret = sdcard_read_queue (self, buffer + queued * SD_BLOCK_SIZE);
+    queued++;
+    }
+
+  for (uint32_t i = 0; i < count && ret == 0; i++)
+    {
+    uint8_t *done;
+    do
+      ret = sdcard_read_wait (self, &done);
+    while (ret == SD_ERR_BUSY);
+    if (ret != 0)
+      {
+#ifdef WARN
+    WARN ("sdcard_read_wait failed: %d", ret);
+#endif
+      break;
+      }
+    if (queued < count)
+      {
+      ret = sdcard_read_queue (self, buffer + queued * SD_BLOCK_SIZE);
+      queued++;
+      }
+    }
 
+  SDError end_ret = sdcard_read_end (self);
+  return ret ? ret : end_ret;
+  }
+
+/*============================================================================
+ * sdcard_read_sectors
+ * Read sectors, retrying at a lower clock rate if the data is corrupt,
+ *   or doesn't arrive
+ * ==========================================================================*/
+SDError sdcard_read_sectors (SDCard *self, uint8_t *buffer, uint32_t start, 
+                              uint32_t count)
+  {
+  SDError ret;
+  do
+    ret = _sdcard_read_sectors (self, buffer, start, count);
+  while (ret != 0 && sdcard_count_error (self, ret));
+  if (ret == 0) self->rate_ok = true;
   return ret;
   }
 
@@ -1503,6 +2067,9 @@ static SDError _sdcard_insert_card (SDCard *self)
     return ret;
     }
 
+  self->high_speed = false;
+  if (self->high_speed_baud > self->baud_rate)
+    self->high_speed = sdcard_enable_high_speed (self);
   sdcard_spi_fast (self);
 
   self->card_initialized = true;
@@ -1510,6 +2077,8 @@ static SDError _sdcard_insert_card (SDCard *self)
   return 0;
   }
 
+#if PICO_ON_DEVICE
+
 /*============================================================================
  * sdcard_init
  * This function initialises the Pico hardware for the SD card, but does
@@ -1519,6 +2088,8 @@ static SDError _sdcard_insert_card (SDCard *self)
  * ==========================================================================*/
 SDError sdcard_init (SDCard *self)
   {
+  // Any rate lowered after errors on a previous card is forgotten
+  sdcard_reset_rate (self);
   if (self->driver_initialized) return 0;
 
 #ifdef DEBUG
@@ -1625,6 +2196,39 @@ SDError sdcard_init (SDCard *self)
   return 0;
   }
 
+#else
+
+/*============================================================================
+ * sdcard_init
+ * On the host, there is no hardware to set up, but there must be an
+ *   emulated card to talk to.
+ * ==========================================================================*/
+SDError sdcard_init (SDCard *self)
+  {
+  sdcard_reset_rate (self);
+  global_sdcard = self;
+  self->driver_initialized = self->emu != NULL;
+  return 0;
+  }
+
+/*============================================================================
+ * sdcard_attach_emulator
+ * ==========================================================================*/
+void sdcard_attach_emulator (SDCard *self, SDEmu *emu)
+  {
+  self->emu = emu;
+  }
+
+/*============================================================================
+ * sdcard_get_emulator
+ * ==========================================================================*/
+SDEmu *sdcard_get_emulator (const SDCard *self)
+  {
+  return self->emu;
+  }
+
+#endif // PICO_ON_DEVICE
+
 /*============================================================================
  * sdcard_insert_card
  * This is the externally-accessible version of _insert_card, which
@@ -1634,6 +2238,12 @@ SDError sdcard_init (SDCard *self)
  * ==========================================================================*/
 SDError sdcard_insert_card (SDCard *self)
   {
+#if PICO_ON_DEVICE
+#else
+  // Without an emulated card, the host build reads the card image 
+  //   directly (see stubs_host.c), and there's nothing to initialize
+  if (!self->emu) return 0;
+#endif
   sdcard_acquire (self);
 
   SDError ret = _sdcard_insert_card (self);
@@ -1680,26 +2290,12 @@ const char *sdcard_perror (SDError error)
     case SD_ERR_UNINIT_DRIVER: return "Driver is not initialzed";
     case SD_ERR_UNINIT_CARD: return "Card is not uninitialzed";
     case SD_ERR_SEC_RANGE: return "Sector number out of range";
+    case SD_ERR_BUSY: return "Read has not finished yet";
     }
   
   return "Unknown error";
   }
 
-/*============================================================================
- * sdcard_type_to_string
- * ==========================================================================*/
-extern const char *sdcard_type_to_string (SDCardType type)
-  {
-  switch (type)
-    {
-    case SDCARD_NONE: return "none";
-    case SDCARD_V1: return "V1 standard capacity";
-    case SDCARD_V2: return "V2 standard capacity";
-    case SDCARD_V2HC: return "V2 high capacity";
-    default:
-      return "unknown";
-    }
-  }
 
 /*============================================================================
  * sdcard_get_instance
@@ -1726,22 +2322,60 @@ bool sdcard_is_card_initialized (const SDCard *self)
   return self->card_initialized;
   }
 
-#endif // PICO_ON_DEVICE
 
-#if PICO_ON_DEVICE
-#else
-// Stub functions for building host version
+/*============================================================================
+ * sdcard_set_high_speed_baud
+ * ==========================================================================*/
+void sdcard_set_high_speed_baud (SDCard *self, int baud_rate)
+  {
+  self->high_speed_baud = baud_rate;
+  }
 
-SDError sdcard_init (SDCard *self)
+/*============================================================================
+ * sdcard_set_hw_crc
+ * ==========================================================================*/
+void sdcard_set_hw_crc (SDCard *self, bool hw_crc)
   {
-  return 0;
+  self->hw_crc = hw_crc;
+  self->crc_blocks = 0;
+  self->crc_hw_blocks = 0;
+  self->crc_us = 0;
   }
 
-SDError sdcard_insert_card (SDCard *self)
+/*============================================================================
+ * sdcard_type_to_string
+ * ==========================================================================*/
+extern const char *sdcard_type_to_string (SDCardType type)
   {
-  return 0;
+  switch (type)
+    {
+    case SDCARD_NONE: return "none";
+    case SDCARD_V1: return "V1 standard capacity";
+    case SDCARD_V2: return "V2 standard capacity";
+    case SDCARD_V2HC: return "V2 high capacity";
+    default:
+      return "unknown";
+    }
+  }
+
+/*============================================================================
+ * sdcard_get_info
+ * ==========================================================================*/
+void sdcard_get_info (const SDCard *self, SDCardInfo *info)
+  {
+  info->type = self->card_type;
+  info->sectors = self->sectors;
+  info->high_speed = self->high_speed;
+  info->baud_rate = self->current_baud;
+  info->actual_baud_rate = self->actual_baud;
+  info->fallbacks = self->fallbacks;
+  info->crc_errors = self->crc_errors;
+  info->timeouts = self->timeouts;
+  info->hw_crc = self->hw_crc;
+  info->crc_blocks = self->crc_blocks;
+  info->crc_hw_blocks = self->crc_hw_blocks;
+  info->crc_us = self->crc_us;
   }
-#endif
 
 /*============================================================================
  * sdcard_new
@@ -1750,6 +2384,7 @@ SDCard *sdcard_new (int spi, int drive_strength, uint gpio_cs,
           uint gpio_miso, uint gpio_mosi, uint gpio_sck, int baud_rate)
   {
   SDCard *self = malloc (sizeof (SDCard));
+  memset (self, 0, sizeof (SDCard));
   self->driver_initialized = false;
   self->card_initialized = false;
 #if PICO_ON_DEVICE
@@ -1762,6 +2397,9 @@ SDCard *sdcard_new (int spi, int drive_strength, uint gpio_cs,
   self->gpio_mosi = gpio_mosi;
   self->gpio_sck = gpio_sck;
   self->baud_rate = baud_rate;
+  self->high_speed_baud = baud_rate;
+  self->current_baud = 400 * 1000;
+  self->hw_crc = true;
   self->card_type = SDCARD_UNKNOWN;
   return self;
   }
@@ -0,0 +1,690 @@
+/*============================================================================
+ *
+ * sdcard/sdemu.c
+ *
+ * Implementation of the emulated SD card in sdemu.h. Only the SPI-mode
+ * commands that an SDHC card needs to support, and that the driver
+ * uses, are implemented; everything else is an illegal command.
+ *
+ * Each byte the card sends comes from, in order: a count of 0xFF 'fill'
+ * bytes, for the card's response time; an output buffer, holding the
+ * response and any data block; and a count of 0x00 'busy' bytes. When all
+ * these are used up during a read, the next sector is put in the
+ * buffer. The bytes the host sends are collected into commands or, when
+ * a write is in progress, into sectors.
+ *
+ * Copyright (c)2023 Kevin Boone, GPL v3.0
+ *
+ * ==========================================================================*/
+
+#if PICO_ON_DEVICE
+#else
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sdcard/sdemu.h>
+#include <sdcard/crc.h>
+
+#define SDEMU_SECTOR_SIZE 512
+
+// Largest thing the card sends in one go: R1, a token, a sector, a CRC
+#define SDEMU_OUT_SIZE (1 + 1 + SDEMU_SECTOR_SIZE + 2)
+
+// R1 response flags
+#define SDEMU_R1_IDLE       0x01
+#define SDEMU_R1_ILLEGAL    0x04
+#define SDEMU_R1_CRC_ERROR  0x08
+#define SDEMU_R1_PARAMETER  0x40
+
+// Tokens
+#define SDEMU_START_BLOCK          0xFE
+#define SDEMU_START_BLOCK_MULTIPLE 0xFC
+#define SDEMU_STOP_TRAN            0xFD
+#define SDEMU_DATA_ACCEPTED        0x05
+#define SDEMU_DATA_CRC_ERROR       0x0B
+
+// OCR: 2.7-3.6V, power-up complete, card capacity status
+#define SDEMU_OCR_VOLTAGE  0x00FF8000
+#define SDEMU_OCR_READY    0x80000000
+#define SDEMU_OCR_CCS      0x40000000
+
+// Busy time after CMD12 and the stop token, in bytes
+#define SDEMU_STOP_BUSY 2
+
+typedef enum
+  {
+  SDEMU_COMMAND = 0, // Waiting for a command
+  SDEMU_READ, // Sending sectors
+  SDEMU_WRITE_TOKEN, // Waiting for the start of a sector to write
+  SDEMU_WRITE_DATA // Receiving a sector
+  } SDEmuState;
+
+struct _SDEmu
+  {
+  int fd;
+  SDEmuConfig config;
+  SDEmuStats stats;
+  uint64_t bus_ns; // More precise than stats.bus_us
+  unsigned int baud;
+  bool selected;
+  // Card state
+  bool idle; // Not yet initialized by ACMD41
+  bool app_cmd; // The last command was CMD55
+  bool crc_on; // CMD59 has turned on CRC checking
+  bool high_speed; // CMD6 has switched to high-speed mode
+  unsigned int init_polls; // ACMD41s so far
+  SDEmuState state;
+  bool multi; // CMD18 or CMD25, rather than CMD17 or CMD24
+  bool stalled; // A read timeout has been injected
+  uint32_t sector; // Next sector to read or write
+  uint32_t extra_fill; // Added to the delay before the next sector
+  // Bytes to send
+  uint32_t fill;
+  uint8_t out[SDEMU_OUT_SIZE];
+  size_t out_len;
+  size_t out_pos;
+  uint32_t busy;
+  // Bytes received
+  uint8_t cmd[6];
+  size_t cmd_len;
+  uint8_t in[SDEMU_SECTOR_SIZE + 2];
+  size_t in_len;
+  // Fault counters
+  unsigned int n_commands;
+  unsigned int n_reads;
+  unsigned int n_writes;
+  };
+
+/*============================================================================
+ * sdemu_config_defaults
+ * ==========================================================================*/
+void sdemu_config_defaults (SDEmuConfig *config)
+  {
+  memset (config, 0, sizeof (SDEmuConfig));
+  config->high_speed = true;
+  config->init_polls = 2;
+  config->response_bytes = 1;
+  config->read_latency_us = 100;
+  config->write_busy_us = 500;
+  }
+
+/*============================================================================
+ * sdemu_config_parse
+ * ==========================================================================*/
+int sdemu_config_parse (SDEmuConfig *config, const char *spec)
+  {
+  if (!spec) return 0;
+  while (*spec)
+    {
+    char name[32];
+    unsigned long value;
+    int n = 0;
+    if (sscanf (spec, "%31[^=,]=%lu%n", name, &value, &n) != 2)
+      return EINVAL;
+    unsigned int v = (unsigned int)value;
+    unsigned int cmd;
+    if (strcmp (name, "sectors") == 0) config->sectors = v;
+    else if (strcmp (name, "high_speed") == 0) config->high_speed = v != 0;
+    else if (strcmp (name, "max_baud") == 0) config->max_baud = (int)v;
+    else if (strcmp (name, "init_polls") == 0) config->init_polls = v;
+    else if (strcmp (name, "response_bytes") == 0)
+      config->response_bytes = v;
+    else if (strcmp (name, "read_latency") == 0)
+      config->read_latency_us = v;
+    else if (strcmp (name, "write_busy") == 0) config->write_busy_us = v;
+    else if (strcmp (name, "no_response") == 0)
+      config->no_response_every = v;
+    else if (strcmp (name, "crc_error") == 0) config->crc_error_every = v;
+    else if (strcmp (name, "read_timeout") == 0)
+      config->read_timeout_every = v;
+    else if (strcmp (name, "write_reject") == 0)
+      config->write_reject_every = v;
+    else if (sscanf (name, "cmd%u", &cmd) == 1 && cmd < SDEMU_COMMANDS)
+      config->cmd_latency_us[cmd] = v;
+    else
+      return EINVAL;
+    spec += n;
+    if (*spec == ',') spec++;
+    else if (*spec) return EINVAL;
+    }
+  return 0;
+  }
+
+/*============================================================================
+ * sdemu_new
+ * ==========================================================================*/
+SDEmu *sdemu_new (const char *image, const SDEmuConfig *config)
+  {
+  int fd = open (image, O_RDWR);
+  if (fd < 0) return NULL;
+  SDEmu *self = malloc (sizeof (SDEmu));
+  if (!self)
+    {
+    close (fd);
+    return NULL;
+    }
+  memset (self, 0, sizeof (SDEmu));
+  self->fd = fd;
+  if (config)
+    self->config = *config;
+  else
+    sdemu_config_defaults (&self->config);
+  if (self->config.sectors == 0)
+    {
+    struct stat sb;
+    if (fstat (fd, &sb) == 0)
+      self->config.sectors = (uint32_t)(sb.st_size / SDEMU_SECTOR_SIZE);
+    }
+  self->baud = 400 * 1000;
+  self->idle = true;
+  return self;
+  }
+
+/*============================================================================
+ * sdemu_destroy
+ * ==========================================================================*/
+void sdemu_destroy (SDEmu *self)
+  {
+  close (self->fd);
+  free (self);
+  }
+
+/*============================================================================
+ * sdemu_select
+ * ==========================================================================*/
+void sdemu_select (SDEmu *self, bool selected)
+  {
+  self->selected = selected;
+  }
+
+/*============================================================================
+ * sdemu_is_selected
+ * ==========================================================================*/
+bool sdemu_is_selected (const SDEmu *self)
+  {
+  return self->selected;
+  }
+
+/*============================================================================
+ * sdemu_set_baud
+ * ==========================================================================*/
+void sdemu_set_baud (SDEmu *self, unsigned int baud)
+  {
+  self->baud = baud;
+  }
+
+/*============================================================================
+ * sdemu_get_baud
+ * ==========================================================================*/
+unsigned int sdemu_get_baud (const SDEmu *self)
+  {
+  return self->baud;
+  }
+
+/*============================================================================
+ * sdemu_get_stats
+ * ==========================================================================*/
+const SDEmuStats *sdemu_get_stats (const SDEmu *self)
+  {
+  return &self->stats;
+  }
+
+/*============================================================================
+ * sdemu_fault
+ * Return true if a fault should be injected on the count'th occasion
+ * ==========================================================================*/
+static bool sdemu_fault (SDEmu *self, unsigned int count, unsigned int every)
+  {
+  if (every == 0 || count % every != 0) return false;
+  self->stats.faults++;
+  return true;
+  }
+
+/*============================================================================
+ * sdemu_too_fast
+ * Returns true if the clock is faster than the card can cope with
+ * ==========================================================================*/
+static bool sdemu_too_fast (const SDEmu *self)
+  {
+  return self->config.max_baud > 0
+    && self->baud > (unsigned int)self->config.max_baud;
+  }
+
+/*============================================================================
+ * sdemu_us_to_bytes
+ * The number of bytes that cross the bus in a time, at the current rate
+ * ==========================================================================*/
+static uint32_t sdemu_us_to_bytes (const SDEmu *self, unsigned int us)
+  {
+  return (uint32_t)((uint64_t)us * self->baud / 8000000u);
+  }
+
+/*============================================================================
+ * sdemu_respond
+ * Start a response, after the usual delay, discarding anything that
+ *   had not been sent yet
+ * ==========================================================================*/
+static void sdemu_respond (SDEmu *self, uint8_t r1)
+  {
+  self->fill = self->config.response_bytes;
+  self->out[0] = r1;
+  self->out_len = 1;
+  self->out_pos = 0;
+  self->busy = 0;
+  }
+
+/*============================================================================
+ * sdemu_add_out
+ * Add bytes to the response
+ * ==========================================================================*/
+static void sdemu_add_out (SDEmu *self, const uint8_t *data, size_t len)
+  {
+  memcpy (self->out + self->out_len, data, len);
+  self->out_len += len;
+  }
+
+/*============================================================================
+ * sdemu_add_block
+ * Add a data block, with its start token and CRC, to the response
+ * ==========================================================================*/
+static void sdemu_add_block (SDEmu *self, const uint8_t *data, size_t len,
+       bool corrupt)
+  {
+  uint16_t crc = crc16 ((const char *)data, (int)len);
+  if (corrupt) crc ^= 0x5555;
+  uint8_t token = SDEMU_START_BLOCK;
+  uint8_t tail[2] = { (uint8_t)(crc >> 8), (uint8_t)crc };
+  sdemu_add_out (self, &token, 1);
+  sdemu_add_out (self, data, len);
+  sdemu_add_out (self, tail, 2);
+  }
+
+/*============================================================================
+ * sdemu_next_sector
+ * Put the next sector of a read into the output buffer
+ * ==========================================================================*/
+static void sdemu_next_sector (SDEmu *self)
+  {
+  self->out_len = 0;
+  self->out_pos = 0;
+  self->n_reads++;
+  if (sdemu_fault (self, self->n_reads, self->config.read_timeout_every))
+    {
+    // Nothing more will be sent until the next command
+    self->stalled = true;
+    return;
+    }
+
+  uint8_t data[SDEMU_SECTOR_SIZE];
+  if (pread (self->fd, data, sizeof (data),
+       (off_t)self->sector * SDEMU_SECTOR_SIZE) != sizeof (data))
+    memset (data, 0, sizeof (data));
+  bool corrupt = sdemu_too_fast (self)
+    || sdemu_fault (self, self->n_reads, self->config.crc_error_every);
+  self->fill = sdemu_us_to_bytes (self, self->config.read_latency_us)
+    + self->extra_fill;
+  self->extra_fill = 0;
+  sdemu_add_block (self, data, sizeof (data), corrupt);
+  self->stats.sectors_read++;
+  self->sector++;
+  if (!self->multi) self->state = SDEMU_COMMAND;
+  }
+
+/*============================================================================
+ * sdemu_next_out
+ * Get the next byte that the card sends
+ * ==========================================================================*/
+static uint8_t sdemu_next_out (SDEmu *self)
+  {
+  if (self->fill > 0)
+    {
+    self->fill--;
+    self->stats.busy_bytes++;
+    return 0xFF;
+    }
+  if (self->out_pos < self->out_len)
+    return self->out[self->out_pos++];
+  if (self->busy > 0)
+    {
+    self->busy--;
+    self->stats.busy_bytes++;
+    return 0x00;
+    }
+  if (self->state == SDEMU_READ && !self->stalled)
+    {
+    sdemu_next_sector (self);
+    return sdemu_next_out (self);
+    }
+  return 0xFF;
+  }
+
+/*============================================================================
+ * sdemu_csd
+ * Make a version 2 card-specific data register, which is mostly
+ *   constant, apart from the size
+ * ==========================================================================*/
+static void sdemu_csd (const SDEmu *self, uint8_t *csd)
+  {
+  memset (csd, 0, 16);
+  csd[0] = 0x40; // CSD_STRUCTURE = 1
+  csd[3] = self->high_speed ? 0x5A : 0x32; // TRAN_SPEED, 50 or 25MHz
+  csd[5] = 0x09; // READ_BL_LEN = 512 bytes
+  // C_SIZE is bits 69:48, and is the size in 512kB units, less one
+  uint32_t c_size = self->config.sectors / 1024 - 1;
+  for (int i = 0; i < 22; i++)
+    {
+    int pos = 48 + i;
+    if (c_size & (1u << i))
+      csd[15 - pos / 8] |= (uint8_t)(1u << (pos % 8));
+    }
+  csd[15] = 0x01;
+  }
+
+/*============================================================================
+ * sdemu_switch_function
+ * Handle CMD6, for function group 1 only. The status block is 512 bits,
+ *   sent most significant first.
+ * ==========================================================================*/
+static void sdemu_switch_function (SDEmu *self, uint32_t arg,
+       uint8_t *status)
+  {
+  memset (status, 0, 64);
+  status[1] = 100; // Maximum current, mA
+  // Bits 415:400 are the functions supported by group 1
+  status[13] = self->config.high_speed ? 0x03 : 0x01;
+  unsigned int fn = arg & 0x0F;
+  unsigned int result;
+  if (fn == 0x0F)
+    result = self->high_speed ? 1 : 0; // No change
+  else if (fn == 0 || (fn == 1 && self->config.high_speed))
+    result = fn;
+  else
+    result = 0x0F; // Can't switch to that
+  // Bits 379:376 are the function that group 1 is, or would be, using
+  status[16] = (uint8_t)result;
+  if ((arg & 0x80000000) && result != 0x0F)
+    self->high_speed = result == 1;
+  }
+
+/*============================================================================
+ * sdemu_command
+ * Carry out a complete command
+ * ==========================================================================*/
+static void sdemu_command (SDEmu *self)
+  {
+  unsigned int cmd = self->cmd[0] & 0x3F;
+  uint32_t arg = (uint32_t)self->cmd[1] << 24 | (uint32_t)self->cmd[2] << 16
+    | (uint32_t)self->cmd[3] << 8 | self->cmd[4];
+  bool app = self->app_cmd;
+  self->app_cmd = false;
+  self->stats.commands++;
+
+  self->n_commands++;
+  if (sdemu_fault (self, self->n_commands, self->config.no_response_every))
+    return;
+
+  // Whatever was being sent is abandoned -- properly only by CMD12, but
+  //   a new command of any kind is the best clue we're going to get
+  bool was_reading = self->state == SDEMU_READ;
+  self->state = SDEMU_COMMAND;
+  self->stalled = false;
+
+  uint8_t r1 = self->idle ? SDEMU_R1_IDLE : 0;
+
+  // CMD0 and CMD8 always have their CRCs checked, the rest only when
+  //   CMD59 says so.
+  if ((self->crc_on || cmd == 0 || cmd == 8)
+       && (uint8_t)(crc7 ((const char *)self->cmd, 5) << 1 | 0x01)
+            != self->cmd[5])
+    {
+    sdemu_respond (self, r1 | SDEMU_R1_CRC_ERROR);
+    return;
+    }
+
+  // Until it is initialized, the card accepts only the commands that
+  //   initialize it
+  if (self->idle && !(cmd == 0 || cmd == 8 || cmd == 55 || cmd == 58
+       || cmd == 59 || (app && cmd == 41)))
+    {
+    sdemu_respond (self, r1 | SDEMU_R1_ILLEGAL);
+    return;
+    }
+
+  uint8_t data[64];
+  uint32_t latency = sdemu_us_to_bytes (self,
+    self->config.cmd_latency_us[cmd]);
+  switch (cmd)
+    {
+    case 0: // GO_IDLE_STATE
+      self->idle = true;
+      self->crc_on = false;
+      self->high_speed = false;
+      self->init_polls = 0;
+      sdemu_respond (self, SDEMU_R1_IDLE);
+      break;
+
+    case 8: // SEND_IF_COND, R7 echoes the voltage and check pattern
+      sdemu_respond (self, r1);
+      data[0] = 0;
+      data[1] = 0;
+      data[2] = (uint8_t)((arg >> 8) & 0x0F);
+      data[3] = (uint8_t)arg;
+      sdemu_add_out (self, data, 4);
+      break;
+
+    case 6: // SWITCH_FUNC
+      sdemu_respond (self, r1);
+      sdemu_switch_function (self, arg, data);
+      self->fill += latency;
+      sdemu_add_block (self, data, 64, false);
+      latency = 0;
+      break;
+
+    case 9: // SEND_CSD
+      sdemu_respond (self, r1);
+      sdemu_csd (self, data);
+      sdemu_add_block (self, data, 16, false);
+      break;
+
+    case 12: // STOP_TRANSMISSION
+      // The byte after the command is a stuff byte, and the response
+      //   follows that. Then the card is briefly busy.
+      sdemu_respond (self, was_reading ? r1 : r1 | SDEMU_R1_ILLEGAL);
+      self->fill++;
+      self->busy = SDEMU_STOP_BUSY;
+      break;
+
+    case 13: // SEND_STATUS, R2
+      sdemu_respond (self, r1);
+      data[0] = 0;
+      sdemu_add_out (self, data, 1);
+      break;
+
+    case 16: // SET_BLOCKLEN, which can only be 512 on an SDHC card
+      sdemu_respond (self, arg == SDEMU_SECTOR_SIZE
+        ? r1 : r1 | SDEMU_R1_PARAMETER);
+      break;
+
+    case 17: // READ_SINGLE_BLOCK
+    case 18: // READ_MULTIPLE_BLOCK
+      if (arg >= self->config.sectors)
+        {
+        sdemu_respond (self, r1 | SDEMU_R1_PARAMETER);
+        break;
+        }
+      sdemu_respond (self, r1);
+      self->state = SDEMU_READ;
+      self->multi = cmd == 18;
+      self->sector = arg;
+      // The response has to come promptly, so the command's latency 
+      //   delays the first sector instead
+      self->extra_fill = latency;
+      latency = 0;
+      break;
+
+    case 23: // ACMD23, SET_WR_BLK_ERASE_COUNT
+      sdemu_respond (self, app ? r1 : r1 | SDEMU_R1_ILLEGAL);
+      break;
+
+    case 24: // WRITE_BLOCK
+    case 25: // WRITE_MULTIPLE_BLOCK
+      if (arg >= self->config.sectors)
+        {
+        sdemu_respond (self, r1 | SDEMU_R1_PARAMETER);
+        break;
+        }
+      sdemu_respond (self, r1);
+      self->state = SDEMU_WRITE_TOKEN;
+      self->multi = cmd == 25;
+      self->sector = arg;
+      break;
+
+    case 41: // ACMD41, SD_SEND_OP_COND
+      self->init_polls++;
+      if (self->init_polls >= self->config.init_polls)
+        self->idle = false;
+      sdemu_respond (self, self->idle ? SDEMU_R1_IDLE : 0);
+      break;
+
+    case 55: // APP_CMD
+      self->app_cmd = true;
+      sdemu_respond (self, r1);
+      break;
+
+    case 58: // READ_OCR, R3
+      {
+      uint32_t ocr = SDEMU_OCR_VOLTAGE;
+      if (!self->idle) ocr |= SDEMU_OCR_READY | SDEMU_OCR_CCS;
+      sdemu_respond (self, r1);
+      data[0] = (uint8_t)(ocr >> 24);
+      data[1] = (uint8_t)(ocr >> 16);
+      data[2] = (uint8_t)(ocr >> 8);
+      data[3] = (uint8_t)ocr;
+      sdemu_add_out (self, data, 4);
+      }
+      break;
+
+    case 59: // CRC_ON_OFF
+      self->crc_on = arg & 1;
+      sdemu_respond (self, r1);
+      break;
+
+    default:
+      sdemu_respond (self, r1 | SDEMU_R1_ILLEGAL);
+      break;
+    }
+
+  // For commands that don't send data, the extra latency is time the
+  //   card is busy after it has responded
+  self->busy += latency;
+  }
+
+/*============================================================================
+ * sdemu_write_sector
+ * Store a sector that has been received, and send the data response
+ * ==========================================================================*/
+static void sdemu_write_sector (SDEmu *self)
+  {
+  uint16_t crc = (uint16_t)(self->in[SDEMU_SECTOR_SIZE] << 8
+    | self->in[SDEMU_SECTOR_SIZE + 1]);
+  self->n_writes++;
+  bool bad = sdemu_too_fast (self)
+    || (self->crc_on && crc != crc16 ((const char *)self->in,
+                                      SDEMU_SECTOR_SIZE))
+    || sdemu_fault (self, self->n_writes, self->config.write_reject_every);
+
+  uint8_t response = SDEMU_DATA_CRC_ERROR;
+  if (!bad && self->sector < self->config.sectors
+       && pwrite (self->fd, self->in, SDEMU_SECTOR_SIZE,
+            (off_t)self->sector * SDEMU_SECTOR_SIZE) == SDEMU_SECTOR_SIZE)
+    {
+    response = SDEMU_DATA_ACCEPTED;
+    self->stats.sectors_written++;
+    self->sector++;
+    }
+
+  self->fill = 0;
+  self->out[0] = response;
+  self->out_len = 1;
+  self->out_pos = 0;
+  self->busy = response == SDEMU_DATA_ACCEPTED
+    ? sdemu_us_to_bytes (self, self->config.write_busy_us) + 1 : 0;
+  self->state = self->multi ? SDEMU_WRITE_TOKEN : SDEMU_COMMAND;
+  }
+
+/*============================================================================
+ * sdemu_input
+ * Deal with a byte sent by the host
+ * ==========================================================================*/
+static void sdemu_input (SDEmu *self, uint8_t mosi)
+  {
+  switch (self->state)
+    {
+    case SDEMU_WRITE_DATA:
+      self->in[self->in_len++] = mosi;
+      if (self->in_len == sizeof (self->in))
+        sdemu_write_sector (self);
+      return;
+
+    case SDEMU_WRITE_TOKEN:
+      if (mosi == (self->multi
+            ? SDEMU_START_BLOCK_MULTIPLE : SDEMU_START_BLOCK))
+        {
+        self->state = SDEMU_WRITE_DATA;
+        self->in_len = 0;
+        return;
+        }
+      if (self->multi && mosi == SDEMU_STOP_TRAN)
+        {
+        self->state = SDEMU_COMMAND;
+        self->fill = 1;
+        self->busy = SDEMU_STOP_BUSY;
+        return;
+        }
+      // During a multiple block write, only the stop token ends it
+      if (self->multi) return;
+      break;
+
+    default:
+      break;
+    }
+
+  // Collect a command, which always starts 01xxxxxx, so can't be
+  //   confused with 0xFF or a token
+  if (self->cmd_len == 0 && (mosi & 0xC0) != 0x40)
+    return;
+  self->cmd[self->cmd_len++] = mosi;
+  if (self->cmd_len == sizeof (self->cmd))
+    {
+    self->cmd_len = 0;
+    sdemu_command (self);
+    }
+  }
+
+/*============================================================================
+ * sdemu_exchange
+ * ==========================================================================*/
+uint8_t sdemu_exchange (SDEmu *self, uint8_t mosi)
+  {
+  // Bytes sent while the card isn't selected aren't counted: the only
+  //   ones that matter are sent at start-up, in a loop that is timed,
+  //   so the host sends far more of them than the Pico would.
+  if (!self->selected) return 0xFF;
+  self->stats.bytes++;
+  if (self->baud > 0)
+    {
+    self->bus_ns += 8000000000ull / self->baud;
+    self->stats.bus_us = self->bus_ns / 1000;
+    }
+  uint8_t miso = sdemu_next_out (self);
+  sdemu_input (self, mosi);
+  return miso;
+  }
+
+#endif // PICO_ON_DEVICE
+
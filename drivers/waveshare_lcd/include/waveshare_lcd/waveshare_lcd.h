@@ -37,6 +37,17 @@ typedef enum _WSLCDScanDir
   WSLCD_SCAN_LANDSCAPE
   } WSLCDScanDir; 
 
+/*============================================================================
+ * rotations, relative to the scan direction set at construction time 
+ * ==========================================================================*/
+typedef enum _WSLCDRotation
+  {
+  WSLCD_ROTATE_0 = 0,
+  WSLCD_ROTATE_90,  // Clockwise
+  WSLCD_ROTATE_180,
+  WSLCD_ROTATE_270
+  } WSLCDRotation;
+
 typedef struct _WSLCD WSLCD;
 
 /** Create a new instance of the driver, specifying the various
@@ -80,11 +91,49 @@ extern void wslcd_clear (WSLCD *self, uint16_t colour);
 /** Write the data at buff to the display, with coordinates as 
     specified. The window to be written can be any size, in principle,
     but it isn't possible to draw the entire screen from the Pico's RAM,
-    because there isn't enough. */ 
+    because there isn't enough. Except for very small windows, the
+    data is sent by DMA, directly from buff. So buff can be in flash,
+    and there's no need to copy it to RAM first. */ 
 extern void wslcd_write_window 
         (const WSLCD *self, const uint16_t *buff, uint16_t w, 
         uint16_t h, uint16_t x, uint16_t y);
 
+/** Begin writing a window of w by h pixels at x, y, without 
+    supplying the data in one go. The pixels are then sent by any
+    number of calls to wslcd_stream_pixels and wslcd_stream_repeated,
+    which must add up to exactly w * h pixels, followed by
+    wslcd_end_window. Nothing else may be written to the display in
+    between. This allows an image to be decoded straight into the 
+    outgoing pixel stream, without a buffer for the whole window. */
+extern void wslcd_begin_window (const WSLCD *self, uint16_t x, uint16_t y,
+        uint16_t w, uint16_t h);
+
+/** Send len RGB565 pixels from buff, within a window started by
+    wslcd_begin_window. */
+extern void wslcd_stream_pixels (const WSLCD *self, const uint16_t *buff, 
+        int len);
+
+/** Send len pixels all of the same colour, within a window started by
+    wslcd_begin_window. */
+extern void wslcd_stream_repeated (const WSLCD *self, uint16_t colour, 
+        int len);
+
+/** Finish a window started by wslcd_begin_window. */
+extern void wslcd_end_window (const WSLCD *self);
+
+/** Rotate the mapping between the window coordinates and the panel, 
+    by reprogramming the controller's memory access control register. 
+    Nothing already on the screen changes, but subsequent writes are
+    mapped rotated, and the width and height swap for 90 and 270 degrees.
+    This allows, for example, a portrait image to be written in its
+    natural order and appear rotated on a landscape screen, at no cost. 
+    Rotations are relative to the scan direction set at construction
+    time; use WSLCD_ROTATE_0 to restore it. */
+extern void wslcd_set_rotation (WSLCD *self, WSLCDRotation rotation);
+
+/** Get the rotation last set by wslcd_set_rotation. */
+extern WSLCDRotation wslcd_get_rotation (const WSLCD *self);
+
 // DOES NOT WORK. The hardware does not even provide a way to select 
 //   between read and write operations.
 extern void wslcd_read_window 
@@ -13,6 +13,7 @@
 #include <stdio.h> 
 #if PICO_ON_DEVICE
 #include <hardware/spi.h> 
+#include <hardware/dma.h> 
 #endif
 #include <hardware/gpio.h> 
 #include <waveshare_lcd/waveshare_lcd.h> 
@@ -23,6 +24,16 @@
 #define LCD_3_5_WIDTH  LCD_X_MAXPIXEL
 #define LCD_3_5_HEIGHT  LCD_Y_MAXPIXEL 
 
+// Bits in the memory access control (MADCTL, 0x36) register
+#define MADCTL_MY 0x80 // Row address order
+#define MADCTL_MX 0x40 // Column address order
+#define MADCTL_MV 0x20 // Row/column exchange
+
+// Windows smaller than this many pixels are written a word at a time,
+//   rather than by DMA -- setting up the transfer and switching the
+//   SPI format would take longer than the transfer itself.
+#define WSLCD_DMA_MIN_PIXELS 32
+
 // Opaque structure
 
 struct _WSLCD
@@ -42,7 +53,10 @@ struct _WSLCD
   int height;
   int width;
   WSLCDScanDir scan_dir; // Portrait, landscape, etc
+  WSLCDRotation rotation; // Relative to scan_dir
+  uint8_t madctl; // MADCTL value for scan_dir, unrotated
   uint8_t id;
+  int dma; // DMA channel for pixel data
   };
 
 #if PICO_ON_DEVICE
@@ -303,6 +317,7 @@ static void wslcd_set_scan (WSLCD *self, WSLCDScanDir scan_dir)
 
     wslcd_write_reg (self, 0x36);
     wslcd_write_data (self, MemoryAccessReg_Data);
+    self->madctl = (uint8_t)MemoryAccessReg_Data;
     }
   }
 
@@ -374,6 +389,43 @@ void wslcd_send_repeated_word (const WSLCD *self, uint16_t word, int len)
   gpio_put (self->gpio_cs, 1);
   }
 
+/*============================================================================
+  wslcd_send_words_dma
+  Sends len 16-bit words from buff by DMA. The SPI is switched to 16-bit
+    frames for the duration, so the words go out most-significant byte 
+    first, as the panel expects, without any byte-swapping. Because the
+    DMA reads straight from buff, this works just as well for data in
+    flash (through XIP) as in RAM. If increment is false, the same word
+    is sent len times. The caller must set DC and CS.
+ ===========================================================================*/
+static void wslcd_send_words_dma (const WSLCD *self, const uint16_t *buff, 
+         int len, bool increment)
+  {
+  spi_inst_t *spi = self->spi;
+  spi_set_format (spi, 16, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+
+  dma_channel_config c = dma_channel_get_default_config ((uint)self->dma);
+  channel_config_set_transfer_data_size (&c, DMA_SIZE_16);
+  channel_config_set_dreq (&c, 
+    spi_get_index (spi) ? DREQ_SPI1_TX : DREQ_SPI0_TX);
+  channel_config_set_read_increment (&c, increment);
+  channel_config_set_write_increment (&c, false);
+  dma_channel_configure ((uint)self->dma, &c, &spi_get_hw (spi)->dr, 
+    buff, (uint)len, true);
+  dma_channel_wait_for_finish_blocking ((uint)self->dma);
+
+  // The DMA channel finishes when the last word is in the FIFO, not when
+  //   it has been sent. We're ignoring the received data, so the
+  //   receive FIFO will have overflowed -- clear that up, too.
+  while (spi_get_hw (spi)->sr & SPI_SSPSR_BSY_BITS)
+    tight_loop_contents();
+  while (spi_is_readable (spi))
+    (void)spi_get_hw (spi)->dr;
+  spi_get_hw (spi)->icr = SPI_SSPICR_RORIC_BITS;
+
+  spi_set_format (spi, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+  }
+
 #endif // PICO_ON_DEVICE
 
 /*============================================================================
@@ -421,9 +473,16 @@ void wslcd_write_window (const WSLCD *self, const uint16_t *buff,
   int len = w * h;
   gpio_put (self->gpio_dc, 1);
   gpio_put (self->gpio_cs, 0);
-  for (int i = 0; i < len; i++) 
+  if (len >= WSLCD_DMA_MIN_PIXELS)
+    {
+    wslcd_send_words_dma (self, buff, len, true);
+    }
+  else
     {
-    wslcd_write_word_be (self, buff[i]);
+    for (int i = 0; i < len; i++) 
+      {
+      wslcd_write_word_be (self, buff[i]);
+      }
     }
   gpio_put (self->gpio_cs, 1);
 #else
@@ -432,6 +491,77 @@ void wslcd_write_window (const WSLCD *self, const uint16_t *buff,
 #endif
   }
 
+/*============================================================================
+  wslcd_begin_window
+ ===========================================================================*/
+void wslcd_begin_window (const WSLCD *self, uint16_t x, uint16_t y, 
+        uint16_t w, uint16_t h)
+  {
+#if PICO_ON_DEVICE
+  wslcd_set_window_write (self, x, y, x + w, y + h); 
+  gpio_put (self->gpio_dc, 1);
+  gpio_put (self->gpio_cs, 0);
+#else
+  (void)self; (void)x; (void)y; (void)w; (void)h;
+#endif
+  }
+
+/*============================================================================
+  wslcd_stream_pixels
+ ===========================================================================*/
+void wslcd_stream_pixels (const WSLCD *self, const uint16_t *buff, int len)
+  {
+#if PICO_ON_DEVICE
+  if (len >= WSLCD_DMA_MIN_PIXELS)
+    {
+    wslcd_send_words_dma (self, buff, len, true);
+    }
+  else
+    {
+    for (int i = 0; i < len; i++) 
+      {
+      wslcd_write_word_be (self, buff[i]);
+      }
+    }
+#else
+  (void)self; (void)buff; (void)len;
+#endif
+  }
+
+/*============================================================================
+  wslcd_stream_repeated
+ ===========================================================================*/
+void wslcd_stream_repeated (const WSLCD *self, uint16_t colour, int len)
+  {
+#if PICO_ON_DEVICE
+  if (len >= WSLCD_DMA_MIN_PIXELS)
+    {
+    wslcd_send_words_dma (self, &colour, len, false);
+    }
+  else
+    {
+    for (int i = 0; i < len; i++) 
+      {
+      wslcd_write_word_be (self, colour);
+      }
+    }
+#else
+  (void)self; (void)colour; (void)len;
+#endif
+  }
+
+/*============================================================================
+  wslcd_end_window
+ ===========================================================================*/
+void wslcd_end_window (const WSLCD *self)
+  {
+#if PICO_ON_DEVICE
+  gpio_put (self->gpio_cs, 1);
+#else
+  (void)self;
+#endif
+  }
+
 /*============================================================================
   wslcd_read_window
   DOES NOT WORK
@@ -492,6 +622,59 @@ void wslcd_set_pixel (const WSLCD *self, uint16_t x, uint16_t y,
 #endif
   }
 
+/*============================================================================
+  wslcd_set_rotation
+  Rotation is done entirely by the panel controller. Relative to the 
+    unrotated mapping, 180 degrees reverses both the row and column order;
+    90 and 270 degrees exchange rows and columns, and then reverse one
+    of them. The display function control register (0xB6) is left alone.
+ ===========================================================================*/
+void wslcd_set_rotation (WSLCD *self, WSLCDRotation rotation)
+  {
+  if (rotation == self->rotation) return;
+
+  uint8_t madctl = self->madctl;
+  switch (rotation)
+    {
+    case WSLCD_ROTATE_0:
+      break;
+    case WSLCD_ROTATE_90:
+      madctl ^= MADCTL_MV | MADCTL_MY;
+      break;
+    case WSLCD_ROTATE_180:
+      madctl ^= MADCTL_MX | MADCTL_MY;
+      break;
+    case WSLCD_ROTATE_270:
+      madctl ^= MADCTL_MV | MADCTL_MX;
+      break;
+    }
+
+  // The width and height only swap when we change between an odd and
+  //   an even number of quarter-turns
+  if ((rotation & 1) != (self->rotation & 1))
+    {
+    int t = self->width;
+    self->width = self->height;
+    self->height = t;
+    }
+  self->rotation = rotation;
+
+#if PICO_ON_DEVICE
+  wslcd_write_reg (self, 0x36);
+  wslcd_write_data (self, madctl);
+#else
+  (void)madctl;
+#endif
+  }
+
+/*============================================================================
+  wslcd_get_rotation
+ ===========================================================================*/
+WSLCDRotation wslcd_get_rotation (const WSLCD *self)
+  {
+  return self->rotation;
+  }
+
 /*============================================================================
   wslcd_init
   Initialize the display hardware. This can be quite slow, but the
@@ -511,6 +694,8 @@ void wslcd_init (WSLCD *self)
   wslcd_initreg (self);
   wslcd_set_scan (self, self->scan_dir);
 
+  self->dma = dma_claim_unused_channel (true);
+
   sleep_ms (200);
 #else
   (void)self;
@@ -540,6 +725,7 @@ WSLCD *wslcd_new (int spi, uint gpio_cs, uint gpio_miso,
   self->gpio_bl = gpio_bl;
   self->baud_rate = baud_rate;
   self->scan_dir = scan_dir;
+  self->rotation = WSLCD_ROTATE_0;
   return self;
   }
 
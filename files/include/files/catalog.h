@@ -0,0 +1,143 @@
+/*===========================================================================
+
+  files/catalog.h
+
+  The catalog of photos on the SD card. Photos are found by scanning a
+  directory and, recursively, the directories -- albums -- inside it.
+  The scan is done a slice at a time, so photos can be shown as soon
+  as the first few have been found, and the rest are added while the
+  program is otherwise idle. However big the collection, the time to
+  the first photo is the same.
+
+  Photos' names are not kept in memory. Instead, each photo is 
+  recorded as the position of its entry in its directory, which takes 
+  six bytes, and its path is looked up again when it's needed. 
+
+  Each photo's JPEG header is read when it's found, unless 
+  CATALOG_CHECK_HEADERS in config.h is 0. Photos that the decoder can't
+  handle, or that are bigger than JPEG_MAX_SIZE, are left out. The 
+  photo's size, colour sampling, restart interval, and whether it's
+  progressive, are packed into another four bytes. Where its EXIF 
+  thumbnail is -- which is needed to preview the photo -- takes four 
+  more, if JPEG_PREVIEW is set. Anything else is read from the photo's
+  header when it's shown.
+
+  Packs -- files made by tools/ppcpack that hold many photos -- are
+  found by the scan too, and their photos are catalogued from the
+  pack's index, without reading the photos. Each takes the same space
+  as a photo in a file of its own.
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+===========================================================================*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <gfx/framestats.h>
+
+// The longest path of a photo; photos with longer paths are ignored
+#define CATALOG_MAX_PATH 256
+
+// Directories and positions within them are numbered with 16 bits, so
+//   this is the most directories that will be scanned, and the most
+//   entries in any one of them. FAT directories can't be bigger than
+//   this anyway, but exFAT ones can.
+#define CATALOG_MAX_DIRS 65535
+#define CATALOG_MAX_ENTRIES 65536
+
+struct _Catalog;
+typedef struct _Catalog Catalog;
+
+/** What the catalog knows about a photo from its JPEG header, or its 
+    pack's index. All zero if the header wasn't read. The sizes are 
+    kept in 8-pixel units, so are rounded up to a multiple of 8. */
+typedef struct _CatalogInfo
+  {
+  unsigned int width;
+  unsigned int height;
+  unsigned int restart_interval; // In MCUs, rounded down to a power of 2,
+                                 //   or zero if there are no restarts
+  uint8_t sampling; // A JpegSampling
+  bool progressive;
+  uint32_t thumb_offset; // The EXIF thumbnail
+  uint32_t thumb_len; // ... or zero if there isn't one, or it wasn't kept
+  } CatalogInfo;
+
+/** Where a photo is in its file. Photos in files of their own have
+    offset and size zero. */
+typedef struct _CatalogExtent
+  {
+  uint32_t offset;
+  uint32_t size;
+  } CatalogExtent;
+
+typedef struct _CatalogProgress
+  {
+  unsigned int photos; // Photos found so far
+  unsigned int dirs_scanned; // Directories finished with
+  unsigned int dirs_pending; // Directories found but not yet scanned
+  unsigned int skipped; // Photos ignored, because of the limits above
+  unsigned int unsupported; // Files left out because they can't be shown
+  unsigned int packs; // Packs found
+  uint64_t header_bytes; // Bytes the header parser has read
+  uint64_t scan_us; // Time spent scanning
+  bool done;
+  size_t index_bytes; // Memory used for photos and directories
+  FrameStats lookups; // Time taken to look up each photo's path
+  unsigned int searches; // Lookups that had to search the directory
+  } CatalogProgress;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Create a catalog of the files that match pattern, in the directory
+    root and the directories below it, and the photos in packs, which 
+    match pack_pattern. pack_pattern may be NULL, to ignore packs. 
+    Nothing is read from the card until catalog_step is called. Hidden
+    and system directories are not scanned. */
+extern Catalog *catalog_new (const char *root, const char *pattern,
+               const char *pack_pattern);
+
+extern void catalog_destroy (Catalog *self);
+
+/** Scan for about budget_us microseconds -- at least one directory
+    entry is read. Returns true if there is more to scan. */
+extern bool catalog_step (Catalog *self, uint32_t budget_us);
+
+/** The number of photos found so far. Photos are only ever added, so
+    a photo's number doesn't change. */
+extern unsigned int catalog_count (const Catalog *self);
+
+/** Copy the path of photo n into path, which has room for len bytes.
+    The photo's directory entry is read from the card. If the directory
+    has changed, so the photo isn't where it was, the directory is 
+    searched for it. Returns an errno if there is no such photo, or it
+    can't be found. */
+extern int catalog_get_path (Catalog *self, unsigned int n,
+               char *path, size_t len);
+
+/** As catalog_get_path, and also fill in extent, which may be NULL. 
+    For a photo in a pack, path is the pack's, and the pack's index is
+    read to find the photo in it. */
+extern int catalog_get_photo (Catalog *self, unsigned int n,
+               char *path, size_t len, CatalogExtent *extent);
+
+/** Copy what is known about photo n into info. Returns ENOENT if there
+    is no such photo. */
+extern int catalog_get_info (const Catalog *self, unsigned int n,
+               CatalogInfo *info);
+
+extern void catalog_get_progress (const Catalog *self,
+               CatalogProgress *progress);
+
+/** The directory being scanned, or NULL if there isn't one. */
+extern const char *catalog_get_scanning (const Catalog *self);
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -10,19 +10,151 @@
 
 #pragma once
 
+#include <stdint.h>
+#include <stdbool.h>
 #include <klib/list.h>
 #include <gfx/gfxconsole.h>
+#include <gfx/framestats.h>
 #include <waveshare_lcd/waveshare_lcd.h>
+#include <files/framecache.h>
+
+// A JPEG file being drawn on the display, a slice at a time
+struct _JpegJob;
+typedef struct _JpegJob JpegJob;
+
+// A file being read into memory, a chunk at a time
+struct _Prefetch;
+typedef struct _Prefetch Prefetch;
 
 #ifdef __cplusplus
 extern "C" { 
 #endif
 
 /** Show a JPEG file on the display. The GfxConsole here is used to
-    display error messages if the operation fails. */
+    display error messages if the operation fails. This is a 
+    convenience function that runs a JpegJob to completion. */
 extern void files_show_jpeg (GfxConsole *console, WSLCD *wslcd, 
                const char *path);
 
+/** Open a JPEG file and prepare to draw it, clearing the borders if it
+    doesn't fill the display. Returns NULL, having written a message
+    to the console, if the file can't be opened or isn't a JPEG that
+    we can decode. The decoder has global state, so only one job
+    can exist at a time. */
+extern JpegJob *files_jpeg_open (GfxConsole *console, WSLCD *wslcd, 
+               const char *path);
+
+/** As files_jpeg_open, but decode a JPEG that is already in memory. The
+    data must remain valid until the job is finished. */
+extern JpegJob *files_jpeg_open_mem (GfxConsole *console, WSLCD *wslcd, 
+               const uint8_t *data, uint32_t len);
+
+/** As files_jpeg_open, but first draw the photo's EXIF thumbnail, which
+    is thumb_len bytes at thumb_offset in the file, scaled up to the 
+    size the photo will be. The thumbnail is decoded before this 
+    returns, so something is on the display much sooner than the 
+    first rows of the photo would be. If thumb_len is zero, or the 
+    thumbnail can't be decoded, or previews are switched off, this
+    is the same as files_jpeg_open. */
+extern JpegJob *files_jpeg_open_preview (GfxConsole *console, WSLCD *wslcd,
+               const char *path, uint32_t thumb_offset, uint32_t thumb_len);
+
+/** As files_jpeg_open_preview, for a JPEG that starts at offset in the
+    file -- a photo in a pack. */
+extern JpegJob *files_jpeg_open_part (GfxConsole *console, WSLCD *wslcd,
+               const char *path, uint32_t offset, uint32_t thumb_offset, 
+               uint32_t thumb_len);
+
+/** As files_jpeg_open_mem, with a preview as files_jpeg_open_preview. */
+extern JpegJob *files_jpeg_open_mem_preview (GfxConsole *console, 
+               WSLCD *wslcd, const uint8_t *data, uint32_t len, 
+               uint32_t thumb_offset, uint32_t thumb_len);
+
+/** If the frame cache has a frame for the photo at offset in the file
+    at path, return a job that draws it. Steps then draw strips of 
+    rows, rather than rows of MCUs. Returns NULL if there is no usable
+    frame. */
+extern JpegJob *files_jpeg_open_cached (GfxConsole *console, WSLCD *wslcd, 
+               FrameCache *cache, const char *path, uint32_t offset);
+
+/** Write the decoded image to the frame cache, as a frame for the photo
+    at offset in the file at path, as it is drawn. This must be called before the first 
+    step. If the frame can't be written, the job carries on without 
+    it. The frame is only kept if the job runs to completion. */
+extern void files_jpeg_record (JpegJob *job, FrameCache *cache, 
+               const char *path, uint32_t offset);
+
+/** Decode and draw whole rows of MCUs, stopping after max_rows rows, 
+    or at the end of the first row that finishes after budget_us 
+    microseconds. Returns true if there is more to draw. The display
+    is left unrotated between steps, so other things can draw on it. */
+extern bool files_jpeg_step (JpegJob *job, unsigned int max_rows, 
+               uint32_t budget_us);
+
+/** Close the file and free the job. This can be called at any time,
+    to abandon a job part way through. */
+extern void files_jpeg_finish (JpegJob *job);
+
+/** Start reading a file into memory. Returns NULL if the file can't be
+    opened, or is larger than max_size, or there isn't enough memory. */
+extern Prefetch *files_prefetch_open (const char *path, uint32_t max_size);
+
+/** As files_prefetch_open, but read size bytes from offset in the file 
+    -- a photo in a pack. A size of zero means the rest of the file. 
+    If offset is a multiple of 512, and the file is in one piece, the
+    reads go straight to the card, as for a whole file. */
+extern Prefetch *files_prefetch_open_part (const char *path, 
+               uint32_t offset, uint32_t size, uint32_t max_size);
+
+/** Read up to max_bytes more of the file. Returns true if there is more
+    to read. */
+extern bool files_prefetch_step (Prefetch *self, uint32_t max_bytes);
+
+/** The Adler-32 checksum (see flashcache_adler32) of the data read so
+    far, which is worked out as it arrives. */
+extern uint32_t files_prefetch_checksum (const Prefetch *self);
+
+/** If the whole of the specified file, or the part of it at offset, 
+    has been read, return its data and set len. Otherwise return NULL.
+    The data belongs to the Prefetch. */
+extern const uint8_t *files_prefetch_get (const Prefetch *self, 
+               const char *path, uint32_t offset, uint32_t *len);
+
+/** The path of the file being read. */
+extern const char *files_prefetch_path (const Prefetch *self);
+
+extern void files_prefetch_free (Prefetch *self);
+
+/** The number of photos, opened for drawing or reading into memory, 
+    that were found to be in one piece on the card, and in more. A
+    photo that is read ahead and then opened again to draw it is 
+    counted once. */
+extern void files_get_layout_stats (unsigned int *contiguous, 
+               unsigned int *fragmented);
+
+/** If zero_copy is set, the decoder reads its input where it is -- 
+    in FatFs's sector buffer, or in prefetched data -- rather than
+    from a copy. This resets the decode statistics, so the two ways 
+    can be compared. */
+extern void files_set_zero_copy (bool zero_copy);
+
+extern bool files_get_zero_copy (void);
+
+/** Time taken to decode and draw each photo, from the beginning of 
+    the first step to the end of the last, not counting time between 
+    steps. There are separate figures for photos read from the card
+    while decoding, and from memory. */
+extern const FrameStats *files_get_decode_stats (bool from_mem);
+
+/** Switch thumbnail previews on or off. This resets the preview 
+    statistics. */
+extern void files_set_preview (bool preview);
+
+extern bool files_get_preview (void);
+
+/** Time from opening a photo to its thumbnail having been drawn. */
+extern const FrameStats *files_get_preview_stats (void);
+
 /** Fill the List with files in the directory dir that match the pattern. */
 extern int files_list_dir (const char *dir, const char *pattern, List *files);
 
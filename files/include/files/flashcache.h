@@ -0,0 +1,113 @@
+/*===========================================================================
+
+  files/flashcache.h
+
+  A cache of photos in the Pico's own flash, in the part that the
+  program doesn't use. Photos are copied there, as JPEG files, once
+  they have been read ahead from the SD card, and are then decoded
+  straight from the memory-mapped (XIP) flash, without touching the
+  card -- and still can be if the card stops working. Photos are copied
+  until the cache is full, and then kept: nothing is overwritten to
+  make room, so the flash is only written again when a cached photo
+  changes on the card and is dropped.
+
+  Each photo takes a run of flash sectors. The number of times each 
+  sector has been erased is kept, even over a restart, and a sector 
+  that has been erased FLASH_CACHE_MAX_ERASES times is not used again.
+  Each photo starts with a header, which is written last, so a photo
+  that was interrupted by a power cut is never used. The header holds
+  the photo's path, which is compared when the photo is looked up. The
+  headers are read when the cache is created, to build the directory
+  in RAM.
+
+  On the host, the flash is simulated by the file HOST_FLASH_IMAGE.
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+===========================================================================*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+struct _FlashCache;
+typedef struct _FlashCache FlashCache;
+
+typedef struct _FlashCacheStats
+  {
+  unsigned int hits;
+  unsigned int misses;
+  unsigned int writes; // Photos copied to flash
+  unsigned int evictions; // Photos out of date, or more than are wanted
+  unsigned int erases; // Sectors erased since start-up
+  unsigned int most_erases; // The most any one sector has ever been erased
+  unsigned int photos; // Photos in the cache now
+  uint32_t used_bytes; // Flash taken by those photos
+  uint32_t size_bytes; // The whole of the cache's flash
+  } FlashCacheStats;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Create a cache in the last size_kb kilobytes of flash, holding at
+    most max_photos photos. If max_photos is zero, the photos already
+    in flash can be shown, but no more are copied there. If there are
+    more than max_photos, the oldest are dropped. Returns NULL 
+    if there isn't enough memory, or the flash is not clear of the 
+    program. */
+extern FlashCache *flashcache_new (uint32_t size_kb, unsigned int max_photos);
+
+extern void flashcache_destroy (FlashCache *self);
+
+/** Look for the photo at offset in the file at path. If the cache has
+    it, return a pointer to its data, which can be read like memory,
+    and set len. Otherwise return NULL. If the card has a file of a
+    different size or date at path, the cached copy is out of date,
+    and is dropped; if the file can't be found at all, the copy is
+    used anyway, as its path matches. The data stays valid until the 
+    next call to flashcache_write_step. */
+extern const uint8_t *flashcache_get (FlashCache *self, const char *path,
+             uint32_t offset, uint32_t *len);
+
+/** As flashcache_get, but only say whether the photo is cached, without
+    counting a hit or miss. */
+extern bool flashcache_contains (FlashCache *self, const char *path,
+             uint32_t offset);
+
+/** Copy len bytes of data -- the photo at offset in the file at path --
+    to flash, a sector at a time. Each call erases and programs one
+    sector, which stops the whole Pico for tens of milliseconds. The
+    data must be in RAM, not flash, and must be unchanged from one call
+    to the next, until this returns false, when the photo is in the
+    cache. A call with a different photo abandons the one being copied.
+    checksum is flashcache_adler32 of the data, which the caller will
+    usually have worked out while reading it. Returns false straight 
+    away if the photo is already cached, or can't be -- if the cache is
+    full, or its path is too long to store, for example. */
+extern bool flashcache_write_step (FlashCache *self, const char *path,
+             uint32_t offset, const uint8_t *data, uint32_t len,
+             uint32_t checksum);
+
+/** The Adler-32 checksum of len bytes of data, continuing from adler,
+    which is 1 for the start of the data. The cache uses this to check
+    that a photo is intact. */
+extern uint32_t flashcache_adler32 (uint32_t adler, const uint8_t *data,
+             uint32_t len);
+
+/** The number of photos in the cache. */
+extern unsigned int flashcache_count (const FlashCache *self);
+
+/** The n'th photo in the cache, oldest first, for showing when the
+    card can't be read. Returns NULL if there is no such photo. */
+extern const uint8_t *flashcache_get_nth (FlashCache *self, unsigned int n,
+             uint32_t *len);
+
+extern const FlashCacheStats *flashcache_get_stats
+             (const FlashCache *self);
+
+#ifdef __cplusplus
+}
+#endif
+
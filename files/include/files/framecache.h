@@ -0,0 +1,81 @@
+/*===========================================================================
+
+  files/framecache.h
+
+  A cache of decoded photos, in a directory on the SD card. Each frame
+  is the whole display, as RGB565 words in the order the panel wants
+  them, so drawing a cached photo is just a matter of copying it from
+  the card to the display. Frames are keyed by the photo's path, size,
+  and modification time, so a photo that is replaced is decoded again.
+  When the cache is full, the frame that was least recently used is
+  deleted.
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+===========================================================================*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <ff.h>
+
+struct _FrameCache;
+typedef struct _FrameCache FrameCache;
+
+// What is needed to draw a frame, apart from the pixels
+typedef struct _FrameInfo
+  {
+  uint16_t width; // As rotated
+  uint16_t height;
+  uint8_t rotation; // A WSLCDRotation
+  } FrameInfo;
+
+typedef struct _FrameCacheStats
+  {
+  unsigned int hits;
+  unsigned int misses;
+  unsigned int writes; // Frames completed
+  unsigned int evictions;
+  unsigned int frames; // Frames in the cache now
+  } FrameCacheStats;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Create a cache in the specified directory, which is created if
+    necessary, holding at most max_frames frames. Returns NULL if the
+    directory can't be created. */
+extern FrameCache *framecache_new (const char *dir, unsigned int max_frames);
+
+extern void framecache_destroy (FrameCache *self);
+
+/** Look for a frame for the photo at offset in the file at path -- 
+    offset is zero unless the photo is in a pack. If there is one, 
+    returns zero, with fp open and positioned at the first pixel, and 
+    info filled in. The caller must close fp. Otherwise returns ENOENT,
+    or another errno. */
+extern int framecache_open_read (FrameCache *self, const char *path,
+             uint32_t offset, FIL *fp, FrameInfo *info);
+
+/** Start writing a frame for the photo at path and offset, deleting 
+    old frames if the cache is full. On success, fp is open and 
+    positioned for the first pixel; the pixels must then be written a
+    row at a time, and framecache_close_write called. Only one frame can be written at a
+    time. Returns an errno on failure. */
+extern int framecache_open_write (FrameCache *self, const char *path,
+             uint32_t offset, FIL *fp);
+
+/** Finish writing a frame. If complete is false, or the header can't
+    be written, the frame is deleted. */
+extern void framecache_close_write (FrameCache *self, FIL *fp,
+             const FrameInfo *info, bool complete);
+
+extern const FrameCacheStats *framecache_get_stats
+             (const FrameCache *self);
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -0,0 +1,78 @@
+/*===========================================================================
+
+  files/jpeghdr.h
+
+  A minimal parser for JPEG headers. It walks the marker segments up to
+  the start of the scan, reading only the few bytes it needs from each, 
+  so it is cheap enough to run before every decode, and on every photo
+  when the catalog is built -- a typical camera JPEG costs a few hundred
+  bytes.
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0 
+
+===========================================================================*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" { 
+#endif
+
+/** A function that reads len bytes from offset into buf, and returns the
+    number of bytes actually read, which will be less than len at
+    the end of the data. The data argument is whatever was passed to
+    jpeghdr_parse. */
+typedef uint32_t (*JpegHdrReadFn) (void *data, uint32_t offset, 
+                     uint8_t *buf, uint32_t len);
+
+// How the colour components are sampled. The names are picojpeg's: 
+//   H2V2 means the luminance has twice the chrominance's resolution in
+//   both directions, and so on. picojpeg can't decode OTHER.
+typedef enum 
+  {
+  JPEGHDR_SAMP_UNKNOWN = 0, // No frame header found
+  JPEGHDR_SAMP_GREY,
+  JPEGHDR_SAMP_H1V1,
+  JPEGHDR_SAMP_H2V1,
+  JPEGHDR_SAMP_H1V2,
+  JPEGHDR_SAMP_H2V2,
+  JPEGHDR_SAMP_OTHER
+  } JpegSampling;
+
+typedef struct _JpegHeader
+  {
+  unsigned int width;
+  unsigned int height;
+  uint8_t sof; // The start-of-frame marker; 0xC0 is baseline
+  uint8_t precision; // Bits per sample
+  uint8_t components;
+  uint8_t quant_tables; // The highest quantization table number used
+  JpegSampling sampling;
+  bool progressive;
+  unsigned int restart_interval; // In MCUs; zero if there are no restarts
+  // The thumbnail in the EXIF block, as an offset into the file and a 
+  //   length. Both are zero if there isn't one.
+  uint32_t thumb_offset;
+  uint32_t thumb_len;
+  // EXIF orientation, 1-8. 1 (the default) is 'upright', 3 is 'upside
+  //   down', 6 needs rotating 90 degrees clockwise to be upright, and
+  //   8 needs rotating 90 degrees anticlockwise. The others are mirror
+  //   images, which cameras don't produce.
+  int orientation;
+  } JpegHeader;
+
+/** Parse the JPEG header, filling in hdr. Returns zero on success, or
+    an errno if the data is not a JPEG file, or can't be read. */
+extern int jpeghdr_parse (JpegHdrReadFn read_fn, void *data, JpegHeader *hdr);
+
+/** Returns NULL if picojpeg can decode an image with this header, or
+    else a short description of what it can't handle. */
+extern const char *jpeghdr_unsupported (const JpegHeader *hdr);
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -0,0 +1,89 @@
+/*===========================================================================
+
+  files/pack.h
+
+  The pack format, which holds many photos in one file. On a card with
+  thousands of photos, finding and opening each one is much of the 
+  cost of showing it, and photos copied one at a time can end up in
+  pieces. A pack is one file, which is usually in one piece, with an
+  index at the start, so each photo can be read with a single 
+  multi-block read from a known sector.
+
+  Packs are made on the host by tools/ppcpack, and are found by the
+  catalog, which reads only the index. All numbers are little-endian.
+
+    Header, PACK_HEADER_SIZE bytes:
+      0   magic, "PPCPACK\0"
+      8   version, 16 bits
+      10  size of each index entry, 16 bits
+      12  number of photos, 32 bits
+    Index, one PACK_ENTRY_SIZE entry for each photo:
+      0   offset of the photo from the start of the pack, 32 bits
+      4   size of the photo, 32 bits
+      8   width, 16 bits
+      10  height, 16 bits
+      12  hash of the photo's original name, 32 bits
+      16  offset of the EXIF thumbnail from the start of the photo,
+            32 bits, or zero
+      20  size of the EXIF thumbnail, 16 bits, or zero
+      22  restart interval, 16 bits
+      24  sampling, 8 bits, a JpegSampling
+      25  EXIF orientation, 8 bits
+      26  reserved, zero
+    Padding, to a multiple of PACK_ALIGN bytes
+    The photos, each starting on a multiple of PACK_ALIGN bytes
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+===========================================================================*/
+
+#pragma once
+
+#include <stdint.h>
+
+#define PACK_MAGIC "PPCPACK"
+#define PACK_VERSION 1
+#define PACK_HEADER_SIZE 16
+#define PACK_ENTRY_SIZE 32
+// Photos start on a sector boundary
+#define PACK_ALIGN 512
+
+typedef struct _PackEntry
+  {
+  uint32_t offset;
+  uint32_t size;
+  uint16_t width;
+  uint16_t height;
+  uint32_t name_hash;
+  uint32_t thumb_offset;
+  uint16_t thumb_len;
+  uint16_t restart_interval;
+  uint8_t sampling;
+  uint8_t orientation;
+  } PackEntry;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Check the PACK_HEADER_SIZE bytes of a pack header, and get the 
+    number of photos. Returns EINVAL if it isn't a pack, or is a
+    version we can't read. */
+extern int pack_decode_header (const uint8_t *buf, uint32_t *count);
+
+extern void pack_encode_header (uint8_t *buf, uint32_t count);
+
+extern void pack_decode_entry (const uint8_t *buf, PackEntry *entry);
+
+extern void pack_encode_entry (uint8_t *buf, const PackEntry *entry);
+
+/** The offset of the first photo in a pack of count photos. */
+extern uint32_t pack_data_offset (uint32_t count);
+
+/** The hash stored for a name: 32-bit FNV-1a. */
+extern uint32_t pack_hash (const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
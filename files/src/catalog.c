@@ -0,0 +1,751 @@
+/* =======================================================================
+
+  files/catalog.c
+
+  The scan is depth-first, with a stack of directories still to be
+  scanned. The directory being scanned stays open between slices, and
+  each slice reads as many entries from it as it has time for.
+
+  Each photo is stored as a directory number, and the entry number in
+  that directory from which f_readdir found it, which f_seekdir can go
+  back to. A 16-bit hash of the name is kept too, so we can tell if 
+  the entry there is no longer the photo -- if a file has been created
+  in a deleted entry in front of it, for example. If so, the directory
+  is searched for a file with the same hash, and the entry number where
+  it was found is stored in place of the old one, so the search is only
+  done once. Only the directories' paths are stored as strings.
+
+  Reading a photo's header means opening it by name, which is a search
+  of a directory that is probably still in FatFs's window, and then one
+  or two sector reads.
+
+  A pack is found in the same way, and then its index is read an entry
+  at a time, with the directory scan waiting until it's done. Its 
+  photos are stored as the pack's number in the index, with the 
+  directory number CATALOG_PACKED, and the pack's own position is 
+  kept in a table of packs. Photos from a pack are numbered one after
+  another, so the pack is found from the photo's number.
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+ ======================================================================= */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <errno.h>
+#include <pico/stdlib.h>
+#include <ff.h>
+#include <klib/list.h>
+#include <gfx/framestats.h>
+#include <files/jpeghdr.h>
+#include <files/pack.h>
+#include <files/catalog.h>
+#include "config.h"
+
+#define CATALOG_ENTRY_SIZE 32 // Bytes in a FAT directory entry
+
+// The directory number of a photo in a pack. CATALOG_MAX_DIRS keeps
+//   real directory numbers below this.
+#define CATALOG_PACKED 0xFFFF
+
+// A photo's EXIF thumbnail is stored as offset << CATALOG_THUMB_LEN_BITS
+//   | length. The EXIF block can't be bigger than 64 kB, and comes at or
+//   near the start of the file, so the offset fits in the 17 bits left;
+//   thumbnails of 32 kB or more are not kept, and the photo is shown
+//   without a preview.
+#define CATALOG_THUMB_LEN_BITS 15
+
+// A photo's format is packed into 32 bits: from the bottom, its width 
+//   and height in 8-pixel units, in CATALOG_SIZE_BITS each, then its 
+//   JpegSampling in 3 bits, its restart interval in 4 -- zero, or one 
+//   more than the interval's log2 -- and a bit that is set if it is 
+//   progressive. Sizes that are too big are stored as the biggest there
+//   is room for, and restart intervals of 2^14 or more as 2^14.
+#define CATALOG_SIZE_BITS 12
+#define CATALOG_SAMPLING_SHIFT (2 * CATALOG_SIZE_BITS)
+#define CATALOG_RESTART_SHIFT (CATALOG_SAMPLING_SHIFT + 3)
+#define CATALOG_PROGRESSIVE_BIT (1u << (CATALOG_RESTART_SHIFT + 4))
+
+/* =======================================================================
+   A pack that the scan has found
+ ======================================================================= */
+typedef struct _CatalogPack
+  {
+  uint32_t location; // The pack's own directory and entry number
+  uint16_t hash; // ... and the hash of its name
+  unsigned int first; // The number of its first photo in the catalog
+  unsigned int count; // Photos from it in the catalog
+  } CatalogPack;
+
+/* =======================================================================
+   Opaque struct
+ ======================================================================= */
+struct _Catalog
+  {
+  char *pattern;
+  char *pack_pattern; // NULL if packs aren't looked for
+  uint32_t *photos; // Directory number << 16 | entry number
+  uint16_t *hashes; // Hashes of the photos' names
+  uint32_t *formats; // The photos' sizes, and so on, packed
+#if JPEG_PREVIEW
+  uint32_t *thumbs; // Where the photos' thumbnails are, packed
+#endif
+  unsigned int capacity; // Size of photos, hashes, formats, and thumbs
+  char **dirs; // Paths of the directories scanned so far
+  unsigned int ndirs;
+  unsigned int dirs_capacity;
+  List *pending; // Paths of directories waiting to be scanned
+  char *scanning; // The directory that dir is open on, or NULL
+  DIR dir;
+  FIL fp; // The photo whose header, or the pack whose index, is being read
+  CatalogPack *packs;
+  unsigned int npacks;
+  unsigned int packs_capacity;
+  bool packing; // Reading the index of the last pack in packs
+  uint32_t pack_next; // The next entry to read
+  uint32_t pack_entries;
+  CatalogProgress progress;
+  };
+
+/* =======================================================================
+   catalog_match
+   Match a name against a pattern with * and ? wildcards, ignoring case
+     as FAT does.
+ ======================================================================= */
+static bool catalog_match (const char *pattern, const char *name)
+  {
+  while (*pattern)
+    {
+    if (*pattern == '*')
+      {
+      pattern++;
+      do
+        {
+        if (catalog_match (pattern, name)) return true;
+        } while (*name++);
+      return false;
+      }
+    if (!*name) return false;
+    if (*pattern != '?' && tolower ((unsigned char)*pattern)
+         != tolower ((unsigned char)*name))
+      return false;
+    pattern++;
+    name++;
+    }
+  return *name == 0;
+  }
+
+/* =======================================================================
+   catalog_hash
+   FNV-1a, folded to 16 bits
+ ======================================================================= */
+static uint16_t catalog_hash (const char *s)
+  {
+  uint32_t h = pack_hash (s);
+  return (uint16_t)(h ^ (h >> 16));
+  }
+
+/* =======================================================================
+   catalog_join
+   Make the path of name in directory dir. Returns false if it's
+     too long.
+ ======================================================================= */
+static bool catalog_join (const char *dir, const char *name, char *path)
+  {
+  size_t l = strlen (dir);
+  const char *sep = (l > 0 && dir[l - 1] == '/') ? "" : "/";
+  int n = snprintf (path, CATALOG_MAX_PATH, "%s%s%s", dir, sep, name);
+  return n > 0 && n < CATALOG_MAX_PATH;
+  }
+
+/* =======================================================================
+   catalog_header_read
+   Positional read callback for the JPEG header parser
+ ======================================================================= */
+static uint32_t catalog_header_read (void *data, uint32_t offset, 
+        uint8_t *buf, uint32_t len)
+  {
+  Catalog *self = (Catalog *)data;
+  UINT br = 0;
+  if (f_tell (&self->fp) != offset && f_lseek (&self->fp, offset) != FR_OK) 
+    return 0;
+  if (f_read (&self->fp, buf, len, &br) != FR_OK) return 0;
+  self->progress.header_bytes += br;
+  return br;
+  }
+
+/* =======================================================================
+   catalog_pack_thumb
+   Pack a thumbnail's offset and length into 32 bits. Returns zero -- 
+     no thumbnail -- if they don't fit.
+ ======================================================================= */
+static uint32_t catalog_pack_thumb (uint32_t offset, uint32_t len)
+  {
+  if (len == 0 || len >= 1u << CATALOG_THUMB_LEN_BITS
+       || offset >= 1u << (32 - CATALOG_THUMB_LEN_BITS))
+    return 0;
+  return offset << CATALOG_THUMB_LEN_BITS | len;
+  }
+
+/* =======================================================================
+   catalog_pack_size
+   A width or height, in 8-pixel units, rounded up, in CATALOG_SIZE_BITS
+ ======================================================================= */
+static uint32_t catalog_pack_size (unsigned int size)
+  {
+  const uint32_t max = (1u << CATALOG_SIZE_BITS) - 1;
+  uint32_t units = (size + 7) / 8;
+  return units < max ? units : max;
+  }
+
+/* =======================================================================
+   catalog_pack_format
+   Pack a photo's size, sampling, restart interval, and progressive 
+     flag into 32 bits
+ ======================================================================= */
+static uint32_t catalog_pack_format (unsigned int width, unsigned int height,
+        unsigned int sampling, unsigned int restart_interval, 
+        bool progressive)
+  {
+  uint32_t restart = 0;
+  while (restart < 15 && restart_interval >> restart) restart++;
+  return catalog_pack_size (width) 
+    | catalog_pack_size (height) << CATALOG_SIZE_BITS
+    | (sampling & 7) << CATALOG_SAMPLING_SHIFT
+    | restart << CATALOG_RESTART_SHIFT
+    | (progressive ? CATALOG_PROGRESSIVE_BIT : 0);
+  }
+
+/* =======================================================================
+   catalog_check
+   Read the header of the photo at path, and set format and thumb to its
+     format and where its thumbnail is, packed. Returns false if it 
+     can't be shown.
+ ======================================================================= */
+static bool catalog_check (Catalog *self, const char *path, 
+        uint32_t *format, uint32_t *thumb)
+  {
+  *format = 0;
+  *thumb = 0;
+#if CATALOG_CHECK_HEADERS
+  if (f_open (&self->fp, path, FA_READ) != FR_OK) return false;
+  JpegHeader hdr;
+  int err = jpeghdr_parse (catalog_header_read, self, &hdr);
+  f_close (&self->fp);
+  if (err || jpeghdr_unsupported (&hdr)) return false;
+#if JPEG_MAX_SIZE
+  if (hdr.width > JPEG_MAX_SIZE || hdr.height > JPEG_MAX_SIZE) 
+    return false;
+#endif
+  *format = catalog_pack_format (hdr.width, hdr.height, hdr.sampling,
+    hdr.restart_interval, hdr.progressive);
+  *thumb = catalog_pack_thumb (hdr.thumb_offset, hdr.thumb_len);
+#else
+  (void)self; (void)path;
+#endif
+  return true;
+  }
+
+/* =======================================================================
+   catalog_add
+   Add a photo, at location -- a directory and entry number -- with
+     the given name hash, and its format and thumbnail, packed. Returns 
+     false if there's no room.
+ ======================================================================= */
+static bool catalog_add (Catalog *self, uint32_t location, uint16_t hash,
+        uint32_t format, uint32_t thumb)
+  {
+  unsigned int n = self->progress.photos;
+  if (n >= CATALOG_MAX_PHOTOS)
+    {
+    self->progress.skipped++;
+    return false;
+    }
+  if (n == self->capacity)
+    {
+    // Growing by half, rather than doubling, wastes less at the end, and
+    //   needs less while the arrays are being moved
+    unsigned int capacity = self->capacity ? self->capacity * 3 / 2 : 64;
+    if (capacity > CATALOG_MAX_PHOTOS) capacity = CATALOG_MAX_PHOTOS;
+    uint32_t *photos = realloc (self->photos, capacity * sizeof (uint32_t));
+    if (photos) self->photos = photos;
+    uint16_t *hashes = realloc (self->hashes, capacity * sizeof (uint16_t));
+    if (hashes) self->hashes = hashes;
+    uint32_t *formats = realloc (self->formats, 
+      capacity * sizeof (uint32_t));
+    if (formats) self->formats = formats;
+    size_t each = 2 * sizeof (uint32_t) + sizeof (uint16_t);
+#if JPEG_PREVIEW
+    uint32_t *thumbs = realloc (self->thumbs, capacity * sizeof (uint32_t));
+    if (thumbs) self->thumbs = thumbs;
+    each += sizeof (uint32_t);
+#else
+    bool thumbs = true;
+#endif
+    if (!photos || !hashes || !formats || !thumbs)
+      {
+      self->progress.skipped++;
+      return false;
+      }
+    self->progress.index_bytes += (capacity - self->capacity) * each;
+    self->capacity = capacity;
+    }
+  self->photos[n] = location;
+  self->hashes[n] = hash;
+  self->formats[n] = format;
+#if JPEG_PREVIEW
+  self->thumbs[n] = thumb;
+#else
+  (void)thumb;
+#endif
+  self->progress.photos++;
+  return true;
+  }
+
+/* =======================================================================
+   catalog_location
+   The location of the entry found by reading from position pos in the
+     directory being scanned, which is always the last one in dirs.
+     Returns false if the entry number is too big to store.
+ ======================================================================= */
+static bool catalog_location (const Catalog *self, DWORD pos, 
+        uint32_t *location)
+  {
+  uint32_t entry = pos / CATALOG_ENTRY_SIZE;
+  if (entry >= CATALOG_MAX_ENTRIES) return false;
+  *location = (uint32_t)(self->ndirs - 1) << 16 | entry;
+  return true;
+  }
+
+/* =======================================================================
+   catalog_open_pack
+   Start reading the index of the pack at path, whose entry is at 
+     location. Returns false if it isn't a pack we can read.
+ ======================================================================= */
+static bool catalog_open_pack (Catalog *self, const char *path, 
+        uint32_t location, const char *name)
+  {
+  if (self->npacks == self->packs_capacity)
+    {
+    unsigned int capacity = self->packs_capacity ? self->packs_capacity * 2 : 4;
+    CatalogPack *packs = realloc (self->packs, 
+      capacity * sizeof (CatalogPack));
+    if (!packs) return false;
+    self->progress.index_bytes += (capacity - self->packs_capacity) 
+      * sizeof (CatalogPack);
+    self->packs = packs;
+    self->packs_capacity = capacity;
+    }
+  if (f_open (&self->fp, path, FA_READ) != FR_OK) return false;
+  uint8_t buf[PACK_HEADER_SIZE];
+  UINT br;
+  uint32_t count;
+  if (f_read (&self->fp, buf, sizeof (buf), &br) != FR_OK 
+       || br != sizeof (buf) || pack_decode_header (buf, &count) != 0)
+    {
+    f_close (&self->fp);
+    return false;
+    }
+  CatalogPack *pack = &self->packs[self->npacks++];
+  pack->location = location;
+  pack->hash = catalog_hash (name);
+  pack->first = self->progress.photos;
+  pack->count = 0;
+  self->packing = true;
+  self->pack_next = 0;
+  self->pack_entries = count;
+  self->progress.packs++;
+  return true;
+  }
+
+/* =======================================================================
+   catalog_read_pack
+   Read the next entry from the index of the pack being read, and add
+     its photo, if it can be shown.
+ ======================================================================= */
+static void catalog_read_pack (Catalog *self)
+  {
+  CatalogPack *pack = &self->packs[self->npacks - 1];
+  uint8_t buf[PACK_ENTRY_SIZE];
+  UINT br;
+  if (self->pack_next >= self->pack_entries 
+       || self->pack_next >= CATALOG_MAX_ENTRIES
+       || f_read (&self->fp, buf, sizeof (buf), &br) != FR_OK 
+       || br != sizeof (buf))
+    {
+    if (self->pack_next < self->pack_entries) 
+      self->progress.skipped += self->pack_entries - self->pack_next;
+    f_close (&self->fp);
+    self->packing = false;
+    return;
+    }
+  uint32_t k = self->pack_next++;
+  PackEntry entry;
+  pack_decode_entry (buf, &entry);
+  // The packer only takes photos we can show, but it doesn't know 
+  //   JPEG_MAX_SIZE
+  if (entry.size == 0 || entry.offset % PACK_ALIGN != 0 
+      || entry.sampling == JPEGHDR_SAMP_OTHER
+#if JPEG_MAX_SIZE
+      || entry.width > JPEG_MAX_SIZE || entry.height > JPEG_MAX_SIZE
+#endif
+      )
+    {
+    self->progress.unsupported++;
+    return;
+    }
+  if (catalog_add (self, (uint32_t)CATALOG_PACKED << 16 | k, 
+       (uint16_t)(entry.name_hash ^ (entry.name_hash >> 16)), 
+       catalog_pack_format (entry.width, entry.height, entry.sampling,
+         entry.restart_interval, false),
+       catalog_pack_thumb (entry.thumb_offset, entry.thumb_len)))
+    pack->count++;
+  }
+
+/* =======================================================================
+   catalog_add_dir
+   Add the directory about to be scanned to dirs. Returns false if 
+     there's no room.
+ ======================================================================= */
+static bool catalog_add_dir (Catalog *self, char *path)
+  {
+  if (self->ndirs >= CATALOG_MAX_DIRS) return false;
+  if (self->ndirs == self->dirs_capacity)
+    {
+    unsigned int capacity = self->dirs_capacity ? self->dirs_capacity * 2 : 16;
+    char **dirs = realloc (self->dirs, capacity * sizeof (char *));
+    if (!dirs) return false;
+    self->progress.index_bytes += (capacity - self->dirs_capacity) 
+      * sizeof (char *);
+    self->dirs = dirs;
+    self->dirs_capacity = capacity;
+    }
+  self->dirs[self->ndirs++] = path;
+  self->progress.index_bytes += strlen (path) + 1;
+  return true;
+  }
+
+/* =======================================================================
+   catalog_open_next
+   Open the next directory on the stack. Returns false if there are
+     none left.
+ ======================================================================= */
+static bool catalog_open_next (Catalog *self)
+  {
+  while (list_length (self->pending) > 0)
+    {
+    char *path = list_get (self->pending, 0);
+    char *dir = strdup (path);
+    list_remove_object (self->pending, path);
+    self->progress.dirs_pending--;
+    if (dir && f_opendir (&self->dir, dir) == FR_OK)
+      {
+      if (catalog_add_dir (self, dir))
+        {
+        self->scanning = dir;
+        return true;
+        }
+      f_closedir (&self->dir);
+      }
+    // A directory that can't be read is treated as empty
+    free (dir);
+    self->progress.dirs_scanned++;
+    }
+  return false;
+  }
+
+/* =======================================================================
+   catalog_close
+ ======================================================================= */
+static void catalog_close (Catalog *self)
+  {
+  if (!self->scanning) return;
+  f_closedir (&self->dir);
+  // The path stays in dirs
+  self->scanning = NULL;
+  self->progress.dirs_scanned++;
+  }
+
+/* =======================================================================
+   catalog_new
+ ======================================================================= */
+Catalog *catalog_new (const char *root, const char *pattern,
+      const char *pack_pattern)
+  {
+  Catalog *self = malloc (sizeof (Catalog));
+  if (!self) return NULL;
+  memset (self, 0, sizeof (Catalog));
+  self->pattern = strdup (pattern);
+  if (pack_pattern) self->pack_pattern = strdup (pack_pattern);
+  self->pending = list_create (free);
+  list_prepend (self->pending, strdup (root));
+  self->progress.dirs_pending = 1;
+  return self;
+  }
+
+/* =======================================================================
+   catalog_destroy
+ ======================================================================= */
+void catalog_destroy (Catalog *self)
+  {
+  if (self->scanning) f_closedir (&self->dir);
+  if (self->packing) f_close (&self->fp);
+  list_destroy (self->pending);
+  for (unsigned int i = 0; i < self->ndirs; i++)
+    free (self->dirs[i]);
+  free (self->dirs);
+  free (self->photos);
+  free (self->hashes);
+  free (self->formats);
+#if JPEG_PREVIEW
+  free (self->thumbs);
+#endif
+  free (self->packs);
+  free (self->pack_pattern);
+  free (self->pattern);
+  free (self);
+  }
+
+/* =======================================================================
+   catalog_step
+ ======================================================================= */
+bool catalog_step (Catalog *self, uint32_t budget_us)
+  {
+  if (self->progress.done) return false;
+  uint64_t start = time_us_64 ();
+  char path[CATALOG_MAX_PATH];
+  FILINFO fi;
+  uint32_t format, thumb;
+  do
+    {
+    if (self->packing)
+      {
+      catalog_read_pack (self);
+      continue;
+      }
+    if (!self->scanning && !catalog_open_next (self))
+      {
+      self->progress.done = true;
+      break;
+      }
+    DWORD pos = self->dir.dptr;
+    if (f_readdir (&self->dir, &fi) != FR_OK || fi.fname[0] == 0)
+      {
+      catalog_close (self);
+      continue;
+      }
+    if (!catalog_join (self->scanning, fi.fname, path))
+      {
+      self->progress.skipped++;
+      continue;
+      }
+    if (fi.fattrib & AM_DIR)
+      {
+      if (fi.fattrib & (AM_HID | AM_SYS)) continue;
+      char *dir = strdup (path);
+      if (!dir) continue;
+      list_prepend (self->pending, dir);
+      self->progress.dirs_pending++;
+      }
+    else if (self->pack_pattern 
+              && catalog_match (self->pack_pattern, fi.fname))
+      {
+      uint32_t location;
+      if (!catalog_location (self, pos, &location))
+        self->progress.skipped++;
+      else if (!catalog_open_pack (self, path, location, fi.fname))
+        self->progress.unsupported++;
+      }
+    else if (catalog_match (self->pattern, fi.fname))
+      {
+      uint32_t location;
+      if (!catalog_location (self, pos, &location))
+        self->progress.skipped++;
+      else if (catalog_check (self, path, &format, &thumb))
+        catalog_add (self, location, catalog_hash (fi.fname), format, 
+          thumb);
+      else
+        self->progress.unsupported++;
+      }
+    } while (time_us_64 () - start < budget_us);
+  self->progress.scan_us += time_us_64 () - start;
+  return !self->progress.done;
+  }
+
+/* =======================================================================
+   catalog_count
+ ======================================================================= */
+unsigned int catalog_count (const Catalog *self)
+  {
+  return self->progress.photos;
+  }
+
+/* =======================================================================
+   catalog_is_entry
+   Check that a directory entry is the file with the given hash, that
+     matches pattern
+ ======================================================================= */
+static bool catalog_is_entry (const FILINFO *fi, uint16_t hash, 
+        const char *pattern)
+  {
+  return fi->fname[0] && !(fi->fattrib & AM_DIR) 
+    && catalog_hash (fi->fname) == hash 
+    && catalog_match (pattern, fi->fname);
+  }
+
+/* =======================================================================
+   catalog_find
+   Find the path of the file at location, with the given hash, that 
+     matches pattern. If it's not where it was, the directory is 
+     searched for it, and location is updated to where it was found.
+ ======================================================================= */
+static int catalog_find (Catalog *self, uint32_t *location, uint16_t hash,
+        const char *pattern, char *path, size_t len)
+  {
+  const char *dir_path = self->dirs[*location >> 16];
+  DWORD pos = (*location & 0xFFFF) * CATALOG_ENTRY_SIZE;
+  DIR dir;
+  FILINFO fi;
+  if (f_opendir (&dir, dir_path) != FR_OK) return ENOENT;
+  bool found = f_seekdir (&dir, pos) == FR_OK 
+    && f_readdir (&dir, &fi) == FR_OK && catalog_is_entry (&fi, hash, pattern);
+  if (!found)
+    {
+    self->progress.searches++;
+    f_rewinddir (&dir);
+    while (!found)
+      {
+      pos = dir.dptr;
+      if (f_readdir (&dir, &fi) != FR_OK || !fi.fname[0]) break;
+      found = catalog_is_entry (&fi, hash, pattern);
+      }
+    if (found && pos / CATALOG_ENTRY_SIZE < CATALOG_MAX_ENTRIES)
+      *location = (*location & 0xFFFF0000) | pos / CATALOG_ENTRY_SIZE;
+    }
+  f_closedir (&dir);
+  if (!found) return ENOENT;
+  char full[CATALOG_MAX_PATH];
+  if (!catalog_join (dir_path, fi.fname, full) || strlen (full) >= len) 
+    return ENAMETOOLONG;
+  strcpy (path, full);
+  return 0;
+  }
+
+/* =======================================================================
+   catalog_find_pack
+   The pack that photo n is in
+ ======================================================================= */
+static CatalogPack *catalog_find_pack (const Catalog *self, 
+        unsigned int n)
+  {
+  for (unsigned int i = self->npacks; i > 0; i--)
+    if (self->packs[i - 1].first <= n) return &self->packs[i - 1];
+  return NULL;
+  }
+
+/* =======================================================================
+   catalog_read_extent
+   Read where photo k is in the pack at path from the pack's index
+ ======================================================================= */
+static int catalog_read_extent (const char *path, uint32_t k, 
+        CatalogExtent *extent)
+  {
+  FIL fp;
+  if (f_open (&fp, path, FA_READ) != FR_OK) return ENOENT;
+  uint8_t buf[PACK_ENTRY_SIZE];
+  UINT br = 0;
+  FRESULT fr = f_lseek (&fp, PACK_HEADER_SIZE + k * PACK_ENTRY_SIZE);
+  if (fr == FR_OK) fr = f_read (&fp, buf, sizeof (buf), &br);
+  f_close (&fp);
+  if (fr != FR_OK || br != sizeof (buf)) return EIO;
+  PackEntry entry;
+  pack_decode_entry (buf, &entry);
+  extent->offset = entry.offset;
+  extent->size = entry.size;
+  return 0;
+  }
+
+/* =======================================================================
+   catalog_get_photo
+ ======================================================================= */
+int catalog_get_photo (Catalog *self, unsigned int n, char *path,
+      size_t len, CatalogExtent *extent)
+  {
+  if (n >= self->progress.photos) return ENOENT;
+  uint64_t start = time_us_64 ();
+  uint32_t location = self->photos[n];
+  int ret;
+  if (location >> 16 == CATALOG_PACKED)
+    {
+    CatalogPack *pack = catalog_find_pack (self, n);
+    ret = catalog_find (self, &pack->location, pack->hash, 
+      self->pack_pattern, path, len);
+    if (ret == 0 && extent)
+      ret = catalog_read_extent (path, location & 0xFFFF, extent);
+    }
+  else
+    {
+    ret = catalog_find (self, &self->photos[n], self->hashes[n], 
+      self->pattern, path, len);
+    if (extent)
+      {
+      extent->offset = 0;
+      extent->size = 0;
+      }
+    }
+  framestats_add (&self->progress.lookups, 
+    (uint32_t)(time_us_64 () - start));
+  return ret;
+  }
+
+/* =======================================================================
+   catalog_get_path
+ ======================================================================= */
+int catalog_get_path (Catalog *self, unsigned int n, char *path,
+      size_t len)
+  {
+  return catalog_get_photo (self, n, path, len, NULL);
+  }
+
+/* =======================================================================
+   catalog_get_info
+ ======================================================================= */
+int catalog_get_info (const Catalog *self, unsigned int n, 
+      CatalogInfo *info)
+  {
+  if (n >= self->progress.photos) return ENOENT;
+  memset (info, 0, sizeof (CatalogInfo));
+  uint32_t format = self->formats[n];
+  const uint32_t size_mask = (1u << CATALOG_SIZE_BITS) - 1;
+  info->width = (format & size_mask) * 8;
+  info->height = (format >> CATALOG_SIZE_BITS & size_mask) * 8;
+  info->sampling = (uint8_t)(format >> CATALOG_SAMPLING_SHIFT & 7);
+  uint32_t restart = format >> CATALOG_RESTART_SHIFT & 15;
+  info->restart_interval = restart ? 1u << (restart - 1) : 0;
+  info->progressive = (format & CATALOG_PROGRESSIVE_BIT) != 0;
+#if JPEG_PREVIEW
+  uint32_t thumb = self->thumbs[n];
+  info->thumb_offset = thumb >> CATALOG_THUMB_LEN_BITS;
+  info->thumb_len = thumb & ((1u << CATALOG_THUMB_LEN_BITS) - 1);
+#endif
+  return 0;
+  }
+
+/* =======================================================================
+   catalog_get_progress
+ ======================================================================= */
+void catalog_get_progress (const Catalog *self, CatalogProgress *progress)
+  {
+  *progress = self->progress;
+  }
+
+/* =======================================================================
+   catalog_get_scanning
+ ======================================================================= */
+const char *catalog_get_scanning (const Catalog *self)
+  {
+  return self->scanning;
+  }
+
@@ -13,19 +13,55 @@
 #include <stdlib.h>
 #include <fcntl.h>
 #include <errno.h>
+#include <limits.h>
 #include <pico/stdlib.h>
 #include <files/files.h>
+#include <files/jpeghdr.h>
+#include <files/framecache.h>
+#include <files/flashcache.h>
+#include <fsintf/diskcache.h>
+#include <fsintf/diskasync.h>
 #include <ff.h>
 #include <klib/list.h>
 #include <gfx/gfxconsole.h>
 #include <gfx/picojpeg.h>
+#include <gfx/framestats.h>
 #include <log/log.h>
 #include <waveshare_lcd/waveshare_lcd.h>
+#include "config.h"
 
 #define BLACK 0
 
 FATFS fatfs;
 
+// Photos opened that turned out to be in one piece, and in more
+static unsigned int files_contiguous;
+static unsigned int files_fragmented;
+// The last photo counted, by its file's first cluster and its offset
+//   in the file
+static DWORD files_counted_cluster;
+static uint32_t files_counted_offset;
+
+// If set, the decoder reads FatFs's sector buffer, or the prefetched
+//   data, where it is, rather than having it copied to its own buffer
+static bool files_zero_copy = JPEG_ZERO_COPY;
+
+// Time taken to decode and draw whole photos, from the card and from
+//   memory
+static FrameStats files_decode_card;
+static FrameStats files_decode_mem;
+
+// If set, a photo's EXIF thumbnail, if we're told where it is, is 
+//   scaled up and drawn before the photo is decoded
+static bool files_preview = JPEG_PREVIEW;
+
+// Time from opening a photo to its thumbnail being on the display
+static FrameStats files_preview_stats;
+
+// The data handed over by f_forward; see files_pjpeg_forward
+static const BYTE *files_forward_data;
+static UINT files_forward_len;
+
 /*============================================================================
  * files_fresult_to_errno
  * Convert a FATFS error into a Linux errno, so we can display it using
@@ -71,6 +107,57 @@ int files_fresult_to_errno (FRESULT err)
   return EIO;
   }
 
+/* =======================================================================
+   files_count_layout
+   Count a photo as contiguous or fragmented. A photo is often opened 
+     twice in a row -- once to read it ahead, and again to draw it if the
+     read-ahead didn't finish -- but is only counted the first time.
+ ======================================================================= */
+static void files_count_layout (const FIL *fp, uint32_t offset, 
+        bool contiguous)
+  {
+  if (fp->obj.sclust == files_counted_cluster 
+      && offset == files_counted_offset) 
+    return;
+  files_counted_cluster = fp->obj.sclust;
+  files_counted_offset = offset;
+  if (contiguous)
+    files_contiguous++;
+  else
+    files_fragmented++;
+  }
+
+/* =======================================================================
+   files_map_clusters
+   Give an open file a cluster map, which must last as long as the file
+     is open. If the file is in one piece, return its first sector; 
+     otherwise, or if it has more fragments than the map can hold,
+     return 0, and FatFs will read it in the usual way. offset is
+     the position of the photo in the file, which is only used to tell
+     photos in a pack apart in the statistics.
+ ======================================================================= */
+static LBA_t files_map_clusters (FIL *fp, DWORD *clmt, uint32_t offset)
+  {
+  fp->cltbl = clmt;
+  clmt[0] = FILES_CLMT_ITEMS;
+  if (f_lseek (fp, CREATE_LINKMAP) != FR_OK)
+    {
+    fp->cltbl = NULL;
+    files_count_layout (fp, offset, false);
+    return 0;
+    }
+  // The map is its own size, then a length and start cluster for 
+  //   each fragment, then a zero. An empty file has no fragments.
+  if (clmt[0] < 4) return 0;
+  if (clmt[0] > 4)
+    {
+    files_count_layout (fp, offset, false);
+    return 0;
+    }
+  files_count_layout (fp, offset, true);
+  return fatfs.database + (LBA_t)fatfs.csize * (clmt[2] - 2);
+  }
+
 /* =======================================================================
    files_pjpeg_callback
    Called by the JPEG decompressor when it wants more deta.
@@ -86,6 +173,163 @@ static unsigned char files_pjpeg_callback (unsigned char *buf,
   return 0;
   }
 
+/* =======================================================================
+   files_forward_func
+   Called by f_forward with a pointer into the file's sector buffer. It
+     takes one piece at a time: if it took more, FatFs would read the
+     next sector over the one we have not decoded yet.
+ ======================================================================= */
+static UINT files_forward_func (const BYTE *p, UINT btf)
+  {
+  if (btf == 0) return files_forward_len == 0; // Ready for more?
+  files_forward_data = p;
+  files_forward_len = btf;
+  return btf;
+  }
+
+/* =======================================================================
+   files_pjpeg_forward
+   As files_pjpeg_callback, but the decoder reads the rest of the 
+     current sector where it is, in the FIL's own buffer. The buffer
+     isn't touched until the decoder asks for more.
+ ======================================================================= */
+static unsigned char files_pjpeg_forward (const unsigned char **buf, 
+        unsigned short *bytes_available, void *data)
+  {
+  FIL *fp = (FIL *)data;
+  UINT bf;
+  files_forward_len = 0;
+  f_forward (fp, files_forward_func, 512, &bf);
+  *buf = files_forward_data;
+  *bytes_available = (unsigned short)files_forward_len;
+  return 0;
+  }
+
+/* =======================================================================
+   FilesPart
+   A JPEG that starts at base in an open file -- a pack, perhaps
+ ======================================================================= */
+typedef struct _FilesPart
+  {
+  FIL *fp;
+  uint32_t base;
+  } FilesPart;
+
+/* =======================================================================
+   files_jpeghdr_read
+   Positional read callback for the JPEG header parser.
+ ======================================================================= */
+static uint32_t files_jpeghdr_read (void *data, uint32_t offset, 
+        uint8_t *buf, uint32_t len)
+  {
+  const FilesPart *part = (const FilesPart *)data;
+  UINT br = 0;
+  // The parser mostly reads straight on from where it left off, so
+  //   only seek when it skips a segment
+  FSIZE_t pos = part->base + offset;
+  if (f_tell (part->fp) != pos && f_lseek (part->fp, pos) != FR_OK) 
+    return 0;
+  if (f_read (part->fp, buf, len, &br) != FR_OK) return 0;
+  return br;
+  }
+
+/* =======================================================================
+   FilesMemSource 
+   A JPEG that has already been read into memory
+ ======================================================================= */
+typedef struct _FilesMemSource
+  {
+  const uint8_t *data;
+  uint32_t len;
+  uint32_t pos;
+  } FilesMemSource;
+
+/* =======================================================================
+   files_pjpeg_mem_callback
+   As files_pjpeg_callback, but for a file in memory
+ ======================================================================= */
+static unsigned char files_pjpeg_mem_callback (unsigned char *buf, 
+        unsigned char buf_size, unsigned char *bytes_actually_read, 
+        void *data)
+  {
+  FilesMemSource *mem = (FilesMemSource *)data;
+  uint32_t n = mem->len - mem->pos;
+  if (n > buf_size) n = buf_size;
+  memcpy (buf, mem->data + mem->pos, n);
+  mem->pos += n;
+  *bytes_actually_read = (unsigned char)n;
+  return 0;
+  }
+
+/* =======================================================================
+   files_pjpeg_mem_ptr
+   As files_pjpeg_mem_callback, but the decoder reads the data where
+     it is
+ ======================================================================= */
+static unsigned char files_pjpeg_mem_ptr (const unsigned char **buf, 
+        unsigned short *bytes_available, void *data)
+  {
+  FilesMemSource *mem = (FilesMemSource *)data;
+  uint32_t n = mem->len - mem->pos;
+  if (n > USHRT_MAX) n = USHRT_MAX;
+  *buf = mem->data + mem->pos;
+  mem->pos += n;
+  *bytes_available = (unsigned short)n;
+  return 0;
+  }
+
+/* =======================================================================
+   files_jpeghdr_mem_read
+ ======================================================================= */
+static uint32_t files_jpeghdr_mem_read (void *data, uint32_t offset, 
+        uint8_t *buf, uint32_t len)
+  {
+  const FilesMemSource *mem = (const FilesMemSource *)data;
+  if (offset >= mem->len) return 0;
+  if (len > mem->len - offset) len = mem->len - offset;
+  memcpy (buf, mem->data + offset, len);
+  return len;
+  }
+
+/* =======================================================================
+   files_choose_rotation
+   Work out how to rotate the panel to show an image of the given
+     size and EXIF orientation. The orientation is respected if the 
+     image will fit the screen that way. If it only fits on its side
+     -- a 320x480 portrait, for example -- it gets the additional quarter
+     turn specified by PORTRAIT_ROTATION in config.h.
+ ======================================================================= */
+static WSLCDRotation files_choose_rotation (const WSLCD *wslcd, 
+         const JpegHeader *hdr)
+  {
+  WSLCDRotation rot;
+  switch (hdr->orientation)
+    {
+    case 3: rot = WSLCD_ROTATE_180; break;
+    case 6: rot = WSLCD_ROTATE_90; break;
+    case 8: rot = WSLCD_ROTATE_270; break;
+    default: rot = WSLCD_ROTATE_0;
+    }
+
+  // Width and height of the display as it is now, unrotated
+  unsigned int w = (unsigned int)wslcd_get_width (wslcd);
+  unsigned int h = (unsigned int)wslcd_get_height (wslcd);
+  if (wslcd_get_rotation (wslcd) & 1)
+    {
+    unsigned int t = w; w = h; h = t;
+    }
+
+  bool fits_flat = hdr->width <= w && hdr->height <= h;
+  bool fits_side = hdr->width <= h && hdr->height <= w;
+  bool rot_is_side = (rot & 1) != 0;
+
+  if ((rot_is_side ? fits_side : fits_flat) || PORTRAIT_ROTATION == 0)
+    return rot;
+  if (rot_is_side ? fits_flat : fits_side)
+    return (WSLCDRotation)((rot + PORTRAIT_ROTATION) & 3);
+  return rot; // Doesn't fit either way -- it will be cropped
+  }
+
 /*=========================================================================
   rgb888_to_rgb565
 =========================================================================*/
@@ -96,135 +340,963 @@ static inline uint16_t files_rgb888_to_rgb565 (uint8_t r,
   }
 
 /* =======================================================================
-   files_show_jpeg
-   Draw a JPEG file with the specified path on the LCD display. The
-     gfxconsole argument is used only for error messages, which will
-     only be visible if the JPEG decompression fails.
+   Opaque struct for a JPEG rendering job
  ======================================================================= */
-void files_show_jpeg (GfxConsole *console, WSLCD *wslcd, const char *path)
+struct _JpegJob
   {
+  GfxConsole *console;
+  WSLCD *wslcd;
+  bool from_mem; // If true, read from mem, rather than fp
   FIL fp;
-  FRESULT fr = f_open (&fp, path, FA_READ);
-  if (fr == 0)
+  DWORD clmt[FILES_CLMT_ITEMS];
+  FilesMemSource mem;
+  WSLCDRotation rotation;
+  pjpeg_image_info_t image_info;
+  int decoded_width;
+  int decoded_height;
+  int block_width;
+  int block_height;
+  int display_width; // As rotated for this image
+  int display_height;
+  int xoffset;
+  int yoffset;
+  int mcu_x;
+  int mcu_y;
+  uint16_t *block;
+  bool done;
+  bool failed; // The decoder stopped before the end
+  // Frame cache
+  FrameCache *cache; // If set, writing to, or reading from, cache_fp
+  bool replay; // Drawing a cached frame, rather than decoding
+  FIL cache_fp;
+  uint16_t *strip; // Rows of the whole display
+  int strip_rows;
+  int rows_out; // Rows written to, or read from, the cache
+  uint32_t decode_us; // Time spent in steps so far
+  uint32_t base; // Where the JPEG starts in fp
+  uint32_t thumb_offset; // EXIF thumbnail, if there is one to preview
+  uint32_t thumb_len;
+  };
+
+/* =======================================================================
+   files_thumb_to_image
+   The first pixel of the image, along one axis, that is drawn from 
+     thumbnail pixel t or after, when the thumbnail's content starts at 
+     c and is n pixels long, and the image is len pixels long
+ ======================================================================= */
+static int files_thumb_to_image (int t, int c, int n, int len)
+  {
+  if (t <= c) return 0;
+  int i = ((t - c) * len + n - 1) / n;
+  return i > len ? len : i;
+  }
+
+/* =======================================================================
+   files_jpeg_preview
+   Decode the photo's EXIF thumbnail, and draw it scaled up to cover the
+     part of the display that the photo will. Thumbnails are often 
+     160x120, with black bars if the photo isn't 4:3; only the part 
+     with the photo's shape is used. The scaling is nearest-neighbour,
+     which is crude, but the photo is drawn over it straight away. The
+     display must already be rotated for the photo.
+ ======================================================================= */
+static void files_jpeg_preview (JpegJob *self, const JpegHeader *hdr)
+  {
+  pjpeg_image_info_t info;
+  FilesMemSource thumb;
+  unsigned char r;
+  if (self->from_mem)
+    {
+    if (self->thumb_offset > self->mem.len 
+        || self->thumb_len > self->mem.len - self->thumb_offset)
+      return;
+    thumb.data = self->mem.data + self->thumb_offset;
+    thumb.len = self->thumb_len;
+    thumb.pos = 0;
+    r = pjpeg_decode_init (&info, files_pjpeg_mem_callback, &thumb, 0);
+    }
+  else
     {
-    pjpeg_image_info_t image_info;
-    unsigned char r = pjpeg_decode_init (&image_info,
-                        files_pjpeg_callback, &fp, 0); 
+    if (f_lseek (&self->fp, self->base + self->thumb_offset) != FR_OK) 
+      return;
+    r = pjpeg_decode_init (&info, files_pjpeg_callback, &self->fp, 0);
+    }
+  if (r != 0) return;
 
-    if (r == 0)
+  // The photo, as it will be drawn, and the part of the thumbnail that
+  //   shows it
+  int w = (int)hdr->width;
+  int h = (int)hdr->height;
+  int dw = wslcd_get_width (self->wslcd);
+  int dh = wslcd_get_height (self->wslcd);
+  int xoffset = (dw - w) / 2;
+  int yoffset = (dh - h) / 2;
+  int tw = info.m_width;
+  int th = info.m_height;
+  int cw = tw, ch = th;
+  if (w * th > h * tw)
+    ch = tw * h / w;
+  else
+    cw = th * w / h;
+  if (cw == 0 || ch == 0) return;
+  int cx = (tw - cw) / 2;
+  int cy = (th - ch) / 2;
+
+  // Rows of scaled-up pixels are collected here, and written to the 
+  //   display together
+  int buf_size = dw * 8;
+  uint16_t *buf = malloc ((size_t)buf_size * sizeof (uint16_t));
+  if (!buf) return;
+
+  for (int mcu_y = 0; mcu_y < info.m_MCUSPerCol; mcu_y++)
+    for (int mcu_x = 0; mcu_x < info.m_MCUSPerRow; mcu_x++)
+    {
+    if (pjpeg_decode_mcu () != 0) goto done;
+    for (int y = 0; y < info.m_MCUHeight; y += 8)
+      for (int x = 0; x < info.m_MCUWidth; x += 8)
       {
-      int decoded_width = image_info.m_width;
-      int decoded_height = image_info.m_height;
-      int block_width = image_info.m_MCUWidth;
-      int block_height = image_info.m_MCUHeight;
-      int display_width = wslcd_get_width (wslcd);
-      int display_height = wslcd_get_height (wslcd);
-      int xoffset = (display_width - decoded_width) / 2;
-      int yoffset = (display_height - decoded_height) / 2;
-
-      //printf ("y offset = %d\n", yoffset);
-
-      if (yoffset > 0)
+      int sx = mcu_x * info.m_MCUWidth + x;
+      int sy = mcu_y * info.m_MCUHeight + y;
+      int sw = tw - sx < 8 ? tw - sx : 8;
+      int sh = th - sy < 8 ? th - sy : 8;
+      if (sw <= 0 || sh <= 0) continue;
+      // The display pixels drawn from this block
+      int x0 = xoffset + files_thumb_to_image (sx, cx, cw, w);
+      int x1 = xoffset + files_thumb_to_image (sx + sw, cx, cw, w);
+      int y0 = yoffset + files_thumb_to_image (sy, cy, ch, h);
+      int y1 = yoffset + files_thumb_to_image (sy + sh, cy, ch, h);
+      if (x0 < 0) x0 = 0;
+      if (y0 < 0) y0 = 0;
+      if (x1 > dw) x1 = dw;
+      if (y1 > dh) y1 = dh;
+      int n = x1 - x0;
+      if (n <= 0 || y1 <= y0) continue;
+      int src_ofs = (x * 8) + (y * 16);
+      const uint8_t *pr = info.m_pMCUBufR + src_ofs;
+      const uint8_t *pg = info.m_pMCUBufG + src_ofs;
+      const uint8_t *pb = info.m_pMCUBufB + src_ofs;
+      int rows_per_write = buf_size / n;
+      int row = y0;
+      while (row < y1)
         {
-        wslcd_fill_area (wslcd, 0, 0, (uint16_t)display_width, 
-          (uint16_t)yoffset, BLACK);
-        wslcd_fill_area (wslcd, 0, (uint16_t)(display_height - yoffset), 
-           (uint16_t)display_width, (uint16_t)display_height, BLACK);
+        int rows = y1 - row < rows_per_write ? y1 - row : rows_per_write;
+        uint16_t *p = buf;
+        for (int yy = row; yy < row + rows; yy++)
+          {
+          int by = cy + (yy - yoffset) * ch / h - sy;
+          if (by < 0) by = 0; else if (by > sh - 1) by = sh - 1;
+          for (int xx = x0; xx < x1; xx++)
+            {
+            int bx = cx + (xx - xoffset) * cw / w - sx;
+            if (bx < 0) bx = 0; else if (bx > sw - 1) bx = sw - 1;
+            int i = by * 8 + bx;
+            *p++ = files_rgb888_to_rgb565 (pr[i], pg[i], pb[i]);
+            }
+          }
+        wslcd_write_window (self->wslcd, buf, (uint16_t)n, (uint16_t)rows,
+          (uint16_t)x0, (uint16_t)row);
+        row += rows;
         }
+      }
+    }
+done:
+  free (buf);
+  }
+
+/* =======================================================================
+   files_jpeg_start
+   Start decoding, from whichever source the job has. Returns false, 
+     having written a message to the console, if the decoder can't 
+     handle the file.
+ ======================================================================= */
+static bool files_jpeg_start (JpegJob *self)
+  {
+  GfxConsole *console = self->console;
+  WSLCD *wslcd = self->wslcd;
+  uint64_t start = time_us_64();
+
+  // Rotation is done by the panel, so it costs nothing at decode
+  //   time. We have to parse the header ourselves, to get the EXIF 
+  //   orientation, and then rewind for the decoder.
+  JpegHeader hdr;
+  FilesPart part = { &self->fp, self->base };
+  self->rotation = WSLCD_ROTATE_0;
+  int hdr_err = self->from_mem 
+    ? jpeghdr_parse (files_jpeghdr_mem_read, &self->mem, &hdr)
+    : jpeghdr_parse (files_jpeghdr_read, &part, &hdr);
+  if (hdr_err == 0)
+    {
+    const char *why = jpeghdr_unsupported (&hdr);
+    if (why)
+      {
+      log_write (console, "Can't show JPEG: %s\n", why);
+      return false;
+      }
+    self->rotation = files_choose_rotation (wslcd, &hdr);
+    // The thumbnail is decoded to completion before the photo's 
+    //   decoding starts, since the decoder can only do one at a time
+    if (files_preview && self->thumb_len)
+      {
+      wslcd_set_rotation (wslcd, self->rotation);
+      files_jpeg_preview (self, &hdr);
+      wslcd_set_rotation (wslcd, WSLCD_ROTATE_0);
+      framestats_add (&files_preview_stats, 
+        (uint32_t)(time_us_64() - start));
+      }
+    }
+
+  unsigned char r;
+  if (self->from_mem)
+    {
+    self->mem.pos = 0;
+    if (files_zero_copy)
+      r = pjpeg_decode_init_ptr (&self->image_info,
+                      files_pjpeg_mem_ptr, &self->mem, 0); 
+    else
+      r = pjpeg_decode_init (&self->image_info,
+                      files_pjpeg_mem_callback, &self->mem, 0); 
+    }
+  else
+    {
+    f_lseek (&self->fp, self->base);
+    if (files_zero_copy)
+      r = pjpeg_decode_init_ptr (&self->image_info,
+                      files_pjpeg_forward, &self->fp, 0); 
+    else
+      r = pjpeg_decode_init (&self->image_info,
+                      files_pjpeg_callback, &self->fp, 0); 
+    }
+  if (r != 0)
+    {
+    if (r == PJPG_UNSUPPORTED_MODE)
+      log_write (console, "Progressive JPEGs not supported\n");
+    else
+      log_write (console, "Bad JPEG, error %d\n", r);
+    return false;
+    }
+
+  wslcd_set_rotation (wslcd, self->rotation);
+
+  self->decoded_width = self->image_info.m_width;
+  self->decoded_height = self->image_info.m_height;
+  self->block_width = self->image_info.m_MCUWidth;
+  self->block_height = self->image_info.m_MCUHeight;
+  self->display_width = wslcd_get_width (wslcd);
+  self->display_height = wslcd_get_height (wslcd);
+  self->xoffset = (self->display_width - self->decoded_width) / 2;
+  self->yoffset = (self->display_height - self->decoded_height) / 2;
+  int display_width = self->display_width;
+  int display_height = self->display_height;
+  int xoffset = self->xoffset;
+  int yoffset = self->yoffset;
+
+  //printf ("y offset = %d\n", yoffset);
+
+  if (yoffset > 0)
+    {
+    wslcd_fill_area (wslcd, 0, 0, (uint16_t)display_width, 
+      (uint16_t)yoffset, BLACK);
+    wslcd_fill_area (wslcd, 0, (uint16_t)(display_height - yoffset), 
+       (uint16_t)display_width, (uint16_t)display_height, BLACK);
+    }
+
+  if (xoffset > 0)
+    {
+    wslcd_fill_area (wslcd, 0, 0, (uint16_t)xoffset, 
+      (uint16_t)display_height, BLACK);
+    wslcd_fill_area (wslcd, (uint16_t)(display_width - xoffset - 1), 0, 
+       (uint16_t)display_width, (uint16_t)display_height, BLACK);
+    }
+
+  wslcd_set_rotation (wslcd, WSLCD_ROTATE_0);
+
+  self->block = malloc ((size_t)(self->block_width * self->block_height) 
+    * sizeof (uint16_t));
+  if (!self->block) self->done = true;
+  return true;
+  }
+
+/* =======================================================================
+   files_jpeg_new
+ ======================================================================= */
+static JpegJob *files_jpeg_new (GfxConsole *console, WSLCD *wslcd)
+  {
+  JpegJob *self = malloc (sizeof (JpegJob));
+  if (!self)
+    {
+    log_write (console, "Out of memory\n");
+    return NULL;
+    }
+  memset (self, 0, sizeof (JpegJob));
+  self->console = console;
+  self->wslcd = wslcd;
+  return self;
+  }
+
+/* =======================================================================
+   files_jpeg_open
+ ======================================================================= */
+JpegJob *files_jpeg_open (GfxConsole *console, WSLCD *wslcd, 
+           const char *path)
+  {
+  return files_jpeg_open_preview (console, wslcd, path, 0, 0);
+  }
+
+/* =======================================================================
+   files_jpeg_open_preview
+ ======================================================================= */
+JpegJob *files_jpeg_open_preview (GfxConsole *console, WSLCD *wslcd, 
+           const char *path, uint32_t thumb_offset, uint32_t thumb_len)
+  {
+  return files_jpeg_open_part (console, wslcd, path, 0, thumb_offset,
+    thumb_len);
+  }
+
+/* =======================================================================
+   files_jpeg_open_part
+ ======================================================================= */
+JpegJob *files_jpeg_open_part (GfxConsole *console, WSLCD *wslcd, 
+           const char *path, uint32_t offset, uint32_t thumb_offset, 
+           uint32_t thumb_len)
+  {
+  JpegJob *self = files_jpeg_new (console, wslcd);
+  if (!self) return NULL;
+  self->base = offset;
+  self->thumb_offset = thumb_offset;
+  self->thumb_len = thumb_len;
+
+  FRESULT fr = f_open (&self->fp, path, FA_READ);
+  if (fr != 0)
+    {
+    log_write (console, "Can't open: %s\n", path);
+    free (self);
+    return NULL;
+    }
+  // The decoder reads a little at a time, through FatFs, but the map
+  //   saves a trip to the FAT at each cluster boundary, and when the
+  //   header parser seeks.
+  files_map_clusters (&self->fp, self->clmt, offset);
+
+  if (!files_jpeg_start (self))
+    {
+    f_close (&self->fp);
+    free (self);
+    return NULL;
+    }
+  return self;
+  }
+
+/* =======================================================================
+   files_jpeg_open_mem
+ ======================================================================= */
+JpegJob *files_jpeg_open_mem (GfxConsole *console, WSLCD *wslcd, 
+           const uint8_t *data, uint32_t len)
+  {
+  return files_jpeg_open_mem_preview (console, wslcd, data, len, 0, 0);
+  }
+
+/* =======================================================================
+   files_jpeg_open_mem_preview
+ ======================================================================= */
+JpegJob *files_jpeg_open_mem_preview (GfxConsole *console, WSLCD *wslcd, 
+           const uint8_t *data, uint32_t len, uint32_t thumb_offset,
+           uint32_t thumb_len)
+  {
+  JpegJob *self = files_jpeg_new (console, wslcd);
+  if (!self) return NULL;
+  self->thumb_offset = thumb_offset;
+  self->thumb_len = thumb_len;
+
+  self->from_mem = true;
+  self->mem.data = data;
+  self->mem.len = len;
+  if (!files_jpeg_start (self))
+    {
+    free (self);
+    return NULL;
+    }
+  return self;
+  }
+
+/* =======================================================================
+   files_jpeg_draw_mcu
+   Draw the MCU that picojpeg has just decoded, in 8x8 blocks
+ ======================================================================= */
+static void files_jpeg_draw_mcu (JpegJob *self)
+  {
+  const pjpeg_image_info_t *info = &self->image_info;
+  int block_width = self->block_width;
+  int block_height = self->block_height;
+  int mcu_x = self->mcu_x;
+  int mcu_y = self->mcu_y;
+  uint16_t *block = self->block;
+
+  int target_x = mcu_x * block_width + self->xoffset;
+  int target_y = mcu_y * block_height + self->yoffset;
+
+  for (int y = 0; y < block_height; y += 8)
+    {
+    int by_limit = self->decoded_height - (mcu_y * block_height + y);
+    if (by_limit > 8) by_limit = 8;
+
+    for (int x = 0; x < block_width; x += 8)
+      {
+      int bx_limit = self->decoded_width - (mcu_x * block_width + x);
+      if (bx_limit > 8) bx_limit = 8;
 
-      if (xoffset > 0)
+      int src_ofs = (x * 8) + (y * 16);
+      uint8_t *pSrcR = info->m_pMCUBufR + src_ofs;
+      uint8_t *pSrcG = info->m_pMCUBufG + src_ofs;
+      uint8_t *pSrcB = info->m_pMCUBufB + src_ofs;
+
+      int bc = 0;
+      for (int by = 0; by < by_limit; by++)
         {
-        wslcd_fill_area (wslcd, 0, 0, (uint16_t)xoffset, 
-          (uint16_t)display_height, BLACK);
-        wslcd_fill_area (wslcd, (uint16_t)(display_width - xoffset - 1), 0, 
-           (uint16_t)display_width, (uint16_t)display_height, BLACK);
+        for (int bx = 0; bx < bx_limit; bx++)
+           {
+           uint8_t r = *pSrcR++;
+           uint8_t g = *pSrcG++;
+           uint8_t b = *pSrcB++;
+           block [bc] = files_rgb888_to_rgb565 (r, g, b); 
+           bc++; 
+           }
+
+        pSrcR += (8 - bx_limit);
+        pSrcG += (8 - bx_limit);
+        pSrcB += (8 - bx_limit);
         }
 
-      uint16_t *block = 
-        malloc ((size_t)(block_width * block_height) * sizeof (uint16_t));
-      
-      int mcu_x = 0, mcu_y = 0;
-      for (;;)
+      if (target_x + bx_limit < self->display_width &&
+            target_y + by_limit < self->display_height)
         {
-        unsigned char r = pjpeg_decode_mcu();
-        if (r)
+        wslcd_write_window (self->wslcd, block, (uint16_t)bx_limit, 
+            (uint16_t)by_limit, (uint16_t)target_x, (uint16_t)target_y);
+        if (self->strip && target_x >= 0)
           {
-          // TODO -- show error, if we haven't run out of data
-          break;
+          for (int by = 0; by < by_limit; by++)
+            memcpy (self->strip + (y + by) * self->display_width 
+              + target_x, block + by * bx_limit, 
+              (size_t)bx_limit * sizeof (uint16_t));
           }
-
-	int target_x = mcu_x * block_width + xoffset;
-	int target_y = mcu_y * block_height + yoffset;
-
-	for (int y = 0; y < block_height; y += 8)
-	  {
-	  int by_limit = decoded_height - (mcu_y * block_height + y);
-	  if (by_limit > 8) by_limit = 8;
-
-	  for (int x = 0; x < block_width; x += 8)
-	    {
-	    int bx_limit = decoded_width - (mcu_x * block_width + x);
-	    if (bx_limit > 8) bx_limit = 8;
-
-	    int src_ofs = (x * 8) + (y * 16);
-	    uint8_t *pSrcR = image_info.m_pMCUBufR + src_ofs;
-	    uint8_t *pSrcG = image_info.m_pMCUBufG + src_ofs;
-	    uint8_t *pSrcB = image_info.m_pMCUBufB + src_ofs;
-
-	    int bc = 0;
-	    for (int by = 0; by < by_limit; by++)
-	      {
-	      for (int bx = 0; bx < bx_limit; bx++)
-		 {
-		 uint8_t r = *pSrcR++;
-		 uint8_t g = *pSrcG++;
-		 uint8_t b = *pSrcB++;
-		 block [bc] = files_rgb888_to_rgb565 (r, g, b); 
-		 bc++; 
-		 }
-
-	      pSrcR += (8 - bx_limit);
-	      pSrcG += (8 - bx_limit);
-	      pSrcB += (8 - bx_limit);
-	      }
-
-	    if (target_x + bx_limit < display_width &&
-	          target_y + by_limit < display_height)
-              {
-              wslcd_write_window (wslcd, block, (uint16_t)bx_limit, 
-                  (uint16_t)by_limit, (uint16_t)target_x, (uint16_t)target_y);
-              }
-	    }
-	  }
-
-	mcu_x++;
-	if (mcu_x == image_info.m_MCUSPerRow)
-	  {
-	  mcu_x = 0;
-	  mcu_y++;
-	  }
         }
+      }
+    }
+  }
+
+/* =======================================================================
+   files_record_rows
+   Write n rows of the strip to the frame cache, or give up on the 
+     frame if that fails.
+ ======================================================================= */
+static void files_record_rows (JpegJob *self, int first, int n)
+  {
+  if (!self->cache || n <= 0) return;
+  UINT len = (UINT)(n * self->display_width) * sizeof (uint16_t);
+  UINT bw;
+  FRESULT fr = f_write (&self->cache_fp, 
+    self->strip + first * self->display_width, len, &bw);
+  if (fr != FR_OK || bw != len)
+    {
+    framecache_close_write (self->cache, &self->cache_fp, NULL, false);
+    self->cache = NULL;
+    }
+  else
+    self->rows_out += n;
+  }
+
+/* =======================================================================
+   files_record_black
+   Write n rows of border to the frame cache
+ ======================================================================= */
+static void files_record_black (JpegJob *self, int n)
+  {
+  memset (self->strip, 0, (size_t)(self->strip_rows * self->display_width) 
+    * sizeof (uint16_t));
+  while (n > 0 && self->cache)
+    {
+    int rows = n < self->strip_rows ? n : self->strip_rows;
+    files_record_rows (self, 0, rows);
+    n -= rows;
+    }
+  }
+
+/* =======================================================================
+   files_record_mcu_row
+   Write the rows of the MCU row that has just been drawn, that are on
+     the display, to the frame cache.
+ ======================================================================= */
+static void files_record_mcu_row (JpegJob *self)
+  {
+  if (!self->cache) return;
+  // The rows of the strip, in display coordinates
+  int top = self->mcu_y * self->block_height + self->yoffset;
+  int first = self->rows_out - top;
+  int last = self->block_height;
+  if (top + last > self->display_height) last = self->display_height - top;
+  files_record_rows (self, first, last - first);
+  memset (self->strip, 0, (size_t)(self->strip_rows * self->display_width) 
+    * sizeof (uint16_t));
+  }
 
-      free (block);
+/* =======================================================================
+   files_record_finish
+   Complete the cached frame, if the whole image was decoded, or discard 
+     it.
+ ======================================================================= */
+static void files_record_finish (JpegJob *self)
+  {
+  if (!self->cache) return;
+  if (self->done && !self->failed && self->rows_out < self->display_height)
+    files_record_black (self, self->display_height - self->rows_out);
+  if (!self->cache) return;
+  FrameInfo info;
+  info.width = (uint16_t)self->display_width;
+  info.height = (uint16_t)self->display_height;
+  info.rotation = (uint8_t)self->rotation;
+  framecache_close_write (self->cache, &self->cache_fp, &info, 
+    self->done && !self->failed 
+      && self->rows_out == self->display_height);
+  self->cache = NULL;
+  }
 
+/* =======================================================================
+   files_replay_step
+   Draw some more of a cached frame
+ ======================================================================= */
+static bool files_replay_step (JpegJob *self, unsigned int max_strips, 
+       uint32_t budget_us)
+  {
+  uint64_t start = time_us_64();
+  unsigned int strips = 0;
+  while (!self->done)
+    {
+    int n = self->display_height - self->rows_out;
+    if (n > self->strip_rows) n = self->strip_rows;
+    UINT len = (UINT)(n * self->display_width) * sizeof (uint16_t);
+    UINT br;
+    FRESULT fr = f_read (&self->cache_fp, self->strip, len, &br);
+    if (fr != FR_OK || br != len)
+      {
+      self->done = true;
+      break;
       }
-    else if (r == PJPG_UNSUPPORTED_MODE)
+    wslcd_write_window (self->wslcd, self->strip, 
+      (uint16_t)self->display_width, (uint16_t)n, 0, 
+      (uint16_t)self->rows_out);
+    self->rows_out += n;
+    if (self->rows_out >= self->display_height)
+      self->done = true;
+    strips++;
+    if (strips >= max_strips || time_us_64() - start >= budget_us)
+      break;
+    }
+  return !self->done;
+  }
+
+/* =======================================================================
+   files_jpeg_step
+ ======================================================================= */
+bool files_jpeg_step (JpegJob *self, unsigned int max_rows, 
+       uint32_t budget_us)
+  {
+  if (self->done) return false;
+
+  if (self->replay)
+    {
+    wslcd_set_rotation (self->wslcd, self->rotation);
+    bool more = files_replay_step (self, max_rows, budget_us);
+    wslcd_set_rotation (self->wslcd, WSLCD_ROTATE_0);
+    return more;
+    }
+
+  // Other things may draw on the display between slices, and they
+  //   expect it to be the right way up
+  wslcd_set_rotation (self->wslcd, self->rotation);
+  uint64_t start = time_us_64();
+  unsigned int rows = 0;
+  while (!self->done)
+    {
+    unsigned char r = pjpeg_decode_mcu();
+    if (r)
       {
-      log_write (console, "Progressive JPEGs not supported\n");
+      // TODO -- show error, if we haven't run out of data
+      if (r != PJPG_NO_MORE_BLOCKS) self->failed = true;
+      self->done = true;
+      break;
       }
-    else
+
+    files_jpeg_draw_mcu (self);
+
+    self->mcu_x++;
+    if (self->mcu_x == self->image_info.m_MCUSPerRow)
       {
-      log_write (console, "Bad JPEG, error %d\n", r);
+      files_record_mcu_row (self);
+      self->mcu_x = 0;
+      self->mcu_y++;
+      if (self->mcu_y == self->image_info.m_MCUSPerCol)
+        self->done = true;
+      rows++;
+      if (rows >= max_rows || time_us_64() - start >= budget_us)
+        break;
       }
+    }
+  wslcd_set_rotation (self->wslcd, WSLCD_ROTATE_0);
+  self->decode_us += (uint32_t)(time_us_64() - start);
+  if (self->done) 
+    {
+    files_record_finish (self);
+    if (!self->failed)
+      framestats_add (self->from_mem ? &files_decode_mem 
+        : &files_decode_card, self->decode_us);
+    }
+  return !self->done;
+  }
+
+/* =======================================================================
+   files_jpeg_open_cached
+ ======================================================================= */
+JpegJob *files_jpeg_open_cached (GfxConsole *console, WSLCD *wslcd, 
+           FrameCache *cache, const char *path, uint32_t offset)
+  {
+  FIL fp;
+  FrameInfo info;
+  if (framecache_open_read (cache, path, offset, &fp, &info) != 0) 
+    return NULL;
 
-    f_close (&fp);
+  JpegJob *self = files_jpeg_new (console, wslcd);
+  if (self)
+    {
+    self->replay = true;
+    self->cache_fp = fp;
+    self->rotation = (WSLCDRotation)(info.rotation & 3);
+    wslcd_set_rotation (wslcd, self->rotation);
+    self->display_width = wslcd_get_width (wslcd);
+    self->display_height = wslcd_get_height (wslcd);
+    wslcd_set_rotation (wslcd, WSLCD_ROTATE_0);
+    self->strip_rows = FRAME_CACHE_STRIP_ROWS;
+    self->strip = malloc ((size_t)(self->strip_rows * self->display_width) 
+      * sizeof (uint16_t));
+    // A frame for a different display is no use
+    if (self->strip && info.width == self->display_width 
+          && info.height == self->display_height)
+      return self;
+    free (self->strip);
+    free (self);
+    }
+  f_close (&fp);
+  return NULL;
+  }
+
+/* =======================================================================
+   files_jpeg_record
+ ======================================================================= */
+void files_jpeg_record (JpegJob *self, FrameCache *cache, const char *path,
+       uint32_t offset)
+  {
+  if (self->replay || self->cache || self->done 
+       || self->mcu_x || self->mcu_y) 
+    return;
+  self->strip_rows = self->block_height;
+  size_t size = (size_t)(self->strip_rows * self->display_width) 
+    * sizeof (uint16_t);
+  self->strip = malloc (size);
+  if (!self->strip) return;
+  if (framecache_open_write (cache, path, offset, &self->cache_fp) != 0)
+    {
+    free (self->strip);
+    self->strip = NULL;
+    return;
     }
+  self->cache = cache;
+  // The border above the image
+  if (self->yoffset > 0) files_record_black (self, self->yoffset);
+  memset (self->strip, 0, size);
+  }
+
+/* =======================================================================
+   files_jpeg_finish
+ ======================================================================= */
+void files_jpeg_finish (JpegJob *self)
+  {
+  if (self->replay)
+    f_close (&self->cache_fp);
   else
     {
-    log_write (console, "Can't open: %s\n", path);
+    files_record_finish (self);
+    if (!self->from_mem) f_close (&self->fp);
+    }
+  free (self->strip);
+  free (self->block);
+  free (self);
+  }
+
+/* =======================================================================
+   files_show_jpeg
+   Draw a JPEG file with the specified path on the LCD display. The
+     gfxconsole argument is used only for error messages, which will
+     only be visible if the JPEG decompression fails.
+ ======================================================================= */
+void files_show_jpeg (GfxConsole *console, WSLCD *wslcd, const char *path)
+  {
+  JpegJob *job = files_jpeg_open (console, wslcd, path);
+  if (job)
+    {
+    while (files_jpeg_step (job, UINT_MAX, UINT32_MAX))
+      ;
+    files_jpeg_finish (job);
     }
   }
 
+/* =======================================================================
+   Opaque struct for reading a file into memory in the background
+ ======================================================================= */
+struct _Prefetch
+  {
+  char *path;
+  uint32_t base; // Where the data starts in the file
+  FIL fp;
+  DWORD clmt[FILES_CLMT_ITEMS];
+  LBA_t sector; // Sector at base, if the file is in one piece, or 0
+  uint8_t *data;
+  uint32_t len;
+  uint32_t pos;
+  uint32_t checksum; // Adler-32 of the data up to pos
+  bool open;
+  };
+
+/* =======================================================================
+   files_prefetch_open
+ ======================================================================= */
+Prefetch *files_prefetch_open (const char *path, uint32_t max_size)
+  {
+  return files_prefetch_open_part (path, 0, 0, max_size);
+  }
+
+/* =======================================================================
+   files_prefetch_open_part
+ ======================================================================= */
+Prefetch *files_prefetch_open_part (const char *path, uint32_t offset,
+            uint32_t size, uint32_t max_size)
+  {
+  Prefetch *self = malloc (sizeof (Prefetch));
+  if (!self) return NULL;
+  memset (self, 0, sizeof (Prefetch));
+  self->checksum = 1;
+
+  if (f_open (&self->fp, path, FA_READ) != FR_OK)
+    {
+    free (self);
+    return NULL;
+    }
+  self->open = true;
+
+  FSIZE_t file_size = f_size (&self->fp);
+  if (offset >= file_size) 
+    size = 0;
+  else if (size == 0 || size > file_size - offset) 
+    size = (uint32_t)(file_size - offset);
+  if (size == 0 || size > max_size)
+    {
+    files_prefetch_free (self);
+    return NULL;
+    }
+  self->base = offset;
+  self->sector = files_map_clusters (&self->fp, self->clmt, offset);
+  // Direct reads are whole sectors
+  if (self->sector && offset % 512 == 0) 
+    self->sector += offset / 512;
+  else
+    self->sector = 0;
+
+  self->len = size;
+  self->data = malloc (self->len);
+  self->path = strdup (path);
+  if (!self->data || !self->path)
+    {
+    files_prefetch_free (self);
+    return NULL;
+    }
+  return self;
+  }
+
+/* =======================================================================
+   files_prefetch_read_direct
+   Read count whole sectors from the card, straight into the buffer at
+     pos, as one multi-block read, working out the checksum of each 
+     sector while the next one arrives. Whatever the background read 
+     doesn't get is read again with disk_read, which retries. Returns
+     the number of bytes read.
+ ======================================================================= */
+static UINT files_prefetch_read_direct (Prefetch *self, UINT count)
+  {
+  BYTE *buff = self->data + self->pos;
+  LBA_t sector = self->sector + self->pos / 512;
+  UINT summed = 0;
+  if (disk_read_start (fatfs.pdrv, buff, sector, count) == RES_OK)
+    {
+    int done;
+    while (summed < count && (done = disk_read_poll (fatfs.pdrv)) >= 0)
+      {
+      for (; summed < (UINT)done; summed++)
+        self->checksum = flashcache_adler32 (self->checksum, 
+          buff + summed * 512, 512);
+      }
+    disk_read_finish (fatfs.pdrv);
+    }
+  if (summed < count && disk_read (fatfs.pdrv, buff + summed * 512, 
+       sector + summed, count - summed) == RES_OK)
+    {
+    self->checksum = flashcache_adler32 (self->checksum, 
+      buff + summed * 512, (count - summed) * 512);
+    summed = count;
+    }
+  return summed * 512;
+  }
+
+/* =======================================================================
+   files_prefetch_step
+   Reads are kept to whole sectors, apart from the last, so FatFs reads
+     straight into our buffer, with multi-block reads from the card.
+     If the file is in one piece, whole sectors are read from the card
+     directly, each step in a single multi-block read, however many
+     clusters it spans. Only the part-sector at the end, if there is 
+     one, goes through FatFs.
+ ======================================================================= */
+bool files_prefetch_step (Prefetch *self, uint32_t max_bytes)
+  {
+  if (!self->open) return false;
+  uint32_t n = self->len - self->pos;
+  if (max_bytes < 512) max_bytes = 512;
+  max_bytes &= ~511u;
+  if (n > max_bytes) n = max_bytes;
+  UINT br = 0;
+  FRESULT fr;
+  if (self->sector && n >= 512)
+    {
+    UINT count = n / 512;
+    br = files_prefetch_read_direct (self, count);
+    fr = br == count * 512 ? FR_OK : FR_DISK_ERR;
+    }
+  else
+    {
+    // FatFs doesn't know about the direct reads
+    fr = f_lseek (&self->fp, self->base + self->pos);
+    if (fr == FR_OK) 
+      fr = f_read (&self->fp, self->data + self->pos, n, &br);
+    self->checksum = flashcache_adler32 (self->checksum, 
+      self->data + self->pos, br);
+    }
+  self->pos += br;
+  if (fr != FR_OK || br == 0 || self->pos >= self->len)
+    {
+    // A short file is as good as complete -- the decoder will cope
+    self->len = self->pos;
+    f_close (&self->fp);
+    self->open = false;
+    }
+  return self->open;
+  }
+
+/* =======================================================================
+   files_prefetch_checksum
+ ======================================================================= */
+uint32_t files_prefetch_checksum (const Prefetch *self)
+  {
+  return self->checksum;
+  }
+
+/* =======================================================================
+   files_prefetch_get
+ ======================================================================= */
+const uint8_t *files_prefetch_get (const Prefetch *self, const char *path,
+        uint32_t offset, uint32_t *len)
+  {
+  if (self->open || self->base != offset || strcmp (self->path, path) != 0) 
+    return NULL;
+  *len = self->len;
+  return self->data;
+  }
+
+/* =======================================================================
+   files_prefetch_path
+ ======================================================================= */
+const char *files_prefetch_path (const Prefetch *self)
+  {
+  return self->path;
+  }
+
+/* =======================================================================
+   files_prefetch_free
+ ======================================================================= */
+void files_prefetch_free (Prefetch *self)
+  {
+  if (self->open) f_close (&self->fp);
+  free (self->data);
+  free (self->path);
+  free (self);
+  }
+
+/* =======================================================================
+   files_get_layout_stats
+ ======================================================================= */
+void files_get_layout_stats (unsigned int *contiguous, 
+        unsigned int *fragmented)
+  {
+  *contiguous = files_contiguous;
+  *fragmented = files_fragmented;
+  }
+
+/* =======================================================================
+   files_set_zero_copy
+ ======================================================================= */
+void files_set_zero_copy (bool zero_copy)
+  {
+  files_zero_copy = zero_copy;
+  files_decode_card = (FrameStats){0};
+  files_decode_mem = (FrameStats){0};
+  }
+
+/* =======================================================================
+   files_get_zero_copy
+ ======================================================================= */
+bool files_get_zero_copy (void)
+  {
+  return files_zero_copy;
+  }
+
+/* =======================================================================
+   files_get_decode_stats
+ ======================================================================= */
+const FrameStats *files_get_decode_stats (bool from_mem)
+  {
+  return from_mem ? &files_decode_mem : &files_decode_card;
+  }
+
+/* =======================================================================
+   files_set_preview
+ ======================================================================= */
+void files_set_preview (bool preview)
+  {
+  files_preview = preview;
+  files_preview_stats = (FrameStats){0};
+  }
+
+/* =======================================================================
+   files_get_preview
+ ======================================================================= */
+bool files_get_preview (void)
+  {
+  return files_preview;
+  }
+
+/* =======================================================================
+   files_get_preview_stats
+ ======================================================================= */
+const FrameStats *files_get_preview_stats (void)
+  {
+  return &files_preview_stats;
+  }
+
 /* =======================================================================
    files_list_dir
    Fill the List object with matching files. The list should be 
@@ -252,7 +1324,15 @@ int files_list_dir (const char *dir, const char *pattern, List *files)
  ======================================================================= */
 int files_mount (void)
   {
-  FRESULT fr = f_mount (&fatfs, "0:", 0);
+  // Mount now, rather than on first use, so that the layout of the 
+  //   volume is known, for the sector cache
+  FRESULT fr = f_mount (&fatfs, "0:", 1);
+  DiskCache *cache = disk_get_cache ();
+  if (fr == FR_OK && cache)
+    {
+    diskcache_set_data_start (cache, fatfs.database);
+    diskcache_set_window (cache, fatfs.win);
+    }
   return files_fresult_to_errno (fr);
   }
 
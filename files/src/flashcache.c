@@ -0,0 +1,695 @@
+/* =======================================================================
+
+  files/flashcache.c
+
+  The cache's flash is divided into 4kB sectors -- the smallest unit
+  that can be erased. Each photo takes a run of whole sectors, starting
+  with a one-page header. A new photo goes in the first free run after
+  the photo written last, going back to the first sector at the end,
+  so that space freed by photos that went out of date is reused in
+  turn. Nothing is ever dropped to make room: once the cache is full,
+  or has max_photos photos, no more are copied, and the flash is only
+  erased again when a cached photo changes on the card. Copying every
+  photo shown, as a ring of recent photos, would erase a few dozen
+  sectors every few minutes, for photos that -- shuffled from a large
+  catalog -- would hardly ever be shown again before they were 
+  overwritten.
+
+  The number of times each sector has been erased is counted, and a
+  sector that reaches FLASH_CACHE_MAX_ERASES is not used again. The 
+  counts are kept in the headers: each holds the most that any of its
+  photo's sectors has been erased. When the cache is created, each 
+  sector is given the count from the header of the photo it belongs 
+  to, or, if it belongs to none, the highest count of all, so the
+  counts can be too high but are never too low.
+
+  The header is programmed after the rest of the photo, so a photo is
+  only recognized if it was written completely. Each header also has a
+  checksum of the photo, because a photo that was partly overwritten
+  before a power cut still has its header. The photo's path follows the
+  header, in the same page. The directory in RAM only keeps a hash of
+  it, and the path in flash is compared when a photo is looked up, so 
+  two photos whose paths have the same hash can't be confused.
+
+  On the Pico, erasing or programming flash stops execution from flash,
+  so interrupts are disabled while it's done. Nothing else runs on the
+  second core, and DMA from flash -- the clock's digits -- is always
+  finished before the CPU carries on, so nothing else can be reading
+  the flash at the time.
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+ ======================================================================= */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <ff.h>
+#include <pico/stdlib.h>
+#include <files/flashcache.h>
+#if PICO_ON_DEVICE
+#include <hardware/flash.h>
+#include <hardware/sync.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "config.h"
+
+#define FLASHCACHE_MAGIC 0x59435050 // "PPCY"
+#define FLASHCACHE_SECTOR_SIZE 4096 // FLASH_SECTOR_SIZE
+#define FLASHCACHE_PAGE_SIZE 256 // FLASH_PAGE_SIZE
+#define FLASHCACHE_HEADER_SIZE FLASHCACHE_PAGE_SIZE
+
+#if PICO_ON_DEVICE
+// Set by the linker, at the end of the program in flash
+extern char __flash_binary_end;
+#endif
+
+/* =======================================================================
+   FlashHeader
+   As stored in the first page of a photo's first sector
+ ======================================================================= */
+typedef struct _FlashHeader
+  {
+  uint32_t magic;
+  uint32_t seq; // Higher is more recent
+  uint32_t key; // Hash of the photo's path and offset
+  uint32_t offset; // Of the photo in its file
+  uint32_t file_size; // Of the file the photo came from
+  uint32_t file_time; // FAT date and time of that file
+  uint32_t len; // Of the photo
+  uint32_t checksum; // Adler-32 of the photo
+  uint32_t erases; // The most any of the photo's sectors has been erased
+  uint32_t header_check; // Sum of the fields above
+  } FlashHeader;
+
+// The rest of the header page holds the path, so photos with longer 
+//   paths are not cached
+#define FLASHCACHE_MAX_PATH (FLASHCACHE_HEADER_SIZE - sizeof (FlashHeader))
+
+/* =======================================================================
+   FlashEntry
+   A photo in the directory
+ ======================================================================= */
+typedef struct _FlashEntry
+  {
+  FlashHeader hdr;
+  uint16_t sector; // The first
+  uint16_t sectors;
+  } FlashEntry;
+
+/* =======================================================================
+   Opaque struct
+ ======================================================================= */
+struct _FlashCache
+  {
+  const uint8_t *base; // The cache's flash, as it appears in memory
+#if PICO_ON_DEVICE
+  uint32_t flash_offset; // Where it is, for erasing and programming
+#else
+  uint8_t *sim; // The simulated flash, mapped from HOST_FLASH_IMAGE
+  uint32_t sim_size;
+#endif
+  unsigned int sectors;
+  uint16_t *erases; // Of each sector, as far as is known
+  unsigned int max_photos; // Or zero, not to copy any more
+  FlashEntry *entries; // Oldest first
+  unsigned int count;
+  unsigned int capacity; // Of entries
+  unsigned int head; // Where to start looking for space for a photo
+  uint32_t next_seq;
+  FlashCacheStats stats;
+  // The photo being written, if writing is true
+  bool writing;
+  FlashEntry pending;
+  char pending_path[FLASHCACHE_MAX_PATH];
+  unsigned int done; // Sectors written so far
+  };
+
+/* =======================================================================
+   flashcache_hash
+   FNV-1a
+ ======================================================================= */
+static uint32_t flashcache_hash (const char *s)
+  {
+  uint32_t h = 2166136261u;
+  while (*s)
+    {
+    h ^= (uint8_t)*s++;
+    h *= 16777619u;
+    }
+  return h;
+  }
+
+/* =======================================================================
+   flashcache_adler32
+ ======================================================================= */
+uint32_t flashcache_adler32 (uint32_t adler, const uint8_t *data, 
+           uint32_t len)
+  {
+  uint32_t a = adler & 0xFFFF, b = adler >> 16;
+  while (len > 0)
+    {
+    // The sums can't overflow in this many bytes
+    uint32_t n = len < 5552 ? len : 5552;
+    len -= n;
+    while (n--)
+      {
+      a += *data++;
+      b += a;
+      }
+    a %= 65521;
+    b %= 65521;
+    }
+  return b << 16 | a;
+  }
+
+/* =======================================================================
+   flashcache_header_check
+ ======================================================================= */
+static uint32_t flashcache_header_check (const FlashHeader *hdr)
+  {
+  return hdr->magic + hdr->seq + hdr->key + hdr->offset + hdr->file_size
+    + hdr->file_time + hdr->len + hdr->checksum + hdr->erases;
+  }
+
+/* =======================================================================
+   flashcache_sectors_for
+   The number of sectors a photo of len bytes takes, with its header
+ ======================================================================= */
+static unsigned int flashcache_sectors_for (uint32_t len)
+  {
+  return (unsigned int)(((uint64_t)len + FLASHCACHE_HEADER_SIZE
+    + FLASHCACHE_SECTOR_SIZE - 1) / FLASHCACHE_SECTOR_SIZE);
+  }
+
+/* =======================================================================
+   flashcache_erase
+   Erase one sector of the cache
+ ======================================================================= */
+static void flashcache_erase (FlashCache *self, unsigned int sector)
+  {
+  uint32_t pos = (uint32_t)sector * FLASHCACHE_SECTOR_SIZE;
+#if PICO_ON_DEVICE
+  uint32_t irq = save_and_disable_interrupts ();
+  flash_range_erase (self->flash_offset + pos, FLASHCACHE_SECTOR_SIZE);
+  restore_interrupts (irq);
+#else
+  memset (self->sim + pos, 0xFF, FLASHCACHE_SECTOR_SIZE);
+#endif
+  self->stats.erases++;
+  self->erases[sector]++;
+  if (self->erases[sector] > self->stats.most_erases)
+    self->stats.most_erases = self->erases[sector];
+  }
+
+/* =======================================================================
+   flashcache_program_pages
+   Program whole pages at pos, which is a multiple of the page size.
+     The data must be in RAM, because the flash can't be read while it
+     is being programmed.
+ ======================================================================= */
+static void flashcache_program_pages (FlashCache *self, uint32_t pos,
+       const uint8_t *data, uint32_t len)
+  {
+  if (len == 0) return;
+#if PICO_ON_DEVICE
+  uint32_t irq = save_and_disable_interrupts ();
+  flash_range_program (self->flash_offset + pos, data, len);
+  restore_interrupts (irq);
+#else
+  // Programming can only clear bits
+  for (uint32_t i = 0; i < len; i++)
+    self->sim[pos + i] &= data[i];
+#endif
+  }
+
+/* =======================================================================
+   flashcache_program
+   Program len bytes at pos, which is a multiple of the page size. The
+     end of the last page is left erased.
+ ======================================================================= */
+static void flashcache_program (FlashCache *self, uint32_t pos,
+       const uint8_t *data, uint32_t len)
+  {
+  uint32_t whole = len / FLASHCACHE_PAGE_SIZE * FLASHCACHE_PAGE_SIZE;
+  flashcache_program_pages (self, pos, data, whole);
+  if (whole < len)
+    {
+    uint8_t page[FLASHCACHE_PAGE_SIZE];
+    memset (page, 0xFF, sizeof (page));
+    memcpy (page, data + whole, len - whole);
+    flashcache_program_pages (self, pos + whole, page, sizeof (page));
+    }
+  }
+
+/* =======================================================================
+   flashcache_data
+   Where an entry's photo is
+ ======================================================================= */
+static const uint8_t *flashcache_data (const FlashCache *self,
+       const FlashEntry *e)
+  {
+  return self->base + (uint32_t)e->sector * FLASHCACHE_SECTOR_SIZE
+    + FLASHCACHE_HEADER_SIZE;
+  }
+
+/* =======================================================================
+   flashcache_path
+   The path of an entry's photo, which follows its header
+ ======================================================================= */
+static const char *flashcache_path (const FlashCache *self,
+       const FlashEntry *e)
+  {
+  return (const char *)self->base 
+    + (uint32_t)e->sector * FLASHCACHE_SECTOR_SIZE + sizeof (FlashHeader);
+  }
+
+/* =======================================================================
+   flashcache_remove
+   Drop the n'th entry from the directory. Its sectors are then free for
+     another photo.
+ ======================================================================= */
+static void flashcache_remove (FlashCache *self, unsigned int n)
+  {
+  self->stats.used_bytes -=
+    (uint32_t)self->entries[n].sectors * FLASHCACHE_SECTOR_SIZE;
+  memmove (&self->entries[n], &self->entries[n + 1],
+    (self->count - n - 1) * sizeof (FlashEntry));
+  self->count--;
+  self->stats.photos = self->count;
+  self->stats.evictions++;
+  }
+
+/* =======================================================================
+   flashcache_add
+   Add an entry to the directory, in order of age. Returns false if
+     there isn't enough memory.
+ ======================================================================= */
+static bool flashcache_add (FlashCache *self, const FlashEntry *e)
+  {
+  if (self->count == self->capacity)
+    {
+    unsigned int capacity = self->capacity ? self->capacity * 2 : 8;
+    FlashEntry *entries = realloc (self->entries,
+      capacity * sizeof (FlashEntry));
+    if (!entries) return false;
+    self->entries = entries;
+    self->capacity = capacity;
+    }
+  unsigned int n = self->count;
+  while (n > 0 && self->entries[n - 1].hdr.seq > e->hdr.seq)
+    {
+    self->entries[n] = self->entries[n - 1];
+    n--;
+    }
+  self->entries[n] = *e;
+  self->count++;
+  self->stats.photos = self->count;
+  self->stats.used_bytes += (uint32_t)e->sectors * FLASHCACHE_SECTOR_SIZE;
+  return true;
+  }
+
+/* =======================================================================
+   flashcache_find
+   The index of the entry for the photo at offset in path, with the
+     specified key, or -1. The key is checked first, so the path in
+     flash is only read for a likely match.
+ ======================================================================= */
+static int flashcache_find (const FlashCache *self, uint32_t key,
+       const char *path, uint32_t offset)
+  {
+  for (unsigned int i = 0; i < self->count; i++)
+    {
+    const FlashEntry *e = &self->entries[i];
+    if (e->hdr.key == key && e->hdr.offset == offset
+         && strcmp (flashcache_path (self, e), path) == 0)
+      return (int)i;
+    }
+  return -1;
+  }
+
+/* =======================================================================
+   flashcache_scan
+   Build the directory from the headers in flash, checking each photo,
+     find where to carry on writing, and work out how often each sector
+     has been erased
+ ======================================================================= */
+static void flashcache_scan (FlashCache *self)
+  {
+  unsigned int most = 0;
+  unsigned int s = 0;
+  while (s < self->sectors)
+    {
+    FlashEntry e;
+    memcpy (&e.hdr, self->base + s * FLASHCACHE_SECTOR_SIZE,
+      sizeof (FlashHeader));
+    e.sector = (uint16_t)s;
+    e.sectors = (uint16_t)flashcache_sectors_for (e.hdr.len);
+    if (e.hdr.magic != FLASHCACHE_MAGIC
+         || e.hdr.header_check != flashcache_header_check (&e.hdr)
+         || e.hdr.len == 0 || s + e.sectors > self->sectors
+         || !memchr (flashcache_path (self, &e), 0, FLASHCACHE_MAX_PATH)
+         || flashcache_adler32 (1, flashcache_data (self, &e), e.hdr.len)
+              != e.hdr.checksum)
+      {
+      s++;
+      continue;
+      }
+
+    unsigned int erases = e.hdr.erases > 65535 ? 65535 : e.hdr.erases;
+    for (unsigned int i = s; i < s + e.sectors; i++)
+      self->erases[i] = (uint16_t)erases;
+    if (erases > most) most = erases;
+
+    // A photo that was written again, after it changed, replaces the
+    //   old copy. If there are more photos than are wanted now, the
+    //   oldest are dropped.
+    int old = flashcache_find (self, e.hdr.key, flashcache_path (self, &e),
+      e.hdr.offset);
+    if (old < 0 || self->entries[old].hdr.seq < e.hdr.seq)
+      {
+      if (old >= 0) flashcache_remove (self, (unsigned int)old);
+      flashcache_add (self, &e);
+      if (self->max_photos && self->count > self->max_photos) 
+        flashcache_remove (self, 0);
+      }
+    if (e.hdr.seq >= self->next_seq)
+      {
+      self->next_seq = e.hdr.seq + 1;
+      self->head = s + e.sectors;
+      }
+    s += e.sectors;
+    }
+  if (self->head >= self->sectors) self->head = 0;
+  // A sector that's in no photo could have been erased as often as 
+  //   any other
+  for (s = 0; s < self->sectors; s++)
+    if (self->erases[s] == 0) self->erases[s] = (uint16_t)most;
+  self->stats.most_erases = most;
+  // Photos dropped while the directory was built don't count
+  self->stats.evictions = 0;
+  }
+
+#if !PICO_ON_DEVICE
+/* =======================================================================
+   flashcache_map_sim
+   Map the file that stands in for the flash on the host, so the cache
+     is still there next time. A new file starts off erased. Returns
+     NULL if it can't be mapped.
+ ======================================================================= */
+static uint8_t *flashcache_map_sim (uint32_t size)
+  {
+  int fd = open (HOST_FLASH_IMAGE, O_RDWR | O_CREAT, 0644);
+  if (fd < 0) return NULL;
+  struct stat st;
+  bool erased = fstat (fd, &st) != 0 || st.st_size != (off_t)size;
+  if (erased && ftruncate (fd, (off_t)size) != 0)
+    {
+    close (fd);
+    return NULL;
+    }
+  void *p = mmap (NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close (fd);
+  if (p == MAP_FAILED) return NULL;
+  if (erased) memset (p, 0xFF, size);
+  return p;
+  }
+#endif
+
+/* =======================================================================
+   flashcache_new
+ ======================================================================= */
+FlashCache *flashcache_new (uint32_t size_kb, unsigned int max_photos)
+  {
+  uint32_t size = size_kb * 1024;
+  size -= size % FLASHCACHE_SECTOR_SIZE;
+  // Sectors are numbered in 16 bits in the directory
+  if (size == 0 || size / FLASHCACHE_SECTOR_SIZE > 65535)
+    return NULL;
+
+#if PICO_ON_DEVICE
+  if (size > PICO_FLASH_SIZE_BYTES) return NULL;
+  uint32_t flash_offset = PICO_FLASH_SIZE_BYTES - size;
+  if ((uintptr_t)&__flash_binary_end > XIP_BASE + flash_offset)
+    return NULL;
+#endif
+
+  FlashCache *self = malloc (sizeof (FlashCache));
+  if (!self) return NULL;
+  memset (self, 0, sizeof (FlashCache));
+  self->sectors = size / FLASHCACHE_SECTOR_SIZE;
+  self->erases = calloc (self->sectors, sizeof (uint16_t));
+  self->max_photos = max_photos;
+  self->next_seq = 1;
+  self->stats.size_bytes = size;
+#if PICO_ON_DEVICE
+  self->flash_offset = flash_offset;
+  self->base = (const uint8_t *)XIP_BASE + flash_offset;
+#else
+  self->sim = flashcache_map_sim (size);
+  self->sim_size = size;
+  self->base = self->sim;
+#endif
+  if (!self->base || !self->erases)
+    {
+    flashcache_destroy (self);
+    return NULL;
+    }
+
+  flashcache_scan (self);
+  return self;
+  }
+
+/* =======================================================================
+   flashcache_destroy
+ ======================================================================= */
+void flashcache_destroy (FlashCache *self)
+  {
+#if !PICO_ON_DEVICE
+  if (self->sim) munmap (self->sim, self->sim_size);
+#endif
+  free (self->entries);
+  free (self->erases);
+  free (self);
+  }
+
+/* =======================================================================
+   flashcache_key
+   The hash of a photo's path and offset -- the same as the frame 
+     cache's, so a photo in a file of its own has just the path's hash
+ ======================================================================= */
+static uint32_t flashcache_key (const char *path, uint32_t offset)
+  {
+  return flashcache_hash (path) ^ (offset * 2654435761u);
+  }
+
+/* =======================================================================
+   flashcache_make_key
+   Fill in the parts of the header that identify the photo. Returns
+     false if the file can't be found.
+ ======================================================================= */
+static bool flashcache_make_key (const char *path, uint32_t offset,
+       FlashHeader *hdr)
+  {
+  memset (hdr, 0, sizeof (FlashHeader));
+  hdr->key = flashcache_key (path, offset);
+  hdr->offset = offset;
+  FILINFO fi;
+  if (f_stat (path, &fi) != FR_OK) return false;
+  hdr->file_size = (uint32_t)fi.fsize;
+  hdr->file_time = (uint32_t)fi.fdate << 16 | fi.ftime;
+  return true;
+  }
+
+/* =======================================================================
+   flashcache_lookup
+   The index of the entry for the photo at offset in path, or -1. An
+     entry for a file that has changed is dropped. The path in flash
+     has been compared, so an entry can safely be used if the file 
+     can't be found at all.
+ ======================================================================= */
+static int flashcache_lookup (FlashCache *self, const char *path,
+       uint32_t offset)
+  {
+  FlashHeader key;
+  bool found = flashcache_make_key (path, offset, &key);
+  int n = flashcache_find (self, key.key, path, offset);
+  if (n >= 0 && found
+       && (self->entries[n].hdr.file_size != key.file_size
+       || self->entries[n].hdr.file_time != key.file_time))
+    {
+    flashcache_remove (self, (unsigned int)n);
+    n = -1;
+    }
+  return n;
+  }
+
+/* =======================================================================
+   flashcache_get
+ ======================================================================= */
+const uint8_t *flashcache_get (FlashCache *self, const char *path,
+       uint32_t offset, uint32_t *len)
+  {
+  int n = flashcache_lookup (self, path, offset);
+  if (n < 0)
+    {
+    self->stats.misses++;
+    return NULL;
+    }
+  self->stats.hits++;
+  *len = self->entries[n].hdr.len;
+  return flashcache_data (self, &self->entries[n]);
+  }
+
+/* =======================================================================
+   flashcache_contains
+ ======================================================================= */
+bool flashcache_contains (FlashCache *self, const char *path,
+       uint32_t offset)
+  {
+  return flashcache_lookup (self, path, offset) >= 0;
+  }
+
+/* =======================================================================
+   flashcache_is_free
+   Whether the run of sectors from start can take a photo: it must be in
+     no photo in the directory, and not worn out
+ ======================================================================= */
+static bool flashcache_is_free (const FlashCache *self, unsigned int start,
+       unsigned int sectors)
+  {
+  if (start + sectors > self->sectors) return false;
+  for (unsigned int s = start; s < start + sectors; s++)
+    if (self->erases[s] >= FLASH_CACHE_MAX_ERASES) return false;
+  for (unsigned int i = 0; i < self->count; i++)
+    {
+    const FlashEntry *e = &self->entries[i];
+    if (e->sector < start + sectors && start < e->sector + e->sectors)
+      return false;
+    }
+  return true;
+  }
+
+/* =======================================================================
+   flashcache_start_write
+   Work out where the photo will go. Returns false if the photo can't
+     be cached, or there's no room for it.
+ ======================================================================= */
+static bool flashcache_start_write (FlashCache *self, const FlashHeader *key,
+       uint32_t len, uint32_t checksum)
+  {
+  unsigned int sectors = flashcache_sectors_for (len);
+  unsigned int start = 0;
+  unsigned int i;
+  for (i = 0; i < self->sectors; i++)
+    {
+    start = (self->head + i) % self->sectors;
+    if (flashcache_is_free (self, start, sectors)) break;
+    }
+  if (i == self->sectors) return false;
+
+  FlashEntry *e = &self->pending;
+  e->hdr = *key;
+  e->hdr.magic = FLASHCACHE_MAGIC;
+  e->hdr.len = len;
+  e->hdr.checksum = checksum;
+  e->sector = (uint16_t)start;
+  e->sectors = (uint16_t)sectors;
+  self->writing = true;
+  self->done = 0;
+  return true;
+  }
+
+/* =======================================================================
+   flashcache_write_step
+ ======================================================================= */
+bool flashcache_write_step (FlashCache *self, const char *path,
+       uint32_t offset, const uint8_t *data, uint32_t len, uint32_t checksum)
+  {
+  // Once the cache is full, nothing is dropped to make room
+  if (self->count >= self->max_photos) return false;
+  FlashEntry *e = &self->pending;
+  if (!self->writing || e->hdr.len != len || e->hdr.offset != offset
+       || strcmp (self->pending_path, path) != 0)
+    {
+    // Sectors already erased for a photo that was abandoned are just
+    //   written over
+    self->writing = false;
+    FlashHeader key;
+    if (len == 0 || strlen (path) >= FLASHCACHE_MAX_PATH
+         || !flashcache_make_key (path, offset, &key))
+      return false;
+    if (flashcache_lookup (self, path, offset) >= 0) return false;
+    if (!flashcache_start_write (self, &key, len, checksum)) return false;
+    strcpy (self->pending_path, path);
+    }
+
+  // Each sector holds the part of the photo, with its header in front,
+  //   that falls within it. The header itself is left until last.
+  unsigned int s = e->sector + self->done;
+  uint32_t pos = (uint32_t)s * FLASHCACHE_SECTOR_SIZE;
+  uint32_t start = self->done * FLASHCACHE_SECTOR_SIZE;
+  uint32_t end = start + FLASHCACHE_SECTOR_SIZE;
+  if (end > len + FLASHCACHE_HEADER_SIZE) end = len + FLASHCACHE_HEADER_SIZE;
+  if (start == 0)
+    {
+    start = FLASHCACHE_HEADER_SIZE;
+    pos += FLASHCACHE_HEADER_SIZE;
+    }
+  flashcache_erase (self, s);
+  flashcache_program (self, pos, data + start - FLASHCACHE_HEADER_SIZE,
+    end - start);
+  self->done++;
+  if (self->done < e->sectors) return true;
+
+  // The header page is the header followed by the path
+  uint8_t page[FLASHCACHE_HEADER_SIZE];
+  e->hdr.seq = self->next_seq++;
+  e->hdr.erases = 0;
+  for (unsigned int i = e->sector; i < e->sector + e->sectors; i++)
+    if (self->erases[i] > e->hdr.erases) e->hdr.erases = self->erases[i];
+  e->hdr.header_check = flashcache_header_check (&e->hdr);
+  memset (page, 0xFF, sizeof (page));
+  memcpy (page, &e->hdr, sizeof (FlashHeader));
+  strcpy ((char *)page + sizeof (FlashHeader), self->pending_path);
+  flashcache_program_pages (self, 
+    (uint32_t)e->sector * FLASHCACHE_SECTOR_SIZE, page, sizeof (page));
+  self->writing = false;
+  self->head = e->sector + e->sectors;
+  if (self->head >= self->sectors) self->head = 0;
+  flashcache_add (self, e);
+  self->stats.writes++;
+  return false;
+  }
+
+/* =======================================================================
+   flashcache_count
+ ======================================================================= */
+unsigned int flashcache_count (const FlashCache *self)
+  {
+  return self->count;
+  }
+
+/* =======================================================================
+   flashcache_get_nth
+ ======================================================================= */
+const uint8_t *flashcache_get_nth (FlashCache *self, unsigned int n,
+       uint32_t *len)
+  {
+  if (n >= self->count) return NULL;
+  *len = self->entries[n].hdr.len;
+  return flashcache_data (self, &self->entries[n]);
+  }
+
+/* =======================================================================
+   flashcache_get_stats
+ ======================================================================= */
+const FlashCacheStats *flashcache_get_stats (const FlashCache *self)
+  {
+  return &self->stats;
+  }
+
@@ -0,0 +1,401 @@
+/* =======================================================================
+
+  files/framecache.c
+
+  Each frame is a file whose name is a hash of the photo's path. It
+  starts with a one-sector header, so the pixels are sector-aligned,
+  and FatFs can read and write them directly to and from the caller's
+  buffer, with multi-block transfers. The header is only filled in when
+  the frame is complete, so a frame that was interrupted -- by a power
+  cut, for example -- is never used. The header holds the photo's
+  path, so two photos whose paths have the same hash can't be confused.
+
+  The frames are listed in RAM, with the time each was last used, when
+  the cache is created; after that, the directory on the card is not
+  read again. The card may not have a real-time clock behind it, so
+  frames are not aged using FAT timestamps. Instead, each header has a
+  stamp, which is set when the frame is written, and set again the
+  first time the frame is used after each start-up, so that frames that
+  are used often survive a restart. Later uses only read the frame,
+  and are recorded in RAM.
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+ ======================================================================= */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <ff.h>
+#include <files/framecache.h>
+
+#define FRAMECACHE_MAGIC 0x47435050 // "PPCG"
+#define FRAMECACHE_HEADER_SIZE 512
+#define FRAMECACHE_PATTERN "*.frm"
+#define FRAMECACHE_MAX_NAME (FF_LFN_BUF + 64)
+// Photos with longer paths are not cached
+#define FRAMECACHE_MAX_PATH 256
+
+/* =======================================================================
+   FrameHeader
+   As stored in the first sector of the frame file
+ ======================================================================= */
+typedef struct _FrameHeader
+  {
+  uint32_t magic;
+  uint32_t path_hash;
+  uint32_t offset; // Of the photo in its file
+  uint32_t file_size;
+  uint32_t file_time; // FAT date and time of the photo
+  uint32_t last_used; // Stamp, higher is more recent
+  uint16_t width;
+  uint16_t height;
+  uint8_t rotation;
+  char path[FRAMECACHE_MAX_PATH];
+  } FrameHeader;
+
+/* =======================================================================
+   FrameEntry
+   A frame in the RAM directory, known by the hash in its file name
+ ======================================================================= */
+typedef struct _FrameEntry
+  {
+  uint32_t path_hash;
+  uint32_t last_used;
+  bool stamped; // The header's stamp has been set since start-up
+  } FrameEntry;
+
+/* =======================================================================
+   Opaque struct
+ ======================================================================= */
+struct _FrameCache
+  {
+  char *dir;
+  unsigned int max_frames;
+  uint32_t next_stamp;
+  FrameCacheStats stats;
+  FrameEntry *entries;
+  unsigned int entries_size; // Allocated
+  FrameHeader header; // The last header read
+  FrameHeader key; // The photo being looked up
+  // The frame being written
+  char pending_name[FRAMECACHE_MAX_NAME];
+  FrameHeader pending;
+  };
+
+/* =======================================================================
+   framecache_hash
+   FNV-1a
+ ======================================================================= */
+static uint32_t framecache_hash (const char *s)
+  {
+  uint32_t h = 2166136261u;
+  while (*s)
+    {
+    h ^= (uint8_t)*s++;
+    h *= 16777619u;
+    }
+  return h;
+  }
+
+/* =======================================================================
+   framecache_name
+   The name of the frame file with the specified hash
+ ======================================================================= */
+static void framecache_name (const FrameCache *self, uint32_t path_hash,
+       char *name)
+  {
+  snprintf (name, FRAMECACHE_MAX_NAME, "%s/%08lx.frm", self->dir,
+    (unsigned long)path_hash);
+  }
+
+/* =======================================================================
+   framecache_make_key
+   Fill in the parts of the header that identify the photo, and the
+     name of the frame file. Returns an errno if the photo can't
+     be found, or can't be cached.
+ ======================================================================= */
+static int framecache_make_key (const FrameCache *self, const char *path,
+       uint32_t offset, FrameHeader *hdr, char *name)
+  {
+  if (strlen (path) >= FRAMECACHE_MAX_PATH) return ENAMETOOLONG;
+  FILINFO fi;
+  if (f_stat (path, &fi) != FR_OK) return ENOENT;
+  memset (hdr, 0, sizeof (FrameHeader));
+  // A photo in a file of its own has offset zero, so the hash is just
+  //   the path's
+  hdr->path_hash = framecache_hash (path) ^ (offset * 2654435761u);
+  hdr->offset = offset;
+  hdr->file_size = (uint32_t)fi.fsize;
+  hdr->file_time = (uint32_t)fi.fdate << 16 | fi.ftime;
+  strcpy (hdr->path, path);
+  framecache_name (self, hdr->path_hash, name);
+  return 0;
+  }
+
+/* =======================================================================
+   framecache_find
+   Return the index in the RAM directory of the frame with the specified
+     hash, or -1
+ ======================================================================= */
+static int framecache_find (const FrameCache *self, uint32_t path_hash)
+  {
+  for (unsigned int i = 0; i < self->stats.frames; i++)
+    if (self->entries[i].path_hash == path_hash) return (int)i;
+  return -1;
+  }
+
+/* =======================================================================
+   framecache_add
+   Add a frame to the RAM directory. Returns false if there isn't
+     enough memory.
+ ======================================================================= */
+static bool framecache_add (FrameCache *self, uint32_t path_hash,
+       uint32_t last_used, bool stamped)
+  {
+  if (self->stats.frames == self->entries_size)
+    {
+    unsigned int size = self->entries_size ? self->entries_size * 2 : 8;
+    FrameEntry *e = realloc (self->entries, size * sizeof (FrameEntry));
+    if (!e) return false;
+    self->entries = e;
+    self->entries_size = size;
+    }
+  FrameEntry *e = &self->entries[self->stats.frames++];
+  e->path_hash = path_hash;
+  e->last_used = last_used;
+  e->stamped = stamped;
+  return true;
+  }
+
+/* =======================================================================
+   framecache_remove
+   Remove the i'th frame from the RAM directory, and delete its file
+ ======================================================================= */
+static void framecache_remove (FrameCache *self, unsigned int i)
+  {
+  char name[FRAMECACHE_MAX_NAME];
+  framecache_name (self, self->entries[i].path_hash, name);
+  f_unlink (name);
+  self->entries[i] = self->entries[--self->stats.frames];
+  }
+
+/* =======================================================================
+   framecache_read_header
+ ======================================================================= */
+static bool framecache_read_header (FIL *fp, FrameHeader *hdr)
+  {
+  UINT br;
+  if (f_read (fp, hdr, sizeof (FrameHeader), &br) != FR_OK) return false;
+  return br == sizeof (FrameHeader) && hdr->magic == FRAMECACHE_MAGIC;
+  }
+
+/* =======================================================================
+   framecache_scan
+   Build the RAM directory from the frame files on the card. This is the
+     only time that the directory on the card is read. Files that aren't
+     named as frames are left alone; frames with bad headers --
+     incomplete, or from an older version -- are given the oldest
+     possible stamp, so they are the first to go.
+ ======================================================================= */
+static void framecache_scan (FrameCache *self)
+  {
+  char name[FRAMECACHE_MAX_NAME];
+  DIR dp;
+  FILINFO fi;
+  FRESULT fr = f_findfirst (&dp, &fi, self->dir, FRAMECACHE_PATTERN);
+  while (fr == FR_OK && fi.fname[0])
+    {
+    unsigned long path_hash;
+    char ext[5];
+    if (sscanf (fi.fname, "%8lx.%4s", &path_hash, ext) == 2
+         && strcmp (ext, "frm") == 0)
+      {
+      snprintf (name, sizeof (name), "%s/%s", self->dir, fi.fname);
+      FIL fp;
+      uint32_t stamp = 0;
+      if (f_open (&fp, name, FA_READ) == FR_OK)
+        {
+        if (framecache_read_header (&fp, &self->header))
+          stamp = self->header.last_used;
+        f_close (&fp);
+        }
+      if (stamp >= self->next_stamp) self->next_stamp = stamp + 1;
+      if (!framecache_add (self, (uint32_t)path_hash, stamp, false)) break;
+      }
+    fr = f_findnext (&dp, &fi);
+    }
+  f_closedir (&dp);
+  }
+
+/* =======================================================================
+   framecache_evict
+   Delete the least recently used frame. Returns false if there are
+     none.
+ ======================================================================= */
+static bool framecache_evict (FrameCache *self)
+  {
+  if (self->stats.frames == 0) return false;
+  unsigned int oldest = 0;
+  for (unsigned int i = 1; i < self->stats.frames; i++)
+    if (self->entries[i].last_used < self->entries[oldest].last_used)
+      oldest = i;
+  framecache_remove (self, oldest);
+  self->stats.evictions++;
+  return true;
+  }
+
+/* =======================================================================
+   framecache_new
+ ======================================================================= */
+FrameCache *framecache_new (const char *dir, unsigned int max_frames)
+  {
+  FRESULT fr = f_mkdir (dir);
+  if (fr != FR_OK && fr != FR_EXIST) return NULL;
+
+  FrameCache *self = malloc (sizeof (FrameCache));
+  if (!self) return NULL;
+  memset (self, 0, sizeof (FrameCache));
+  self->dir = strdup (dir);
+  self->max_frames = max_frames;
+  self->next_stamp = 1;
+  framecache_scan (self);
+  return self;
+  }
+
+/* =======================================================================
+   framecache_destroy
+ ======================================================================= */
+void framecache_destroy (FrameCache *self)
+  {
+  free (self->entries);
+  free (self->dir);
+  free (self);
+  }
+
+/* =======================================================================
+   framecache_open_read
+ ======================================================================= */
+int framecache_open_read (FrameCache *self, const char *path, 
+       uint32_t offset, FIL *fp, FrameInfo *info)
+  {
+  FrameHeader *key = &self->key;
+  FrameHeader *hdr = &self->header;
+  char name[FRAMECACHE_MAX_NAME];
+  int ret = framecache_make_key (self, path, offset, key, name);
+  int e = ret == 0 ? framecache_find (self, key->path_hash) : -1;
+  if (ret == 0)
+    {
+    ret = ENOENT;
+    // The frame is only opened for writing the first time it's used
+    //   since start-up, to update its stamp
+    bool stamp = e >= 0 && !self->entries[e].stamped;
+    if (e >= 0 && f_open (fp, name, 
+         stamp ? FA_READ | FA_WRITE : FA_READ) == FR_OK)
+      {
+      if (framecache_read_header (fp, hdr)
+           && hdr->offset == key->offset
+           && hdr->file_size == key->file_size
+           && hdr->file_time == key->file_time
+           && strcmp (hdr->path, key->path) == 0)
+        {
+        self->entries[e].last_used = self->next_stamp++;
+        if (stamp)
+          {
+          // A failure here only costs the frame its place after a 
+          //   restart, so it isn't tried again
+          UINT bw;
+          hdr->last_used = self->entries[e].last_used;
+          if (f_lseek (fp, 0) == FR_OK) 
+            f_write (fp, hdr, sizeof (FrameHeader), &bw);
+          f_sync (fp);
+          self->entries[e].stamped = true;
+          }
+        if (f_lseek (fp, FRAMECACHE_HEADER_SIZE) == FR_OK)
+          {
+          info->width = hdr->width;
+          info->height = hdr->height;
+          info->rotation = hdr->rotation;
+          ret = 0;
+          }
+        }
+      if (ret) f_close (fp);
+      }
+    }
+  if (ret == 0)
+    self->stats.hits++;
+  else
+    self->stats.misses++;
+  return ret;
+  }
+
+/* =======================================================================
+   framecache_open_write
+ ======================================================================= */
+int framecache_open_write (FrameCache *self, const char *path, 
+       uint32_t offset, FIL *fp)
+  {
+  if (self->max_frames == 0) return ENOSPC;
+  int ret = framecache_make_key (self, path, offset, &self->pending,
+    self->pending_name);
+  if (ret) return ret;
+
+  // A frame with the same name -- out of date, or for another photo
+  //   whose path has the same hash -- has to go first
+  int e = framecache_find (self, self->pending.path_hash);
+  if (e >= 0) framecache_remove (self, (unsigned int)e);
+  while (self->stats.frames >= self->max_frames && framecache_evict (self))
+    ;
+
+  if (f_open (fp, self->pending_name, FA_WRITE | FA_CREATE_ALWAYS) != FR_OK)
+    return EIO;
+
+  // Write a blank header, which will not be recognized as a frame
+  static const uint8_t blank[FRAMECACHE_HEADER_SIZE];
+  UINT bw;
+  if (f_write (fp, blank, sizeof (blank), &bw) != FR_OK
+       || bw != sizeof (blank))
+    {
+    f_close (fp);
+    f_unlink (self->pending_name);
+    return EIO;
+    }
+  return 0;
+  }
+
+/* =======================================================================
+   framecache_close_write
+ ======================================================================= */
+void framecache_close_write (FrameCache *self, FIL *fp,
+       const FrameInfo *info, bool complete)
+  {
+  if (complete)
+    {
+    FrameHeader *hdr = &self->pending;
+    hdr->magic = FRAMECACHE_MAGIC;
+    hdr->last_used = self->next_stamp++;
+    hdr->width = info->width;
+    hdr->height = info->height;
+    hdr->rotation = info->rotation;
+    UINT bw;
+    complete = f_lseek (fp, 0) == FR_OK
+      && f_write (fp, hdr, sizeof (FrameHeader), &bw) == FR_OK
+      && bw == sizeof (FrameHeader);
+    }
+  if (f_close (fp) != FR_OK) complete = false;
+  if (complete && framecache_add (self, self->pending.path_hash,
+                    self->pending.last_used, true))
+    self->stats.writes++;
+  else
+    f_unlink (self->pending_name);
+  }
+
+/* =======================================================================
+   framecache_get_stats
+ ======================================================================= */
+const FrameCacheStats *framecache_get_stats (const FrameCache *self)
+  {
+  return &self->stats;
+  }
+
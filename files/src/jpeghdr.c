@@ -0,0 +1,277 @@
+/* =======================================================================
+ 
+  files/jpeghdr.c
+
+  A minimal JPEG header parser. See jpeghdr.h.
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+ ======================================================================= */
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <files/jpeghdr.h>
+
+// Marker codes that we care about
+#define M_SOI   0xD8
+#define M_EOI   0xD9
+#define M_SOS   0xDA
+#define M_DRI   0xDD
+#define M_APP1  0xE1
+
+// EXIF tags: the orientation, in IFD0, and the thumbnail's offset and
+//   length, in IFD1
+#define EXIF_TAG_ORIENTATION 0x0112
+#define EXIF_TAG_THUMB_OFFSET 0x0201
+#define EXIF_TAG_THUMB_LEN 0x0202
+
+// The largest image picojpeg will decode
+#define JPEGHDR_MAX_DIMENSION 16384
+
+// Give up on files that have an absurd number of segments before the
+//   frame header. This prevents us scanning a large non-JPEG file byte
+//   by byte.
+#define JPEGHDR_MAX_SEGMENTS 64 
+
+// Limit on the number of entries we will examine in an IFD. Each IFD
+//   is read in one piece, into a buffer of 12 bytes per entry.
+#define JPEGHDR_MAX_IFD_ENTRIES 32
+
+/* =======================================================================
+  jpeghdr_get16, jpeghdr_get32
+  Extract 16- and 32-bit values, which might be big- or little-endian 
+    in an EXIF block. Markers are always big-endian.
+ ======================================================================= */
+static unsigned int jpeghdr_get16 (const uint8_t *p, int big_endian)
+  {
+  if (big_endian)
+    return (unsigned int)(p[0] << 8 | p[1]);
+  return (unsigned int)(p[1] << 8 | p[0]);
+  }
+
+static uint32_t jpeghdr_get32 (const uint8_t *p, int big_endian)
+  {
+  if (big_endian)
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 
+      | (uint32_t)p[2] << 8 | p[3];
+  return (uint32_t)p[3] << 24 | (uint32_t)p[2] << 16 
+      | (uint32_t)p[1] << 8 | p[0];
+  }
+
+/* =======================================================================
+  jpeghdr_is_sof
+  Returns non-zero if the marker is one of the start-of-frame types. 
+    C4, C8, and CC are in the same range, but are something else.
+ ======================================================================= */
+static int jpeghdr_is_sof (uint8_t marker)
+  {
+  return marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 
+    && marker != 0xC8 && marker != 0xCC;
+  }
+
+/* =======================================================================
+  jpeghdr_read_ifd
+  Read the entries of the IFD at offset ifd, relative to the TIFF 
+    header at tiff, into e. Returns the number read, and sets next to
+    the offset of the next IFD, or zero if there isn't one.
+ ======================================================================= */
+static unsigned int jpeghdr_read_ifd (JpegHdrReadFn read_fn, void *data, 
+     uint32_t tiff, uint32_t ifd, int be, uint8_t *e, uint32_t *next)
+  {
+  uint8_t n[4];
+  *next = 0;
+  if (read_fn (data, tiff + ifd, n, 2) != 2) return 0;
+  unsigned int entries = jpeghdr_get16 (n, be);
+  if (read_fn (data, tiff + ifd + 2 + entries * 12, n, 4) == 4)
+    *next = jpeghdr_get32 (n, be);
+  if (entries > JPEGHDR_MAX_IFD_ENTRIES) 
+    entries = JPEGHDR_MAX_IFD_ENTRIES;
+  return read_fn (data, tiff + ifd + 2, e, entries * 12) / 12;
+  }
+
+/* =======================================================================
+  jpeghdr_parse_exif
+  Look for the orientation tag in IFD0 of the EXIF block that starts
+    at offset, and the thumbnail in IFD1. We don't look any further.
+ ======================================================================= */
+static void jpeghdr_parse_exif (JpegHdrReadFn read_fn, void *data, 
+     uint32_t offset, uint32_t len, JpegHeader *hdr)
+  {
+  uint8_t b[14];
+  if (len < 14) return;
+  if (read_fn (data, offset, b, 14) != 14) return;
+  if (memcmp (b, "Exif\0\0", 6) != 0) return;
+
+  // The TIFF header starts after 'Exif\0\0', and all EXIF offsets are
+  //   relative to it.
+  uint32_t tiff = offset + 6;
+  uint32_t tiff_len = len - 6;
+  int be;
+  if (b[6] == 'M' && b[7] == 'M') 
+    be = 1;
+  else if (b[6] == 'I' && b[7] == 'I')
+    be = 0;
+  else
+    return;
+
+  uint8_t e[JPEGHDR_MAX_IFD_ENTRIES * 12];
+  uint32_t ifd1;
+  unsigned int entries = jpeghdr_read_ifd (read_fn, data, tiff,
+    jpeghdr_get32 (b + 10, be), be, e, &ifd1);
+  for (unsigned int i = 0; i < entries; i++)
+    {
+    if (jpeghdr_get16 (e + i * 12, be) == EXIF_TAG_ORIENTATION)
+      {
+      // A SHORT value is left-justified in the four-byte value field
+      int o = (int)jpeghdr_get16 (e + i * 12 + 8, be);
+      if (o >= 1 && o <= 8) hdr->orientation = o;
+      break;
+      }
+    }
+
+  if (ifd1 == 0 || ifd1 >= tiff_len) return;
+  uint32_t next;
+  entries = jpeghdr_read_ifd (read_fn, data, tiff, ifd1, be, e, &next);
+  uint32_t thumb_offset = 0, thumb_len = 0;
+  for (unsigned int i = 0; i < entries; i++)
+    {
+    unsigned int tag = jpeghdr_get16 (e + i * 12, be);
+    // These are usually LONGs, but SHORTs are allowed
+    uint32_t value = jpeghdr_get16 (e + i * 12 + 2, be) == 3
+      ? jpeghdr_get16 (e + i * 12 + 8, be) 
+      : jpeghdr_get32 (e + i * 12 + 8, be);
+    if (tag == EXIF_TAG_THUMB_OFFSET) 
+      thumb_offset = value;
+    else if (tag == EXIF_TAG_THUMB_LEN) 
+      thumb_len = value;
+    }
+  // The thumbnail has to be inside the EXIF block
+  if (thumb_offset && thumb_len && thumb_offset < tiff_len 
+       && thumb_len <= tiff_len - thumb_offset)
+    {
+    hdr->thumb_offset = tiff + thumb_offset;
+    hdr->thumb_len = thumb_len;
+    }
+  }
+
+/* =======================================================================
+  jpeghdr_parse_sof
+  Read the frame header, whose contents start at offset
+ ======================================================================= */
+static int jpeghdr_parse_sof (JpegHdrReadFn read_fn, void *data, 
+     uint32_t offset, uint32_t len, uint8_t marker, JpegHeader *hdr)
+  {
+  // Precision, height, width, components, and three bytes for each
+  //   of up to three components
+  uint8_t b[15];
+  if (len < 6) return EINVAL;
+  uint32_t n = len > sizeof (b) ? sizeof (b) : len;
+  if (read_fn (data, offset, b, n) != n) return EIO;
+  hdr->sof = marker;
+  hdr->progressive = (marker & 0x03) == 0x02;
+  hdr->precision = b[0];
+  hdr->height = jpeghdr_get16 (b + 1, 1);
+  hdr->width = jpeghdr_get16 (b + 3, 1);
+  hdr->components = b[5];
+
+  // picojpeg handles only chrominance at 1x1, and luminance at 1x1, 
+  //   2x1, 1x2, or 2x2
+  unsigned int c = hdr->components;
+  if (c != 1 && c != 3) 
+    {
+    hdr->sampling = JPEGHDR_SAMP_OTHER;
+    return 0;
+    }
+  if (n < 6 + 3 * c) return EINVAL;
+  for (unsigned int i = 0; i < c; i++)
+    if (b[8 + i * 3] > hdr->quant_tables) 
+      hdr->quant_tables = b[8 + i * 3];
+  uint8_t y = b[7];
+  if (c == 3 && (b[10] != 0x11 || b[13] != 0x11))
+    hdr->sampling = JPEGHDR_SAMP_OTHER;
+  else if (c == 1)
+    hdr->sampling = y == 0x11 ? JPEGHDR_SAMP_GREY : JPEGHDR_SAMP_OTHER;
+  else if (y == 0x11)
+    hdr->sampling = JPEGHDR_SAMP_H1V1;
+  else if (y == 0x21)
+    hdr->sampling = JPEGHDR_SAMP_H2V1;
+  else if (y == 0x12)
+    hdr->sampling = JPEGHDR_SAMP_H1V2;
+  else if (y == 0x22)
+    hdr->sampling = JPEGHDR_SAMP_H2V2;
+  else
+    hdr->sampling = JPEGHDR_SAMP_OTHER;
+  return 0;
+  }
+
+/* =======================================================================
+  jpeghdr_parse 
+ ======================================================================= */
+int jpeghdr_parse (JpegHdrReadFn read_fn, void *data, JpegHeader *hdr)
+  {
+  memset (hdr, 0, sizeof (JpegHeader));
+  hdr->orientation = 1;
+
+  uint8_t b[8];
+  if (read_fn (data, 0, b, 2) != 2) return EIO;
+  if (b[0] != 0xFF || b[1] != M_SOI) return EINVAL;
+
+  uint32_t offset = 2;
+  for (int seg = 0; seg < JPEGHDR_MAX_SEGMENTS; seg++)
+    {
+    if (read_fn (data, offset, b, 4) != 4) return EIO;
+    if (b[0] != 0xFF) return EINVAL;
+    if (b[1] == 0xFF) 
+      {
+      // Fill byte before a marker -- skip it
+      offset++;
+      continue;
+      }
+    uint8_t marker = b[1];
+    if (marker == M_SOS || marker == M_EOI) 
+      break;
+    uint32_t len = jpeghdr_get16 (b + 2, 1);
+    if (len < 2) return EINVAL;
+
+    if (marker == M_APP1 && !hdr->width)
+      {
+      jpeghdr_parse_exif (read_fn, data, offset + 4, len - 2, hdr);
+      }
+    else if (jpeghdr_is_sof (marker))
+      {
+      int err = jpeghdr_parse_sof (read_fn, data, offset + 4, len - 2, 
+        marker, hdr);
+      if (err) return err;
+      }
+    else if (marker == M_DRI && len >= 4)
+      {
+      // The restart interval can come before or after the frame header,
+      //   so we carry on to the start of the scan
+      if (read_fn (data, offset + 4, b, 2) != 2) return EIO;
+      hdr->restart_interval = jpeghdr_get16 (b, 1);
+      }
+    offset += 2 + len;
+    }
+
+  return hdr->width ? 0 : EINVAL;
+  }
+
+/* =======================================================================
+  jpeghdr_unsupported
+  These are the checks that picojpeg makes when it reads the headers. 
+ ======================================================================= */
+const char *jpeghdr_unsupported (const JpegHeader *hdr)
+  {
+  if (hdr->progressive) return "progressive";
+  if (hdr->sof != 0xC0) return "not baseline";
+  if (hdr->precision != 8) return "not 8-bit";
+  if (hdr->width == 0 || hdr->height == 0 
+      || hdr->width > JPEGHDR_MAX_DIMENSION 
+      || hdr->height > JPEGHDR_MAX_DIMENSION)
+    return "bad size";
+  if (hdr->components != 1 && hdr->components != 3) return "not RGB";
+  if (hdr->sampling == JPEGHDR_SAMP_OTHER) return "unusual sampling";
+  if (hdr->quant_tables > 1) return "too many tables";
+  return NULL;
+  }
@@ -0,0 +1,127 @@
+/* =======================================================================
+ 
+  files/pack.c
+
+  Reading and writing pack headers. See pack.h for the format. This 
+  has nothing to do with files as such, so that the host packer can
+  use it too.
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+ ======================================================================= */
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <files/pack.h>
+
+/* =======================================================================
+  pack_get16, pack_get32, pack_put16, pack_put32
+ ======================================================================= */
+static uint16_t pack_get16 (const uint8_t *p)
+  {
+  return (uint16_t)(p[0] | p[1] << 8);
+  }
+
+static uint32_t pack_get32 (const uint8_t *p)
+  {
+  return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 
+    | (uint32_t)p[3] << 24;
+  }
+
+static void pack_put16 (uint8_t *p, uint16_t v)
+  {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  }
+
+static void pack_put32 (uint8_t *p, uint32_t v)
+  {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+  p[2] = (uint8_t)(v >> 16);
+  p[3] = (uint8_t)(v >> 24);
+  }
+
+/* =======================================================================
+  pack_decode_header
+ ======================================================================= */
+int pack_decode_header (const uint8_t *buf, uint32_t *count)
+  {
+  if (memcmp (buf, PACK_MAGIC, sizeof (PACK_MAGIC)) != 0) return EINVAL;
+  if (pack_get16 (buf + 8) != PACK_VERSION) return EINVAL;
+  if (pack_get16 (buf + 10) != PACK_ENTRY_SIZE) return EINVAL;
+  *count = pack_get32 (buf + 12);
+  return 0;
+  }
+
+/* =======================================================================
+  pack_encode_header
+ ======================================================================= */
+void pack_encode_header (uint8_t *buf, uint32_t count)
+  {
+  memset (buf, 0, PACK_HEADER_SIZE);
+  memcpy (buf, PACK_MAGIC, sizeof (PACK_MAGIC));
+  pack_put16 (buf + 8, PACK_VERSION);
+  pack_put16 (buf + 10, PACK_ENTRY_SIZE);
+  pack_put32 (buf + 12, count);
+  }
+
+/* =======================================================================
+  pack_decode_entry
+ ======================================================================= */
+void pack_decode_entry (const uint8_t *buf, PackEntry *entry)
+  {
+  entry->offset = pack_get32 (buf);
+  entry->size = pack_get32 (buf + 4);
+  entry->width = pack_get16 (buf + 8);
+  entry->height = pack_get16 (buf + 10);
+  entry->name_hash = pack_get32 (buf + 12);
+  entry->thumb_offset = pack_get32 (buf + 16);
+  entry->thumb_len = pack_get16 (buf + 20);
+  entry->restart_interval = pack_get16 (buf + 22);
+  entry->sampling = buf[24];
+  entry->orientation = buf[25];
+  }
+
+/* =======================================================================
+  pack_encode_entry
+ ======================================================================= */
+void pack_encode_entry (uint8_t *buf, const PackEntry *entry)
+  {
+  memset (buf, 0, PACK_ENTRY_SIZE);
+  pack_put32 (buf, entry->offset);
+  pack_put32 (buf + 4, entry->size);
+  pack_put16 (buf + 8, entry->width);
+  pack_put16 (buf + 10, entry->height);
+  pack_put32 (buf + 12, entry->name_hash);
+  pack_put32 (buf + 16, entry->thumb_offset);
+  pack_put16 (buf + 20, entry->thumb_len);
+  pack_put16 (buf + 22, entry->restart_interval);
+  buf[24] = entry->sampling;
+  buf[25] = entry->orientation;
+  }
+
+/* =======================================================================
+  pack_data_offset
+ ======================================================================= */
+uint32_t pack_data_offset (uint32_t count)
+  {
+  uint32_t index = PACK_HEADER_SIZE + count * PACK_ENTRY_SIZE;
+  return (index + PACK_ALIGN - 1) / PACK_ALIGN * PACK_ALIGN;
+  }
+
+/* =======================================================================
+  pack_hash
+  FNV-1a
+ ======================================================================= */
+uint32_t pack_hash (const char *name)
+  {
+  uint32_t h = 2166136261u;
+  while (*name)
+    {
+    h ^= (uint8_t)*name++;
+    h *= 16777619u;
+    }
+  return h;
+  }
@@ -4710,6 +4710,31 @@ FRESULT f_readdir (
 
 
 
+/*-----------------------------------------------------------------------*/
+/* Move the Read Position of a Directory Object                          */
+/*-----------------------------------------------------------------------*/
+/* Local patch for pico-photo-clock: not in ChaN's FatFs R0.14a.       */
+/* The offset is a value of dp->dptr saved earlier; the next f_readdir  */
+/* returns the first item at or after it.                               */
+
+FRESULT f_seekdir (
+	DIR* dp,			/* Pointer to the open directory object */
+	DWORD ofs			/* Offset of the directory entry, a multiple of 32 */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+
+
+	res = validate(&dp->obj, &fs);	/* Check validity of the directory object */
+	if (res == FR_OK) {
+		res = dir_sdi(dp, ofs);		/* Move to the entry */
+	}
+	LEAVE_FF(fs, res);
+}
+
+
+
 #if FF_USE_FIND
 /*-----------------------------------------------------------------------*/
 /* Find Next File                                                        */
@@ -5660,8 +5685,19 @@ FRESULT f_forward (
 		csect = (UINT)(fp->fptr / SS(fs) & (fs->csize - 1));	/* Sector offset in the cluster */
 		if (fp->fptr % SS(fs) == 0) {				/* On the sector boundary? */
 			if (csect == 0) {						/* On the cluster boundary? */
-				clst = (fp->fptr == 0) ?			/* On the top of the file? */
-					fp->obj.sclust : get_fat(&fp->obj, fp->clust);
+				if (fp->fptr == 0) {				/* On the top of the file? */
+					clst = fp->obj.sclust;
+				} else {
+#if FF_USE_FASTSEEK
+					/* Local patch for pico-photo-clock: follow the CLMT, as f_read does */
+					if (fp->cltbl) {
+						clst = clmt_clust(fp, fp->fptr);	/* Get cluster# from the CLMT */
+					} else
+#endif
+					{
+						clst = get_fat(&fp->obj, fp->clust);
+					}
+				}
 				if (clst <= 1) ABORT(fs, FR_INT_ERR);
 				if (clst == 0xFFFFFFFF) ABORT(fs, FR_DISK_ERR);
 				fp->clust = clst;					/* Update current cluster */
@@ -0,0 +1,55 @@
+/*============================================================================
+ *
+ * fsintf/diskasync.h
+ *
+ * Reading a run of sectors in the background, for callers that have
+ * work to do on each sector as it arrives. disk_read_start sends the
+ * read command, and disk_read_poll collects whatever sectors have
+ * arrived, without waiting for any more. On the Pico, each sector is
+ * transferred by DMA while the caller works on the one before it.
+ *
+ * The card holds the SPI bus from disk_read_start until
+ * disk_read_finish, so nothing else on the bus -- the display, in
+ * particular -- can be used in between, and no other disk I/O can be
+ * done. The work that overlaps the reads must be computation.
+ *
+ * These reads bypass the sector cache, and are not retried if they
+ * fail. The caller should read whatever did not arrive with disk_read,
+ * which does retry.
+ *
+ * These functions are implemented by the platform-specific disk I/O
+ * code. On the host, without an emulated card, the whole read is done
+ * by disk_read_start.
+ *
+ * Copyright (c)2023 Kevin Boone, GPL v3.0
+ *
+ * ==========================================================================*/
+
+#pragma once
+
+#include <ff.h>
+#include <diskio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Start reading count sectors, from sector, into buff. Only one read
+    can be in progress at a time. If this returns RES_OK,
+    disk_read_finish must be called, even if the read fails. */
+extern DRESULT disk_read_start (BYTE pdrv, BYTE *buff, LBA_t sector,
+        UINT count);
+
+/** Collect any sectors that have arrived, and return the number that
+    have arrived so far, which are the first in buff. Returns -1 if the
+    read failed, in which case the sectors already counted are still
+    good. */
+extern int disk_read_poll (BYTE pdrv);
+
+/** Finish the read, and release the bus. This can be called before all
+    the sectors have arrived, to abandon the read. */
+extern void disk_read_finish (BYTE pdrv);
+
+#ifdef __cplusplus
+}
+#endif
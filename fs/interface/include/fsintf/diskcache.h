@@ -0,0 +1,103 @@
+/*============================================================================
+ *
+ * fsintf/diskcache.h
+ *
+ * A small sector cache, between FatFs and the block device. FatFs reads
+ * the FAT and directories a sector at a time, and reads the same sectors
+ * over and over again when it follows cluster chains, or scans a 
+ * directory with many files. The cache keeps the most recently used 
+ * sectors in RAM. It is write-through, so the card is always up to date.
+ *
+ * Sectors before the start of the data area -- the boot sector, the FATs,
+ * and (except on FAT32 and exFAT) the root directory -- are metadata. 
+ * Sectors in the data area are file contents or, on FAT32 and exFAT, 
+ * directories. Each kind has its own policy, so that reading a large
+ * photo doesn't push all the metadata out of the cache. 
+ *
+ * FatFs reads the FAT and directories into its window, fs->win, and the
+ * parts of files that it doesn't transfer in whole sectors into the 
+ * file's own buffer, fp->buf. The policy DISKCACHE_WINDOW, for data, 
+ * caches only the first kind. A photo that is decoded a few bytes at a
+ * time, through fp->buf, is read a sector at a time, and would otherwise
+ * cost a copy of every sector into the cache, and push the directories
+ * out of it.
+ *
+ * Copyright (c)2023 Kevin Boone, GPL v3.0
+ *
+ * ==========================================================================*/
+
+#pragma once
+
+#include <ff.h>
+#include <diskio.h>
+
+typedef enum
+  {
+  DISKCACHE_NEVER = 0, // Don't cache
+  DISKCACHE_SINGLE = 1, // Cache sectors only from single-sector reads
+  DISKCACHE_ALWAYS = 2, // Cache everything 
+  DISKCACHE_WINDOW = 3 // Cache sectors only when read into FatFs's window
+  } DiskCachePolicy;
+
+typedef DRESULT (*DiskCacheReadFn) (BYTE pdrv, BYTE *buff, LBA_t sector, 
+                   UINT count);
+typedef DRESULT (*DiskCacheWriteFn) (BYTE pdrv, const BYTE *buff, 
+                   LBA_t sector, UINT count);
+
+typedef struct _DiskCacheStats
+  {
+  unsigned int meta_hits; // Counts of sectors
+  unsigned int meta_misses;
+  unsigned int data_hits;
+  unsigned int data_misses;
+  unsigned int uncached; // Read without looking in the cache
+  } DiskCacheStats;
+
+struct _DiskCache;
+typedef struct _DiskCache DiskCache;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Create a cache of the specified number of sectors, which reads and
+    writes the device using read_fn and write_fn. Returns NULL if there
+    isn't enough memory. */
+extern DiskCache *diskcache_new (unsigned int sectors, 
+        DiskCachePolicy meta_policy, DiskCachePolicy data_policy,
+        DiskCacheReadFn read_fn, DiskCacheWriteFn write_fn);
+
+extern void diskcache_destroy (DiskCache *self);
+
+/** Set the first sector of the data area. Until this is called, all 
+    sectors are treated as metadata. */
+extern void diskcache_set_data_start (DiskCache *self, LBA_t data_start);
+
+/** Set the buffer that FatFs uses as its window -- the win member of the
+    FATFS. Until this is called, the policy DISKCACHE_WINDOW caches 
+    nothing. */
+extern void diskcache_set_window (DiskCache *self, const BYTE *window);
+
+/** Forget all cached sectors -- when the card might have changed. */
+extern void diskcache_invalidate (DiskCache *self);
+
+/** Read sectors, from the cache where possible, with the same 
+    arguments and results as disk_read. */
+extern DRESULT diskcache_read (DiskCache *self, BYTE pdrv, BYTE *buff, 
+        LBA_t sector, UINT count);
+
+/** Write sectors to the device, updating any copies in the cache. */
+extern DRESULT diskcache_write (DiskCache *self, BYTE pdrv, 
+        const BYTE *buff, LBA_t sector, UINT count);
+
+extern const DiskCacheStats *diskcache_get_stats (const DiskCache *self);
+
+/** Get the cache used by the disk_xxx functions, or NULL if there 
+    isn't one. This is implemented by the platform-specific disk I/O 
+    code. */
+extern DiskCache *disk_get_cache (void);
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -0,0 +1,233 @@
+/*============================================================================
+ *
+ * diskcache.c
+ *
+ * Implementation of the sector cache in fsintf/diskcache.h. The cache is
+ * small -- a few tens of sectors -- so a linear search is fast enough,
+ * and least-recently-used is tracked with a counter per sector.
+ *
+ * Copyright (c)2023 Kevin Boone, GPL v3.0
+ *
+ * ==========================================================================*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <ff.h>
+#include <diskio.h>
+#include <fsintf/diskcache.h>
+
+#define DISKCACHE_SECTOR_SIZE 512
+
+typedef struct _DiskCacheEntry
+  {
+  LBA_t sector;
+  uint32_t last_used; // Zero if the entry is empty
+  } DiskCacheEntry;
+
+struct _DiskCache
+  {
+  unsigned int size; // Number of sectors
+  DiskCachePolicy meta_policy;
+  DiskCachePolicy data_policy;
+  DiskCacheReadFn read_fn;
+  DiskCacheWriteFn write_fn;
+  LBA_t data_start;
+  const BYTE *window; // FatFs's window, or NULL if not known
+  uint32_t clock; // Incremented on every access
+  DiskCacheEntry *entries;
+  BYTE *data;
+  DiskCacheStats stats;
+  };
+
+/*============================================================================
+ * diskcache_new
+ * ==========================================================================*/
+DiskCache *diskcache_new (unsigned int sectors, DiskCachePolicy meta_policy,
+        DiskCachePolicy data_policy, DiskCacheReadFn read_fn,
+        DiskCacheWriteFn write_fn)
+  {
+  DiskCache *self = malloc (sizeof (DiskCache));
+  if (!self) return NULL;
+  memset (self, 0, sizeof (DiskCache));
+  self->size = sectors;
+  self->meta_policy = meta_policy;
+  self->data_policy = data_policy;
+  self->read_fn = read_fn;
+  self->write_fn = write_fn;
+  self->data_start = (LBA_t)-1;
+  self->entries = calloc (sectors, sizeof (DiskCacheEntry));
+  self->data = malloc ((size_t)sectors * DISKCACHE_SECTOR_SIZE);
+  if (!self->entries || !self->data)
+    {
+    diskcache_destroy (self);
+    return NULL;
+    }
+  return self;
+  }
+
+/*============================================================================
+ * diskcache_destroy
+ * ==========================================================================*/
+void diskcache_destroy (DiskCache *self)
+  {
+  free (self->entries);
+  free (self->data);
+  free (self);
+  }
+
+/*============================================================================
+ * diskcache_set_data_start
+ * ==========================================================================*/
+void diskcache_set_data_start (DiskCache *self, LBA_t data_start)
+  {
+  self->data_start = data_start;
+  }
+
+/*============================================================================
+ * diskcache_set_window
+ * ==========================================================================*/
+void diskcache_set_window (DiskCache *self, const BYTE *window)
+  {
+  self->window = window;
+  }
+
+/*============================================================================
+ * diskcache_invalidate
+ * ==========================================================================*/
+void diskcache_invalidate (DiskCache *self)
+  {
+  for (unsigned int i = 0; i < self->size; i++)
+    self->entries[i].last_used = 0;
+  }
+
+/*============================================================================
+ * diskcache_find
+ * Return the index of the entry holding sector, or -1
+ * ==========================================================================*/
+static int diskcache_find (const DiskCache *self, LBA_t sector)
+  {
+  for (unsigned int i = 0; i < self->size; i++)
+    {
+    const DiskCacheEntry *e = &self->entries[i];
+    if (e->last_used && e->sector == sector) return (int)i;
+    }
+  return -1;
+  }
+
+/*============================================================================
+ * diskcache_victim
+ * Return the index of an empty entry or, if there isn't one, the least
+ *   recently used
+ * ==========================================================================*/
+static unsigned int diskcache_victim (const DiskCache *self)
+  {
+  unsigned int victim = 0;
+  for (unsigned int i = 0; i < self->size; i++)
+    {
+    if (self->entries[i].last_used < self->entries[victim].last_used)
+      victim = i;
+    }
+  return victim;
+  }
+
+/*============================================================================
+ * diskcache_store
+ * Put a copy of a sector in the cache, replacing the least recently used
+ * ==========================================================================*/
+static void diskcache_store (DiskCache *self, LBA_t sector, const BYTE *buff)
+  {
+  unsigned int i = diskcache_victim (self);
+  memcpy (self->data + i * DISKCACHE_SECTOR_SIZE, buff,
+    DISKCACHE_SECTOR_SIZE);
+  self->entries[i].sector = sector;
+  self->entries[i].last_used = ++self->clock;
+  }
+
+/*============================================================================
+ * diskcache_read
+ * ==========================================================================*/
+DRESULT diskcache_read (DiskCache *self, BYTE pdrv, BYTE *buff,
+        LBA_t sector, UINT count)
+  {
+  // A transfer is cached only if every sector in it can be. In
+  //   practice, multi-sector transfers are file data, and very rarely
+  //   straddle the start of the data area.
+  bool meta = sector + count <= self->data_start;
+  DiskCachePolicy policy = meta ? self->meta_policy : self->data_policy;
+  if (policy == DISKCACHE_NEVER
+       || (policy == DISKCACHE_SINGLE && count > 1)
+       || (policy == DISKCACHE_WINDOW && buff != self->window))
+    {
+    self->stats.uncached += count;
+    return self->read_fn (pdrv, buff, sector, count);
+    }
+
+  // Sectors that are not in the cache are read in runs, directly into
+  //   the caller's buffer, and then copied into the cache.
+  UINT run = 0; // Number of misses before sector + i
+  for (UINT i = 0; i <= count; i++)
+    {
+    int e = i < count ? diskcache_find (self, sector + i) : -1;
+    if (e >= 0 || i == count)
+      {
+      if (run > 0)
+        {
+        UINT first = i - run;
+        BYTE *dest = buff + first * DISKCACHE_SECTOR_SIZE;
+        DRESULT ret = self->read_fn (pdrv, dest, sector + first, run);
+        if (ret != RES_OK) return ret;
+        for (UINT j = 0; j < run; j++)
+          diskcache_store (self, sector + first + j,
+            dest + j * DISKCACHE_SECTOR_SIZE);
+        run = 0;
+        }
+      if (e >= 0)
+        {
+        memcpy (buff + i * DISKCACHE_SECTOR_SIZE,
+          self->data + (unsigned int)e * DISKCACHE_SECTOR_SIZE,
+          DISKCACHE_SECTOR_SIZE);
+        self->entries[e].last_used = ++self->clock;
+        if (meta) self->stats.meta_hits++; else self->stats.data_hits++;
+        }
+      }
+    else
+      {
+      run++;
+      if (meta) self->stats.meta_misses++; else self->stats.data_misses++;
+      }
+    }
+  return RES_OK;
+  }
+
+/*============================================================================
+ * diskcache_write
+ * ==========================================================================*/
+DRESULT diskcache_write (DiskCache *self, BYTE pdrv, const BYTE *buff,
+        LBA_t sector, UINT count)
+  {
+  DRESULT ret = self->write_fn (pdrv, buff, sector, count);
+  // Keep cached copies in step with the card -- or, if the write
+  //   failed, we don't know what's on the card, so forget them.
+  for (UINT i = 0; i < count; i++)
+    {
+    int e = diskcache_find (self, sector + i);
+    if (e < 0) continue;
+    if (ret == RES_OK)
+      memcpy (self->data + (unsigned int)e * DISKCACHE_SECTOR_SIZE,
+        buff + i * DISKCACHE_SECTOR_SIZE, DISKCACHE_SECTOR_SIZE);
+    else
+      self->entries[e].last_used = 0;
+    }
+  return ret;
+  }
+
+/*============================================================================
+ * diskcache_get_stats
+ * ==========================================================================*/
+const DiskCacheStats *diskcache_get_stats (const DiskCache *self)
+  {
+  return &self->stats;
+  }
+
@@ -6,12 +6,17 @@
  *
  * ==========================================================================*/
 
-#if PICO_ON_DEVICE
+#include "config.h"
+
+// Host builds use this too, if the SD card is emulated
+#if PICO_ON_DEVICE || HOST_SD_EMULATOR
 
 #include <stdio.h>
 #include <ff.h> // From ChaN's FAT driver
 #include <diskio.h> // From ChaN's FAT driver
 #include <sdcard/sdcard.h> 
+#include <fsintf/diskcache.h> 
+#include <fsintf/diskasync.h> 
 
 //#define TRACE SYSLOG_TRACE
 //#define DEBUG SYSLOG_DEBUG
@@ -50,6 +55,29 @@ static int sdcard_err_to_fatfs_err (int err)
     }
   }
 
+// The sector cache, created when the disk is first initialized
+static DiskCache *disk_cache;
+
+// The state of the read started by disk_read_start
+static BYTE *async_buff; // Where the sectors go
+static UINT async_count; // Sectors to read
+static UINT async_queued; // Sectors whose buffers have been queued
+static UINT async_done; // Sectors that have arrived
+static bool async_failed;
+
+static DRESULT disk_read_uncached (BYTE pdrv,  BYTE *buff, LBA_t sector, 
+        UINT count);
+static DRESULT disk_write_uncached (BYTE pdrv, const BYTE *buff, 
+        LBA_t sector, UINT count);
+
+/*============================================================================
+ * disk_get_cache
+ * ==========================================================================*/
+DiskCache *disk_get_cache (void)
+  {
+  return disk_cache;
+  }
+
 /*============================================================================
  * disk_initialize
  * see http://elm-chan.org/fsw/ff/doc/dinit.html
@@ -84,6 +112,13 @@ DSTATUS disk_initialize (BYTE pdrv)
   else
     ret |= STA_NOINIT;
 
+  // It might be a different card
+  if (disk_cache)
+    diskcache_invalidate (disk_cache);
+  else if (DISK_CACHE_SECTORS > 0)
+    disk_cache = diskcache_new (DISK_CACHE_SECTORS, DISK_CACHE_META_POLICY,
+      DISK_CACHE_DATA_POLICY, disk_read_uncached, disk_write_uncached);
+
 #ifdef TRACE
   TRACE ("%s:%d donn", __FUNCTION__, __LINE__);
 #endif
@@ -134,10 +169,10 @@ DSTATUS disk_status (BYTE pdrv)
   }
 
 /*============================================================================
- * disk_read
- * see http://elm-chan.org/fsw/ff/doc/dread.html
+ * disk_read_uncached
  * ==========================================================================*/
-DRESULT disk_read (BYTE pdrv,  BYTE *buff, LBA_t sector, UINT count) 
+static DRESULT disk_read_uncached (BYTE pdrv,  BYTE *buff, LBA_t sector, 
+        UINT count) 
   {
 #ifdef TRACE
   TRACE ("%s:%d start", __FUNCTION__, __LINE__);
@@ -162,10 +197,85 @@ DRESULT disk_read (BYTE pdrv,  BYTE *buff, LBA_t sector, UINT count)
   }
 
 /*============================================================================
- * disk_write
- * see http://elm-chan.org/fsw/ff/doc/dwrite.html
+ * disk_read
+ * see http://elm-chan.org/fsw/ff/doc/dread.html
  * ==========================================================================*/
-DRESULT disk_write (BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count) 
+DRESULT disk_read (BYTE pdrv,  BYTE *buff, LBA_t sector, UINT count) 
+  {
+  if (disk_cache)
+    return diskcache_read (disk_cache, pdrv, buff, sector, count);
+  return disk_read_uncached (pdrv, buff, sector, count);
+  }
+
+/*============================================================================
+ * disk_read_start
+ * As many sectors are queued as the driver allows; the rest are queued
+ *   as the ones before them arrive.
+ * ==========================================================================*/
+DRESULT disk_read_start (BYTE pdrv, BYTE *buff, LBA_t sector, UINT count)
+  {
+  SDCard *s = sdcard_get_instance (pdrv); 
+  if (!s)
+    return RES_NOTRDY; // Should not be possible to get here
+
+  SDError ret = sdcard_read_begin (s, (uint32_t)sector, count);
+  if (ret != 0)
+    {
+#ifdef WARN
+    WARN ("%s:%d sdcard_read_begin error %d", __FUNCTION__, __LINE__, ret);
+#endif
+    return sdcard_err_to_fatfs_err (ret);
+    }
+
+  async_buff = buff;
+  async_count = count;
+  async_queued = 0;
+  async_done = 0;
+  async_failed = false;
+  while (async_queued < count && async_queued < SDCARD_READ_QUEUE)
+    sdcard_read_queue (s, async_buff + async_queued++ * SD_BLOCK_SIZE);
+  return RES_OK;
+  }
+
+/*============================================================================
+ * disk_read_poll
+ * ==========================================================================*/
+int disk_read_poll (BYTE pdrv)
+  {
+  SDCard *s = sdcard_get_instance (pdrv); 
+  while (!async_failed && async_done < async_count)
+    {
+    uint8_t *sector;
+    SDError ret = sdcard_read_wait (s, &sector);
+    if (ret == SD_ERR_BUSY) break;
+    if (ret != 0)
+      {
+#ifdef WARN
+      WARN ("%s:%d sdcard_read_wait error %d", __FUNCTION__, __LINE__, ret);
+#endif
+      async_failed = true;
+      break;
+      }
+    async_done++;
+    if (async_queued < async_count)
+      sdcard_read_queue (s, async_buff + async_queued++ * SD_BLOCK_SIZE);
+    }
+  return async_failed ? -1 : (int)async_done;
+  }
+
+/*============================================================================
+ * disk_read_finish
+ * ==========================================================================*/
+void disk_read_finish (BYTE pdrv)
+  {
+  sdcard_read_end (sdcard_get_instance (pdrv));
+  }
+
+/*============================================================================
+ * disk_write_uncached
+ * ==========================================================================*/
+static DRESULT disk_write_uncached (BYTE pdrv, const BYTE *buff, 
+        LBA_t sector, UINT count) 
   {
 #ifdef TRACE
   TRACE ("%s:%d start", __FUNCTION__, __LINE__);
@@ -189,6 +299,17 @@ DRESULT disk_write (BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count)
   return sdcard_err_to_fatfs_err (ret);
   }
 
+/*============================================================================
+ * disk_write
+ * see http://elm-chan.org/fsw/ff/doc/dwrite.html
+ * ==========================================================================*/
+DRESULT disk_write (BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count) 
+  {
+  if (disk_cache)
+    return diskcache_write (disk_cache, pdrv, buff, sector, count);
+  return disk_write_uncached (pdrv, buff, sector, count);
+  }
+
 DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void *buff)
   {
   (void)pdrv; (void)cmd; (void)buff;
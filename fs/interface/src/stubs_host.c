@@ -2,14 +2,19 @@
   Copyright (c)2022 Kevin Boone, GPLv3.0
  ======================================================================= */
 
-#if PICO_ON_DEVICE
+#include "config.h"
+
+#if PICO_ON_DEVICE || HOST_SD_EMULATOR
 #else
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <ff.h> // From ChaN's FAT driver
 #include <diskio.h> // From ChaN's FAT driver
+#include <fsintf/diskcache.h> 
+#include <fsintf/diskasync.h> 
 //#include <fat/fat.h>
 
 //#define TRACE SYSLOG_TRACE
@@ -17,10 +22,29 @@
 //#define INFO SYSLOG_INFO
 //#define WARN SYSLOG_WARN
 
-#define FATFS_LOOPBACK_FILE "/tmp/fatfs_loopback.img"
+#define FATFS_LOOPBACK_FILE HOST_SD_IMAGE
 
 static int fd = -1;
 
+// The sector cache, created when the disk is first initialized
+static DiskCache *disk_cache;
+
+// The result of disk_read_start: the number of sectors read, or -1
+static int async_done;
+
+static DRESULT disk_read_uncached (BYTE pdrv,  BYTE *buff, LBA_t sector, 
+        UINT count);
+static DRESULT disk_write_uncached (BYTE pdrv, const BYTE *buff, 
+        LBA_t sector, UINT count);
+
+/*============================================================================
+ * disk_get_cache
+ * ==========================================================================*/
+DiskCache *disk_get_cache (void)
+  {
+  return disk_cache;
+  }
+
 /*============================================================================
  * sdcard_err_to_fatfs_err
  * Converts and error code returned by one of the sdcard_xxx functions into
@@ -46,10 +70,21 @@ DSTATUS disk_initialize (BYTE pdrv)
 #endif
 
   DSTATUS ret = 0;
-  fd = open (FATFS_LOOPBACK_FILE, O_RDWR);
+  // The image can be changed at run time, so tools can work on more 
+  //   than one
+  const char *image = getenv ("PPC_SDIMAGE");
+  if (!image || !*image) image = FATFS_LOOPBACK_FILE;
+  if (fd >= 0) close (fd);
+  fd = open (image, O_RDWR);
   if (fd < 0)
     return STA_NOINIT;
 
+  if (disk_cache)
+    diskcache_invalidate (disk_cache);
+  else if (DISK_CACHE_SECTORS > 0)
+    disk_cache = diskcache_new (DISK_CACHE_SECTORS, DISK_CACHE_META_POLICY,
+      DISK_CACHE_DATA_POLICY, disk_read_uncached, disk_write_uncached);
+
 #ifdef TRACE
   TRACE ("Done");
 #endif
@@ -78,10 +113,10 @@ DSTATUS disk_status (BYTE pdrv)
   }
 
 /*============================================================================
- * disk_read
- * see http://elm-chan.org/fsw/ff/doc/dread.html
+ * disk_read_uncached
  * ==========================================================================*/
-DRESULT disk_read (BYTE pdrv,  BYTE *buff, LBA_t sector, UINT count) 
+static DRESULT disk_read_uncached (BYTE pdrv,  BYTE *buff, LBA_t sector, 
+        UINT count) 
   {
   (void)pdrv;
 #ifdef TRACE
@@ -99,10 +134,50 @@ DRESULT disk_read (BYTE pdrv,  BYTE *buff, LBA_t sector, UINT count)
   }
 
 /*============================================================================
- * disk_write
- * see http://elm-chan.org/fsw/ff/doc/dwrite.html
+ * disk_read
+ * see http://elm-chan.org/fsw/ff/doc/dread.html
  * ==========================================================================*/
-DRESULT disk_write (BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count) 
+DRESULT disk_read (BYTE pdrv,  BYTE *buff, LBA_t sector, UINT count) 
+  {
+  if (disk_cache)
+    return diskcache_read (disk_cache, pdrv, buff, sector, count);
+  return disk_read_uncached (pdrv, buff, sector, count);
+  }
+
+/*============================================================================
+ * disk_read_start
+ * The image file is read straight away, so there's nothing left to do
+ *   in the background
+ * ==========================================================================*/
+DRESULT disk_read_start (BYTE pdrv, BYTE *buff, LBA_t sector, UINT count)
+  {
+  DRESULT ret = disk_read_uncached (pdrv, buff, sector, count);
+  async_done = ret == RES_OK ? (int)count : -1;
+  return ret;
+  }
+
+/*============================================================================
+ * disk_read_poll
+ * ==========================================================================*/
+int disk_read_poll (BYTE pdrv)
+  {
+  (void)pdrv;
+  return async_done;
+  }
+
+/*============================================================================
+ * disk_read_finish
+ * ==========================================================================*/
+void disk_read_finish (BYTE pdrv)
+  {
+  (void)pdrv;
+  }
+
+/*============================================================================
+ * disk_write_uncached
+ * ==========================================================================*/
+static DRESULT disk_write_uncached (BYTE pdrv, const BYTE *buff, 
+        LBA_t sector, UINT count) 
   {
   (void)pdrv;
 #ifdef TRACE
@@ -119,6 +194,17 @@ DRESULT disk_write (BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count)
   return linux_err_to_fatfs_err (ret);
   }
 
+/*============================================================================
+ * disk_write
+ * see http://elm-chan.org/fsw/ff/doc/dwrite.html
+ * ==========================================================================*/
+DRESULT disk_write (BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count) 
+  {
+  if (disk_cache)
+    return diskcache_write (disk_cache, pdrv, buff, sector, count);
+  return disk_write_uncached (pdrv, buff, sector, count);
+  }
+
 DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void *buff)
   {
   (void)pdrv; (void)cmd; (void)buff;
@@ -9,7 +9,9 @@
 
 #include <waveshare_lcd/waveshare_lcd.h>
 #include <gfx/fonthandler.h>
+#include <stdbool.h>
 #include <ds3231/ds3231.h>
+#include <gfx/framestats.h>
 
 struct _Clock;
 typedef struct _Clock Clock;
@@ -30,12 +32,24 @@ extern void clock_destroy (Clock *self);
 extern void clock_position_at (Clock *self, unsigned int x, 
                unsigned int y);
 
-/** Force and update of the entire clock -- time and date.
-    Because we don't display seconds yet, this is the only function
-    provided to update the display, and it should be called once
-    a minute (but pobably no more).  */
+/** Force and update of the entire clock -- time and date. This is
+    needed after anything else has been drawn over the clock, such 
+    as a new background.  */
 extern void clock_draw_all (Clock *self);
 
+/** Read the time, and redraw only the digits that have changed since 
+    the clock was last drawn. This is cheap enough to call once a 
+    second, and must be, if the seconds are shown. */
+extern void clock_update (Clock *self);
+
+/** Show or hide the seconds, which are drawn in the small font to the
+    right of the minutes. This changes the size of the clock, so call 
+    it before clock_get_size. */
+extern void clock_set_show_seconds (Clock *self, bool show_seconds);
+
+/** Timing of clock_update calls. */
+extern const FrameStats *clock_get_stats (const Clock *self);
+
 /** Return the overall size of the clock, calculated from the supplied
     fonts. */
 extern void clock_get_size (const Clock *self, 
@@ -14,6 +14,24 @@
 #pragma once
 
 #include <stdint.h>
+#include <waveshare_lcd/waveshare_lcd.h>
+
+// In the offset table of a glyph atlas or RLE font, marks a character 
+//   that is not in the font 
+#define FONTHANDLER_NO_GLYPH 0xFFFFFFFF
+
+// Op-codes in the run-length encoded font format. Each glyph is a stream
+//   of these, covering font_width * font_height pixels in raster order.
+//   Coverage values are four bits, 0 (background) to 15 (foreground).
+// 0x00-0x3F: 1-64 pixels of coverage 0
+#define FONTHANDLER_RLE_BLANK   0x00
+// 0x40-0x7F: 1-64 pixels of coverage 15
+#define FONTHANDLER_RLE_SOLID   0x40
+// 0x80-0xFF: 1-128 pixels of coverage follow, two per byte, high
+//   nibble first
+#define FONTHANDLER_RLE_LITERAL 0x80
+#define FONTHANDLER_RLE_MAX_RUN 64
+#define FONTHANDLER_RLE_MAX_LITERAL 128
 
 struct _FontHandler;
 typedef struct _FontHandler FontHandler;
@@ -29,16 +47,62 @@ extern FontHandler *fonthandler_new (unsigned char *font_data[95],
                       unsigned int *font_length[95], unsigned int font_width, 
                       unsigned int font_height);
 
+/** Create a fonthandler instance from a pre-rendered glyph atlas, 
+      generated by the fontconv utility. The atlas is an array of RGB565
+      pixels, already blended for a specific foreground and background
+      colour, each glyph font_width by font_height pixels. offsets[c - 32]
+      is the index in pixels of the first pixel of character c, or
+      FONTHANDLER_NO_GLYPH. As the atlas will be in flash, glyphs can be
+      sent straight to the display with no decoding and no copying. */
+extern FontHandler *fonthandler_new_atlas (const uint16_t *pixels, 
+                      const uint32_t offsets[95], unsigned int font_width, 
+                      unsigned int font_height);
+
+/** Create a fonthandler instance from a run-length encoded font, 
+      generated by fontconv -r. The glyphs are stored as 4-bit coverage
+      values, so the colours can be set at run time using 
+      fonthandler_set_colours. fonthandler_draw_glyph expands them
+      straight into the pixel stream going to the display, so no glyph
+      buffer is needed, and decoding runs at memory speed. The arguments
+      are as for fonthandler_new_atlas, except that the offsets are
+      in bytes. */
+extern FontHandler *fonthandler_new_rle (const uint8_t *data, 
+                      const uint32_t offsets[95], unsigned int font_width, 
+                      unsigned int font_height);
+
 extern void fonthandler_destroy (FontHandler *self);
 
+/** Set the RGB565 foreground and background colours of a run-length
+      encoded font. The default is white on black. The colours of 
+      other font types are fixed, and this function has no effect. */
+extern void fonthandler_set_colours (FontHandler *self, uint16_t fg, 
+                      uint16_t bg);
+
+/** Draw the glyph for the specified character, with its top-left corner
+      at x,y on the display. This is the quickest way to draw a glyph,
+      whatever kind of font it comes from. */
+extern void fonthandler_draw_glyph (FontHandler *self, WSLCD *wslcd, 
+                      int c, unsigned int x, unsigned int y);
+
+/** As fonthandler_draw_glyph, but enlarge the glyph by an integer scale
+      factor, by repeating pixels and rows as they are sent to the 
+      display. The glyph occupies scale * font_width by 
+      scale * font_height pixels. Only one scaled row is ever held in
+      memory. */
+extern void fonthandler_draw_glyph_scaled (FontHandler *self, 
+                      WSLCD *wslcd, int c, unsigned int x, unsigned int y,
+                      unsigned int scale);
+
 /** Generate a glyph for the specified character, which must be in the
       range 32-126. The return value is a link to an internal buffer, 
       and the caller must not free or modify it. The data returns is
-      an array of 8-bit unsigned intensity values. */
+      an array of 8-bit unsigned intensity values. For an atlas font,
+      the intensity is taken from the green component. */
 extern const unsigned char *fonthandler_get_glyph (FontHandler *self, int c);
 
 /** As fonthandler_get_glyph, but returns an array of 16-bit RGB565 values, 
-      suitable for transferring directly to an RGB565 display panel. */ 
+      suitable for transferring directly to an RGB565 display panel. 
+      For an atlas font, this is a pointer into the atlas itself. */ 
 extern const uint16_t *fonthandler_get_glyph_565 (FontHandler *self, int c);
 
 extern unsigned int fonthandler_get_font_height (const FontHandler *self);
@@ -0,0 +1,38 @@
+/*============================================================================
+ *
+ *  gfx/framestats.h
+ *
+ * Timing of periodic display updates, for the 'stats' command. 
+ *
+ * Copyright (c)2023 Kevin Boone, GPL v3.0
+ *
+ * ==========================================================================*/
+#pragma once
+
+#include <stdint.h>
+
+typedef struct _FrameStats
+  {
+  unsigned int frames;
+  uint32_t last_us;
+  uint32_t worst_us;
+  uint64_t total_us;
+  } FrameStats;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Record one frame, taking the specified time. */
+extern void framestats_add (FrameStats *self, uint32_t us);
+
+/** Print the statistics to stdout, each line prefixed with name. The
+    budget is the time available for a frame, so the fraction of the
+    CPU used can be shown. */
+extern void framestats_print (const FrameStats *self, const char *name,
+              uint32_t budget_us);
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -117,6 +117,13 @@ typedef unsigned char (*pjpeg_need_bytes_callback_t)(unsigned char* pBuf, unsign
 // Not thread safe.
 unsigned char pjpeg_decode_init(pjpeg_image_info_t *pInfo, pjpeg_need_bytes_callback_t pNeed_bytes_callback, void *pCallback_data, unsigned char reduce);
 
+typedef unsigned char (*pjpeg_need_bytes_ptr_callback_t)(const unsigned char **ppBuf, unsigned short *pBytes_available, void *pCallback_data);
+
+// As pjpeg_decode_init, but the callback supplies a pointer to the caller's own data, which is decoded 
+// where it is, rather than being copied into the decompressor's input buffer. The data must stay valid 
+// until the callback is called again. Setting *pBytes_available to 0 means the end of the input.
+unsigned char pjpeg_decode_init_ptr(pjpeg_image_info_t *pInfo, pjpeg_need_bytes_ptr_callback_t pNeed_bytes_ptr_callback, void *pCallback_data, unsigned char reduce);
+
 // Decompresses the file's next MCU. Returns 0 on success, PJPG_NO_MORE_BLOCKS if no more blocks are available, or an error code.
 // Must be called a total of m_MCUSPerRow*m_MCUSPerCol times to completely decompress the image.
 // Not thread safe.
@@ -10,6 +10,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <pico/stdlib.h>
 #include <waveshare_lcd/waveshare_lcd.h>
 #include <gfx/clock.h>
 #include <gfx/fonthandler.h>
@@ -32,8 +33,20 @@ struct _Clock
   unsigned int small_font_height;
   unsigned int x;
   unsigned int y;
+  bool show_seconds;
+  // What is currently on screen, so that clock_update can redraw only
+  //   the characters that have changed. Empty after clock_draw_all.
+  char shown_hhmm[5];
+  char shown_ss[3];
+  char shown_date[8];
+  FrameStats stats;
   };
 
+// Space between the hours and the minutes, where the colon goes
+#define CLOCK_COLON_GAP 20
+// Space between the minutes and the seconds
+#define CLOCK_SECONDS_GAP 8
+
 /* =======================================================================
   clock_position_at
  ======================================================================= */
@@ -45,66 +58,13 @@ void clock_position_at (Clock *self, unsigned int x,
   }
 
 /* =======================================================================
-  clock_draw_seconds
-  Not currently used
- ======================================================================= */
-void clock_draw_seconds (Clock *self)
-  {
-  (void)self;
-  /*
-  int s = 1; 
-
-  int dummy;
-  ds3231_get_datetime (self->ds3231, &dummy, 
-        &dummy, &dummy, &dummy, &dummy, &s);
-
-  if (s == 0)
-     clock_draw_all (self);
-  else
-    {
-    char ss[10];
-    sprintf (ss, "%02d", s);
-    unsigned int y = self->y;
-    for (unsigned int i = 0; i < 2; i++)
-      {
-      unsigned int x = self->x + self->font_width * (i + 6); 
-      const uint16_t *glyph565 = fonthandler_get_glyph_565 
-	(self->fh, ss[i]);
-      wslcd_transfer_window (self->wslcd, glyph565, 
-	(uint16_t)self->font_width, (uint16_t)self->font_height, 
-       (uint16_t) x, (uint16_t)y); 
-      }
-    }
-  */
-  }
-
-/* =======================================================================
-  clock_draw_all
+  clock_draw_char
  ======================================================================= */
 static void clock_draw_char (Clock *self, int size, unsigned int x, 
         unsigned int y, int c)
   {
-  FontHandler *fh;
-  unsigned int font_width;
-  unsigned int font_height;
-  if (size == 0)
-    {
-    fh = self->big_fh;
-    font_width = self->big_font_width;
-    font_height = self->big_font_height;
-    }
-  else
-    {
-    fh = self->small_fh;
-    font_width = self->small_font_width;
-    font_height = self->small_font_height;
-    }
-
-  const uint16_t *glyph565 = fonthandler_get_glyph_565 (fh, c);
-
-  wslcd_write_window (self->wslcd, glyph565, 
-      (uint16_t)font_width, (uint16_t)font_height, 
-     (uint16_t)x, (uint16_t)y); 
+  FontHandler *fh = (size == 0) ? self->big_fh : self->small_fh;
+  fonthandler_draw_glyph (fh, self->wslcd, c, x, y);
   }
 
 
@@ -141,6 +101,82 @@ static const char *clock_get_month_name (int month)
   return "???";
   }
 
+/* =======================================================================
+  clock_hhmm_width
+  Width of the time digits, which the date is centred under
+ ======================================================================= */
+static unsigned int clock_hhmm_width (const Clock *self)
+  {
+  return 4 * self->big_font_width + CLOCK_COLON_GAP;
+  }
+
+/* =======================================================================
+  clock_seconds_x, clock_seconds_y
+  The seconds are in the small font, to the right of the minutes. The
+    factor 4/5 lines up the baselines of the two fonts, which are 
+    about a fifth of the way up from the bottom of the glyph.
+ ======================================================================= */
+static unsigned int clock_seconds_x (const Clock *self)
+  {
+  return self->x + clock_hhmm_width (self) + CLOCK_SECONDS_GAP;
+  }
+
+static unsigned int clock_seconds_y (const Clock *self)
+  {
+  return self->y + (self->big_font_height - self->small_font_height) * 4 / 5;
+  }
+
+/* =======================================================================
+  clock_draw_time
+  Draw whatever parts of the time and date differ from what is on 
+    screen.
+ ======================================================================= */
+static void clock_draw_time (Clock *self, int month, int day, int h, 
+              int m, int s)
+  {
+  char hhmm[5];
+  snprintf (hhmm, sizeof (hhmm), "%02u%02u", (unsigned)h % 100, 
+    (unsigned)m % 100);
+  for (unsigned int i = 0; i < 4; i++)
+    {
+    if (self->shown_hhmm[i] == hhmm[i]) continue;
+    unsigned int x = self->x + i * self->big_font_width 
+      + (i >= 2 ? CLOCK_COLON_GAP : 0);
+    clock_draw_char (self, 0, x, self->y, hhmm[i]);
+    }
+  memcpy (self->shown_hhmm, hhmm, sizeof (hhmm));
+
+  if (self->show_seconds)
+    {
+    char ss[3];
+    snprintf (ss, sizeof (ss), "%02u", (unsigned)s % 100);
+    for (unsigned int i = 0; i < 2; i++)
+      {
+      if (self->shown_ss[i] == ss[i]) continue;
+      clock_draw_char (self, 1, clock_seconds_x (self) 
+        + i * self->small_font_width, clock_seconds_y (self), ss[i]);
+      }
+    memcpy (self->shown_ss, ss, sizeof (ss));
+    }
+
+  // TODO AM/PM
+  // Jan 29
+  char date[8];
+  snprintf (date, sizeof (date), "%s %02u", clock_get_month_name (month), 
+    (unsigned)day % 100);
+  if (strcmp (date, self->shown_date) != 0)
+    {
+    unsigned int date_width = 6 * self->small_font_width;
+    unsigned int clock_width = clock_hhmm_width (self);
+    unsigned date_x = 0;
+    if (clock_width > date_width)
+      date_x = (clock_width - date_width) / 2;
+    clock_draw_text (self, 1, self->x + date_x, 
+      self->y + self->big_font_height - DATE_Y_ADJUST, date);
+    strcpy (self->shown_date, date);
+    }
+  }
+
 /* =======================================================================
   clock_draw_all
  ======================================================================= */
@@ -156,34 +192,18 @@ void clock_draw_all (Clock *self)
   ds3231_get_datetime (self->ds3231, &dummy, 
         &month, &day, &h, &m, &s);
 
-  char ss[20];
-  sprintf (ss, "%02d%02d", h, m);
-
-  clock_draw_char (self, 0, self->x + self->big_font_width * 3 / 2 + 10, 
-    self->y, ':');
-
-  unsigned int x = self->x;
-  unsigned int y = self->y;
-  clock_draw_char (self, 0, x, y, ss[0]);
-  x += self->big_font_width;
-  clock_draw_char (self, 0, x, y, ss[1]);
-  x += self->big_font_width + 20;
-  clock_draw_char (self, 0, x, y, ss[2]);
-  x += self->big_font_width;
-  clock_draw_char (self, 0, x, y, ss[3]);
-  
-  // TODO AM/PM
-  // Jan 29
+  memset (self->shown_hhmm, 0, sizeof (self->shown_hhmm));
+  memset (self->shown_ss, 0, sizeof (self->shown_ss));
+  memset (self->shown_date, 0, sizeof (self->shown_date));
+
+  clock_draw_char (self, 0, self->x + self->big_font_width * 3 / 2 
+    + CLOCK_COLON_GAP / 2, self->y, ':');
+
   unsigned int date_width = 6 * self->small_font_width;
-  unsigned int clock_width = 4 * self->big_font_width + 20;
+  unsigned int clock_width = clock_hhmm_width (self);
   unsigned date_x = 0;
   if (clock_width > date_width)
     date_x = (clock_width - date_width) / 2;
-
-  sprintf (ss, "%s %02d", clock_get_month_name (month), day);
-  
-  clock_draw_text (self, 1, self->x + date_x, 
-    self->y + self->big_font_height - DATE_Y_ADJUST, ss);
  
   if (date_x > 0)
     {
@@ -200,8 +220,57 @@ void clock_draw_all (Clock *self)
      (uint16_t)(self->y + self->big_font_height 
         - DATE_Y_ADJUST + self->small_font_height), 
       0); 
+    }
 
+  if (self->show_seconds)
+    {
+    // Black out the whole column to the right of the time, so the 
+    //   clock remains a tidy box
+    unsigned int width, height;
+    clock_get_size (self, &width, &height);
+    wslcd_fill_area (self->wslcd, (uint16_t)(self->x + clock_width), 
+      (uint16_t)self->y, (uint16_t)(self->x + width), 
+      (uint16_t)(self->y + height), 0);
     }
+
+  clock_draw_time (self, month, day, h, m, s);
+  }
+
+/* =======================================================================
+  clock_update
+ ======================================================================= */
+void clock_update (Clock *self)
+  {
+  uint64_t start = time_us_64();
+
+  int month = 1;
+  int day = 1;
+  int h = 1;
+  int m = 1;
+  int s = 1; 
+
+  int dummy;
+  ds3231_get_datetime (self->ds3231, &dummy, 
+        &month, &day, &h, &m, &s);
+  clock_draw_time (self, month, day, h, m, s);
+
+  framestats_add (&self->stats, (uint32_t)(time_us_64() - start));
+  }
+
+/* =======================================================================
+  clock_set_show_seconds
+ ======================================================================= */
+void clock_set_show_seconds (Clock *self, bool show_seconds)
+  {
+  self->show_seconds = show_seconds;
+  }
+
+/* =======================================================================
+  clock_get_stats
+ ======================================================================= */
+const FrameStats *clock_get_stats (const Clock *self)
+  {
+  return &self->stats;
   }
 
 /* =======================================================================
@@ -212,7 +281,10 @@ void clock_get_size (const Clock *self,
   {
   *height = fonthandler_get_font_height (self->big_fh);
   *height += fonthandler_get_font_height (self->small_fh) - 16;
-  *width = 4 * fonthandler_get_font_width (self->big_fh) + 20;
+  *width = clock_hhmm_width (self);
+  if (self->show_seconds)
+    *width += CLOCK_SECONDS_GAP 
+      + 2 * fonthandler_get_font_width (self->small_fh);
   }
 
 /* =======================================================================
@@ -0,0 +1,1075 @@
+// This file is automatically generated. Do not edit
+// Generated by fontconv -r from dejavu_sans_mono_36
+#include "dejavu_sans_mono_36_rle.h"
+const uint8_t dejavu_sans_mono_36_rle_data[] = {
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x33,
+  0x3f, 0x3f, 0x3f, 0x84, 0x0e, 0xff, 0xa0, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12,
+  0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12,
+  0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12,
+  0x83, 0xef, 0xf9, 0x12, 0x83, 0xdf, 0xf9, 0x12, 0x83, 0xcf, 0xf8, 0x12, 0x83, 0xbf, 0xf7, 0x12,
+  0x83, 0xbf, 0xf6, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0x5a, 0xa3, 0x3f, 0x17, 0x83, 0x67, 0x74,
+  0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa,
+  0x3f, 0x3f, 0x3f, 0x2f, 0x3f, 0x3f, 0x3c, 0x80, 0x10, 0x42, 0x02, 0x83, 0x5f, 0xfb, 0x0b, 0x80,
+  0x10, 0x42, 0x02, 0x83, 0x5f, 0xfb, 0x0b, 0x80, 0x10, 0x42, 0x02, 0x83, 0x5f, 0xfb, 0x0b, 0x80,
+  0x10, 0x42, 0x02, 0x83, 0x5f, 0xfb, 0x0b, 0x80, 0x10, 0x42, 0x02, 0x83, 0x5f, 0xfb, 0x0b, 0x80,
+  0x10, 0x42, 0x02, 0x83, 0x5f, 0xfb, 0x0b, 0x80, 0x10, 0x42, 0x02, 0x83, 0x5f, 0xfb, 0x0b, 0x80,
+  0x10, 0x42, 0x02, 0x83, 0x5f, 0xfb, 0x0b, 0x80, 0x10, 0x42, 0x02, 0x83, 0x5f, 0xfb, 0x0b, 0x83,
+  0x1a, 0xaa, 0x02, 0x83, 0x4a, 0xb8, 0x0c, 0x80, 0x10, 0x1d, 0x80, 0x10, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x2f, 0x3f, 0x3f, 0x3f, 0x83, 0x0e, 0xfd, 0x03, 0x83, 0xcf, 0xf1, 0x0a,
+  0x83, 0x2f, 0xfa, 0x02, 0x83, 0x1f, 0xfc, 0x0b, 0x83, 0x6f, 0xf6, 0x02, 0x83, 0x4f, 0xf8, 0x0b,
+  0x83, 0xaf, 0xf2, 0x02, 0x83, 0x8f, 0xf4, 0x0b, 0x82, 0xdf, 0xe0, 0x03, 0x83, 0xcf, 0xf1, 0x0a,
+  0x83, 0x2f, 0xfa, 0x02, 0x83, 0x1f, 0xfc, 0x0b, 0x83, 0x6f, 0xf6, 0x02, 0x83, 0x5f, 0xf8, 0x06,
+  0x93, 0xaa, 0xab, 0xad, 0xff, 0xca, 0xab, 0xcf, 0xfc, 0xba, 0xa6, 0x02, 0x80, 0xe0, 0x51, 0x80,
+  0x90, 0x02, 0x80, 0xe0, 0x51, 0x80, 0x90, 0x06, 0x83, 0x6f, 0xf6, 0x02, 0x83, 0x4f, 0xf8, 0x0b,
+  0x83, 0x9f, 0xf3, 0x02, 0x83, 0x8f, 0xf4, 0x09, 0x84, 0x10, 0xef, 0xe0, 0x03, 0x83, 0xbf, 0xf1,
+  0x0a, 0x83, 0x2f, 0xfa, 0x02, 0x83, 0x1f, 0xfc, 0x0b, 0x83, 0x6f, 0xf6, 0x02, 0x83, 0x3f, 0xf8,
+  0x0b, 0x83, 0xaf, 0xf3, 0x02, 0x83, 0x7f, 0xf5, 0x06, 0x52, 0x80, 0x90, 0x02, 0x52, 0x80, 0x90,
+  0x02, 0x93, 0xaa, 0xaa, 0xdf, 0xfc, 0xaa, 0xac, 0xff, 0xca, 0xaa, 0xa6, 0x06, 0x83, 0xaf, 0xf3,
+  0x02, 0x83, 0x8f, 0xf4, 0x0b, 0x82, 0xdf, 0xe0, 0x03, 0x83, 0xbf, 0xf1, 0x0a, 0x83, 0x2f, 0xfa,
+  0x03, 0x82, 0xef, 0xc0, 0x0b, 0x83, 0x5f, 0xf6, 0x02, 0x83, 0x4f, 0xf8, 0x0b, 0x83, 0xaf, 0xf2,
+  0x02, 0x83, 0x8f, 0xf4, 0x0b, 0x82, 0xdf, 0xe0, 0x03, 0x83, 0xbf, 0xf1, 0x0a, 0x83, 0x2e, 0xfa,
+  0x03, 0x82, 0xff, 0xc0, 0x3f, 0x3f, 0x3f, 0x2f, 0x3f, 0x3f, 0x2a, 0x82, 0x9f, 0x30, 0x13, 0x82,
+  0x9f, 0x30, 0x13, 0x82, 0x9f, 0x20, 0x13, 0x82, 0x9f, 0x30, 0x0f, 0x83, 0x17, 0xbe, 0x42, 0x84,
+  0xec, 0x95, 0x10, 0x09, 0x81, 0x6e, 0x49, 0x80, 0xe0, 0x08, 0x80, 0x60, 0x42, 0x89, 0xc8, 0xbf,
+  0x88, 0xbe, 0xfd, 0x07, 0x8e, 0x2e, 0xff, 0x70, 0x09, 0xf2, 0x00, 0x16, 0xb0, 0x07, 0x83, 0x6f,
+  0xfc, 0x02, 0x82, 0x9f, 0x30, 0x0c, 0x83, 0x9f, 0xf8, 0x02, 0x82, 0x9f, 0x30, 0x0c, 0x83, 0x9f,
+  0xf9, 0x02, 0x82, 0x9f, 0x20, 0x0c, 0x89, 0x8f, 0xfd, 0x10, 0x09, 0xf3, 0x05, 0x80, 0x10, 0x05,
+  0x80, 0x30, 0x42, 0x85, 0xa1, 0x09, 0xf3, 0x0d, 0x80, 0xa0, 0x42, 0x84, 0xea, 0xcf, 0x20, 0x0e,
+  0x80, 0xb0, 0x46, 0x82, 0xc8, 0x30, 0x0c, 0x81, 0x5c, 0x47, 0x81, 0xa1, 0x0c, 0x82, 0x25, 0xc0,
+  0x45, 0x81, 0xd1, 0x0d, 0x84, 0x9f, 0x33, 0x90, 0x42, 0x80, 0xb0, 0x0d, 0x85, 0x9f, 0x20, 0x07,
+  0x42, 0x80, 0x30, 0x0c, 0x82, 0x9f, 0x30, 0x02, 0x83, 0xef, 0xf7, 0x0c, 0x82, 0x8f, 0x30, 0x02,
+  0x83, 0xcf, 0xf8, 0x0c, 0x82, 0x9f, 0x30, 0x02, 0x83, 0xcf, 0xf7, 0x05, 0x81, 0x61, 0x04, 0x85,
+  0x9f, 0x20, 0x02, 0x42, 0x80, 0x40, 0x05, 0x83, 0xaf, 0x93, 0x02, 0x88, 0x9f, 0x20, 0x1c, 0xff,
+  0xc0, 0x06, 0x80, 0xa0, 0x42, 0x86, 0xeb, 0x9c, 0xfa, 0xa0, 0x42, 0x81, 0xe3, 0x06, 0x81, 0x5d,
+  0x4a, 0x81, 0xd3, 0x09, 0x84, 0x38, 0xbd, 0xe0, 0x42, 0x83, 0xea, 0x61, 0x0f, 0x82, 0x9f, 0x30,
+  0x13, 0x82, 0x9f, 0x20, 0x13, 0x82, 0x9f, 0x30, 0x13, 0x82, 0x9f, 0x30, 0x13, 0x82, 0x9f, 0x30,
+  0x13, 0x82, 0x57, 0x10, 0x3f, 0x25, 0x3f, 0x3f, 0x3f, 0x11, 0x86, 0x5b, 0xef, 0xc8, 0x10, 0x0d,
+  0x81, 0x1a, 0x45, 0x81, 0xd2, 0x0c, 0x89, 0x7f, 0xfd, 0x77, 0xaf, 0xfd, 0x0b, 0x83, 0x1f, 0xfb,
+  0x03, 0x83, 0x6f, 0xf6, 0x0a, 0x83, 0x5f, 0xf2, 0x04, 0x82, 0xcf, 0xa0, 0x0a, 0x82, 0x6f, 0xf0,
+  0x05, 0x82, 0x9f, 0xc0, 0x0a, 0x83, 0x5f, 0xf3, 0x04, 0x82, 0xcf, 0xa0, 0x0a, 0x83, 0x1f, 0xfb,
+  0x03, 0x83, 0x6f, 0xf6, 0x06, 0x80, 0x10, 0x03, 0x89, 0x8f, 0xfc, 0x86, 0xaf, 0xfe, 0x05, 0x83,
+  0x4a, 0xf2, 0x03, 0x80, 0xa0, 0x45, 0x81, 0xd2, 0x02, 0x86, 0x17, 0xdf, 0xfd, 0x40, 0x04, 0x8f,
+  0x5b, 0xef, 0xd8, 0x10, 0x03, 0x9e, 0xff, 0xa4, 0x0d, 0x86, 0x6c, 0xff, 0xe8, 0x20, 0x0c, 0x86,
+  0x28, 0xef, 0xfb, 0x50, 0x0d, 0x86, 0x4b, 0xff, 0xe8, 0x20, 0x0c, 0x90, 0x17, 0xdf, 0xfc, 0x61,
+  0x00, 0x3a, 0xdf, 0xd9, 0x20, 0x04, 0x80, 0x40, 0x42, 0x81, 0xa3, 0x03, 0x80, 0x60, 0x45, 0x81,
+  0xe4, 0x03, 0x83, 0x1d, 0x71, 0x04, 0x8a, 0x4f, 0xfe, 0x86, 0x9f, 0xfe, 0x30, 0x0b, 0x83, 0xcf,
+  0xd1, 0x02, 0x83, 0x3f, 0xf9, 0x0b, 0x82, 0xff, 0x70, 0x04, 0x82, 0x8f, 0xf0, 0x0a, 0x83, 0x2f,
+  0xf4, 0x04, 0x83, 0x6f, 0xf1, 0x09, 0x83, 0x1f, 0xf6, 0x04, 0x82, 0x8f, 0xf0, 0x0b, 0x83, 0xcf,
+  0xe2, 0x02, 0x83, 0x3e, 0xfb, 0x0b, 0x8a, 0x4f, 0xfe, 0x86, 0x9e, 0xff, 0x30, 0x0c, 0x80, 0x70,
+  0x46, 0x80, 0x50, 0x0e, 0x86, 0x3a, 0xef, 0xe9, 0x30, 0x02, 0x80, 0x10, 0x1f, 0x80, 0x10, 0x3f,
+  0x3f, 0x3f, 0x04, 0x3f, 0x3f, 0x3d, 0x89, 0x17, 0xbe, 0xfe, 0xda, 0x61, 0x0b, 0x81, 0x3e, 0x47,
+  0x80, 0x50, 0x0a, 0x81, 0x1e, 0x42, 0x86, 0xeb, 0xbd, 0xff, 0x50, 0x0a, 0x80, 0x80, 0x42, 0x80,
+  0x50, 0x03, 0x82, 0x27, 0x50, 0x0a, 0x83, 0xbf, 0xf8, 0x12, 0x83, 0xdf, 0xf4, 0x12, 0x83, 0xbf,
+  0xf6, 0x12, 0x83, 0x7f, 0xfb, 0x12, 0x80, 0x20, 0x42, 0x80, 0x40, 0x12, 0x84, 0x8f, 0xfd, 0x10,
+  0x11, 0x80, 0x80, 0x42, 0x80, 0x90, 0x0f, 0x81, 0x1b, 0x44, 0x80, 0x60, 0x0e, 0x88, 0xbf, 0xfb,
+  0x6f, 0xfe, 0x40, 0x05, 0x82, 0x23, 0x30, 0x03, 0x8a, 0x8f, 0xfb, 0x00, 0x9f, 0xfd, 0x10, 0x04,
+  0x8a, 0xbf, 0xf1, 0x00, 0x2f, 0xfe, 0x20, 0x02, 0x83, 0xcf, 0xfb, 0x04, 0x89, 0xbf, 0xf1, 0x00,
+  0x8f, 0xf9, 0x03, 0x84, 0x2e, 0xff, 0x80, 0x03, 0x82, 0xcf, 0xf0, 0x02, 0x83, 0xcf, 0xf4, 0x04,
+  0x80, 0x50, 0x42, 0x80, 0x40, 0x02, 0x82, 0xdf, 0xd0, 0x02, 0x83, 0xef, 0xf2, 0x05, 0x89, 0x9f,
+  0xfe, 0x20, 0x1f, 0xfa, 0x02, 0x42, 0x80, 0x20, 0x05, 0x89, 0x1c, 0xff, 0xc1, 0x5f, 0xf6, 0x02,
+  0x83, 0xdf, 0xf6, 0x06, 0x87, 0x2e, 0xff, 0x9c, 0xfe, 0x03, 0x83, 0xaf, 0xfb, 0x07, 0x80, 0x60,
+  0x44, 0x80, 0x70, 0x03, 0x80, 0x50, 0x42, 0x80, 0x60, 0x07, 0x85, 0x9f, 0xfe, 0xc1, 0x04, 0x80,
+  0xd0, 0x42, 0x80, 0x60, 0x05, 0x81, 0x1a, 0x42, 0x81, 0xc1, 0x04, 0x81, 0x3e, 0x42, 0x86, 0xc7,
+  0x43, 0x59, 0xe0, 0x44, 0x80, 0x90, 0x05, 0x81, 0x3d, 0x49, 0x81, 0xb7, 0x42, 0x80, 0x50, 0x05,
+  0x82, 0x18, 0xe0, 0x45, 0x88, 0xc5, 0x00, 0x9f, 0xfe, 0x20, 0x06, 0x86, 0x13, 0x67, 0x75, 0x20,
+  0x3f, 0x08, 0x80, 0x10, 0x3f, 0x3f, 0x0e, 0x3f, 0x3f, 0x3f, 0x84, 0x0b, 0xff, 0x50, 0x12, 0x83,
+  0xbf, 0xf5, 0x12, 0x83, 0xbf, 0xf5, 0x12, 0x83, 0xbf, 0xf5, 0x12, 0x83, 0xbf, 0xf5, 0x12, 0x83,
+  0xbf, 0xf5, 0x12, 0x83, 0xbf, 0xf5, 0x12, 0x83, 0xbf, 0xf5, 0x12, 0x83, 0xbf, 0xf5, 0x12, 0x83,
+  0x7a, 0xa4, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x1f, 0x3f, 0x27, 0x80, 0x10,
+  0x2e, 0x80, 0x10, 0x13, 0x83, 0x8f, 0xf4, 0x11, 0x83, 0x3f, 0xfb, 0x12, 0x83, 0xbf, 0xf4, 0x11,
+  0x83, 0x4f, 0xfb, 0x12, 0x83, 0xbf, 0xf4, 0x11, 0x83, 0x3f, 0xfd, 0x12, 0x83, 0xaf, 0xf9, 0x11,
+  0x84, 0x1e, 0xff, 0x30, 0x11, 0x83, 0x5f, 0xfe, 0x12, 0x83, 0x9f, 0xfa, 0x12, 0x83, 0xdf, 0xf7,
+  0x11, 0x80, 0x10, 0x42, 0x80, 0x40, 0x11, 0x80, 0x30, 0x42, 0x80, 0x20, 0x11, 0x80, 0x60, 0x42,
+  0x80, 0x10, 0x11, 0x83, 0x7f, 0xfe, 0x12, 0x83, 0x7f, 0xfe, 0x12, 0x83, 0x8f, 0xfe, 0x12, 0x80,
+  0x70, 0x42, 0x12, 0x80, 0x60, 0x42, 0x80, 0x10, 0x11, 0x80, 0x30, 0x42, 0x80, 0x20, 0x11, 0x80,
+  0x10, 0x42, 0x80, 0x40, 0x12, 0x83, 0xdf, 0xf7, 0x12, 0x83, 0x9f, 0xfa, 0x12, 0x83, 0x5f, 0xfe,
+  0x13, 0x42, 0x80, 0x30, 0x12, 0x83, 0x9f, 0xf8, 0x12, 0x83, 0x3f, 0xfe, 0x13, 0x83, 0xbf, 0xf5,
+  0x12, 0x83, 0x4f, 0xfc, 0x13, 0x83, 0xbf, 0xf4, 0x12, 0x83, 0x2f, 0xfb, 0x13, 0x83, 0x8f, 0xf4,
+  0x3f, 0x39, 0x3f, 0x3f, 0x26, 0x83, 0x9f, 0xf4, 0x12, 0x83, 0x1f, 0xfc, 0x13, 0x83, 0x8f, 0xf6,
+  0x12, 0x83, 0x2f, 0xfe, 0x13, 0x83, 0xaf, 0xf6, 0x12, 0x83, 0x4f, 0xfd, 0x13, 0x83, 0xdf, 0xf4,
+  0x12, 0x83, 0x9f, 0xfa, 0x12, 0x80, 0x40, 0x42, 0x12, 0x80, 0x10, 0x42, 0x80, 0x40, 0x12, 0x83,
+  0xcf, 0xf8, 0x12, 0x83, 0x9f, 0xfb, 0x12, 0x83, 0x7f, 0xfe, 0x12, 0x80, 0x50, 0x42, 0x80, 0x10,
+  0x11, 0x80, 0x40, 0x42, 0x80, 0x20, 0x11, 0x80, 0x40, 0x42, 0x80, 0x20, 0x11, 0x80, 0x40, 0x42,
+  0x80, 0x30, 0x11, 0x80, 0x40, 0x42, 0x80, 0x20, 0x11, 0x80, 0x60, 0x42, 0x12, 0x83, 0x7f, 0xfe,
+  0x12, 0x83, 0x9f, 0xfb, 0x12, 0x83, 0xcf, 0xf8, 0x11, 0x80, 0x10, 0x42, 0x80, 0x40, 0x11, 0x83,
+  0x4f, 0xfe, 0x12, 0x83, 0x9f, 0xfa, 0x12, 0x83, 0xef, 0xf4, 0x11, 0x83, 0x4f, 0xfd, 0x12, 0x83,
+  0xaf, 0xf6, 0x11, 0x83, 0x2f, 0xfe, 0x12, 0x83, 0x9f, 0xf6, 0x11, 0x84, 0x1f, 0xfc, 0x10, 0x11,
+  0x83, 0x9f, 0xf4, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x83, 0x03, 0xfd, 0x13, 0x82, 0x3f, 0xd0, 0x13,
+  0x82, 0x2f, 0xd0, 0x0d, 0x82, 0x59, 0x10, 0x02, 0x82, 0x2f, 0xd0, 0x03, 0x82, 0x3b, 0x10, 0x06,
+  0x8f, 0xdf, 0xe6, 0x00, 0x3f, 0xd0, 0x01, 0x9f, 0xf8, 0x06, 0x8f, 0x29, 0xff, 0xc4, 0x2f, 0xd0,
+  0x6e, 0xfe, 0x71, 0x08, 0x8b, 0x3b, 0xff, 0xbf, 0xec, 0xfe, 0x81, 0x0c, 0x81, 0x4c, 0x43, 0x81,
+  0x92, 0x0e, 0x81, 0x17, 0x42, 0x81, 0xd4, 0x0e, 0x83, 0x6d, 0xfe, 0x43, 0x81, 0xb3, 0x0a, 0x8d,
+  0x4d, 0xff, 0x83, 0xfd, 0x2a, 0xff, 0xa2, 0x07, 0x8f, 0xbf, 0xfb, 0x20, 0x3f, 0xd0, 0x05, 0xdf,
+  0xf6, 0x06, 0x82, 0x8d, 0x50, 0x02, 0x82, 0x2f, 0xd0, 0x03, 0x82, 0x8f, 0x30, 0x06, 0x80, 0x10,
+  0x04, 0x82, 0x3f, 0xd0, 0x04, 0x80, 0x10, 0x0d, 0x82, 0x3f, 0xd0, 0x13, 0x82, 0x2f, 0xd0, 0x13,
+  0x82, 0x15, 0x40, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x33, 0x83,
+  0x47, 0x72, 0x12, 0x83, 0x9f, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf4, 0x12, 0x83,
+  0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf4, 0x12, 0x83, 0x9f, 0xf5, 0x0a, 0x83,
+  0x7e, 0xfe, 0x46, 0x83, 0xee, 0xfe, 0x43, 0x80, 0x20, 0x02, 0x80, 0x70, 0x51, 0x80, 0x30, 0x02,
+  0x80, 0x70, 0x51, 0x80, 0x20, 0x0a, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf,
+  0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf,
+  0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x3f, 0x3f, 0x3f, 0x3f, 0x1d, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x0b, 0x85, 0x14, 0x44, 0x51, 0x10, 0x80, 0x20, 0x43, 0x80, 0x40, 0x10,
+  0x80, 0x30, 0x43, 0x80, 0x40, 0x10, 0x80, 0x30, 0x43, 0x80, 0x40, 0x10, 0x80, 0x40, 0x43, 0x80,
+  0x20, 0x10, 0x80, 0x80, 0x42, 0x80, 0xa0, 0x11, 0x80, 0xb0, 0x42, 0x80, 0x20, 0x11, 0x42, 0x80,
+  0x90, 0x11, 0x80, 0x40, 0x42, 0x80, 0x20, 0x11, 0x83, 0x8f, 0xf9, 0x0f, 0x86, 0x10, 0x0c, 0xfe,
+  0x10, 0x3f, 0x3e, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x2f, 0x80, 0x10, 0x25, 0x89, 0x9d,
+  0xdd, 0xdd, 0xdd, 0xd6, 0x0c, 0x80, 0xb0, 0x47, 0x80, 0x60, 0x0c, 0x80, 0xb0, 0x47, 0x80, 0x60,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x24, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x0b, 0x84, 0x25, 0x54, 0x50, 0x11, 0x80, 0x60, 0x43, 0x80, 0x10, 0x10, 0x80, 0x60, 0x43,
+  0x11, 0x80, 0x60, 0x43, 0x80, 0x10, 0x10, 0x80, 0x60, 0x43, 0x80, 0x10, 0x10, 0x80, 0x70, 0x43,
+  0x3f, 0x17, 0x80, 0x10, 0x3f, 0x3f, 0x16, 0x3f, 0x3f, 0x3f, 0x06, 0x83, 0x9f, 0xfb, 0x11, 0x80,
+  0x20, 0x42, 0x80, 0x40, 0x11, 0x83, 0x9f, 0xfc, 0x11, 0x84, 0x1e, 0xff, 0x50, 0x11, 0x83, 0x7f,
+  0xfd, 0x12, 0x83, 0xef, 0xf6, 0x11, 0x83, 0x6f, 0xfe, 0x12, 0x83, 0xdf, 0xf7, 0x11, 0x84, 0x5f,
+  0xfe, 0x10, 0x11, 0x83, 0xdf, 0xf8, 0x11, 0x84, 0x5f, 0xfe, 0x10, 0x11, 0x83, 0xbf, 0xf9, 0x11,
+  0x80, 0x30, 0x42, 0x80, 0x20, 0x11, 0x83, 0xaf, 0xfa, 0x11, 0x80, 0x30, 0x42, 0x80, 0x30, 0x11,
+  0x83, 0xaf, 0xfa, 0x11, 0x80, 0x20, 0x42, 0x80, 0x40, 0x11, 0x83, 0x9f, 0xfb, 0x11, 0x84, 0x1e,
+  0xff, 0x50, 0x11, 0x83, 0x8f, 0xfc, 0x11, 0x84, 0x1e, 0xff, 0x60, 0x11, 0x83, 0x7f, 0xfd, 0x11,
+  0x84, 0x1e, 0xff, 0x60, 0x11, 0x84, 0x6f, 0xfe, 0x10, 0x11, 0x83, 0xdf, 0xf7, 0x11, 0x84, 0x5f,
+  0xfe, 0x10, 0x11, 0x83, 0xcf, 0xf8, 0x11, 0x80, 0x40, 0x42, 0x80, 0x20, 0x11, 0x83, 0xbf, 0xfa,
+  0x12, 0x83, 0x88, 0x72, 0x3f, 0x3f, 0x1a, 0x3f, 0x3f, 0x3e, 0x87, 0x4a, 0xdf, 0xec, 0x82, 0x0c,
+  0x81, 0x1b, 0x47, 0x80, 0x70, 0x0b, 0x80, 0xc0, 0x43, 0x81, 0xdd, 0x43, 0x80, 0x70, 0x09, 0x80,
+  0x90, 0x42, 0x85, 0x91, 0x00, 0x3d, 0x42, 0x80, 0x40, 0x07, 0x84, 0x2e, 0xff, 0xa0, 0x04, 0x84,
+  0x1e, 0xff, 0xb0, 0x07, 0x80, 0x80, 0x42, 0x80, 0x20, 0x05, 0x80, 0x60, 0x42, 0x80, 0x30, 0x06,
+  0x83, 0xcf, 0xfb, 0x06, 0x80, 0x10, 0x42, 0x80, 0x80, 0x05, 0x80, 0x10, 0x42, 0x80, 0x70, 0x07,
+  0x83, 0xcf, 0xfc, 0x05, 0x80, 0x40, 0x42, 0x80, 0x40, 0x07, 0x83, 0x9f, 0xfe, 0x05, 0x80, 0x60,
+  0x42, 0x80, 0x20, 0x07, 0x80, 0x70, 0x42, 0x80, 0x20, 0x04, 0x80, 0x80, 0x42, 0x02, 0x86, 0x49,
+  0x81, 0x00, 0x50, 0x42, 0x80, 0x30, 0x04, 0x8d, 0x9f, 0xfe, 0x00, 0x2f, 0xfe, 0xc0, 0x05, 0x42,
+  0x80, 0x40, 0x04, 0x86, 0x9f, 0xfe, 0x00, 0x70, 0x43, 0x82, 0x20, 0x40, 0x42, 0x80, 0x50, 0x04,
+  0x86, 0xaf, 0xfe, 0x00, 0x50, 0x42, 0x83, 0xe0, 0x04, 0x42, 0x80, 0x50, 0x04, 0x83, 0x9f, 0xfe,
+  0x02, 0x86, 0x8e, 0xd4, 0x00, 0x40, 0x42, 0x80, 0x40, 0x04, 0x80, 0x80, 0x42, 0x08, 0x80, 0x50,
+  0x42, 0x80, 0x40, 0x04, 0x80, 0x70, 0x42, 0x80, 0x10, 0x07, 0x80, 0x60, 0x42, 0x80, 0x30, 0x04,
+  0x80, 0x50, 0x42, 0x80, 0x20, 0x05, 0x82, 0x10, 0x80, 0x42, 0x80, 0x10, 0x04, 0x80, 0x30, 0x42,
+  0x80, 0x50, 0x07, 0x83, 0xaf, 0xfd, 0x06, 0x83, 0xef, 0xf9, 0x07, 0x83, 0xef, 0xfa, 0x06, 0x83,
+  0xaf, 0xfd, 0x06, 0x80, 0x40, 0x42, 0x80, 0x50, 0x06, 0x80, 0x50, 0x42, 0x80, 0x50, 0x05, 0x84,
+  0xbf, 0xfe, 0x10, 0x07, 0x84, 0xdf, 0xfe, 0x20, 0x03, 0x80, 0x60, 0x42, 0x80, 0x80, 0x08, 0x80,
+  0x40, 0x42, 0x84, 0xe8, 0x56, 0xa0, 0x42, 0x81, 0xd1, 0x09, 0x80, 0x60, 0x48, 0x81, 0xe2, 0x0b,
+  0x81, 0x3c, 0x45, 0x81, 0xa1, 0x0e, 0x85, 0x26, 0x76, 0x51, 0x3f, 0x3f, 0x3f, 0x17, 0x3f, 0x3f,
+  0x3d, 0x83, 0x36, 0x9d, 0x42, 0x80, 0xc0, 0x0c, 0x81, 0x8e, 0x46, 0x80, 0xb0, 0x0c, 0x80, 0xa0,
+  0x47, 0x80, 0xc0, 0x0c, 0x89, 0xaf, 0xec, 0x95, 0xcf, 0xfb, 0x0c, 0x82, 0x43, 0x10, 0x02, 0x83,
+  0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83,
+  0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83,
+  0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83,
+  0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x0d, 0x80,
+  0x10, 0x03, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x0c, 0x82, 0x4f,
+  0xe0, 0x49, 0x82, 0xef, 0x40, 0x06, 0x80, 0x40, 0x4d, 0x80, 0x40, 0x06, 0x80, 0x40, 0x4d, 0x80,
+  0x40, 0x3f, 0x3f, 0x3f, 0x28, 0x3f, 0x3f, 0x3c, 0x89, 0x48, 0xcd, 0xfe, 0xdb, 0x71, 0x09, 0x82,
+  0x18, 0xe0, 0x49, 0x80, 0x60, 0x08, 0x80, 0x10, 0x49, 0x83, 0xef, 0xf9, 0x07, 0x8a, 0x2f, 0xfe,
+  0x95, 0x20, 0x02, 0x80, 0x43, 0x80, 0x60, 0x06, 0x83, 0x2d, 0x61, 0x06, 0x84, 0x4e, 0xff, 0xe0,
+  0x12, 0x80, 0x90, 0x42, 0x80, 0x30, 0x11, 0x80, 0x40, 0x42, 0x80, 0x60, 0x11, 0x80, 0x40, 0x42,
+  0x80, 0x60, 0x11, 0x80, 0x50, 0x42, 0x80, 0x40, 0x11, 0x80, 0x90, 0x42, 0x80, 0x10, 0x10, 0x84,
+  0x1e, 0xff, 0x90, 0x11, 0x84, 0x9f, 0xfe, 0x20, 0x10, 0x80, 0x60, 0x42, 0x80, 0x60, 0x10, 0x80,
+  0x30, 0x42, 0x80, 0x90, 0x10, 0x85, 0x3e, 0xff, 0xb1, 0x0f, 0x85, 0x2e, 0xff, 0xc1, 0x0f, 0x85,
+  0x2d, 0xff, 0xc1, 0x0f, 0x85, 0x1d, 0xff, 0xd2, 0x0f, 0x85, 0x1d, 0xff, 0xd1, 0x0f, 0x85, 0x1c,
+  0xff, 0xd2, 0x0f, 0x85, 0x1c, 0xff, 0xd2, 0x0f, 0x85, 0x1c, 0xff, 0xe3, 0x10, 0x84, 0xcf, 0xfe,
+  0x30, 0x10, 0x80, 0x50, 0x44, 0x80, 0xe0, 0x48, 0x80, 0x90, 0x05, 0x80, 0x50, 0x4e, 0x80, 0x90,
+  0x05, 0x80, 0x50, 0x4e, 0x80, 0x90, 0x3f, 0x3f, 0x3f, 0x29, 0x3f, 0x3f, 0x3b, 0x8a, 0x36, 0xac,
+  0xef, 0xfd, 0xb7, 0x10, 0x0a, 0x80, 0xc0, 0x4a, 0x80, 0x80, 0x09, 0x80, 0xc0, 0x4b, 0x80, 0xa0,
+  0x08, 0x8a, 0xcd, 0x96, 0x31, 0x00, 0x26, 0xe0, 0x42, 0x80, 0x70, 0x07, 0x80, 0x20, 0x08, 0x84,
+  0x1d, 0xff, 0xe0, 0x12, 0x80, 0x60, 0x42, 0x80, 0x30, 0x11, 0x80, 0x30, 0x42, 0x80, 0x50, 0x11,
+  0x80, 0x30, 0x42, 0x80, 0x40, 0x11, 0x80, 0x70, 0x42, 0x80, 0x20, 0x10, 0x84, 0x3e, 0xff, 0xb0,
+  0x0e, 0x87, 0x13, 0x8e, 0xff, 0xd1, 0x0a, 0x80, 0x10, 0x47, 0x81, 0x91, 0x0b, 0x80, 0x10, 0x45,
+  0x82, 0xe7, 0x10, 0x0c, 0x84, 0x1d, 0xdd, 0xe0, 0x43, 0x81, 0xe5, 0x10, 0x82, 0x26, 0xd0, 0x42,
+  0x80, 0x60, 0x11, 0x81, 0x1b, 0x42, 0x80, 0x20, 0x11, 0x84, 0x2e, 0xff, 0x90, 0x12, 0x83, 0xbf,
+  0xfc, 0x12, 0x83, 0x9f, 0xfe, 0x12, 0x83, 0xaf, 0xfe, 0x12, 0x83, 0xdf, 0xfd, 0x05, 0x80, 0x10,
+  0x0a, 0x80, 0x60, 0x42, 0x80, 0x80, 0x05, 0x83, 0x9b, 0x51, 0x06, 0x80, 0x70, 0x43, 0x80, 0x20,
+  0x05, 0x8a, 0x9f, 0xfe, 0xc9, 0x77, 0x8a, 0xe0, 0x43, 0x80, 0x70, 0x06, 0x80, 0x90, 0x4c, 0x80,
+  0x70, 0x07, 0x82, 0x38, 0xd0, 0x48, 0x81, 0xa3, 0x0b, 0x88, 0x13, 0x67, 0x77, 0x63, 0x10, 0x3f,
+  0x3f, 0x3f, 0x17, 0x3f, 0x3f, 0x3f, 0x02, 0x81, 0x1e, 0x42, 0x80, 0x70, 0x10, 0x80, 0xa0, 0x43,
+  0x80, 0x70, 0x0f, 0x80, 0x30, 0x44, 0x80, 0x70, 0x0f, 0x82, 0xdf, 0xc0, 0x42, 0x80, 0x70, 0x0e,
+  0x83, 0x8f, 0xf3, 0x42, 0x80, 0x70, 0x0d, 0x84, 0x2f, 0xf8, 0x20, 0x42, 0x80, 0x70, 0x0c, 0x85,
+  0x1c, 0xfe, 0x11, 0x42, 0x80, 0x70, 0x0c, 0x85, 0x7f, 0xf5, 0x01, 0x42, 0x80, 0x70, 0x0b, 0x86,
+  0x2e, 0xfb, 0x00, 0x10, 0x42, 0x80, 0x70, 0x0b, 0x86, 0xbf, 0xf3, 0x00, 0x10, 0x42, 0x80, 0x70,
+  0x0a, 0x83, 0x6f, 0xf8, 0x02, 0x80, 0x20, 0x42, 0x80, 0x70, 0x06, 0x87, 0x10, 0x01, 0xef, 0xe1,
+  0x02, 0x80, 0x10, 0x42, 0x80, 0x70, 0x09, 0x83, 0xaf, 0xf5, 0x03, 0x80, 0x10, 0x42, 0x80, 0x70,
+  0x08, 0x83, 0x4f, 0xfb, 0x04, 0x80, 0x20, 0x42, 0x80, 0x70, 0x08, 0x83, 0xdf, 0xf3, 0x04, 0x80,
+  0x10, 0x42, 0x80, 0x70, 0x07, 0x83, 0x9f, 0xf8, 0x05, 0x80, 0x10, 0x42, 0x80, 0x70, 0x06, 0x84,
+  0x2f, 0xfd, 0x10, 0x05, 0x80, 0x10, 0x42, 0x80, 0x70, 0x06, 0x80, 0x30, 0x50, 0x80, 0xe0, 0x03,
+  0x80, 0x30, 0x50, 0x80, 0xe0, 0x03, 0x8b, 0x3d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x42, 0x83, 0xed,
+  0xdc, 0x0e, 0x80, 0x10, 0x42, 0x80, 0x70, 0x11, 0x80, 0x10, 0x42, 0x80, 0x70, 0x11, 0x80, 0x10,
+  0x42, 0x80, 0x70, 0x11, 0x80, 0x10, 0x42, 0x80, 0x70, 0x11, 0x80, 0x10, 0x42, 0x80, 0x70, 0x11,
+  0x85, 0x1f, 0xef, 0x71, 0x12, 0x80, 0x10, 0x3f, 0x3f, 0x3f, 0x16, 0x3f, 0x3f, 0x3a, 0x80, 0x50,
+  0x4b, 0x80, 0xe0, 0x08, 0x80, 0x60, 0x4b, 0x80, 0xe0, 0x02, 0x80, 0x10, 0x04, 0x80, 0x50, 0x4b,
+  0x80, 0xe0, 0x08, 0x83, 0x5f, 0xfd, 0x12, 0x83, 0x5f, 0xfd, 0x12, 0x83, 0x5f, 0xfd, 0x12, 0x83,
+  0x5f, 0xfd, 0x12, 0x83, 0x5f, 0xfd, 0x12, 0x83, 0x5f, 0xfd, 0x12, 0x8a, 0x5f, 0xfe, 0xad, 0xee,
+  0xda, 0x60, 0x0b, 0x80, 0x50, 0x49, 0x81, 0xe6, 0x09, 0x80, 0x60, 0x4b, 0x80, 0x80, 0x08, 0x89,
+  0x5d, 0x83, 0x10, 0x02, 0x5c, 0x43, 0x80, 0x50, 0x07, 0x80, 0x10, 0x08, 0x80, 0x70, 0x42, 0x80,
+  0xd0, 0x0f, 0x83, 0x10, 0x0a, 0x42, 0x80, 0x50, 0x11, 0x80, 0x20, 0x42, 0x80, 0x80, 0x12, 0x83,
+  0xdf, 0xfa, 0x12, 0x83, 0xcf, 0xfb, 0x12, 0x83, 0xdf, 0xfb, 0x11, 0x80, 0x10, 0x42, 0x80, 0xa0,
+  0x11, 0x80, 0x50, 0x42, 0x80, 0x60, 0x10, 0x85, 0x1d, 0xff, 0xe2, 0x05, 0x82, 0x7b, 0x40, 0x06,
+  0x81, 0x3c, 0x42, 0x80, 0x90, 0x06, 0x89, 0x7f, 0xfe, 0xb8, 0x77, 0x9c, 0x43, 0x81, 0xc1, 0x06,
+  0x80, 0x70, 0x4b, 0x81, 0xb1, 0x07, 0x81, 0x3b, 0x48, 0x81, 0xc6, 0x0b, 0x88, 0x13, 0x56, 0x78,
+  0x75, 0x20, 0x3f, 0x3f, 0x3f, 0x18, 0x3f, 0x3f, 0x3f, 0x88, 0x59, 0xde, 0xfe, 0xc8, 0x30, 0x0b,
+  0x81, 0x3c, 0x48, 0x80, 0x60, 0x09, 0x80, 0x40, 0x4a, 0x80, 0x70, 0x08, 0x80, 0x30, 0x43, 0x88,
+  0x94, 0x10, 0x03, 0x7c, 0x60, 0x08, 0x84, 0xbf, 0xfe, 0x40, 0x07, 0x80, 0x10, 0x07, 0x80, 0x50,
+  0x42, 0x80, 0x50, 0x11, 0x83, 0x9f, 0xfb, 0x12, 0x42, 0x80, 0x60, 0x11, 0x80, 0x30, 0x42, 0x80,
+  0x10, 0x11, 0x8d, 0x6f, 0xfd, 0x00, 0x5b, 0xdf, 0xec, 0x71, 0x08, 0x85, 0x7f, 0xfb, 0x1a, 0x46,
+  0x81, 0xe5, 0x07, 0x84, 0x9f, 0xfa, 0xa0, 0x42, 0x82, 0xdc, 0xe0, 0x43, 0x80, 0x60, 0x06, 0x86,
+  0x9f, 0xfd, 0xff, 0x80, 0x03, 0x81, 0x5e, 0x42, 0x80, 0x20, 0x05, 0x80, 0xa0, 0x43, 0x80, 0x70,
+  0x05, 0x80, 0x40, 0x42, 0x81, 0x91, 0x04, 0x80, 0x90, 0x42, 0x80, 0xc0, 0x07, 0x83, 0xaf, 0xfe,
+  0x05, 0x80, 0x80, 0x42, 0x80, 0x80, 0x07, 0x80, 0x60, 0x42, 0x80, 0x20, 0x04, 0x80, 0x80, 0x42,
+  0x80, 0x40, 0x07, 0x80, 0x40, 0x42, 0x80, 0x40, 0x04, 0x80, 0x50, 0x42, 0x80, 0x40, 0x07, 0x80,
+  0x20, 0x42, 0x80, 0x50, 0x04, 0x80, 0x30, 0x42, 0x80, 0x40, 0x07, 0x80, 0x30, 0x42, 0x80, 0x50,
+  0x04, 0x80, 0x10, 0x42, 0x80, 0x60, 0x05, 0x82, 0x10, 0x40, 0x42, 0x80, 0x30, 0x05, 0x83, 0xbf,
+  0xfa, 0x07, 0x80, 0x80, 0x42, 0x80, 0x10, 0x05, 0x84, 0x7f, 0xfe, 0x20, 0x05, 0x84, 0x1e, 0xff,
+  0xb0, 0x06, 0x85, 0x1d, 0xff, 0xc1, 0x04, 0x80, 0xa0, 0x42, 0x80, 0x50, 0x07, 0x80, 0x60, 0x42,
+  0x85, 0xe8, 0x54, 0x7c, 0x42, 0x80, 0xb0, 0x06, 0x83, 0x10, 0x07, 0x49, 0x81, 0xc1, 0x0a, 0x81,
+  0x4c, 0x45, 0x81, 0xe7, 0x0e, 0x85, 0x25, 0x77, 0x63, 0x3f, 0x0a, 0x80, 0x10, 0x3f, 0x3f, 0x0b,
+  0x3f, 0x3f, 0x39, 0x80, 0x80, 0x4f, 0x05, 0x80, 0x90, 0x4e, 0x80, 0xe0, 0x05, 0x81, 0x8e, 0x47,
+  0x80, 0xe0, 0x44, 0x80, 0x90, 0x11, 0x80, 0x30, 0x42, 0x80, 0x30, 0x11, 0x83, 0x9f, 0xfd, 0x12,
+  0x83, 0xef, 0xf6, 0x11, 0x84, 0x6f, 0xfe, 0x20, 0x11, 0x83, 0xcf, 0xfa, 0x11, 0x80, 0x30, 0x42,
+  0x80, 0x40, 0x11, 0x83, 0x9f, 0xfd, 0x11, 0x84, 0x1e, 0xff, 0x80, 0x11, 0x80, 0x50, 0x42, 0x80,
+  0x20, 0x11, 0x83, 0xcf, 0xfc, 0x11, 0x80, 0x30, 0x42, 0x80, 0x60, 0x11, 0x84, 0x9f, 0xfe, 0x10,
+  0x11, 0x83, 0xef, 0xf9, 0x11, 0x80, 0x50, 0x42, 0x80, 0x30, 0x11, 0x83, 0xbf, 0xfd, 0x11, 0x80,
+  0x20, 0x42, 0x80, 0x70, 0x11, 0x80, 0x80, 0x42, 0x80, 0x20, 0x10, 0x84, 0x1e, 0xff, 0xa0, 0x11,
+  0x80, 0x50, 0x42, 0x80, 0x40, 0x11, 0x84, 0xbf, 0xfe, 0x10, 0x10, 0x80, 0x20, 0x42, 0x80, 0x80,
+  0x11, 0x80, 0x80, 0x42, 0x80, 0x20, 0x10, 0x84, 0x1e, 0xff, 0xb0, 0x3f, 0x80, 0x10, 0x32, 0x80,
+  0x10, 0x3f, 0x3d, 0x3f, 0x3f, 0x3d, 0x89, 0x28, 0xbe, 0xff, 0xda, 0x61, 0x0b, 0x80, 0x80, 0x48,
+  0x81, 0xe5, 0x09, 0x80, 0x90, 0x43, 0x83, 0xdb, 0xce, 0x43, 0x80, 0x40, 0x07, 0x80, 0x40, 0x42,
+  0x81, 0xd3, 0x03, 0x80, 0x60, 0x42, 0x81, 0xe1, 0x06, 0x84, 0xbf, 0xfe, 0x10, 0x05, 0x80, 0x50,
+  0x42, 0x80, 0x70, 0x06, 0x83, 0xef, 0xfa, 0x07, 0x83, 0xef, 0xfa, 0x05, 0x80, 0x10, 0x42, 0x80,
+  0x70, 0x07, 0x83, 0xcf, 0xfb, 0x06, 0x42, 0x80, 0x80, 0x07, 0x83, 0xcf, 0xfa, 0x06, 0x83, 0xcf,
+  0xfb, 0x06, 0x80, 0x10, 0x42, 0x80, 0x70, 0x06, 0x80, 0x50, 0x42, 0x80, 0x30, 0x05, 0x84, 0x8f,
+  0xfe, 0x10, 0x07, 0x80, 0x90, 0x42, 0x89, 0x72, 0x01, 0x39, 0xff, 0xe3, 0x09, 0x81, 0x7e, 0x47,
+  0x81, 0xa2, 0x0b, 0x81, 0x3d, 0x45, 0x81, 0x93, 0x0a, 0x81, 0x2b, 0x42, 0x82, 0xec, 0xd0, 0x43,
+  0x81, 0xa1, 0x07, 0x85, 0x2e, 0xff, 0xc3, 0x03, 0x85, 0x6e, 0xff, 0xc1, 0x06, 0x84, 0xcf, 0xfc,
+  0x10, 0x05, 0x80, 0x30, 0x42, 0x80, 0x80, 0x05, 0x80, 0x40, 0x42, 0x80, 0x40, 0x07, 0x84, 0x9f,
+  0xfe, 0x10, 0x04, 0x80, 0x80, 0x42, 0x08, 0x80, 0x40, 0x42, 0x80, 0x30, 0x04, 0x83, 0x9f, 0xfd,
+  0x08, 0x80, 0x30, 0x42, 0x80, 0x50, 0x04, 0x83, 0xaf, 0xfe, 0x08, 0x80, 0x40, 0x42, 0x80, 0x50,
+  0x04, 0x80, 0x90, 0x42, 0x80, 0x20, 0x07, 0x80, 0x70, 0x42, 0x80, 0x30, 0x04, 0x80, 0x50, 0x42,
+  0x80, 0x80, 0x07, 0x80, 0xd0, 0x42, 0x80, 0x10, 0x04, 0x81, 0x1e, 0x42, 0x80, 0x40, 0x05, 0x80,
+  0x90, 0x42, 0x80, 0xa0, 0x06, 0x80, 0x50, 0x43, 0x85, 0xa6, 0x45, 0x7d, 0x42, 0x81, 0xe1, 0x07,
+  0x80, 0x70, 0x4a, 0x81, 0xd3, 0x09, 0x81, 0x3b, 0x46, 0x82, 0xe9, 0x10, 0x0c, 0x86, 0x14, 0x67,
+  0x76, 0x30, 0x3f, 0x3f, 0x3f, 0x17, 0x3f, 0x3f, 0x3d, 0x88, 0x49, 0xde, 0xfe, 0xc8, 0x20, 0x08,
+  0x84, 0x10, 0x01, 0xa0, 0x48, 0x80, 0x70, 0x09, 0x81, 0x1c, 0x43, 0x82, 0xdc, 0xd0, 0x43, 0x80,
+  0x70, 0x08, 0x80, 0x90, 0x42, 0x81, 0xa2, 0x02, 0x81, 0x2c, 0x42, 0x80, 0x40, 0x06, 0x84, 0x1e,
+  0xff, 0xb0, 0x06, 0x83, 0xcf, 0xfb, 0x06, 0x80, 0x60, 0x42, 0x80, 0x30, 0x06, 0x80, 0x30, 0x42,
+  0x80, 0x20, 0x04, 0x84, 0x19, 0xff, 0xe0, 0x08, 0x83, 0xdf, 0xf7, 0x05, 0x83, 0xbf, 0xfc, 0x08,
+  0x83, 0xbf, 0xfb, 0x05, 0x83, 0xbf, 0xfb, 0x08, 0x83, 0xaf, 0xfd, 0x05, 0x83, 0xaf, 0xfc, 0x07,
+  0x85, 0x1b, 0xff, 0xe1, 0x04, 0x83, 0x9f, 0xfe, 0x08, 0x80, 0xe0, 0x42, 0x80, 0x20, 0x04, 0x80,
+  0x60, 0x42, 0x80, 0x40, 0x06, 0x80, 0x40, 0x43, 0x80, 0x20, 0x04, 0x80, 0x10, 0x42, 0x80, 0xb0,
+  0x05, 0x81, 0x1c, 0x43, 0x80, 0x30, 0x05, 0x80, 0x90, 0x42, 0x81, 0xa2, 0x02, 0x83, 0x2b, 0xfe,
+  0x42, 0x80, 0x30, 0x05, 0x81, 0x1d, 0x43, 0x82, 0xcc, 0xd0, 0x42, 0x80, 0x60, 0x42, 0x80, 0x30,
+  0x06, 0x81, 0x1b, 0x47, 0x81, 0x52, 0x42, 0x80, 0x20, 0x08, 0x89, 0x49, 0xde, 0xec, 0x92, 0x04,
+  0x42, 0x12, 0x83, 0x6f, 0xfd, 0x12, 0x83, 0xbf, 0xfa, 0x11, 0x80, 0x10, 0x42, 0x80, 0x60, 0x11,
+  0x80, 0x80, 0x42, 0x80, 0x10, 0x0d, 0x83, 0x10, 0x04, 0x42, 0x80, 0x90, 0x08, 0x81, 0x83, 0x05,
+  0x80, 0x60, 0x42, 0x81, 0xe1, 0x08, 0x87, 0xdf, 0xd9, 0x78, 0x9d, 0x43, 0x80, 0x50, 0x09, 0x80,
+  0xd0, 0x48, 0x81, 0xe5, 0x0a, 0x81, 0x8d, 0x45, 0x82, 0xe9, 0x20, 0x0d, 0x86, 0x35, 0x77, 0x64,
+  0x10, 0x3f, 0x3f, 0x3f, 0x18, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x20, 0x84, 0x24, 0x55, 0x40, 0x11,
+  0x80, 0x60, 0x43, 0x11, 0x80, 0x60, 0x43, 0x80, 0x10, 0x10, 0x80, 0x60, 0x43, 0x11, 0x80, 0x60,
+  0x43, 0x11, 0x80, 0x60, 0x43, 0x80, 0x10, 0x3f, 0x3f, 0x31, 0x84, 0x25, 0x54, 0x50, 0x11, 0x80,
+  0x60, 0x43, 0x80, 0x10, 0x10, 0x80, 0x60, 0x43, 0x11, 0x80, 0x60, 0x43, 0x80, 0x10, 0x10, 0x80,
+  0x60, 0x43, 0x80, 0x10, 0x10, 0x80, 0x70, 0x43, 0x3f, 0x17, 0x80, 0x10, 0x3f, 0x3f, 0x16, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x20, 0x84, 0x24, 0x55, 0x40, 0x11, 0x80, 0x60, 0x43, 0x11, 0x80, 0x60,
+  0x43, 0x80, 0x10, 0x10, 0x80, 0x60, 0x43, 0x11, 0x80, 0x60, 0x43, 0x11, 0x80, 0x60, 0x43, 0x80,
+  0x10, 0x3f, 0x3f, 0x31, 0x85, 0x14, 0x44, 0x51, 0x10, 0x80, 0x20, 0x43, 0x80, 0x40, 0x10, 0x80,
+  0x30, 0x43, 0x80, 0x40, 0x10, 0x80, 0x30, 0x43, 0x80, 0x40, 0x10, 0x80, 0x40, 0x43, 0x80, 0x20,
+  0x10, 0x80, 0x80, 0x42, 0x80, 0xa0, 0x11, 0x80, 0xb0, 0x42, 0x80, 0x20, 0x11, 0x42, 0x80, 0x90,
+  0x11, 0x80, 0x40, 0x42, 0x80, 0x20, 0x11, 0x83, 0x8f, 0xf9, 0x0f, 0x86, 0x10, 0x0c, 0xfe, 0x10,
+  0x3f, 0x3e, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x13, 0x82, 0x4b, 0x20, 0x10, 0x85, 0x28, 0xef, 0xf2,
+  0x0e, 0x81, 0x5b, 0x44, 0x80, 0x20, 0x0b, 0x82, 0x29, 0xe0, 0x44, 0x82, 0xc7, 0x10, 0x08, 0x82,
+  0x16, 0xc0, 0x44, 0x82, 0xe9, 0x30, 0x09, 0x82, 0x39, 0xe0, 0x44, 0x81, 0xb5, 0x09, 0x82, 0x16,
+  0xc0, 0x44, 0x82, 0xd7, 0x10, 0x0a, 0x81, 0x5e, 0x43, 0x82, 0xe9, 0x30, 0x0d, 0x80, 0x70, 0x42,
+  0x81, 0xc5, 0x10, 0x80, 0x70, 0x43, 0x81, 0xa5, 0x0f, 0x82, 0x3a, 0xe0, 0x43, 0x82, 0xe9, 0x30,
+  0x0e, 0x82, 0x16, 0xd0, 0x44, 0x82, 0xd7, 0x20, 0x0e, 0x82, 0x39, 0xe0, 0x44, 0x81, 0xb6, 0x0f,
+  0x81, 0x6c, 0x44, 0x82, 0xe9, 0x40, 0x0e, 0x82, 0x38, 0xd0, 0x44, 0x81, 0xd1, 0x0f, 0x81, 0x5b,
+  0x43, 0x80, 0x20, 0x11, 0x84, 0x28, 0xdf, 0x20, 0x14, 0x81, 0x51, 0x3f, 0x3f, 0x3f, 0x3f, 0x15,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x32, 0x80, 0x10, 0x25, 0x80, 0x10, 0x03, 0x80, 0x70, 0x51, 0x80,
+  0x20, 0x02, 0x80, 0x70, 0x51, 0x80, 0x20, 0x02, 0x83, 0x7e, 0xfe, 0x4e, 0x80, 0x10, 0x3f, 0x1e,
+  0x80, 0x70, 0x51, 0x80, 0x20, 0x02, 0x80, 0x70, 0x51, 0x80, 0x20, 0x02, 0x80, 0x70, 0x51, 0x80,
+  0x20, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x31, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x02, 0x82, 0x68, 0x30,
+  0x13, 0x85, 0x7f, 0xfc, 0x61, 0x10, 0x80, 0x70, 0x43, 0x82, 0xe9, 0x30, 0x0e, 0x82, 0x29, 0xe0,
+  0x44, 0x82, 0xc7, 0x10, 0x0e, 0x81, 0x5b, 0x45, 0x81, 0x94, 0x0e, 0x82, 0x27, 0xc0, 0x44, 0x85,
+  0xd7, 0x10, 0x01, 0x0b, 0x82, 0x39, 0xe0, 0x44, 0x81, 0xa4, 0x0f, 0x81, 0x5a, 0x44, 0x81, 0xd1,
+  0x0f, 0x82, 0x26, 0xe0, 0x42, 0x80, 0x20, 0x0e, 0x82, 0x27, 0xc0, 0x43, 0x80, 0x20, 0x0b, 0x82,
+  0x15, 0xb0, 0x44, 0x82, 0xd8, 0x10, 0x09, 0x82, 0x39, 0xe0, 0x44, 0x81, 0xa4, 0x09, 0x82, 0x27,
+  0xd0, 0x44, 0x82, 0xd7, 0x20, 0x08, 0x82, 0x16, 0xc0, 0x44, 0x82, 0xe9, 0x40, 0x0a, 0x81, 0x5e,
+  0x44, 0x82, 0xc6, 0x10, 0x0c, 0x80, 0x70, 0x42, 0x82, 0xe9, 0x30, 0x0f, 0x84, 0x7f, 0xc6, 0x10,
+  0x11, 0x81, 0x33, 0x3f, 0x3f, 0x3f, 0x3f, 0x27, 0x3f, 0x3f, 0x3d, 0x89, 0x27, 0xbd, 0xfe, 0xeb,
+  0x61, 0x0a, 0x81, 0x2a, 0x48, 0x81, 0xd3, 0x09, 0x80, 0xb0, 0x43, 0x81, 0xed, 0x45, 0x80, 0x20,
+  0x08, 0x84, 0xbf, 0xd8, 0x30, 0x02, 0x81, 0x3c, 0x42, 0x80, 0xb0, 0x08, 0x82, 0xa7, 0x10, 0x06,
+  0x80, 0xc0, 0x42, 0x80, 0x10, 0x11, 0x80, 0x50, 0x42, 0x80, 0x40, 0x11, 0x80, 0x50, 0x42, 0x80,
+  0x30, 0x11, 0x84, 0x8f, 0xfe, 0x10, 0x10, 0x80, 0x30, 0x42, 0x80, 0x90, 0x10, 0x85, 0x3e, 0xff,
+  0xd1, 0x0f, 0x85, 0x4e, 0xff, 0xd2, 0x0f, 0x85, 0x3e, 0xff, 0xd3, 0x0f, 0x85, 0x2e, 0xff, 0xd2,
+  0x02, 0x80, 0x10, 0x0c, 0x84, 0xaf, 0xfe, 0x20, 0x10, 0x80, 0x10, 0x42, 0x80, 0x60, 0x11, 0x80,
+  0x40, 0x42, 0x80, 0x10, 0x11, 0x80, 0x50, 0x42, 0x12, 0x80, 0x50, 0x42, 0x12, 0x80, 0x50, 0x42,
+  0x13, 0x82, 0x11, 0x10, 0x29, 0x84, 0x37, 0x77, 0x10, 0x11, 0x80, 0x70, 0x42, 0x80, 0x20, 0x11,
+  0x80, 0x70, 0x42, 0x80, 0x20, 0x11, 0x80, 0x70, 0x42, 0x80, 0x20, 0x11, 0x80, 0x70, 0x42, 0x80,
+  0x20, 0x3f, 0x3f, 0x3f, 0x2f, 0x3f, 0x3f, 0x3f, 0x11, 0x80, 0x10, 0x1a, 0x88, 0x48, 0xcd, 0xef,
+  0xc8, 0x20, 0x0b, 0x81, 0x5d, 0x48, 0x80, 0x80, 0x09, 0x80, 0xa0, 0x42, 0x85, 0xeb, 0x98, 0x8c,
+  0x42, 0x80, 0x90, 0x07, 0x85, 0xaf, 0xfe, 0x61, 0x04, 0x84, 0x4e, 0xff, 0x50, 0x05, 0x84, 0x8f,
+  0xfd, 0x20, 0x07, 0x83, 0x3f, 0xfd, 0x04, 0x84, 0x3f, 0xfd, 0x10, 0x09, 0x83, 0x8f, 0xf4, 0x03,
+  0x83, 0xcf, 0xf4, 0x0a, 0x83, 0x2f, 0xf8, 0x02, 0x83, 0x3f, 0xf9, 0x05, 0x89, 0x26, 0x87, 0x40,
+  0x0e, 0xf9, 0x02, 0x83, 0x9f, 0xf3, 0x04, 0x80, 0x90, 0x44, 0x84, 0xc2, 0xdf, 0xa0, 0x02, 0x82,
+  0xdf, 0xd0, 0x04, 0x80, 0xc0, 0x46, 0x89, 0xed, 0xfb, 0x00, 0x1f, 0xf9, 0x03, 0x88, 0x8f, 0xfe,
+  0x51, 0x04, 0xc0, 0x42, 0x86, 0xb0, 0x04, 0xff, 0x60, 0x02, 0x84, 0x2f, 0xfe, 0x20, 0x04, 0x89,
+  0xcf, 0xfa, 0x00, 0x6f, 0xf4, 0x02, 0x83, 0x6f, 0xf6, 0x05, 0x89, 0x3f, 0xfa, 0x00, 0x7f, 0xf3,
+  0x02, 0x83, 0x9f, 0xf2, 0x06, 0x88, 0xef, 0xb0, 0x08, 0xff, 0x20, 0x02, 0x82, 0xbf, 0xf0, 0x07,
+  0x88, 0xcf, 0xb0, 0x08, 0xff, 0x20, 0x02, 0x82, 0xbf, 0xf0, 0x07, 0x88, 0xcf, 0xa0, 0x06, 0xff,
+  0x30, 0x02, 0x83, 0x9f, 0xf2, 0x06, 0x88, 0xef, 0xb0, 0x05, 0xff, 0x40, 0x02, 0x83, 0x6f, 0xf7,
+  0x05, 0x89, 0x3f, 0xfb, 0x00, 0x4f, 0xf7, 0x02, 0x84, 0x1f, 0xfe, 0x20, 0x03, 0x84, 0x1c, 0xff,
+  0xa0, 0x02, 0x82, 0xff, 0xa0, 0x03, 0x88, 0x8f, 0xfd, 0x51, 0x14, 0xc0, 0x42, 0x80, 0xb0, 0x02,
+  0x83, 0xbf, 0xe1, 0x02, 0x81, 0x1c, 0x46, 0x83, 0xed, 0xfb, 0x02, 0x83, 0x7f, 0xf6, 0x04, 0x80,
+  0x90, 0x44, 0x84, 0xd2, 0xdf, 0xa0, 0x02, 0x84, 0x1e, 0xfd, 0x10, 0x04, 0x89, 0x26, 0x87, 0x40,
+  0x02, 0x22, 0x03, 0x83, 0x8f, 0xf9, 0x13, 0x83, 0xcf, 0xf6, 0x12, 0x80, 0x30, 0x42, 0x80, 0x80,
+  0x12, 0x86, 0x4e, 0xff, 0xd5, 0x10, 0x05, 0x80, 0x10, 0x09, 0x81, 0x3d, 0x42, 0x87, 0xeb, 0x98,
+  0x9a, 0xec, 0x0a, 0x82, 0x17, 0xe0, 0x48, 0x80, 0x20, 0x0b, 0x8a, 0x15, 0x9c, 0xef, 0xfd, 0xb6,
+  0x10, 0x3f, 0x1f, 0x3f, 0x3f, 0x3f, 0x80, 0x70, 0x43, 0x80, 0x20, 0x10, 0x80, 0xc0, 0x43, 0x80,
+  0x70, 0x0f, 0x80, 0x20, 0x44, 0x80, 0xb0, 0x0f, 0x83, 0x6f, 0xfa, 0x42, 0x80, 0x10, 0x0e, 0x87,
+  0xbf, 0xf5, 0xaf, 0xf5, 0x0d, 0x88, 0x1e, 0xff, 0x16, 0xff, 0xa0, 0x0d, 0x89, 0x5f, 0xfc, 0x02,
+  0xff, 0xe1, 0x0c, 0x89, 0xaf, 0xf8, 0x00, 0xdf, 0xf4, 0x0c, 0x89, 0xef, 0xf3, 0x00, 0x9f, 0xf9,
+  0x0b, 0x83, 0x4f, 0xfe, 0x02, 0x83, 0x5f, 0xfe, 0x0b, 0x83, 0x9f, 0xfa, 0x03, 0x42, 0x80, 0x30,
+  0x0a, 0x83, 0xdf, 0xf6, 0x03, 0x83, 0xbf, 0xf8, 0x09, 0x80, 0x30, 0x42, 0x80, 0x20, 0x03, 0x83,
+  0x7f, 0xfd, 0x09, 0x83, 0x7f, 0xfd, 0x04, 0x80, 0x30, 0x42, 0x80, 0x20, 0x08, 0x83, 0xcf, 0xf8,
+  0x05, 0x83, 0xef, 0xf7, 0x07, 0x80, 0x10, 0x42, 0x80, 0x40, 0x05, 0x83, 0x9f, 0xfc, 0x07, 0x80,
+  0x60, 0x42, 0x87, 0xdc, 0xdd, 0xcd, 0xdd, 0x42, 0x80, 0x10, 0x06, 0x80, 0xb0, 0x4d, 0x80, 0x60,
+  0x05, 0x80, 0x10, 0x4e, 0x80, 0xb0, 0x05, 0x80, 0x50, 0x42, 0x80, 0x10, 0x07, 0x84, 0x7f, 0xfe,
+  0x10, 0x04, 0x83, 0xaf, 0xfc, 0x08, 0x80, 0x20, 0x42, 0x80, 0x50, 0x04, 0x83, 0xef, 0xf8, 0x09,
+  0x83, 0xef, 0xf9, 0x03, 0x80, 0x40, 0x42, 0x80, 0x40, 0x09, 0x84, 0x9f, 0xfe, 0x10, 0x02, 0x80,
+  0x90, 0x42, 0x0a, 0x80, 0x50, 0x42, 0x80, 0x40, 0x02, 0x83, 0xdf, 0xfb, 0x0a, 0x80, 0x10, 0x42,
+  0x83, 0x90, 0x03, 0x42, 0x80, 0x70, 0x0b, 0x83, 0xcf, 0xfd, 0x3f, 0x3f, 0x3f, 0x27, 0x3f, 0x3f,
+  0x39, 0x80, 0x10, 0x47, 0x84, 0xed, 0xb7, 0x10, 0x08, 0x80, 0x10, 0x4c, 0x80, 0x70, 0x07, 0x80,
+  0x10, 0x42, 0x85, 0xee, 0xed, 0xee, 0x44, 0x80, 0x90, 0x06, 0x80, 0x10, 0x42, 0x80, 0x70, 0x04,
+  0x82, 0x16, 0xd0, 0x42, 0x80, 0x40, 0x05, 0x80, 0x10, 0x42, 0x80, 0x70, 0x06, 0x84, 0x2e, 0xff,
+  0xb0, 0x05, 0x80, 0x10, 0x42, 0x80, 0x70, 0x07, 0x80, 0xa0, 0x42, 0x05, 0x80, 0x10, 0x42, 0x80,
+  0x70, 0x07, 0x80, 0x80, 0x42, 0x80, 0x10, 0x04, 0x80, 0x10, 0x42, 0x80, 0x80, 0x07, 0x80, 0x90,
+  0x42, 0x05, 0x80, 0x10, 0x42, 0x80, 0x70, 0x07, 0x83, 0xcf, 0xfd, 0x05, 0x80, 0x10, 0x42, 0x80,
+  0x70, 0x06, 0x80, 0x40, 0x42, 0x80, 0x80, 0x05, 0x80, 0x10, 0x42, 0x80, 0x80, 0x03, 0x87, 0x13,
+  0x8e, 0xff, 0xd1, 0x05, 0x80, 0x10, 0x4c, 0x81, 0xb2, 0x06, 0x80, 0x10, 0x4a, 0x82, 0xe8, 0x10,
+  0x07, 0x80, 0x10, 0x42, 0x85, 0xed, 0xdd, 0xdd, 0x44, 0x80, 0x60, 0x06, 0x80, 0x10, 0x42, 0x80,
+  0x80, 0x05, 0x81, 0x4a, 0x42, 0x80, 0x70, 0x05, 0x80, 0x10, 0x42, 0x80, 0x70, 0x07, 0x80, 0x80,
+  0x42, 0x80, 0x20, 0x04, 0x80, 0x10, 0x42, 0x80, 0x70, 0x08, 0x83, 0xef, 0xf9, 0x04, 0x80, 0x10,
+  0x42, 0x80, 0x70, 0x08, 0x83, 0xaf, 0xfd, 0x04, 0x80, 0x10, 0x42, 0x80, 0x70, 0x08, 0x83, 0x9f,
+  0xfe, 0x04, 0x80, 0x10, 0x42, 0x80, 0x70, 0x08, 0x83, 0xaf, 0xfe, 0x04, 0x80, 0x10, 0x42, 0x80,
+  0x70, 0x08, 0x83, 0xdf, 0xfc, 0x04, 0x80, 0x10, 0x42, 0x80, 0x70, 0x04, 0x83, 0x10, 0x07, 0x42,
+  0x80, 0x80, 0x04, 0x80, 0x10, 0x42, 0x80, 0x70, 0x02, 0x84, 0x10, 0x03, 0x90, 0x43, 0x80, 0x20,
+  0x04, 0x80, 0x10, 0x42, 0x85, 0xed, 0xed, 0xee, 0x45, 0x80, 0x60, 0x05, 0x80, 0x10, 0x4c, 0x81,
+  0xd5, 0x06, 0x80, 0x10, 0x47, 0x84, 0xee, 0xc9, 0x50, 0x3f, 0x3f, 0x3f, 0x2c, 0x3f, 0x3f, 0x3f,
+  0x89, 0x16, 0xbd, 0xef, 0xdb, 0x83, 0x0b, 0x80, 0x70, 0x49, 0x80, 0xa0, 0x08, 0x81, 0x1b, 0x44,
+  0x81, 0xee, 0x43, 0x80, 0xd0, 0x08, 0x80, 0xb0, 0x42, 0x82, 0xd5, 0x10, 0x02, 0x83, 0x49, 0xfd,
+  0x07, 0x80, 0x60, 0x42, 0x80, 0xa0, 0x07, 0x81, 0x29, 0x06, 0x85, 0x1e, 0xff, 0xd1, 0x10, 0x80,
+  0x60, 0x42, 0x80, 0x50, 0x11, 0x83, 0xcf, 0xfe, 0x11, 0x80, 0x10, 0x42, 0x80, 0xa0, 0x11, 0x80,
+  0x30, 0x42, 0x80, 0x70, 0x11, 0x80, 0x60, 0x42, 0x80, 0x50, 0x11, 0x80, 0x70, 0x42, 0x80, 0x30,
+  0x11, 0x80, 0x80, 0x42, 0x80, 0x30, 0x11, 0x80, 0x80, 0x42, 0x80, 0x20, 0x11, 0x80, 0x70, 0x42,
+  0x80, 0x30, 0x11, 0x80, 0x70, 0x42, 0x80, 0x40, 0x11, 0x80, 0x50, 0x42, 0x80, 0x60, 0x11, 0x80,
+  0x20, 0x42, 0x80, 0x80, 0x12, 0x83, 0xef, 0xfb, 0x12, 0x80, 0x90, 0x42, 0x80, 0x10, 0x11, 0x80,
+  0x40, 0x42, 0x80, 0x90, 0x12, 0x80, 0xb0, 0x42, 0x80, 0x40, 0x08, 0x80, 0x30, 0x07, 0x80, 0x20,
+  0x42, 0x81, 0xe5, 0x05, 0x82, 0x19, 0xd0, 0x08, 0x80, 0x50, 0x43, 0x88, 0xd8, 0x66, 0x8b, 0xff,
+  0xd0, 0x09, 0x81, 0x5e, 0x49, 0x80, 0xd0, 0x0a, 0x82, 0x19, 0xd0, 0x46, 0x81, 0xb3, 0x0c, 0x87,
+  0x13, 0x66, 0x76, 0x41, 0x3f, 0x3f, 0x3f, 0x14, 0x3f, 0x3f, 0x39, 0x80, 0x90, 0x44, 0x85, 0xed,
+  0xc8, 0x51, 0x0a, 0x80, 0x90, 0x49, 0x81, 0xe7, 0x09, 0x80, 0x90, 0x42, 0x82, 0xee, 0xe0, 0x45,
+  0x81, 0xb1, 0x07, 0x80, 0x90, 0x42, 0x03, 0x82, 0x37, 0xe0, 0x42, 0x80, 0xc0, 0x07, 0x80, 0x90,
+  0x42, 0x05, 0x81, 0x1a, 0x42, 0x80, 0x80, 0x06, 0x80, 0x90, 0x42, 0x07, 0x80, 0xc0, 0x42, 0x80,
+  0x10, 0x05, 0x80, 0x90, 0x42, 0x07, 0x80, 0x40, 0x42, 0x80, 0x70, 0x05, 0x80, 0x90, 0x42, 0x08,
+  0x83, 0xef, 0xfc, 0x05, 0x80, 0x90, 0x42, 0x08, 0x83, 0xaf, 0xfe, 0x05, 0x80, 0x90, 0x42, 0x08,
+  0x80, 0x80, 0x42, 0x80, 0x20, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x60, 0x42, 0x80, 0x40, 0x04,
+  0x80, 0x90, 0x42, 0x08, 0x80, 0x50, 0x42, 0x80, 0x50, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x50,
+  0x42, 0x80, 0x60, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x50, 0x42, 0x80, 0x60, 0x04, 0x80, 0x90,
+  0x42, 0x08, 0x80, 0x50, 0x42, 0x80, 0x50, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x60, 0x42, 0x80,
+  0x40, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x80, 0x42, 0x80, 0x30, 0x04, 0x80, 0x90, 0x42, 0x08,
+  0x80, 0xa0, 0x42, 0x05, 0x80, 0x90, 0x42, 0x08, 0x83, 0xef, 0xfc, 0x05, 0x80, 0x90, 0x42, 0x07,
+  0x80, 0x40, 0x42, 0x80, 0x70, 0x05, 0x80, 0x90, 0x42, 0x07, 0x80, 0xc0, 0x42, 0x80, 0x10, 0x05,
+  0x80, 0x90, 0x42, 0x06, 0x80, 0xa0, 0x42, 0x80, 0x80, 0x06, 0x80, 0x90, 0x42, 0x03, 0x82, 0x37,
+  0xe0, 0x42, 0x80, 0xc0, 0x07, 0x80, 0x90, 0x42, 0x82, 0xdd, 0xe0, 0x45, 0x81, 0xc1, 0x07, 0x80,
+  0x90, 0x49, 0x81, 0xd7, 0x09, 0x80, 0x90, 0x44, 0x85, 0xee, 0xc9, 0x41, 0x3f, 0x3f, 0x3f, 0x2e,
+  0x3f, 0x3f, 0x3a, 0x80, 0x80, 0x4e, 0x80, 0x10, 0x05, 0x80, 0x80, 0x4e, 0x80, 0x10, 0x05, 0x80,
+  0x80, 0x4e, 0x06, 0x80, 0x80, 0x42, 0x12, 0x80, 0x80, 0x42, 0x12, 0x80, 0x80, 0x42, 0x12, 0x80,
+  0x80, 0x42, 0x12, 0x80, 0x80, 0x42, 0x12, 0x80, 0x80, 0x42, 0x12, 0x80, 0x80, 0x42, 0x12, 0x80,
+  0x80, 0x42, 0x12, 0x80, 0x80, 0x4d, 0x80, 0x80, 0x06, 0x80, 0x80, 0x4d, 0x80, 0x80, 0x06, 0x80,
+  0x80, 0x42, 0x8b, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe8, 0x06, 0x80, 0x80, 0x42, 0x12, 0x80, 0x80,
+  0x42, 0x12, 0x80, 0x80, 0x42, 0x12, 0x80, 0x80, 0x42, 0x12, 0x80, 0x80, 0x42, 0x12, 0x80, 0x80,
+  0x42, 0x12, 0x80, 0x80, 0x42, 0x12, 0x80, 0x80, 0x42, 0x12, 0x80, 0x80, 0x42, 0x12, 0x80, 0x80,
+  0x4e, 0x80, 0x60, 0x05, 0x80, 0x80, 0x4e, 0x80, 0x60, 0x05, 0x80, 0x80, 0x4e, 0x80, 0x60, 0x3f,
+  0x3f, 0x3f, 0x28, 0x3f, 0x3f, 0x3b, 0x80, 0xe0, 0x4d, 0x80, 0x80, 0x06, 0x80, 0xe0, 0x4d, 0x80,
+  0x80, 0x06, 0x80, 0xe0, 0x4d, 0x80, 0x80, 0x06, 0x83, 0xef, 0xea, 0x12, 0x83, 0xef, 0xfa, 0x12,
+  0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12,
+  0x83, 0xef, 0xfa, 0x12, 0x83, 0xdf, 0xfa, 0x12, 0x80, 0xe0, 0x4c, 0x80, 0x70, 0x07, 0x80, 0xe0,
+  0x4c, 0x80, 0x70, 0x07, 0x80, 0xe0, 0x4b, 0x81, 0xe6, 0x07, 0x83, 0xef, 0xfb, 0x12, 0x83, 0xef,
+  0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef,
+  0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef,
+  0xfa, 0x12, 0x83, 0xdf, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x3f, 0x3f, 0x3f, 0x34, 0x3f, 0x3f, 0x3f,
+  0x88, 0x59, 0xce, 0xfe, 0xc8, 0x30, 0x0b, 0x81, 0x4d, 0x48, 0x81, 0xb2, 0x08, 0x80, 0x60, 0x44,
+  0x82, 0xed, 0xe0, 0x43, 0x80, 0x80, 0x07, 0x80, 0x50, 0x43, 0x89, 0x72, 0x10, 0x03, 0x8e, 0xf8,
+  0x06, 0x85, 0x2e, 0xff, 0xe3, 0x06, 0x82, 0x1a, 0x80, 0x06, 0x80, 0xa0, 0x42, 0x80, 0x40, 0x09,
+  0x80, 0x20, 0x05, 0x84, 0x1e, 0xff, 0xb0, 0x11, 0x80, 0x60, 0x42, 0x80, 0x50, 0x11, 0x80, 0xa0,
+  0x42, 0x80, 0x10, 0x11, 0x83, 0xdf, 0xfc, 0x12, 0x42, 0x80, 0xa0, 0x11, 0x80, 0x10, 0x42, 0x80,
+  0x90, 0x11, 0x80, 0x30, 0x42, 0x80, 0x80, 0x11, 0x80, 0x30, 0x42, 0x80, 0x80, 0x05, 0x80, 0xc0,
+  0x45, 0x80, 0x60, 0x03, 0x80, 0x20, 0x42, 0x80, 0x80, 0x05, 0x80, 0xc0, 0x45, 0x80, 0x60, 0x03,
+  0x80, 0x10, 0x42, 0x80, 0x90, 0x05, 0x83, 0xbd, 0xee, 0x42, 0x80, 0x60, 0x04, 0x42, 0x80, 0xb0,
+  0x09, 0x42, 0x80, 0x60, 0x04, 0x83, 0xcf, 0xfd, 0x09, 0x42, 0x80, 0x60, 0x04, 0x80, 0x80, 0x42,
+  0x80, 0x20, 0x08, 0x42, 0x80, 0x60, 0x04, 0x80, 0x40, 0x42, 0x80, 0x60, 0x08, 0x42, 0x80, 0x60,
+  0x05, 0x83, 0xdf, 0xfc, 0x08, 0x42, 0x80, 0x60, 0x05, 0x80, 0x60, 0x42, 0x80, 0x80, 0x07, 0x42,
+  0x80, 0x60, 0x06, 0x80, 0xc0, 0x42, 0x80, 0x80, 0x03, 0x82, 0x10, 0x20, 0x42, 0x80, 0x60, 0x06,
+  0x81, 0x2d, 0x42, 0x85, 0xe9, 0x66, 0x6a, 0x43, 0x80, 0x60, 0x07, 0x81, 0x1c, 0x4a, 0x80, 0x80,
+  0x0a, 0x81, 0x6d, 0x46, 0x81, 0xa3, 0x0d, 0x86, 0x25, 0x77, 0x64, 0x10, 0x20, 0x80, 0x10, 0x3f,
+  0x3f, 0x33, 0x3f, 0x3f, 0x39, 0x80, 0x90, 0x42, 0x08, 0x80, 0x50, 0x42, 0x80, 0x40, 0x04, 0x80,
+  0x90, 0x42, 0x08, 0x80, 0x50, 0x42, 0x80, 0x40, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x50, 0x42,
+  0x80, 0x40, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x50, 0x42, 0x80, 0x40, 0x04, 0x80, 0x90, 0x42,
+  0x08, 0x80, 0x50, 0x42, 0x80, 0x40, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x50, 0x42, 0x80, 0x40,
+  0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x50, 0x42, 0x80, 0x40, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80,
+  0x50, 0x42, 0x80, 0x40, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x50, 0x42, 0x80, 0x40, 0x04, 0x80,
+  0x90, 0x42, 0x08, 0x80, 0x40, 0x42, 0x80, 0x40, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x50, 0x42,
+  0x80, 0x40, 0x04, 0x80, 0x90, 0x4f, 0x80, 0x40, 0x04, 0x80, 0x90, 0x4f, 0x80, 0x40, 0x04, 0x80,
+  0x90, 0x42, 0x89, 0xee, 0xfe, 0xef, 0xee, 0xfe, 0x42, 0x80, 0x40, 0x04, 0x80, 0x90, 0x42, 0x08,
+  0x80, 0x40, 0x42, 0x80, 0x40, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x50, 0x42, 0x80, 0x40, 0x04,
+  0x80, 0x90, 0x42, 0x08, 0x80, 0x50, 0x42, 0x80, 0x40, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x50,
+  0x42, 0x80, 0x40, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x50, 0x42, 0x80, 0x40, 0x04, 0x80, 0x90,
+  0x42, 0x08, 0x80, 0x50, 0x42, 0x80, 0x40, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x50, 0x42, 0x80,
+  0x40, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x50, 0x42, 0x80, 0x40, 0x04, 0x80, 0x90, 0x42, 0x08,
+  0x80, 0x50, 0x42, 0x80, 0x40, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x50, 0x42, 0x80, 0x40, 0x04,
+  0x80, 0x90, 0x42, 0x08, 0x80, 0x50, 0x42, 0x80, 0x40, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80, 0x40,
+  0x42, 0x80, 0x40, 0x3f, 0x3f, 0x3f, 0x28, 0x3f, 0x3f, 0x3a, 0x80, 0x70, 0x4d, 0x80, 0x20, 0x06,
+  0x80, 0x70, 0x4d, 0x80, 0x20, 0x06, 0x80, 0x70, 0x47, 0x80, 0xe0, 0x44, 0x80, 0x20, 0x0c, 0x83,
+  0xef, 0xf9, 0x12, 0x42, 0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x12, 0x83, 0xef, 0xf9, 0x12, 0x42,
+  0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x12, 0x42,
+  0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x12, 0x42,
+  0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x12, 0x83, 0xef, 0xf9, 0x12, 0x42,
+  0x80, 0x90, 0x04, 0x80, 0x10, 0x0c, 0x83, 0xef, 0xf9, 0x12, 0x42, 0x80, 0x90, 0x12, 0x83, 0xef,
+  0xf9, 0x0c, 0x81, 0x7e, 0x4c, 0x80, 0x20, 0x06, 0x80, 0x70, 0x4d, 0x80, 0x20, 0x06, 0x80, 0x70,
+  0x4d, 0x80, 0x20, 0x3f, 0x3f, 0x3f, 0x29, 0x3f, 0x3f, 0x3d, 0x80, 0x60, 0x48, 0x80, 0xc0, 0x0b,
+  0x80, 0x70, 0x48, 0x80, 0xc0, 0x0b, 0x84, 0x6f, 0xfe, 0xe0, 0x44, 0x80, 0xc0, 0x12, 0x83, 0xbf,
+  0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf,
+  0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf,
+  0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf,
+  0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xbf, 0xfc, 0x12, 0x83, 0xcf, 0xfc, 0x12, 0x83, 0xdf,
+  0xfb, 0x11, 0x80, 0x10, 0x42, 0x80, 0x90, 0x06, 0x82, 0x1b, 0x10, 0x07, 0x80, 0x50, 0x42, 0x80,
+  0x50, 0x06, 0x83, 0x1f, 0xe7, 0x05, 0x81, 0x1d, 0x42, 0x80, 0x20, 0x06, 0x80, 0x10, 0x42, 0x86,
+  0xea, 0x76, 0x69, 0xe0, 0x42, 0x80, 0x90, 0x07, 0x80, 0x10, 0x4b, 0x81, 0xc1, 0x08, 0x82, 0x38,
+  0xd0, 0x46, 0x82, 0xe8, 0x10, 0x0c, 0x86, 0x25, 0x77, 0x76, 0x30, 0x3f, 0x3f, 0x3f, 0x19, 0x3f,
+  0x3f, 0x39, 0x80, 0x90, 0x42, 0x09, 0x80, 0x70, 0x42, 0x81, 0xb1, 0x02, 0x80, 0x90, 0x42, 0x08,
+  0x80, 0x60, 0x42, 0x81, 0xb1, 0x03, 0x80, 0x90, 0x42, 0x07, 0x80, 0x50, 0x42, 0x81, 0xc1, 0x04,
+  0x80, 0x90, 0x42, 0x06, 0x85, 0x5e, 0xff, 0xc1, 0x05, 0x80, 0x90, 0x42, 0x05, 0x85, 0x4e, 0xff,
+  0xc1, 0x06, 0x80, 0x90, 0x42, 0x04, 0x80, 0x40, 0x42, 0x81, 0xc1, 0x07, 0x80, 0x90, 0x42, 0x03,
+  0x85, 0x4e, 0xff, 0xd2, 0x08, 0x80, 0x90, 0x42, 0x02, 0x85, 0x3e, 0xff, 0xd2, 0x09, 0x80, 0x90,
+  0x42, 0x87, 0x00, 0x3e, 0xff, 0xe2, 0x0a, 0x80, 0x90, 0x42, 0x86, 0x02, 0xdf, 0xfe, 0x20, 0x0b,
+  0x80, 0x90, 0x42, 0x81, 0x2d, 0x42, 0x80, 0x40, 0x0c, 0x80, 0x90, 0x42, 0x80, 0xc0, 0x43, 0x80,
+  0x90, 0x0c, 0x80, 0x90, 0x48, 0x80, 0x40, 0x0b, 0x80, 0x90, 0x44, 0x85, 0x5d, 0xff, 0xd1, 0x0a,
+  0x80, 0x90, 0x43, 0x82, 0x40, 0x50, 0x42, 0x80, 0xa0, 0x0a, 0x80, 0x90, 0x42, 0x80, 0x40, 0x02,
+  0x80, 0xa0, 0x42, 0x80, 0x50, 0x09, 0x80, 0x90, 0x42, 0x03, 0x85, 0x1e, 0xff, 0xe2, 0x08, 0x80,
+  0x90, 0x42, 0x04, 0x80, 0x50, 0x42, 0x80, 0xb0, 0x08, 0x80, 0x90, 0x42, 0x05, 0x80, 0xa0, 0x42,
+  0x80, 0x60, 0x07, 0x80, 0x90, 0x42, 0x05, 0x81, 0x1e, 0x42, 0x80, 0x20, 0x06, 0x80, 0x90, 0x42,
+  0x06, 0x80, 0x50, 0x42, 0x80, 0xc0, 0x06, 0x80, 0x90, 0x42, 0x07, 0x80, 0xb0, 0x42, 0x80, 0x70,
+  0x05, 0x80, 0x90, 0x42, 0x07, 0x81, 0x2e, 0x42, 0x80, 0x20, 0x04, 0x80, 0x90, 0x42, 0x08, 0x80,
+  0x60, 0x42, 0x80, 0xc0, 0x04, 0x80, 0x90, 0x42, 0x09, 0x80, 0xb0, 0x42, 0x80, 0x70, 0x03, 0x80,
+  0x90, 0x42, 0x09, 0x81, 0x2e, 0x42, 0x80, 0x30, 0x3f, 0x3f, 0x3f, 0x26, 0x3f, 0x3f, 0x3a, 0x80,
+  0x30, 0x42, 0x80, 0x50, 0x11, 0x80, 0x30, 0x42, 0x80, 0x50, 0x11, 0x80, 0x30, 0x42, 0x80, 0x50,
+  0x11, 0x80, 0x30, 0x42, 0x80, 0x50, 0x11, 0x80, 0x30, 0x42, 0x80, 0x50, 0x11, 0x80, 0x30, 0x42,
+  0x80, 0x50, 0x11, 0x80, 0x30, 0x42, 0x80, 0x50, 0x11, 0x80, 0x30, 0x42, 0x80, 0x50, 0x11, 0x80,
+  0x30, 0x42, 0x80, 0x50, 0x11, 0x80, 0x30, 0x42, 0x80, 0x50, 0x11, 0x80, 0x30, 0x42, 0x80, 0x50,
+  0x11, 0x80, 0x30, 0x42, 0x80, 0x50, 0x11, 0x80, 0x30, 0x42, 0x80, 0x50, 0x11, 0x80, 0x30, 0x42,
+  0x80, 0x50, 0x11, 0x80, 0x30, 0x42, 0x80, 0x50, 0x11, 0x80, 0x30, 0x42, 0x80, 0x50, 0x11, 0x80,
+  0x30, 0x42, 0x80, 0x50, 0x11, 0x80, 0x30, 0x42, 0x80, 0x50, 0x11, 0x80, 0x30, 0x42, 0x80, 0x50,
+  0x11, 0x80, 0x30, 0x42, 0x80, 0x50, 0x11, 0x80, 0x30, 0x42, 0x80, 0x60, 0x11, 0x80, 0x30, 0x42,
+  0x80, 0x50, 0x11, 0x80, 0x30, 0x42, 0x80, 0x50, 0x11, 0x80, 0x30, 0x4f, 0x05, 0x80, 0x40, 0x4f,
+  0x05, 0x80, 0x30, 0x4f, 0x3f, 0x3f, 0x3f, 0x28, 0x3f, 0x3f, 0x38, 0x80, 0x70, 0x43, 0x80, 0x60,
+  0x07, 0x80, 0xc0, 0x43, 0x80, 0x20, 0x02, 0x80, 0x70, 0x43, 0x80, 0xc0, 0x06, 0x80, 0x20, 0x44,
+  0x80, 0x20, 0x02, 0x80, 0x80, 0x44, 0x80, 0x20, 0x05, 0x80, 0x80, 0x44, 0x80, 0x20, 0x02, 0x86,
+  0x7f, 0xfd, 0xff, 0x70, 0x05, 0x82, 0xdf, 0xd0, 0x42, 0x80, 0x20, 0x02, 0x86, 0x7f, 0xfc, 0xbf,
+  0xc0, 0x04, 0x83, 0x3f, 0xf7, 0x42, 0x80, 0x20, 0x02, 0x87, 0x7f, 0xfc, 0x5f, 0xf2, 0x03, 0x83,
+  0x8f, 0xe3, 0x42, 0x80, 0x20, 0x02, 0x87, 0x7f, 0xfc, 0x1f, 0xf7, 0x03, 0x83, 0xdf, 0xa2, 0x42,
+  0x80, 0x20, 0x02, 0x87, 0x7f, 0xfc, 0x0a, 0xfc, 0x02, 0x84, 0x3f, 0xf5, 0x20, 0x42, 0x80, 0x20,
+  0x02, 0x8f, 0x7f, 0xfc, 0x05, 0xff, 0x20, 0x09, 0xfe, 0x02, 0x42, 0x80, 0x20, 0x02, 0x8f, 0x7f,
+  0xfc, 0x01, 0xef, 0x80, 0x0d, 0xf9, 0x02, 0x42, 0x80, 0x20, 0x02, 0x8f, 0x7f, 0xfc, 0x00, 0xaf,
+  0xd0, 0x4f, 0xf5, 0x02, 0x42, 0x80, 0x20, 0x02, 0x8f, 0x8f, 0xfc, 0x00, 0x5f, 0xf3, 0x9f, 0xe1,
+  0x02, 0x42, 0x80, 0x20, 0x02, 0x8f, 0x7f, 0xfc, 0x00, 0x1e, 0xf8, 0xef, 0x90, 0x02, 0x42, 0x80,
+  0x20, 0x02, 0x83, 0x7f, 0xfc, 0x02, 0x80, 0xa0, 0x43, 0x83, 0x40, 0x02, 0x42, 0x80, 0x20, 0x02,
+  0x83, 0x7f, 0xfc, 0x02, 0x80, 0x50, 0x42, 0x80, 0xe0, 0x02, 0x80, 0x20, 0x42, 0x80, 0x20, 0x02,
+  0x83, 0x7f, 0xfc, 0x03, 0x83, 0xef, 0xf9, 0x02, 0x80, 0x20, 0x42, 0x80, 0x20, 0x02, 0x83, 0x7f,
+  0xfc, 0x03, 0x83, 0x7b, 0xb3, 0x02, 0x80, 0x20, 0x42, 0x80, 0x20, 0x02, 0x83, 0x7f, 0xfc, 0x0a,
+  0x80, 0x20, 0x42, 0x80, 0x20, 0x02, 0x83, 0x7f, 0xfc, 0x0a, 0x80, 0x20, 0x42, 0x80, 0x20, 0x02,
+  0x83, 0x7f, 0xfc, 0x0a, 0x80, 0x20, 0x42, 0x80, 0x20, 0x02, 0x83, 0x7f, 0xfc, 0x0a, 0x80, 0x20,
+  0x42, 0x80, 0x20, 0x02, 0x83, 0x7f, 0xfc, 0x0a, 0x80, 0x20, 0x42, 0x80, 0x20, 0x02, 0x83, 0x7f,
+  0xfc, 0x0a, 0x80, 0x20, 0x42, 0x80, 0x20, 0x02, 0x83, 0x7f, 0xfc, 0x0a, 0x80, 0x20, 0x42, 0x80,
+  0x20, 0x02, 0x83, 0x7f, 0xfc, 0x0a, 0x80, 0x20, 0x42, 0x80, 0x20, 0x02, 0x83, 0x7f, 0xfc, 0x0a,
+  0x80, 0x20, 0x42, 0x80, 0x20, 0x3f, 0x3f, 0x3f, 0x27, 0x3f, 0x3f, 0x39, 0x80, 0x80, 0x43, 0x80,
+  0x20, 0x06, 0x80, 0x30, 0x42, 0x80, 0x40, 0x04, 0x80, 0x80, 0x43, 0x80, 0x80, 0x06, 0x80, 0x30,
+  0x42, 0x80, 0x40, 0x04, 0x80, 0x80, 0x43, 0x81, 0xe1, 0x05, 0x80, 0x30, 0x42, 0x80, 0x40, 0x04,
+  0x80, 0x80, 0x44, 0x80, 0x60, 0x05, 0x80, 0x30, 0x42, 0x80, 0x40, 0x04, 0x80, 0x80, 0x44, 0x80,
+  0xc0, 0x05, 0x80, 0x30, 0x42, 0x80, 0x40, 0x04, 0x87, 0x8f, 0xfe, 0xbf, 0xf3, 0x04, 0x80, 0x30,
+  0x42, 0x80, 0x40, 0x04, 0x87, 0x8f, 0xfd, 0x5f, 0xf9, 0x04, 0x80, 0x30, 0x42, 0x80, 0x40, 0x04,
+  0x88, 0x8f, 0xfd, 0x0e, 0xff, 0x10, 0x03, 0x80, 0x30, 0x42, 0x80, 0x40, 0x04, 0x88, 0x8f, 0xfd,
+  0x08, 0xff, 0x70, 0x03, 0x80, 0x30, 0x42, 0x80, 0x40, 0x04, 0x88, 0x8f, 0xfd, 0x02, 0xff, 0xd0,
+  0x03, 0x80, 0x30, 0x42, 0x80, 0x40, 0x04, 0x89, 0x8f, 0xfd, 0x00, 0xaf, 0xf4, 0x02, 0x80, 0x30,
+  0x42, 0x80, 0x40, 0x04, 0x89, 0x8f, 0xfd, 0x00, 0x4f, 0xfa, 0x02, 0x80, 0x30, 0x42, 0x80, 0x40,
+  0x04, 0x83, 0x9f, 0xfd, 0x02, 0x86, 0xdf, 0xf2, 0x00, 0x30, 0x42, 0x80, 0x40, 0x04, 0x83, 0x9f,
+  0xfe, 0x02, 0x86, 0x6f, 0xf8, 0x00, 0x30, 0x42, 0x80, 0x40, 0x04, 0x83, 0x9f, 0xfd, 0x02, 0x86,
+  0x1e, 0xfd, 0x10, 0x30, 0x42, 0x80, 0x40, 0x04, 0x83, 0x9f, 0xfd, 0x03, 0x85, 0x9f, 0xf5, 0x03,
+  0x42, 0x80, 0x40, 0x04, 0x83, 0x9f, 0xfd, 0x03, 0x85, 0x3f, 0xfc, 0x03, 0x42, 0x80, 0x40, 0x04,
+  0x83, 0x9f, 0xfd, 0x04, 0x84, 0xcf, 0xf3, 0x30, 0x42, 0x80, 0x40, 0x04, 0x83, 0x9f, 0xfd, 0x04,
+  0x84, 0x6f, 0xf9, 0x30, 0x42, 0x80, 0x40, 0x04, 0x83, 0x9f, 0xfd, 0x05, 0x83, 0xef, 0xe4, 0x42,
+  0x80, 0x40, 0x04, 0x83, 0x9f, 0xfd, 0x05, 0x83, 0x8f, 0xf9, 0x42, 0x80, 0x40, 0x04, 0x83, 0x9f,
+  0xfd, 0x05, 0x83, 0x2f, 0xfe, 0x42, 0x80, 0x40, 0x04, 0x83, 0x9f, 0xfd, 0x06, 0x80, 0xb0, 0x44,
+  0x80, 0x40, 0x04, 0x83, 0x9f, 0xfd, 0x06, 0x80, 0x50, 0x44, 0x80, 0x40, 0x04, 0x83, 0x9f, 0xfd,
+  0x07, 0x80, 0xd0, 0x43, 0x80, 0x40, 0x04, 0x83, 0x9f, 0xfd, 0x07, 0x80, 0x70, 0x43, 0x80, 0x40,
+  0x3f, 0x3f, 0x3f, 0x28, 0x3f, 0x3f, 0x3d, 0x88, 0x15, 0xbd, 0xee, 0xd9, 0x40, 0x0c, 0x81, 0x3c,
+  0x47, 0x81, 0xa1, 0x09, 0x81, 0x2e, 0x43, 0x81, 0xee, 0x43, 0x80, 0xc0, 0x09, 0x80, 0xd0, 0x42,
+  0x85, 0x81, 0x00, 0x3b, 0x42, 0x80, 0x80, 0x07, 0x80, 0x60, 0x42, 0x80, 0x70, 0x05, 0x80, 0xc0,
+  0x42, 0x80, 0x10, 0x06, 0x83, 0xcf, 0xfd, 0x06, 0x80, 0x30, 0x42, 0x80, 0x80, 0x05, 0x80, 0x20,
+  0x42, 0x80, 0x80, 0x07, 0x83, 0xcf, 0xfc, 0x05, 0x80, 0x60, 0x42, 0x80, 0x40, 0x07, 0x80, 0x90,
+  0x42, 0x80, 0x10, 0x04, 0x80, 0x80, 0x42, 0x80, 0x10, 0x07, 0x80, 0x60, 0x42, 0x80, 0x40, 0x04,
+  0x83, 0xbf, 0xfe, 0x08, 0x80, 0x40, 0x42, 0x80, 0x60, 0x04, 0x83, 0xdf, 0xfd, 0x08, 0x80, 0x30,
+  0x42, 0x80, 0x70, 0x04, 0x83, 0xdf, 0xfc, 0x08, 0x80, 0x20, 0x42, 0x80, 0x80, 0x04, 0x83, 0xdf,
+  0xfc, 0x08, 0x80, 0x20, 0x42, 0x80, 0x90, 0x04, 0x83, 0xef, 0xfc, 0x08, 0x80, 0x20, 0x42, 0x80,
+  0x90, 0x04, 0x83, 0xef, 0xfc, 0x08, 0x80, 0x20, 0x42, 0x80, 0x90, 0x04, 0x83, 0xdf, 0xfc, 0x08,
+  0x80, 0x20, 0x42, 0x80, 0x80, 0x04, 0x83, 0xcf, 0xfe, 0x08, 0x80, 0x40, 0x42, 0x80, 0x70, 0x04,
+  0x80, 0xa0, 0x42, 0x08, 0x80, 0x50, 0x42, 0x80, 0x50, 0x04, 0x80, 0x70, 0x42, 0x80, 0x20, 0x07,
+  0x80, 0x70, 0x42, 0x80, 0x20, 0x04, 0x80, 0x40, 0x42, 0x80, 0x60, 0x07, 0x83, 0xaf, 0xfe, 0x06,
+  0x42, 0x80, 0xa0, 0x06, 0x84, 0x1e, 0xff, 0xa0, 0x06, 0x80, 0xa0, 0x42, 0x80, 0x20, 0x05, 0x80,
+  0x70, 0x42, 0x80, 0x50, 0x06, 0x80, 0x30, 0x42, 0x81, 0xc1, 0x03, 0x84, 0x4e, 0xff, 0xc0, 0x08,
+  0x80, 0x80, 0x42, 0x84, 0xe9, 0x67, 0xa0, 0x43, 0x80, 0x30, 0x09, 0x80, 0xa0, 0x49, 0x80, 0x50,
+  0x0b, 0x81, 0x6d, 0x45, 0x81, 0xb3, 0x0e, 0x85, 0x35, 0x77, 0x52, 0x3f, 0x3f, 0x3f, 0x17, 0x3f,
+  0x3f, 0x3a, 0x80, 0x80, 0x47, 0x83, 0xec, 0x94, 0x09, 0x80, 0x80, 0x4b, 0x81, 0xc3, 0x07, 0x80,
+  0x80, 0x42, 0x84, 0xee, 0xed, 0xe0, 0x45, 0x80, 0x30, 0x06, 0x80, 0x80, 0x42, 0x04, 0x82, 0x15,
+  0xd0, 0x42, 0x81, 0xe1, 0x05, 0x80, 0x70, 0x42, 0x06, 0x81, 0x1c, 0x42, 0x80, 0x70, 0x05, 0x80,
+  0x80, 0x42, 0x07, 0x80, 0x30, 0x42, 0x80, 0xb0, 0x05, 0x83, 0x8e, 0xff, 0x08, 0x80, 0xd0, 0x42,
+  0x05, 0x80, 0x80, 0x42, 0x08, 0x80, 0xa0, 0x42, 0x80, 0x10, 0x04, 0x80, 0x80, 0x42, 0x08, 0x80,
+  0xb0, 0x42, 0x05, 0x80, 0x80, 0x42, 0x08, 0x83, 0xdf, 0xfe, 0x05, 0x80, 0x80, 0x42, 0x07, 0x80,
+  0x30, 0x42, 0x80, 0xb0, 0x05, 0x80, 0x80, 0x42, 0x06, 0x81, 0x1d, 0x42, 0x80, 0x60, 0x05, 0x80,
+  0x80, 0x42, 0x04, 0x82, 0x26, 0xe0, 0x42, 0x81, 0xd1, 0x05, 0x80, 0x80, 0x4d, 0x80, 0x30, 0x06,
+  0x80, 0x80, 0x4b, 0x81, 0xb2, 0x07, 0x80, 0x80, 0x42, 0x88, 0xdd, 0xde, 0xdc, 0xa8, 0x30, 0x09,
+  0x80, 0x80, 0x42, 0x12, 0x80, 0x80, 0x42, 0x12, 0x80, 0x80, 0x42, 0x12, 0x80, 0x80, 0x42, 0x12,
+  0x80, 0x80, 0x42, 0x12, 0x80, 0x80, 0x42, 0x12, 0x80, 0x80, 0x42, 0x12, 0x80, 0x80, 0x42, 0x12,
+  0x80, 0x80, 0x42, 0x12, 0x80, 0x80, 0x42, 0x3f, 0x3f, 0x3f, 0x35, 0x3f, 0x3f, 0x3d, 0x88, 0x15,
+  0xbd, 0xee, 0xd9, 0x40, 0x0c, 0x81, 0x3c, 0x47, 0x81, 0xa1, 0x09, 0x81, 0x2e, 0x43, 0x81, 0xee,
+  0x43, 0x80, 0xc0, 0x09, 0x80, 0xd0, 0x42, 0x85, 0x81, 0x00, 0x3b, 0x42, 0x80, 0x80, 0x07, 0x80,
+  0x60, 0x42, 0x80, 0x70, 0x05, 0x80, 0xc0, 0x42, 0x80, 0x10, 0x06, 0x83, 0xcf, 0xfd, 0x06, 0x80,
+  0x30, 0x42, 0x80, 0x80, 0x05, 0x80, 0x20, 0x42, 0x80, 0x80, 0x07, 0x83, 0xcf, 0xfc, 0x05, 0x80,
+  0x60, 0x42, 0x80, 0x40, 0x07, 0x80, 0x90, 0x42, 0x80, 0x10, 0x04, 0x80, 0x80, 0x42, 0x80, 0x10,
+  0x07, 0x80, 0x60, 0x42, 0x80, 0x40, 0x04, 0x83, 0xbf, 0xfe, 0x08, 0x80, 0x50, 0x42, 0x80, 0x60,
+  0x04, 0x83, 0xdf, 0xfd, 0x08, 0x80, 0x30, 0x42, 0x80, 0x70, 0x04, 0x83, 0xdf, 0xfc, 0x08, 0x80,
+  0x20, 0x42, 0x80, 0x80, 0x04, 0x83, 0xdf, 0xfc, 0x08, 0x80, 0x20, 0x42, 0x80, 0x90, 0x04, 0x83,
+  0xef, 0xfc, 0x08, 0x80, 0x20, 0x42, 0x80, 0x90, 0x04, 0x83, 0xef, 0xfc, 0x08, 0x80, 0x20, 0x42,
+  0x80, 0x90, 0x04, 0x83, 0xdf, 0xfc, 0x08, 0x80, 0x20, 0x42, 0x80, 0x80, 0x04, 0x83, 0xcf, 0xfe,
+  0x08, 0x80, 0x40, 0x42, 0x80, 0x70, 0x04, 0x80, 0xa0, 0x42, 0x08, 0x80, 0x50, 0x42, 0x81, 0x51,
+  0x03, 0x80, 0x70, 0x42, 0x80, 0x20, 0x07, 0x80, 0x80, 0x42, 0x80, 0x20, 0x04, 0x80, 0x40, 0x42,
+  0x80, 0x60, 0x07, 0x83, 0xaf, 0xfe, 0x06, 0x83, 0xef, 0xfa, 0x06, 0x84, 0x1e, 0xff, 0xa0, 0x06,
+  0x80, 0x90, 0x42, 0x80, 0x20, 0x05, 0x80, 0x70, 0x42, 0x80, 0x50, 0x06, 0x80, 0x20, 0x42, 0x81,
+  0xc1, 0x03, 0x84, 0x4e, 0xff, 0xd0, 0x08, 0x80, 0x80, 0x42, 0x84, 0xe8, 0x67, 0xa0, 0x43, 0x80,
+  0x30, 0x09, 0x80, 0xa0, 0x49, 0x80, 0x50, 0x0b, 0x81, 0x5d, 0x46, 0x80, 0x30, 0x0e, 0x83, 0x36,
+  0x79, 0x42, 0x80, 0xa0, 0x12, 0x80, 0x80, 0x42, 0x80, 0xa0, 0x12, 0x80, 0x80, 0x42, 0x81, 0xb1,
+  0x11, 0x83, 0x9f, 0xf7, 0x13, 0x81, 0x73, 0x3f, 0x38, 0x3f, 0x3f, 0x39, 0x80, 0x70, 0x46, 0x84,
+  0xee, 0xc8, 0x30, 0x09, 0x80, 0x70, 0x4b, 0x81, 0xb2, 0x07, 0x80, 0x70, 0x42, 0x84, 0xee, 0xee,
+  0xe0, 0x44, 0x81, 0xd2, 0x06, 0x80, 0x70, 0x42, 0x80, 0x10, 0x03, 0x82, 0x16, 0xe0, 0x42, 0x80,
+  0xb0, 0x06, 0x80, 0x70, 0x42, 0x80, 0x10, 0x05, 0x81, 0x1d, 0x42, 0x80, 0x30, 0x05, 0x80, 0x70,
+  0x42, 0x80, 0x10, 0x06, 0x80, 0x60, 0x42, 0x80, 0x80, 0x05, 0x80, 0x70, 0x42, 0x80, 0x20, 0x06,
+  0x80, 0x10, 0x42, 0x80, 0xa0, 0x05, 0x80, 0x70, 0x42, 0x80, 0x10, 0x07, 0x42, 0x80, 0xb0, 0x05,
+  0x80, 0x70, 0x42, 0x80, 0x10, 0x06, 0x80, 0x10, 0x42, 0x80, 0xa0, 0x05, 0x80, 0x70, 0x42, 0x80,
+  0x10, 0x06, 0x80, 0x50, 0x42, 0x80, 0x70, 0x05, 0x80, 0x80, 0x42, 0x80, 0x10, 0x06, 0x80, 0xc0,
+  0x42, 0x80, 0x20, 0x05, 0x80, 0x70, 0x42, 0x80, 0x10, 0x04, 0x81, 0x5c, 0x42, 0x80, 0x70, 0x06,
+  0x80, 0x70, 0x42, 0x84, 0xee, 0xed, 0xe0, 0x44, 0x80, 0x70, 0x07, 0x80, 0x70, 0x49, 0x82, 0xe7,
+  0x10, 0x08, 0x80, 0x70, 0x4a, 0x81, 0xc3, 0x08, 0x80, 0x70, 0x42, 0x80, 0x10, 0x02, 0x86, 0x26,
+  0xef, 0xfe, 0x20, 0x07, 0x80, 0x70, 0x42, 0x80, 0x10, 0x04, 0x84, 0x2e, 0xff, 0xc0, 0x07, 0x80,
+  0x70, 0x42, 0x80, 0x10, 0x05, 0x80, 0x50, 0x42, 0x80, 0x60, 0x06, 0x80, 0x70, 0x42, 0x80, 0x10,
+  0x06, 0x83, 0xbf, 0xfd, 0x06, 0x80, 0x70, 0x42, 0x80, 0x10, 0x06, 0x80, 0x30, 0x42, 0x80, 0x60,
+  0x05, 0x80, 0x70, 0x42, 0x80, 0x10, 0x07, 0x83, 0xbf, 0xfd, 0x05, 0x80, 0x70, 0x42, 0x80, 0x10,
+  0x07, 0x80, 0x40, 0x42, 0x80, 0x60, 0x04, 0x80, 0x70, 0x42, 0x80, 0x10, 0x08, 0x84, 0xcf, 0xfd,
+  0x10, 0x03, 0x80, 0x70, 0x42, 0x80, 0x10, 0x08, 0x80, 0x50, 0x42, 0x80, 0x60, 0x03, 0x80, 0x70,
+  0x42, 0x80, 0x10, 0x09, 0x84, 0xdf, 0xfd, 0x10, 0x02, 0x80, 0x70, 0x42, 0x80, 0x10, 0x09, 0x80,
+  0x60, 0x42, 0x80, 0x60, 0x3f, 0x3f, 0x3f, 0x26, 0x3f, 0x3f, 0x3d, 0x8a, 0x17, 0xbd, 0xef, 0xec,
+  0x95, 0x10, 0x0a, 0x81, 0x6e, 0x49, 0x80, 0x90, 0x08, 0x80, 0x90, 0x44, 0x82, 0xed, 0xe0, 0x43,
+  0x80, 0xc0, 0x07, 0x80, 0x60, 0x42, 0x82, 0xd5, 0x10, 0x02, 0x84, 0x26, 0xbf, 0xc0, 0x06, 0x85,
+  0x1e, 0xff, 0xb1, 0x07, 0x81, 0x38, 0x06, 0x80, 0x40, 0x42, 0x80, 0x30, 0x11, 0x83, 0x7f, 0xfe,
+  0x12, 0x83, 0x8f, 0xfe, 0x12, 0x80, 0x70, 0x42, 0x80, 0x20, 0x11, 0x80, 0x40, 0x42, 0x80, 0xb0,
+  0x12, 0x80, 0xd0, 0x42, 0x82, 0xd6, 0x10, 0x0f, 0x80, 0x40, 0x45, 0x83, 0xda, 0x52, 0x0c, 0x81,
+  0x4d, 0x47, 0x81, 0xc5, 0x0c, 0x81, 0x6c, 0x47, 0x81, 0xb1, 0x0c, 0x83, 0x15, 0x8c, 0x44, 0x81,
+  0xc1, 0x0f, 0x82, 0x16, 0xe0, 0x42, 0x80, 0x70, 0x11, 0x84, 0x1d, 0xff, 0xe0, 0x10, 0x82, 0x10,
+  0x60, 0x42, 0x80, 0x20, 0x11, 0x80, 0x20, 0x42, 0x80, 0x40, 0x11, 0x80, 0x20, 0x42, 0x80, 0x40,
+  0x11, 0x80, 0x40, 0x42, 0x80, 0x20, 0x04, 0x81, 0x25, 0x0a, 0x83, 0xbf, 0xfe, 0x05, 0x83, 0x3f,
+  0xc6, 0x06, 0x81, 0x1a, 0x42, 0x80, 0x80, 0x05, 0x80, 0x30, 0x42, 0x87, 0xeb, 0x76, 0x57, 0xae,
+  0x42, 0x81, 0xe1, 0x05, 0x80, 0x30, 0x4c, 0x81, 0xd2, 0x07, 0x82, 0x38, 0xd0, 0x47, 0x82, 0xd7,
+  0x10, 0x0b, 0x87, 0x14, 0x67, 0x76, 0x52, 0x3f, 0x3f, 0x3f, 0x17, 0x3f, 0x3f, 0x37, 0x80, 0x30,
+  0x52, 0x83, 0xd0, 0x03, 0x52, 0x86, 0xd0, 0x02, 0xfe, 0xe0, 0x49, 0x80, 0xe0, 0x44, 0x80, 0xc0,
+  0x0a, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xf9, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xdf, 0xf9,
+  0x12, 0x83, 0xef, 0xf9, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa,
+  0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa,
+  0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa,
+  0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa,
+  0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x83, 0xef, 0xfa, 0x3f, 0x3f, 0x3f, 0x2f,
+  0x3f, 0x3f, 0x39, 0x80, 0x60, 0x42, 0x80, 0x20, 0x07, 0x80, 0x70, 0x42, 0x80, 0x10, 0x04, 0x80,
+  0x60, 0x42, 0x80, 0x20, 0x07, 0x80, 0x70, 0x42, 0x80, 0x10, 0x04, 0x80, 0x60, 0x42, 0x80, 0x20,
+  0x07, 0x80, 0x70, 0x42, 0x80, 0x10, 0x04, 0x80, 0x60, 0x42, 0x80, 0x20, 0x07, 0x80, 0x70, 0x42,
+  0x80, 0x10, 0x04, 0x80, 0x60, 0x42, 0x80, 0x20, 0x07, 0x80, 0x70, 0x42, 0x80, 0x10, 0x04, 0x80,
+  0x60, 0x42, 0x80, 0x20, 0x07, 0x80, 0x70, 0x42, 0x80, 0x10, 0x04, 0x80, 0x60, 0x42, 0x80, 0x20,
+  0x07, 0x80, 0x70, 0x42, 0x80, 0x10, 0x04, 0x80, 0x60, 0x42, 0x80, 0x20, 0x07, 0x80, 0x70, 0x42,
+  0x80, 0x10, 0x04, 0x80, 0x60, 0x42, 0x80, 0x20, 0x07, 0x80, 0x70, 0x42, 0x80, 0x10, 0x04, 0x80,
+  0x60, 0x42, 0x80, 0x20, 0x07, 0x80, 0x70, 0x42, 0x80, 0x10, 0x04, 0x80, 0x60, 0x42, 0x80, 0x20,
+  0x07, 0x80, 0x70, 0x42, 0x80, 0x10, 0x04, 0x80, 0x60, 0x42, 0x80, 0x20, 0x07, 0x80, 0x70, 0x42,
+  0x80, 0x10, 0x04, 0x80, 0x60, 0x42, 0x80, 0x20, 0x07, 0x80, 0x70, 0x42, 0x80, 0x10, 0x04, 0x80,
+  0x60, 0x42, 0x80, 0x20, 0x07, 0x80, 0x70, 0x42, 0x80, 0x10, 0x04, 0x80, 0x60, 0x42, 0x80, 0x20,
+  0x07, 0x80, 0x70, 0x42, 0x80, 0x10, 0x04, 0x80, 0x60, 0x42, 0x80, 0x20, 0x07, 0x80, 0x70, 0x42,
+  0x80, 0x10, 0x04, 0x80, 0x60, 0x42, 0x80, 0x30, 0x07, 0x80, 0x70, 0x42, 0x80, 0x10, 0x04, 0x80,
+  0x60, 0x42, 0x80, 0x20, 0x07, 0x80, 0x70, 0x42, 0x80, 0x10, 0x04, 0x80, 0x50, 0x42, 0x80, 0x30,
+  0x07, 0x80, 0x70, 0x42, 0x05, 0x80, 0x40, 0x42, 0x80, 0x30, 0x07, 0x83, 0x8f, 0xfe, 0x05, 0x80,
+  0x20, 0x42, 0x80, 0x40, 0x07, 0x83, 0x9f, 0xfd, 0x06, 0x83, 0xef, 0xfa, 0x06, 0x84, 0x1e, 0xff,
+  0x90, 0x06, 0x80, 0x80, 0x42, 0x80, 0x60, 0x04, 0x81, 0x1b, 0x42, 0x80, 0x30, 0x06, 0x81, 0x1e,
+  0x42, 0x85, 0xc8, 0x66, 0x9e, 0x42, 0x80, 0xa0, 0x08, 0x81, 0x3e, 0x49, 0x81, 0xb1, 0x09, 0x82,
+  0x19, 0xe0, 0x45, 0x81, 0xd6, 0x0e, 0x85, 0x46, 0x77, 0x62, 0x3f, 0x0a, 0x80, 0x10, 0x17, 0x80,
+  0x10, 0x3f, 0x32, 0x3f, 0x3f, 0x38, 0x83, 0xdf, 0xfc, 0x0a, 0x80, 0x20, 0x42, 0x80, 0x80, 0x02,
+  0x80, 0x80, 0x42, 0x80, 0x10, 0x09, 0x80, 0x60, 0x42, 0x80, 0x30, 0x02, 0x80, 0x40, 0x42, 0x80,
+  0x50, 0x09, 0x83, 0xaf, 0xfd, 0x04, 0x83, 0xef, 0xf9, 0x09, 0x83, 0xef, 0xfa, 0x04, 0x83, 0xaf,
+  0xfd, 0x08, 0x80, 0x30, 0x42, 0x80, 0x50, 0x04, 0x80, 0x50, 0x42, 0x80, 0x20, 0x07, 0x80, 0x70,
+  0x42, 0x80, 0x10, 0x04, 0x80, 0x10, 0x42, 0x80, 0x60, 0x07, 0x83, 0xbf, 0xfc, 0x06, 0x83, 0xcf,
+  0xfa, 0x06, 0x80, 0x10, 0x42, 0x80, 0x70, 0x06, 0x83, 0x8f, 0xfe, 0x06, 0x80, 0x40, 0x42, 0x80,
+  0x20, 0x06, 0x80, 0x30, 0x42, 0x80, 0x30, 0x05, 0x83, 0x8f, 0xfd, 0x08, 0x83, 0xdf, 0xf7, 0x05,
+  0x83, 0xdf, 0xf9, 0x08, 0x83, 0x9f, 0xfb, 0x04, 0x80, 0x10, 0x42, 0x80, 0x40, 0x08, 0x84, 0x4f,
+  0xfe, 0x10, 0x03, 0x84, 0x5f, 0xfe, 0x10, 0x08, 0x80, 0x10, 0x42, 0x80, 0x40, 0x03, 0x83, 0xaf,
+  0xfb, 0x0a, 0x83, 0xbf, 0xf8, 0x03, 0x83, 0xdf, 0xf6, 0x0a, 0x83, 0x6f, 0xfc, 0x02, 0x80, 0x20,
+  0x42, 0x80, 0x10, 0x0a, 0x80, 0x20, 0x42, 0x86, 0x10, 0x06, 0xff, 0xc0, 0x0c, 0x89, 0xdf, 0xf5,
+  0x00, 0xaf, 0xf8, 0x0c, 0x89, 0x8f, 0xf9, 0x00, 0xef, 0xf3, 0x0c, 0x88, 0x3f, 0xfd, 0x03, 0xff,
+  0xd0, 0x0e, 0x87, 0xef, 0xf2, 0x8f, 0xf9, 0x0e, 0x87, 0xaf, 0xf6, 0xbf, 0xf4, 0x0e, 0x87, 0x5f,
+  0xfb, 0xff, 0xe1, 0x0e, 0x80, 0x10, 0x44, 0x80, 0xb0, 0x10, 0x80, 0xb0, 0x43, 0x80, 0x70, 0x10,
+  0x80, 0x70, 0x43, 0x80, 0x20, 0x3f, 0x3f, 0x3f, 0x2e, 0x3f, 0x3f, 0x37, 0x83, 0xef, 0xf8, 0x0d,
+  0x88, 0xdf, 0xf9, 0x0c, 0xff, 0xa0, 0x0d, 0x88, 0xef, 0xf7, 0x09, 0xff, 0xc0, 0x0c, 0x80, 0x10,
+  0x42, 0x85, 0x40, 0x7f, 0xfe, 0x0c, 0x80, 0x30, 0x42, 0x82, 0x20, 0x50, 0x42, 0x0c, 0x86, 0x5f,
+  0xfe, 0x00, 0x20, 0x42, 0x80, 0x10, 0x0b, 0x8a, 0x7f, 0xfd, 0x00, 0x1e, 0xff, 0x40, 0x0b, 0x83,
+  0x8f, 0xfa, 0x02, 0x83, 0xdf, 0xf5, 0x02, 0x84, 0x2d, 0xdd, 0xa0, 0x03, 0x83, 0xaf, 0xf8, 0x02,
+  0x83, 0xbf, 0xf7, 0x02, 0x80, 0x50, 0x42, 0x80, 0xe0, 0x03, 0x83, 0xcf, 0xf6, 0x02, 0x83, 0x9f,
+  0xf9, 0x02, 0x80, 0x80, 0x43, 0x80, 0x20, 0x02, 0x83, 0xef, 0xf3, 0x02, 0x83, 0x6f, 0xfb, 0x02,
+  0x88, 0xcf, 0xef, 0xf6, 0x00, 0x10, 0x42, 0x80, 0x10, 0x02, 0x83, 0x4f, 0xfd, 0x02, 0x8b, 0xef,
+  0xae, 0xf9, 0x00, 0x2f, 0xfe, 0x03, 0x92, 0x1f, 0xfe, 0x00, 0x3f, 0xf6, 0xbf, 0xc0, 0x04, 0xff,
+  0xc0, 0x04, 0x42, 0x8e, 0x10, 0x6f, 0xf2, 0x7f, 0xf0, 0x06, 0xff, 0xa0, 0x04, 0x91, 0xdf, 0xf3,
+  0x09, 0xfe, 0x04, 0xff, 0x40, 0x8f, 0xf7, 0x04, 0x91, 0xaf, 0xf5, 0x0c, 0xfa, 0x01, 0xff, 0x70,
+  0x9f, 0xf5, 0x04, 0x91, 0x8f, 0xf7, 0x1f, 0xf7, 0x00, 0xcf, 0xb0, 0xcf, 0xf3, 0x04, 0x91, 0x6f,
+  0xf9, 0x4f, 0xf3, 0x00, 0x9f, 0xe0, 0xdf, 0xf1, 0x04, 0x86, 0x3f, 0xfa, 0x7f, 0xf0, 0x02, 0x86,
+  0x5f, 0xf2, 0xff, 0xe0, 0x05, 0x86, 0x1f, 0xfc, 0xaf, 0xc0, 0x02, 0x86, 0x2f, 0xf6, 0xff, 0xb0,
+  0x06, 0x85, 0xef, 0xed, 0xf8, 0x03, 0x85, 0xdf, 0xcf, 0xf9, 0x06, 0x80, 0xb0, 0x43, 0x80, 0x50,
+  0x03, 0x80, 0xa0, 0x43, 0x80, 0x70, 0x06, 0x80, 0x90, 0x43, 0x80, 0x10, 0x03, 0x80, 0x60, 0x43,
+  0x80, 0x40, 0x06, 0x80, 0x70, 0x42, 0x80, 0xd0, 0x04, 0x80, 0x30, 0x43, 0x80, 0x20, 0x06, 0x80,
+  0x50, 0x42, 0x80, 0x90, 0x05, 0x43, 0x07, 0x80, 0x20, 0x42, 0x80, 0x60, 0x05, 0x83, 0xbf, 0xfc,
+  0x15, 0x80, 0x10, 0x3f, 0x3f, 0x3f, 0x13, 0x3f, 0x3f, 0x38, 0x80, 0x30, 0x42, 0x80, 0x90, 0x09,
+  0x80, 0x50, 0x42, 0x80, 0x70, 0x03, 0x80, 0x80, 0x42, 0x80, 0x40, 0x07, 0x84, 0x1d, 0xff, 0xc0,
+  0x05, 0x83, 0xdf, 0xfb, 0x07, 0x80, 0x80, 0x42, 0x80, 0x30, 0x05, 0x80, 0x50, 0x42, 0x80, 0x60,
+  0x05, 0x80, 0x20, 0x42, 0x80, 0x80, 0x07, 0x84, 0xaf, 0xfd, 0x10, 0x04, 0x84, 0xbf, 0xfd, 0x10,
+  0x07, 0x84, 0x2e, 0xff, 0x90, 0x03, 0x80, 0x50, 0x42, 0x80, 0x40, 0x09, 0x80, 0x70, 0x42, 0x87,
+  0x20, 0x01, 0xdf, 0xf9, 0x0b, 0x8a, 0xcf, 0xfb, 0x00, 0x8f, 0xfe, 0x10, 0x0b, 0x80, 0x30, 0x42,
+  0x81, 0x53, 0x42, 0x80, 0x50, 0x0d, 0x87, 0x9f, 0xfd, 0xbf, 0xfa, 0x0e, 0x81, 0x1e, 0x43, 0x81,
+  0xe1, 0x0f, 0x80, 0x50, 0x43, 0x80, 0x60, 0x10, 0x80, 0x20, 0x43, 0x80, 0x20, 0x10, 0x80, 0xb0,
+  0x43, 0x80, 0xb0, 0x0f, 0x80, 0x50, 0x45, 0x80, 0x50, 0x0d, 0x88, 0x1e, 0xff, 0xa8, 0xff, 0xd0,
+  0x0d, 0x89, 0xaf, 0xfe, 0x21, 0xdf, 0xf8, 0x0b, 0x80, 0x40, 0x42, 0x83, 0x70, 0x05, 0x42, 0x80,
+  0x30, 0x09, 0x84, 0x1d, 0xff, 0xc0, 0x03, 0x83, 0xcf, 0xfb, 0x09, 0x80, 0x80, 0x42, 0x80, 0x30,
+  0x03, 0x80, 0x30, 0x42, 0x80, 0x60, 0x07, 0x80, 0x30, 0x42, 0x80, 0x80, 0x05, 0x84, 0x9f, 0xfe,
+  0x10, 0x05, 0x85, 0x1c, 0xff, 0xe1, 0x05, 0x84, 0x1e, 0xff, 0x90, 0x05, 0x80, 0x60, 0x42, 0x80,
+  0x50, 0x07, 0x80, 0x70, 0x42, 0x80, 0x30, 0x03, 0x80, 0x20, 0x42, 0x80, 0xa0, 0x09, 0x83, 0xdf,
+  0xfc, 0x03, 0x80, 0xb0, 0x42, 0x80, 0x20, 0x09, 0x80, 0x50, 0x42, 0x83, 0x60, 0x05, 0x42, 0x80,
+  0x70, 0x0b, 0x84, 0xcf, 0xfe, 0x20, 0x3f, 0x3f, 0x3f, 0x26, 0x3f, 0x3f, 0x37, 0x84, 0x1e, 0xff,
+  0xb0, 0x0a, 0x80, 0x20, 0x42, 0x80, 0xb0, 0x02, 0x80, 0x70, 0x42, 0x80, 0x40, 0x09, 0x80, 0xa0,
+  0x42, 0x80, 0x20, 0x03, 0x83, 0xdf, 0xfc, 0x08, 0x80, 0x30, 0x42, 0x80, 0x80, 0x04, 0x80, 0x40,
+  0x42, 0x80, 0x60, 0x07, 0x84, 0xbf, 0xfe, 0x10, 0x05, 0x84, 0xbf, 0xfd, 0x10, 0x05, 0x80, 0x50,
+  0x42, 0x80, 0x60, 0x04, 0x82, 0x10, 0x20, 0x42, 0x80, 0x70, 0x05, 0x83, 0xcf, 0xfc, 0x08, 0x80,
+  0x80, 0x42, 0x80, 0x20, 0x03, 0x80, 0x60, 0x42, 0x80, 0x40, 0x08, 0x84, 0x1d, 0xff, 0x90, 0x02,
+  0x84, 0x1e, 0xff, 0x90, 0x0a, 0x80, 0x60, 0x42, 0x87, 0x30, 0x08, 0xff, 0xe1, 0x0b, 0x89, 0xcf,
+  0xfb, 0x02, 0xef, 0xf7, 0x0c, 0x80, 0x30, 0x42, 0x84, 0x4a, 0xff, 0xc0, 0x0e, 0x83, 0x9f, 0xfd,
+  0x42, 0x80, 0x40, 0x0e, 0x81, 0x2e, 0x43, 0x80, 0xa0, 0x10, 0x80, 0x70, 0x42, 0x81, 0xe2, 0x11,
+  0x42, 0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x12,
+  0x42, 0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x12,
+  0x42, 0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x12, 0x42, 0x80, 0x90, 0x3f,
+  0x3f, 0x3f, 0x2f, 0x3f, 0x3f, 0x3a, 0x80, 0xd0, 0x4f, 0x80, 0x30, 0x04, 0x80, 0xd0, 0x4f, 0x80,
+  0x20, 0x04, 0x80, 0xd0, 0x44, 0x80, 0xe0, 0x42, 0x81, 0xee, 0x44, 0x80, 0x20, 0x10, 0x80, 0x40,
+  0x42, 0x80, 0x90, 0x10, 0x85, 0x1d, 0xff, 0xd1, 0x04, 0x80, 0x10, 0x0a, 0x80, 0x90, 0x42, 0x80,
+  0x40, 0x10, 0x80, 0x30, 0x42, 0x80, 0x90, 0x10, 0x85, 0x1d, 0xff, 0xd1, 0x10, 0x80, 0x80, 0x42,
+  0x80, 0x40, 0x10, 0x80, 0x30, 0x42, 0x80, 0x80, 0x11, 0x84, 0xdf, 0xfd, 0x10, 0x10, 0x80, 0x80,
+  0x42, 0x80, 0x30, 0x10, 0x80, 0x30, 0x42, 0x80, 0x80, 0x11, 0x83, 0xcf, 0xfd, 0x11, 0x80, 0x80,
+  0x42, 0x80, 0x30, 0x10, 0x80, 0x20, 0x42, 0x80, 0x80, 0x11, 0x83, 0xcf, 0xfd, 0x11, 0x80, 0x60,
+  0x42, 0x80, 0x30, 0x10, 0x84, 0x2e, 0xff, 0x80, 0x11, 0x83, 0xbf, 0xfc, 0x11, 0x80, 0x60, 0x42,
+  0x80, 0x30, 0x10, 0x80, 0x10, 0x42, 0x80, 0x70, 0x11, 0x84, 0xbf, 0xfc, 0x10, 0x10, 0x80, 0x30,
+  0x45, 0x83, 0xef, 0xfe, 0x46, 0x80, 0x80, 0x03, 0x80, 0x40, 0x50, 0x80, 0x80, 0x03, 0x80, 0x40,
+  0x50, 0x80, 0x80, 0x3f, 0x3f, 0x3f, 0x27, 0x3f, 0x3f, 0x28, 0x80, 0xd0, 0x45, 0x80, 0x90, 0x0e,
+  0x80, 0xd0, 0x45, 0x80, 0x90, 0x0e, 0x87, 0xdf, 0xfa, 0x87, 0x85, 0x0e, 0x83, 0xdf, 0xf6, 0x12,
+  0x83, 0xdf, 0xf5, 0x12, 0x83, 0xdf, 0xf6, 0x12, 0x83, 0xdf, 0xf6, 0x12, 0x83, 0xdf, 0xf6, 0x12,
+  0x83, 0xdf, 0xf6, 0x12, 0x83, 0xdf, 0xf6, 0x12, 0x83, 0xdf, 0xf6, 0x12, 0x83, 0xdf, 0xf6, 0x12,
+  0x83, 0xdf, 0xf6, 0x12, 0x83, 0xdf, 0xf6, 0x12, 0x83, 0xdf, 0xf6, 0x12, 0x83, 0xdf, 0xf6, 0x12,
+  0x83, 0xdf, 0xf6, 0x12, 0x83, 0xdf, 0xf6, 0x12, 0x83, 0xdf, 0xf6, 0x12, 0x83, 0xdf, 0xf6, 0x12,
+  0x83, 0xdf, 0xf6, 0x12, 0x83, 0xdf, 0xf6, 0x12, 0x83, 0xdf, 0xf6, 0x12, 0x83, 0xdf, 0xf6, 0x12,
+  0x83, 0xdf, 0xf6, 0x12, 0x83, 0xdf, 0xf6, 0x12, 0x83, 0xdf, 0xf6, 0x12, 0x83, 0xdf, 0xf6, 0x12,
+  0x83, 0xdf, 0xf6, 0x12, 0x87, 0xdf, 0xfa, 0x77, 0x74, 0x0e, 0x80, 0xd0, 0x45, 0x80, 0x90, 0x0e,
+  0x80, 0xd0, 0x45, 0x80, 0x90, 0x3f, 0x39, 0x3f, 0x3f, 0x38, 0x84, 0x1e, 0xff, 0x60, 0x12, 0x84,
+  0x7f, 0xfd, 0x10, 0x11, 0x80, 0x10, 0x42, 0x80, 0x50, 0x12, 0x83, 0x9f, 0xfc, 0x12, 0x80, 0x20,
+  0x42, 0x80, 0x40, 0x12, 0x83, 0xaf, 0xfb, 0x12, 0x80, 0x30, 0x42, 0x80, 0x30, 0x12, 0x83, 0xbf,
+  0xfa, 0x12, 0x80, 0x30, 0x42, 0x80, 0x20, 0x12, 0x83, 0xbf, 0xf9, 0x12, 0x80, 0x40, 0x42, 0x80,
+  0x10, 0x12, 0x83, 0xcf, 0xf8, 0x12, 0x84, 0x5f, 0xfe, 0x10, 0x12, 0x83, 0xdf, 0xf7, 0x12, 0x84,
+  0x6f, 0xfd, 0x10, 0x11, 0x84, 0x1e, 0xff, 0x60, 0x12, 0x83, 0x7f, 0xfd, 0x12, 0x84, 0x1e, 0xff,
+  0x50, 0x12, 0x83, 0x8f, 0xfc, 0x12, 0x80, 0x10, 0x42, 0x80, 0x40, 0x12, 0x83, 0x9f, 0xfb, 0x12,
+  0x80, 0x20, 0x42, 0x80, 0x30, 0x11, 0x84, 0x1a, 0xff, 0xa0, 0x12, 0x80, 0x30, 0x42, 0x80, 0x20,
+  0x12, 0x83, 0xbf, 0xf9, 0x12, 0x80, 0x40, 0x42, 0x80, 0x20, 0x12, 0x83, 0xcf, 0xf8, 0x12, 0x80,
+  0x50, 0x42, 0x80, 0x10, 0x12, 0x83, 0xcf, 0xf7, 0x12, 0x83, 0x48, 0x86, 0x3f, 0x3f, 0x0d, 0x3f,
+  0x3f, 0x26, 0x80, 0xe0, 0x45, 0x80, 0x80, 0x0e, 0x80, 0xe0, 0x45, 0x80, 0x80, 0x0e, 0x87, 0x78,
+  0x78, 0xdf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12,
+  0x83, 0xbf, 0xf8, 0x12, 0x83, 0xaf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12,
+  0x83, 0xbf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12,
+  0x83, 0xbf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12,
+  0x83, 0xbf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12,
+  0x83, 0xbf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12,
+  0x83, 0xaf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x0e, 0x80, 0x10, 0x02, 0x83, 0xaf, 0xf8, 0x0e, 0x87,
+  0x67, 0x77, 0xdf, 0xf8, 0x0e, 0x80, 0xe0, 0x45, 0x80, 0x80, 0x0e, 0x80, 0xe0, 0x45, 0x80, 0x80,
+  0x3f, 0x3b, 0x3f, 0x3f, 0x3f, 0x84, 0x07, 0x78, 0x40, 0x11, 0x80, 0x90, 0x43, 0x80, 0x40, 0x03,
+  0x80, 0x10, 0x0a, 0x80, 0x60, 0x44, 0x81, 0xe2, 0x0d, 0x80, 0x40, 0x42, 0x85, 0xad, 0xff, 0xd1,
+  0x0b, 0x8b, 0x3e, 0xff, 0x90, 0x1e, 0xff, 0xb1, 0x09, 0x84, 0x1d, 0xff, 0xa0, 0x02, 0x84, 0x2d,
+  0xff, 0x90, 0x08, 0x84, 0x1b, 0xff, 0xb0, 0x04, 0x84, 0x2d, 0xff, 0x70, 0x07, 0x83, 0xaf, 0xfc,
+  0x06, 0x84, 0x3e, 0xff, 0x50, 0x05, 0x84, 0x7f, 0xfc, 0x10, 0x07, 0x84, 0x3e, 0xfe, 0x30, 0x03,
+  0x84, 0x5f, 0xfc, 0x10, 0x09, 0x84, 0x3f, 0xfd, 0x20, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x17, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x33, 0x3f, 0x37, 0x83, 0x68, 0x85, 0x12, 0x84, 0x3f, 0xfe, 0x30, 0x12, 0x84, 0x5f,
+  0xfd, 0x10, 0x12, 0x83, 0x7f, 0xfa, 0x13, 0x83, 0x8f, 0xf6, 0x13, 0x83, 0xbf, 0xf3, 0x13, 0x83,
+  0xcf, 0xd1, 0x3f, 0x82, 0x00, 0x10, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x25, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x06, 0x89, 0x37, 0xad, 0xef, 0xec, 0x85, 0x0a, 0x81, 0x2d,
+  0x49, 0x81, 0xb2, 0x08, 0x80, 0x30, 0x43, 0x83, 0xdc, 0xbc, 0x43, 0x81, 0xe2, 0x07, 0x84, 0x4f,
+  0xb6, 0x10, 0x04, 0x84, 0x5e, 0xff, 0xb0, 0x07, 0x81, 0x12, 0x08, 0x80, 0x40, 0x42, 0x80, 0x20,
+  0x12, 0x83, 0xdf, 0xf6, 0x0c, 0x80, 0x10, 0x04, 0x83, 0xaf, 0xf8, 0x0a, 0x8b, 0x25, 0x68, 0x87,
+  0x88, 0xdf, 0xf8, 0x08, 0x81, 0x6c, 0x4a, 0x80, 0x90, 0x07, 0x80, 0xb0, 0x4c, 0x80, 0x90, 0x06,
+  0x80, 0x90, 0x42, 0x82, 0xb5, 0x20, 0x04, 0x83, 0xaf, 0xf9, 0x05, 0x80, 0x20, 0x42, 0x80, 0x80,
+  0x07, 0x83, 0xaf, 0xf9, 0x05, 0x83, 0x6f, 0xfd, 0x08, 0x83, 0xcf, 0xf9, 0x05, 0x83, 0x9f, 0xfa,
+  0x08, 0x42, 0x80, 0x90, 0x05, 0x83, 0x9f, 0xf9, 0x07, 0x80, 0x50, 0x42, 0x80, 0x90, 0x05, 0x83,
+  0x8f, 0xfd, 0x06, 0x81, 0x1d, 0x42, 0x80, 0x90, 0x05, 0x80, 0x40, 0x42, 0x80, 0x60, 0x04, 0x81,
+  0x1b, 0x43, 0x80, 0x90, 0x06, 0x80, 0xd0, 0x42, 0x8b, 0xa5, 0x34, 0x8e, 0xfe, 0xcf, 0xf9, 0x06,
+  0x81, 0x3e, 0x48, 0x84, 0x4a, 0xff, 0x90, 0x07, 0x81, 0x3b, 0x45, 0x86, 0xb2, 0x0a, 0xff, 0x90,
+  0x09, 0x85, 0x26, 0x77, 0x52, 0x3f, 0x1c, 0x80, 0x10, 0x3f, 0x3b, 0x3f, 0x3f, 0x0c, 0x80, 0x10,
+  0x15, 0x83, 0x9f, 0xf9, 0x12, 0x83, 0x9f, 0xfa, 0x12, 0x83, 0x9f, 0xf9, 0x12, 0x83, 0x9f, 0xfa,
+  0x12, 0x83, 0x9f, 0xf9, 0x12, 0x83, 0x9f, 0xf9, 0x12, 0x83, 0x9f, 0xf9, 0x12, 0x8c, 0x9f, 0xf9,
+  0x01, 0x8d, 0xee, 0xc8, 0x20, 0x09, 0x85, 0x9f, 0xfa, 0x3e, 0x45, 0x81, 0xe5, 0x08, 0x89, 0x9f,
+  0xfb, 0xef, 0xfc, 0xcd, 0x43, 0x80, 0x50, 0x07, 0x80, 0x90, 0x43, 0x81, 0xc2, 0x02, 0x85, 0x4d,
+  0xff, 0xe1, 0x06, 0x80, 0x90, 0x42, 0x81, 0xd1, 0x04, 0x80, 0x30, 0x42, 0x80, 0x80, 0x06, 0x80,
+  0x90, 0x42, 0x80, 0x60, 0x06, 0x83, 0xaf, 0xfd, 0x06, 0x80, 0x90, 0x42, 0x80, 0x10, 0x06, 0x80,
+  0x40, 0x42, 0x80, 0x20, 0x05, 0x83, 0x9f, 0xfd, 0x03, 0x80, 0x10, 0x02, 0x80, 0x10, 0x42, 0x80,
+  0x50, 0x05, 0x83, 0x9f, 0xfa, 0x08, 0x83, 0xef, 0xf7, 0x05, 0x83, 0x9f, 0xfa, 0x08, 0x83, 0xef,
+  0xf7, 0x05, 0x83, 0x9f, 0xfa, 0x08, 0x83, 0xdf, 0xf8, 0x05, 0x83, 0x9f, 0xfa, 0x08, 0x83, 0xef,
+  0xf7, 0x05, 0x83, 0x9f, 0xfc, 0x06, 0x81, 0x10, 0x42, 0x80, 0x60, 0x05, 0x83, 0x9f, 0xfe, 0x03,
+  0x80, 0x10, 0x02, 0x80, 0x30, 0x42, 0x80, 0x40, 0x05, 0x80, 0x90, 0x42, 0x80, 0x30, 0x06, 0x80,
+  0x70, 0x42, 0x80, 0x10, 0x05, 0x80, 0x90, 0x42, 0x80, 0xa0, 0x06, 0x83, 0xdf, 0xfa, 0x06, 0x80,
+  0x90, 0x43, 0x81, 0x51, 0x03, 0x80, 0x80, 0x42, 0x80, 0x40, 0x06, 0x8a, 0x9f, 0xfe, 0xff, 0xa5,
+  0x46, 0xc0, 0x42, 0x80, 0xa0, 0x07, 0x84, 0x9f, 0xfa, 0xa0, 0x47, 0x81, 0xc1, 0x07, 0x86, 0xaf,
+  0xfa, 0x08, 0xe0, 0x43, 0x82, 0xe8, 0x10, 0x0e, 0x85, 0x15, 0x77, 0x51, 0x3f, 0x09, 0x80, 0x10,
+  0x17, 0x80, 0x10, 0x3f, 0x32, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x09, 0x89, 0x16, 0xbd, 0xef, 0xeb,
+  0x71, 0x0b, 0x81, 0x7e, 0x48, 0x80, 0x60, 0x09, 0x80, 0xb0, 0x43, 0x83, 0xec, 0xcd, 0x42, 0x80,
+  0xa0, 0x08, 0x80, 0x90, 0x42, 0x81, 0xc3, 0x03, 0x83, 0x17, 0xea, 0x07, 0x80, 0x40, 0x42, 0x80,
+  0xa0, 0x07, 0x81, 0x16, 0x07, 0x84, 0xbf, 0xfd, 0x10, 0x10, 0x80, 0x10, 0x42, 0x80, 0x70, 0x11,
+  0x80, 0x40, 0x42, 0x80, 0x20, 0x11, 0x84, 0x7f, 0xfe, 0x10, 0x11, 0x83, 0x8f, 0xfe, 0x12, 0x83,
+  0x8f, 0xfd, 0x12, 0x83, 0x8f, 0xfe, 0x12, 0x80, 0x60, 0x42, 0x80, 0x10, 0x11, 0x80, 0x30, 0x42,
+  0x80, 0x40, 0x12, 0x83, 0xef, 0xfa, 0x12, 0x80, 0x80, 0x42, 0x83, 0x40, 0x01, 0x05, 0x80, 0x10,
+  0x07, 0x85, 0x1e, 0xff, 0xe4, 0x05, 0x82, 0x17, 0xa0, 0x08, 0x80, 0x40, 0x43, 0x88, 0xb6, 0x44,
+  0x58, 0xdf, 0xa0, 0x09, 0x81, 0x4e, 0x49, 0x80, 0xa0, 0x0a, 0x82, 0x18, 0xe0, 0x45, 0x82, 0xe8,
+  0x20, 0x0c, 0x86, 0x13, 0x67, 0x76, 0x30, 0x3f, 0x3f, 0x3f, 0x15, 0x28, 0x80, 0x10, 0x3f, 0x3f,
+  0x05, 0x83, 0xef, 0xf5, 0x12, 0x83, 0xef, 0xf5, 0x12, 0x83, 0xef, 0xf5, 0x12, 0x83, 0xef, 0xf5,
+  0x12, 0x83, 0xef, 0xf5, 0x12, 0x83, 0xef, 0xf5, 0x12, 0x83, 0xef, 0xf5, 0x09, 0x8c, 0x39, 0xdf,
+  0xec, 0x60, 0x0e, 0xff, 0x50, 0x08, 0x80, 0x90, 0x46, 0x85, 0xc1, 0xef, 0xf5, 0x07, 0x80, 0x90,
+  0x43, 0x89, 0xcb, 0xdf, 0xfb, 0xef, 0xf5, 0x06, 0x80, 0x40, 0x42, 0x81, 0xc2, 0x02, 0x81, 0x5e,
+  0x43, 0x80, 0x50, 0x06, 0x83, 0xcf, 0xfd, 0x05, 0x80, 0x40, 0x43, 0x80, 0x50, 0x05, 0x80, 0x20,
+  0x42, 0x80, 0x50, 0x06, 0x80, 0xb0, 0x42, 0x80, 0x50, 0x05, 0x80, 0x70, 0x42, 0x80, 0x10, 0x06,
+  0x80, 0x50, 0x42, 0x80, 0x50, 0x05, 0x83, 0x9f, 0xfc, 0x07, 0x80, 0x20, 0x42, 0x80, 0x50, 0x05,
+  0x83, 0xce, 0xfa, 0x08, 0x42, 0x80, 0x50, 0x05, 0x83, 0xcf, 0xf9, 0x08, 0x83, 0xef, 0xf5, 0x05,
+  0x83, 0xcf, 0xf9, 0x08, 0x83, 0xef, 0xf5, 0x05, 0x83, 0xcf, 0xfa, 0x08, 0x42, 0x80, 0x50, 0x05,
+  0x83, 0xaf, 0xfb, 0x07, 0x80, 0x10, 0x42, 0x80, 0x50, 0x05, 0x83, 0x8f, 0xfd, 0x07, 0x80, 0x40,
+  0x42, 0x80, 0x50, 0x05, 0x80, 0x40, 0x42, 0x80, 0x20, 0x06, 0x80, 0x80, 0x42, 0x80, 0x50, 0x05,
+  0x84, 0x1e, 0xff, 0x90, 0x06, 0x80, 0xe0, 0x42, 0x80, 0x50, 0x06, 0x80, 0x80, 0x42, 0x80, 0x50,
+  0x04, 0x80, 0xa0, 0x43, 0x80, 0x50, 0x06, 0x81, 0x1e, 0x42, 0x86, 0x94, 0x46, 0xcf, 0xe0, 0x42,
+  0x80, 0x50, 0x07, 0x81, 0x3e, 0x47, 0x84, 0x5e, 0xff, 0x50, 0x08, 0x81, 0x2a, 0x44, 0x86, 0xd4,
+  0x0e, 0xff, 0x50, 0x0a, 0x84, 0x26, 0x76, 0x40, 0x3f, 0x3f, 0x3f, 0x19, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x16, 0x80, 0x10, 0x17, 0x80, 0x10, 0x17, 0x88, 0x38, 0xce, 0xee, 0xb7, 0x10, 0x0b, 0x81, 0x1a,
+  0x47, 0x81, 0xe4, 0x09, 0x81, 0x2d, 0x42, 0x83, 0xec, 0xbd, 0x43, 0x80, 0x50, 0x07, 0x81, 0x1c,
+  0x42, 0x81, 0x71, 0x02, 0x85, 0x2c, 0xff, 0xe1, 0x06, 0x80, 0x70, 0x42, 0x80, 0x40, 0x06, 0x83,
+  0xcf, 0xf9, 0x06, 0x83, 0xef, 0xf9, 0x07, 0x83, 0x4f, 0xfe, 0x05, 0x80, 0x50, 0x42, 0x80, 0x20,
+  0x08, 0x83, 0xef, 0xf4, 0x04, 0x83, 0x8f, 0xfc, 0x07, 0x85, 0x10, 0xcf, 0xf6, 0x04, 0x91, 0xbf,
+  0xfd, 0x87, 0x78, 0x88, 0x78, 0x88, 0xdf, 0xf7, 0x04, 0x80, 0xc0, 0x4f, 0x80, 0x80, 0x04, 0x80,
+  0xc0, 0x4f, 0x80, 0x80, 0x04, 0x83, 0xbf, 0xf8, 0x12, 0x83, 0xaf, 0xfa, 0x12, 0x83, 0x7f, 0xfd,
+  0x12, 0x80, 0x30, 0x42, 0x80, 0x30, 0x12, 0x83, 0xbf, 0xfc, 0x0a, 0x80, 0x10, 0x06, 0x80, 0x40,
+  0x42, 0x81, 0xb1, 0x06, 0x82, 0x39, 0xc0, 0x07, 0x80, 0x70, 0x42, 0x8a, 0xe9, 0x54, 0x45, 0x8c,
+  0xff, 0xc0, 0x08, 0x80, 0x60, 0x4b, 0x80, 0xc0, 0x09, 0x81, 0x2a, 0x47, 0x82, 0xc7, 0x20, 0x0b,
+  0x87, 0x14, 0x67, 0x76, 0x41, 0x3f, 0x3f, 0x3f, 0x15, 0x3f, 0x3f, 0x2a, 0x83, 0x16, 0xbe, 0x43,
+  0x80, 0xa0, 0x0c, 0x81, 0x1d, 0x46, 0x80, 0xa0, 0x0c, 0x80, 0x90, 0x42, 0x85, 0xdb, 0xaa, 0xa7,
+  0x0c, 0x42, 0x80, 0x80, 0x11, 0x80, 0x30, 0x42, 0x80, 0x10, 0x11, 0x83, 0x4f, 0xfe, 0x0b, 0x80,
+  0x10, 0x05, 0x83, 0x5f, 0xfe, 0x0d, 0x80, 0x90, 0x4d, 0x80, 0xa0, 0x06, 0x80, 0x90, 0x4d, 0x80,
+  0xa0, 0x06, 0x85, 0x47, 0x78, 0x7a, 0x42, 0x86, 0x77, 0x77, 0x77, 0x50, 0x0b, 0x83, 0x5f, 0xfe,
+  0x12, 0x83, 0x5f, 0xfe, 0x12, 0x83, 0x5f, 0xfe, 0x12, 0x83, 0x5f, 0xfe, 0x12, 0x83, 0x5f, 0xfe,
+  0x12, 0x83, 0x5f, 0xfe, 0x12, 0x83, 0x5f, 0xfe, 0x12, 0x83, 0x5f, 0xfe, 0x12, 0x83, 0x5f, 0xfe,
+  0x12, 0x83, 0x5f, 0xfe, 0x12, 0x83, 0x5f, 0xfe, 0x12, 0x83, 0x5f, 0xfe, 0x12, 0x83, 0x5f, 0xfe,
+  0x12, 0x83, 0x5f, 0xfe, 0x12, 0x83, 0x5f, 0xfe, 0x12, 0x83, 0x5f, 0xfe, 0x12, 0x83, 0x4f, 0xfe,
+  0x3f, 0x3f, 0x3f, 0x30, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x07, 0x8c, 0x3a, 0xde, 0xec, 0x60, 0x0e,
+  0xff, 0x50, 0x08, 0x80, 0x90, 0x46, 0x85, 0xc1, 0xef, 0xf5, 0x07, 0x80, 0x80, 0x43, 0x89, 0xcb,
+  0xdf, 0xfa, 0xef, 0xf5, 0x06, 0x80, 0x40, 0x42, 0x81, 0xc2, 0x02, 0x81, 0x4e, 0x43, 0x80, 0x50,
+  0x06, 0x83, 0xcf, 0xfd, 0x05, 0x80, 0x30, 0x43, 0x80, 0x50, 0x05, 0x80, 0x30, 0x42, 0x80, 0x60,
+  0x06, 0x80, 0xa0, 0x42, 0x80, 0x50, 0x05, 0x83, 0x7f, 0xfe, 0x07, 0x80, 0x50, 0x42, 0x80, 0x50,
+  0x05, 0x83, 0xaf, 0xfc, 0x07, 0x80, 0x20, 0x42, 0x80, 0x50, 0x05, 0x83, 0xce, 0xfa, 0x08, 0x42,
+  0x80, 0x50, 0x05, 0x83, 0xcf, 0xf9, 0x08, 0x83, 0xef, 0xf5, 0x05, 0x83, 0xcf, 0xf9, 0x08, 0x83,
+  0xef, 0xf5, 0x05, 0x83, 0xce, 0xfa, 0x08, 0x42, 0x80, 0x50, 0x05, 0x83, 0xaf, 0xfc, 0x07, 0x80,
+  0x20, 0x42, 0x80, 0x50, 0x05, 0x83, 0x7f, 0xfe, 0x07, 0x80, 0x50, 0x42, 0x80, 0x50, 0x05, 0x80,
+  0x30, 0x42, 0x80, 0x60, 0x06, 0x80, 0xa0, 0x42, 0x80, 0x50, 0x06, 0x83, 0xcf, 0xfd, 0x05, 0x80,
+  0x30, 0x43, 0x80, 0x50, 0x06, 0x80, 0x40, 0x42, 0x81, 0xc2, 0x02, 0x81, 0x3d, 0x43, 0x80, 0x50,
+  0x07, 0x80, 0x80, 0x43, 0x89, 0xca, 0xcf, 0xf9, 0xef, 0xf5, 0x08, 0x80, 0x90, 0x46, 0x85, 0xb1,
+  0xef, 0xf5, 0x09, 0x88, 0x49, 0xde, 0xec, 0x60, 0x00, 0x42, 0x80, 0x30, 0x11, 0x80, 0x10, 0x42,
+  0x80, 0x10, 0x11, 0x83, 0x4f, 0xfd, 0x12, 0x83, 0xaf, 0xf8, 0x08, 0x82, 0x88, 0x30, 0x05, 0x84,
+  0x8f, 0xfe, 0x20, 0x08, 0x88, 0xaf, 0xfe, 0xb9, 0x9a, 0xe0, 0x42, 0x80, 0x60, 0x09, 0x80, 0xa0,
+  0x48, 0x81, 0xe5, 0x0a, 0x8a, 0x15, 0x9c, 0xde, 0xfd, 0xb7, 0x10, 0x3f, 0x0c, 0x3f, 0x3f, 0x23,
+  0x83, 0x8f, 0xfa, 0x12, 0x83, 0x9f, 0xfa, 0x12, 0x83, 0x9f, 0xfa, 0x12, 0x83, 0x9f, 0xfa, 0x12,
+  0x83, 0x9f, 0xfa, 0x12, 0x83, 0x9f, 0xfa, 0x08, 0x80, 0x10, 0x08, 0x83, 0x9f, 0xfa, 0x06, 0x80,
+  0x10, 0x0a, 0x8c, 0x9f, 0xfa, 0x00, 0x5b, 0xef, 0xea, 0x40, 0x09, 0x85, 0x9f, 0xfa, 0x1b, 0x46,
+  0x80, 0x80, 0x08, 0x89, 0x9f, 0xfa, 0xbf, 0xfd, 0xce, 0x43, 0x80, 0x40, 0x07, 0x86, 0x9f, 0xfe,
+  0xfb, 0x20, 0x02, 0x80, 0x50, 0x42, 0x80, 0xc0, 0x07, 0x80, 0x80, 0x42, 0x81, 0xc1, 0x04, 0x80,
+  0x60, 0x42, 0x80, 0x20, 0x06, 0x80, 0x90, 0x42, 0x80, 0x40, 0x05, 0x80, 0x10, 0x42, 0x80, 0x40,
+  0x06, 0x83, 0x9f, 0xfe, 0x07, 0x83, 0xdf, 0xf6, 0x06, 0x83, 0x9f, 0xfb, 0x07, 0x83, 0xcf, 0xf7,
+  0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7,
+  0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7,
+  0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7,
+  0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7,
+  0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7,
+  0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7,
+  0x3f, 0x3f, 0x3f, 0x29, 0x3f, 0x3f, 0x29, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83,
+  0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfb, 0x13, 0x82, 0x11, 0x10, 0x3b, 0x80, 0x80, 0x46, 0x80, 0xb0,
+  0x0d, 0x80, 0x70, 0x46, 0x80, 0xc0, 0x0d, 0x88, 0x47, 0x77, 0x7b, 0xff, 0xc0, 0x12, 0x83, 0x7f,
+  0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f,
+  0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f,
+  0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfb, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f,
+  0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x04, 0x80, 0x10, 0x06, 0x90, 0x68, 0x87, 0x87, 0xbf, 0xfe, 0x77,
+  0x88, 0x78, 0x20, 0x05, 0x80, 0xd0, 0x4e, 0x80, 0x30, 0x03, 0x82, 0x10, 0xd0, 0x4e, 0x80, 0x30,
+  0x3f, 0x3f, 0x3f, 0x28, 0x3f, 0x3f, 0x2a, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83,
+  0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x13, 0x82, 0x11, 0x10, 0x3a, 0x80, 0x10, 0x47, 0x80, 0xc0,
+  0x0d, 0x47, 0x80, 0xc0, 0x0d, 0x88, 0x77, 0x77, 0x7b, 0xff, 0xc0, 0x12, 0x83, 0x7f, 0xfc, 0x12,
+  0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12,
+  0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12,
+  0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12,
+  0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfb, 0x12,
+  0x83, 0x7f, 0xfb, 0x12, 0x83, 0x9f, 0xfa, 0x11, 0x84, 0x1d, 0xff, 0x70, 0x11, 0x80, 0x90, 0x42,
+  0x80, 0x30, 0x0b, 0x85, 0x8b, 0xbb, 0xbe, 0x42, 0x80, 0xa0, 0x0c, 0x80, 0xb0, 0x46, 0x81, 0xc1,
+  0x0c, 0x80, 0xb0, 0x43, 0x83, 0xec, 0x61, 0x3f, 0x0f, 0x3f, 0x3f, 0x24, 0x83, 0xdf, 0xf7, 0x12,
+  0x83, 0xdf, 0xf7, 0x12, 0x83, 0xdf, 0xf7, 0x12, 0x83, 0xdf, 0xf7, 0x12, 0x83, 0xdf, 0xf7, 0x12,
+  0x83, 0xdf, 0xf7, 0x12, 0x83, 0xdf, 0xf7, 0x08, 0x80, 0x10, 0x08, 0x83, 0xdf, 0xf7, 0x06, 0x80,
+  0x80, 0x42, 0x80, 0x70, 0x06, 0x83, 0xdf, 0xf7, 0x05, 0x80, 0x80, 0x42, 0x80, 0x60, 0x07, 0x83,
+  0xdf, 0xf7, 0x04, 0x80, 0x90, 0x42, 0x80, 0x50, 0x08, 0x83, 0xdf, 0xf7, 0x03, 0x80, 0x90, 0x42,
+  0x81, 0x51, 0x08, 0x83, 0xdf, 0xf8, 0x02, 0x80, 0x90, 0x42, 0x80, 0x50, 0x0a, 0x86, 0xdf, 0xf7,
+  0x00, 0xa0, 0x42, 0x80, 0x40, 0x0b, 0x89, 0xdf, 0xf7, 0x0a, 0xff, 0xe4, 0x0c, 0x84, 0xdf, 0xf8,
+  0xa0, 0x42, 0x80, 0x60, 0x0d, 0x83, 0xdf, 0xfe, 0x43, 0x81, 0xc1, 0x0c, 0x80, 0xd0, 0x43, 0x80,
+  0xe0, 0x42, 0x80, 0x90, 0x0c, 0x80, 0xd0, 0x42, 0x82, 0xd2, 0x80, 0x42, 0x80, 0x40, 0x0b, 0x8b,
+  0xdf, 0xfd, 0x20, 0x1c, 0xff, 0xe1, 0x0a, 0x83, 0xdf, 0xf8, 0x02, 0x80, 0x20, 0x42, 0x80, 0xb0,
+  0x0a, 0x83, 0xdf, 0xf7, 0x03, 0x80, 0x60, 0x42, 0x80, 0x70, 0x09, 0x83, 0xdf, 0xf8, 0x04, 0x80,
+  0xb0, 0x42, 0x80, 0x30, 0x08, 0x83, 0xdf, 0xf7, 0x04, 0x85, 0x1e, 0xff, 0xd1, 0x07, 0x83, 0xdf,
+  0xf8, 0x05, 0x80, 0x50, 0x42, 0x80, 0x90, 0x07, 0x83, 0xdf, 0xf7, 0x06, 0x80, 0x90, 0x42, 0x80,
+  0x50, 0x06, 0x83, 0xdf, 0xf7, 0x07, 0x84, 0xdf, 0xfe, 0x20, 0x05, 0x83, 0xdf, 0xf7, 0x07, 0x80,
+  0x30, 0x42, 0x80, 0xb0, 0x3f, 0x31, 0x80, 0x10, 0x3f, 0x34, 0x3f, 0x34, 0x80, 0x10, 0x2c, 0x80,
+  0x30, 0x47, 0x80, 0x40, 0x0c, 0x80, 0x30, 0x47, 0x80, 0x40, 0x0c, 0x85, 0x28, 0x88, 0x88, 0x42,
+  0x80, 0x40, 0x12, 0x42, 0x80, 0x40, 0x12, 0x42, 0x80, 0x40, 0x12, 0x42, 0x80, 0x40, 0x12, 0x42,
+  0x80, 0x40, 0x12, 0x42, 0x80, 0x40, 0x12, 0x42, 0x80, 0x40, 0x12, 0x42, 0x80, 0x40, 0x12, 0x42,
+  0x80, 0x40, 0x12, 0x42, 0x80, 0x40, 0x12, 0x42, 0x80, 0x40, 0x12, 0x42, 0x80, 0x40, 0x12, 0x42,
+  0x80, 0x40, 0x12, 0x42, 0x80, 0x40, 0x12, 0x42, 0x80, 0x40, 0x12, 0x42, 0x80, 0x40, 0x12, 0x42,
+  0x80, 0x30, 0x12, 0x42, 0x80, 0x30, 0x12, 0x42, 0x80, 0x40, 0x12, 0x83, 0xef, 0xf6, 0x04, 0x80,
+  0x10, 0x0c, 0x83, 0xbf, 0xfa, 0x12, 0x80, 0x60, 0x42, 0x80, 0x50, 0x12, 0x80, 0xd0, 0x42, 0x85,
+  0xdb, 0xbb, 0xb2, 0x0c, 0x81, 0x2d, 0x46, 0x83, 0x30, 0x01, 0x0a, 0x82, 0x18, 0xc0, 0x44, 0x80,
+  0x30, 0x3f, 0x3f, 0x3f, 0x29, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x02, 0x90, 0x1f, 0xfd, 0x18, 0xee,
+  0xd5, 0x00, 0x6c, 0xfe, 0x90, 0x05, 0x84, 0x1f, 0xfd, 0xb0, 0x44, 0x81, 0x57, 0x44, 0x80, 0xb0,
+  0x04, 0x80, 0x20, 0x43, 0x81, 0xcc, 0x42, 0x84, 0xef, 0xeb, 0xd0, 0x42, 0x80, 0x40, 0x03, 0x80,
+  0x10, 0x42, 0x83, 0x90, 0x04, 0x42, 0x87, 0xe3, 0x00, 0xaf, 0xf7, 0x03, 0x80, 0x10, 0x42, 0x80,
+  0x20, 0x02, 0x83, 0xdf, 0xfb, 0x02, 0x83, 0x4f, 0xfb, 0x03, 0x80, 0x10, 0x42, 0x03, 0x83, 0xbf,
+  0xf8, 0x02, 0x83, 0x2f, 0xfc, 0x03, 0x83, 0x1f, 0xfe, 0x03, 0x83, 0x9f, 0xf7, 0x02, 0x83, 0x1f,
+  0xfd, 0x03, 0x83, 0x1f, 0xfd, 0x03, 0x83, 0x8f, 0xf6, 0x03, 0x82, 0xff, 0xe0, 0x03, 0x83, 0x1f,
+  0xfd, 0x03, 0x83, 0x9f, 0xf6, 0x03, 0x82, 0xff, 0xe0, 0x03, 0x83, 0x1f, 0xfd, 0x03, 0x83, 0x8f,
+  0xf6, 0x03, 0x82, 0xff, 0xe0, 0x03, 0x83, 0x1f, 0xfd, 0x03, 0x83, 0x9f, 0xf6, 0x03, 0x82, 0xff,
+  0xe0, 0x03, 0x83, 0x1f, 0xfd, 0x03, 0x83, 0x9f, 0xf6, 0x03, 0x82, 0xff, 0xe0, 0x03, 0x83, 0x1f,
+  0xfd, 0x03, 0x83, 0x9f, 0xf6, 0x03, 0x82, 0xff, 0xe0, 0x03, 0x83, 0x1f, 0xfd, 0x03, 0x83, 0x9f,
+  0xf6, 0x03, 0x82, 0xff, 0xe0, 0x03, 0x83, 0x1f, 0xfd, 0x03, 0x83, 0x9f, 0xf6, 0x03, 0x82, 0xff,
+  0xe0, 0x03, 0x83, 0x1f, 0xfd, 0x03, 0x83, 0x9f, 0xf6, 0x03, 0x82, 0xff, 0xe0, 0x03, 0x83, 0x1f,
+  0xfd, 0x03, 0x83, 0x9f, 0xf6, 0x03, 0x82, 0xff, 0xe0, 0x03, 0x83, 0x1f, 0xfd, 0x03, 0x83, 0x9f,
+  0xf6, 0x03, 0x82, 0xff, 0xe0, 0x03, 0x83, 0x1f, 0xfd, 0x03, 0x83, 0x9f, 0xf6, 0x03, 0x42, 0x03,
+  0x83, 0x2f, 0xfd, 0x03, 0x83, 0x9f, 0xf6, 0x03, 0x82, 0xff, 0xe0, 0x3f, 0x3f, 0x3f, 0x28, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x23, 0x80, 0x10, 0x13, 0x80, 0x10, 0x0a, 0x8c, 0x9f, 0xfa, 0x00, 0x5b, 0xef,
+  0xea, 0x40, 0x09, 0x85, 0x9f, 0xfa, 0x1b, 0x46, 0x80, 0x80, 0x08, 0x89, 0x9f, 0xfa, 0xbf, 0xfd,
+  0xce, 0x43, 0x80, 0x40, 0x07, 0x86, 0x9f, 0xfe, 0xfb, 0x20, 0x02, 0x80, 0x50, 0x42, 0x80, 0xc0,
+  0x07, 0x80, 0x80, 0x42, 0x81, 0xc1, 0x04, 0x80, 0x60, 0x42, 0x80, 0x20, 0x06, 0x80, 0x90, 0x42,
+  0x80, 0x40, 0x05, 0x80, 0x10, 0x42, 0x80, 0x40, 0x06, 0x83, 0x9f, 0xfe, 0x07, 0x83, 0xdf, 0xf6,
+  0x06, 0x83, 0x9f, 0xfb, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7,
+  0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7,
+  0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7,
+  0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7,
+  0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7,
+  0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7,
+  0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x3f, 0x3f, 0x3f, 0x29, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x07, 0x88, 0x16, 0xbd, 0xee, 0xd9, 0x40, 0x0c, 0x81, 0x4d, 0x47, 0x81, 0xb1, 0x09, 0x80,
+  0x40, 0x43, 0x82, 0xec, 0xc0, 0x43, 0x81, 0xd1, 0x07, 0x85, 0x1e, 0xff, 0xe5, 0x02, 0x81, 0x18,
+  0x42, 0x80, 0xa0, 0x07, 0x80, 0x80, 0x42, 0x80, 0x40, 0x05, 0x80, 0x90, 0x42, 0x80, 0x30, 0x06,
+  0x83, 0xdf, 0xfa, 0x06, 0x84, 0x1e, 0xff, 0x90, 0x05, 0x80, 0x30, 0x42, 0x80, 0x50, 0x07, 0x83,
+  0xaf, 0xfd, 0x05, 0x80, 0x50, 0x42, 0x80, 0x10, 0x07, 0x80, 0x60, 0x42, 0x80, 0x10, 0x04, 0x83,
+  0x7f, 0xfe, 0x08, 0x80, 0x40, 0x42, 0x80, 0x30, 0x04, 0x83, 0x8f, 0xfd, 0x08, 0x80, 0x30, 0x42,
+  0x80, 0x30, 0x04, 0x83, 0x9f, 0xfd, 0x08, 0x80, 0x20, 0x42, 0x80, 0x40, 0x04, 0x83, 0x8f, 0xfe,
+  0x08, 0x80, 0x40, 0x42, 0x80, 0x30, 0x04, 0x80, 0x70, 0x42, 0x08, 0x80, 0x40, 0x42, 0x80, 0x10,
+  0x04, 0x80, 0x40, 0x42, 0x80, 0x30, 0x07, 0x83, 0x7f, 0xfe, 0x05, 0x80, 0x10, 0x42, 0x80, 0x70,
+  0x07, 0x83, 0xcf, 0xfb, 0x06, 0x84, 0xbf, 0xfd, 0x10, 0x05, 0x80, 0x30, 0x42, 0x80, 0x60, 0x06,
+  0x80, 0x50, 0x42, 0x80, 0xa0, 0x04, 0x85, 0x2d, 0xff, 0xe1, 0x07, 0x80, 0xa0, 0x42, 0x85, 0xc6,
+  0x44, 0x8e, 0x42, 0x80, 0x50, 0x08, 0x81, 0x1b, 0x49, 0x80, 0x70, 0x0a, 0x82, 0x16, 0xe0, 0x45,
+  0x81, 0xc4, 0x0e, 0x85, 0x46, 0x77, 0x52, 0x3f, 0x3f, 0x3f, 0x17, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x04, 0x8c, 0x9f, 0xf9, 0x02, 0x8d, 0xee, 0xc7, 0x10, 0x09, 0x85, 0xaf, 0xf9, 0x4e, 0x45, 0x81,
+  0xe4, 0x08, 0x89, 0xaf, 0xfb, 0xef, 0xfc, 0xbd, 0x43, 0x80, 0x40, 0x07, 0x81, 0xae, 0x42, 0x81,
+  0xb3, 0x02, 0x85, 0x4e, 0xff, 0xd1, 0x06, 0x80, 0xa0, 0x42, 0x81, 0xd1, 0x04, 0x80, 0x40, 0x42,
+  0x80, 0x60, 0x06, 0x80, 0xa0, 0x42, 0x80, 0x60, 0x06, 0x83, 0xaf, 0xfc, 0x06, 0x80, 0xa0, 0x42,
+  0x80, 0x10, 0x06, 0x80, 0x50, 0x42, 0x80, 0x10, 0x05, 0x83, 0xaf, 0xfc, 0x07, 0x80, 0x20, 0x42,
+  0x80, 0x40, 0x05, 0x83, 0xaf, 0xfa, 0x08, 0x42, 0x80, 0x60, 0x05, 0x83, 0xaf, 0xf9, 0x08, 0x83,
+  0xef, 0xf6, 0x05, 0x83, 0xaf, 0xf9, 0x08, 0x83, 0xef, 0xf7, 0x05, 0x83, 0xaf, 0xfa, 0x08, 0x42,
+  0x80, 0x60, 0x05, 0x83, 0xaf, 0xfb, 0x07, 0x80, 0x10, 0x42, 0x80, 0x50, 0x05, 0x83, 0xaf, 0xfe,
+  0x07, 0x80, 0x40, 0x42, 0x80, 0x30, 0x05, 0x80, 0xa0, 0x42, 0x80, 0x30, 0x06, 0x83, 0x7f, 0xfe,
+  0x06, 0x80, 0xa0, 0x42, 0x80, 0x90, 0x06, 0x83, 0xef, 0xf9, 0x06, 0x80, 0xa0, 0x43, 0x80, 0x50,
+  0x04, 0x80, 0x90, 0x42, 0x80, 0x30, 0x06, 0x8a, 0xaf, 0xfe, 0xff, 0x95, 0x46, 0xc0, 0x42, 0x80,
+  0x90, 0x07, 0x84, 0xaf, 0xf9, 0xb0, 0x47, 0x81, 0xb1, 0x07, 0x85, 0xaf, 0xf9, 0x19, 0x44, 0x82,
+  0xe8, 0x10, 0x08, 0x8b, 0xaf, 0xf9, 0x00, 0x15, 0x77, 0x51, 0x0a, 0x83, 0xaf, 0xf8, 0x12, 0x83,
+  0xaf, 0xf9, 0x12, 0x83, 0xaf, 0xf9, 0x0c, 0x80, 0x10, 0x04, 0x83, 0xaf, 0xf9, 0x12, 0x83, 0xaf,
+  0xf9, 0x12, 0x83, 0xaf, 0xf9, 0x3f, 0x14, 0x3f, 0x3f, 0x3f, 0x3f, 0x0d, 0x80, 0x10, 0x38, 0x8c,
+  0x28, 0xde, 0xed, 0x71, 0x0b, 0xff, 0x80, 0x08, 0x81, 0x5e, 0x45, 0x85, 0xd3, 0xbf, 0xf8, 0x07,
+  0x80, 0x50, 0x43, 0x89, 0xdb, 0xdf, 0xfd, 0xcf, 0xf8, 0x06, 0x85, 0x1e, 0xff, 0xd3, 0x02, 0x81,
+  0x3d, 0x43, 0x80, 0x80, 0x06, 0x84, 0x8f, 0xfe, 0x30, 0x04, 0x81, 0x2e, 0x42, 0x80, 0x80, 0x06,
+  0x83, 0xdf, 0xf9, 0x06, 0x80, 0x80, 0x42, 0x80, 0x80, 0x05, 0x80, 0x30, 0x42, 0x80, 0x40, 0x06,
+  0x80, 0x20, 0x42, 0x80, 0x80, 0x05, 0x80, 0x50, 0x42, 0x80, 0x10, 0x07, 0x83, 0xef, 0xf8, 0x05,
+  0x83, 0x8f, 0xfe, 0x08, 0x83, 0xcf, 0xf8, 0x05, 0x83, 0x8f, 0xfd, 0x08, 0x83, 0xbf, 0xf8, 0x05,
+  0x83, 0x9f, 0xfd, 0x08, 0x83, 0xbf, 0xf8, 0x05, 0x83, 0x8f, 0xfe, 0x08, 0x83, 0xcf, 0xf8, 0x05,
+  0x83, 0x7f, 0xfe, 0x08, 0x83, 0xdf, 0xf8, 0x05, 0x80, 0x40, 0x42, 0x80, 0x30, 0x06, 0x80, 0x10,
+  0x42, 0x80, 0x80, 0x05, 0x80, 0x10, 0x42, 0x80, 0x60, 0x06, 0x80, 0x40, 0x42, 0x80, 0x80, 0x06,
+  0x83, 0xbf, 0xfd, 0x06, 0x80, 0xb0, 0x42, 0x80, 0x80, 0x06, 0x80, 0x50, 0x42, 0x80, 0x80, 0x04,
+  0x80, 0x60, 0x43, 0x80, 0x80, 0x07, 0x80, 0xb0, 0x42, 0x8a, 0xb5, 0x45, 0xaf, 0xfe, 0xff, 0x80,
+  0x07, 0x81, 0x1c, 0x47, 0x84, 0x8b, 0xff, 0x80, 0x08, 0x81, 0x19, 0x44, 0x86, 0xe7, 0x1b, 0xff,
+  0x80, 0x0a, 0x8b, 0x15, 0x77, 0x51, 0x00, 0xbf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12, 0x83, 0xbf,
+  0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12, 0x83, 0xaf, 0xf8, 0x12, 0x83, 0xbf, 0xf8, 0x12, 0x83, 0xbf,
+  0xf9, 0x3f, 0x08, 0x3f, 0x3f, 0x3f, 0x1b, 0x80, 0x10, 0x3f, 0x1f, 0x80, 0x10, 0x09, 0x8e, 0x9f,
+  0xf9, 0x00, 0x29, 0xce, 0xed, 0xb6, 0x10, 0x07, 0x85, 0xaf, 0xf9, 0x05, 0x47, 0x80, 0x50, 0x07,
+  0x84, 0xaf, 0xf9, 0x50, 0x48, 0x80, 0x50, 0x07, 0x8e, 0xaf, 0xfa, 0xef, 0xc5, 0x10, 0x02, 0x7e,
+  0x40, 0x07, 0x80, 0xa0, 0x43, 0x80, 0x90, 0x06, 0x81, 0x12, 0x07, 0x80, 0xa0, 0x42, 0x80, 0xc0,
+  0x11, 0x80, 0xa0, 0x42, 0x80, 0x40, 0x11, 0x83, 0xaf, 0xfe, 0x12, 0x83, 0xaf, 0xfb, 0x12, 0x83,
+  0xaf, 0xfa, 0x12, 0x83, 0xaf, 0xf9, 0x12, 0x83, 0xaf, 0xf9, 0x12, 0x83, 0xaf, 0xf9, 0x12, 0x83,
+  0xaf, 0xf9, 0x12, 0x83, 0xaf, 0xf9, 0x12, 0x83, 0xaf, 0xf9, 0x12, 0x83, 0xaf, 0xf9, 0x12, 0x83,
+  0xaf, 0xf9, 0x12, 0x83, 0xaf, 0xf9, 0x12, 0x83, 0x9f, 0xf9, 0x3f, 0x3f, 0x3f, 0x32, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x2d, 0x80, 0x10, 0x18, 0x8a, 0x16, 0xbd, 0xff, 0xed, 0xa6, 0x10, 0x0a, 0x81, 0x4e,
+  0x49, 0x80, 0x20, 0x08, 0x80, 0x30, 0x43, 0x84, 0xdb, 0xac, 0xe0, 0x42, 0x80, 0x20, 0x08, 0x84,
+  0xbf, 0xfd, 0x30, 0x04, 0x83, 0x28, 0xe2, 0x08, 0x42, 0x80, 0x40, 0x07, 0x80, 0x10, 0x08, 0x80,
+  0x30, 0x42, 0x80, 0x20, 0x11, 0x80, 0x20, 0x42, 0x80, 0x40, 0x12, 0x84, 0xef, 0xfd, 0x30, 0x11,
+  0x80, 0x80, 0x43, 0x83, 0xc8, 0x62, 0x0e, 0x80, 0xa0, 0x46, 0x82, 0xea, 0x30, 0x0c, 0x81, 0x5b,
+  0x47, 0x80, 0x80, 0x0e, 0x83, 0x37, 0xbe, 0x43, 0x80, 0x50, 0x10, 0x81, 0x17, 0x42, 0x80, 0xc0,
+  0x12, 0x80, 0x70, 0x42, 0x80, 0x10, 0x11, 0x80, 0x30, 0x42, 0x80, 0x10, 0x11, 0x80, 0x50, 0x42,
+  0x07, 0x82, 0x4a, 0x40, 0x06, 0x84, 0x1c, 0xff, 0xb0, 0x07, 0x8a, 0x4f, 0xfd, 0x95, 0x43, 0x58,
+  0xe0, 0x42, 0x80, 0x40, 0x07, 0x80, 0x40, 0x4b, 0x80, 0x60, 0x08, 0x82, 0x18, 0xc0, 0x47, 0x81,
+  0xb3, 0x0c, 0x87, 0x14, 0x67, 0x76, 0x52, 0x3f, 0x3f, 0x3f, 0x17, 0x3f, 0x3f, 0x3f, 0x15, 0x83,
+  0x6f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83,
+  0x7f, 0xfc, 0x0d, 0x80, 0xb0, 0x4e, 0x80, 0x20, 0x05, 0x80, 0xa0, 0x4e, 0x80, 0x20, 0x05, 0x90,
+  0x57, 0x77, 0x8b, 0xff, 0xe7, 0x77, 0x77, 0x77, 0x10, 0x0a, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f,
+  0xfc, 0x06, 0x80, 0x10, 0x0a, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x05, 0x80, 0x10, 0x0b,
+  0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x6f, 0xfc, 0x12,
+  0x83, 0x7f, 0xfc, 0x12, 0x83, 0x7f, 0xfc, 0x12, 0x83, 0x6f, 0xfc, 0x05, 0x80, 0x10, 0x0b, 0x83,
+  0x6f, 0xfd, 0x12, 0x80, 0x40, 0x42, 0x80, 0x10, 0x05, 0x80, 0x10, 0x0a, 0x80, 0x10, 0x42, 0x80,
+  0x90, 0x12, 0x80, 0xa0, 0x42, 0x86, 0xda, 0x89, 0x88, 0x10, 0x0b, 0x81, 0x1c, 0x47, 0x80, 0x20,
+  0x0c, 0x83, 0x16, 0xbd, 0x44, 0x80, 0x20, 0x12, 0x80, 0x10, 0x3f, 0x3f, 0x3f, 0x15, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x04, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07,
+  0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07,
+  0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07,
+  0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07,
+  0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07,
+  0x83, 0xcf, 0xf7, 0x06, 0x83, 0x8f, 0xfa, 0x07, 0x83, 0xcf, 0xf7, 0x06, 0x83, 0x9f, 0xfa, 0x07,
+  0x83, 0xcf, 0xf7, 0x06, 0x83, 0x8f, 0xfa, 0x07, 0x83, 0xdf, 0xf7, 0x06, 0x83, 0x8f, 0xfb, 0x07,
+  0x42, 0x80, 0x70, 0x06, 0x83, 0x7f, 0xfd, 0x06, 0x80, 0x40, 0x42, 0x80, 0x70, 0x06, 0x80, 0x40,
+  0x42, 0x80, 0x20, 0x05, 0x80, 0xa0, 0x42, 0x80, 0x70, 0x06, 0x80, 0x10, 0x42, 0x80, 0xa0, 0x04,
+  0x80, 0x60, 0x43, 0x80, 0x70, 0x07, 0x80, 0xa0, 0x42, 0x8a, 0xc6, 0x56, 0xbf, 0xdc, 0xff, 0x70,
+  0x07, 0x81, 0x2e, 0x46, 0x85, 0xe4, 0xcf, 0xf7, 0x08, 0x81, 0x3c, 0x44, 0x86, 0xc2, 0x0c, 0xff,
+  0x70, 0x0a, 0x84, 0x46, 0x76, 0x30, 0x3f, 0x3f, 0x3f, 0x19, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x02,
+  0x80, 0x10, 0x42, 0x80, 0x40, 0x09, 0x83, 0x9f, 0xfb, 0x04, 0x83, 0xbf, 0xf9, 0x09, 0x83, 0xef,
+  0xf6, 0x04, 0x83, 0x6f, 0xfe, 0x08, 0x80, 0x50, 0x42, 0x80, 0x10, 0x04, 0x84, 0x1e, 0xff, 0x50,
+  0x07, 0x83, 0xaf, 0xfa, 0x06, 0x83, 0xaf, 0xf9, 0x06, 0x84, 0x1e, 0xff, 0x50, 0x06, 0x84, 0x5f,
+  0xfe, 0x10, 0x05, 0x84, 0x4f, 0xfe, 0x10, 0x07, 0x83, 0xef, 0xf5, 0x05, 0x83, 0xaf, 0xfa, 0x08,
+  0x83, 0x9f, 0xfa, 0x04, 0x84, 0x1e, 0xff, 0x40, 0x08, 0x84, 0x4f, 0xfe, 0x10, 0x03, 0x84, 0x5f,
+  0xfe, 0x10, 0x09, 0x83, 0xef, 0xf5, 0x03, 0x83, 0xbf, 0xf9, 0x0a, 0x83, 0x8f, 0xfa, 0x02, 0x80,
+  0x10, 0x42, 0x80, 0x40, 0x0a, 0x80, 0x40, 0x42, 0x86, 0x10, 0x06, 0xff, 0xd0, 0x0c, 0x89, 0xdf,
+  0xf5, 0x00, 0xbf, 0xf8, 0x0c, 0x85, 0x8f, 0xfb, 0x01, 0x42, 0x80, 0x30, 0x0c, 0x88, 0x3f, 0xfe,
+  0x16, 0xff, 0xd0, 0x0e, 0x87, 0xdf, 0xf6, 0xbf, 0xf8, 0x0e, 0x83, 0x7f, 0xfc, 0x42, 0x80, 0x20,
+  0x0e, 0x80, 0x20, 0x44, 0x80, 0xc0, 0x10, 0x80, 0xc0, 0x43, 0x80, 0x70, 0x10, 0x80, 0x70, 0x43,
+  0x80, 0x20, 0x3f, 0x3f, 0x3f, 0x2e, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x85, 0x00, 0xdf, 0xf5, 0x0d,
+  0x88, 0xaf, 0xf8, 0x0a, 0xff, 0x80, 0x0d, 0x88, 0xdf, 0xf5, 0x07, 0xff, 0xb0, 0x0c, 0x80, 0x10,
+  0x42, 0x85, 0x10, 0x3f, 0xfe, 0x0c, 0x83, 0x4f, 0xfd, 0x02, 0x83, 0xef, 0xf2, 0x0b, 0x83, 0x7f,
+  0xfa, 0x02, 0x83, 0xbf, 0xf5, 0x03, 0x83, 0x13, 0x21, 0x03, 0x83, 0xbf, 0xf6, 0x02, 0x83, 0x7f,
+  0xf8, 0x03, 0x83, 0xbf, 0xf6, 0x03, 0x83, 0xef, 0xf2, 0x02, 0x83, 0x4f, 0xfc, 0x02, 0x80, 0x10,
+  0x42, 0x80, 0xa0, 0x02, 0x83, 0x2f, 0xfe, 0x03, 0x80, 0x10, 0x42, 0x02, 0x80, 0x50, 0x42, 0x80,
+  0xe0, 0x02, 0x83, 0x5f, 0xfb, 0x04, 0x91, 0xcf, 0xf3, 0x00, 0x9f, 0xbf, 0xf3, 0x00, 0x8f, 0xf7,
+  0x04, 0x91, 0x9f, 0xf6, 0x00, 0xdf, 0x6c, 0xf7, 0x00, 0xcf, 0xf4, 0x04, 0x91, 0x5f, 0xf9, 0x02,
+  0xff, 0x27, 0xfb, 0x00, 0xef, 0xf1, 0x04, 0x90, 0x2f, 0xfd, 0x05, 0xfd, 0x03, 0xff, 0x13, 0xff,
+  0xc0, 0x06, 0x8f, 0xdf, 0xf1, 0xaf, 0x80, 0x0e, 0xf4, 0x6f, 0xf8, 0x06, 0x8f, 0xaf, 0xf4, 0xef,
+  0x40, 0x09, 0xf9, 0x9f, 0xf5, 0x06, 0x8f, 0x6f, 0xfa, 0xfe, 0x10, 0x05, 0xfd, 0xcf, 0xf2, 0x06,
+  0x80, 0x30, 0x43, 0x80, 0xb0, 0x02, 0x80, 0x10, 0x43, 0x80, 0xd0, 0x08, 0x43, 0x80, 0x60, 0x03,
+  0x80, 0xc0, 0x42, 0x80, 0xa0, 0x08, 0x80, 0xb0, 0x42, 0x80, 0x20, 0x03, 0x80, 0x70, 0x42, 0x80,
+  0x60, 0x08, 0x83, 0x8f, 0xfd, 0x04, 0x80, 0x30, 0x42, 0x82, 0x30, 0x10, 0x3f, 0x3f, 0x3f, 0x28,
+  0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x03, 0x84, 0x9f, 0xfe, 0x10, 0x07, 0x80, 0x50, 0x42, 0x80, 0x40,
+  0x04, 0x84, 0x1d, 0xff, 0xa0, 0x06, 0x84, 0x2e, 0xff, 0x80, 0x06, 0x80, 0x30, 0x42, 0x80, 0x60,
+  0x05, 0x83, 0xbf, 0xfc, 0x08, 0x84, 0x6f, 0xfe, 0x20, 0x03, 0x84, 0x8f, 0xfe, 0x20, 0x09, 0x83,
+  0xaf, 0xfc, 0x02, 0x80, 0x30, 0x42, 0x80, 0x50, 0x0a, 0x8a, 0x1d, 0xff, 0x90, 0x1d, 0xff, 0x90,
+  0x0c, 0x80, 0x30, 0x42, 0x84, 0x4a, 0xff, 0xd0, 0x0e, 0x80, 0x70, 0x44, 0x81, 0xe2, 0x0f, 0x80,
+  0xb0, 0x43, 0x80, 0x60, 0x10, 0x80, 0x20, 0x42, 0x80, 0xc0, 0x11, 0x80, 0x90, 0x43, 0x80, 0x40,
+  0x0f, 0x80, 0x50, 0x44, 0x81, 0xe2, 0x0d, 0x88, 0x2e, 0xff, 0x7c, 0xff, 0xb0, 0x0d, 0x85, 0xcf,
+  0xfb, 0x02, 0x42, 0x80, 0x80, 0x0b, 0x87, 0x9f, 0xfe, 0x20, 0x05, 0x42, 0x80, 0x40, 0x09, 0x80,
+  0x50, 0x42, 0x80, 0x50, 0x03, 0x84, 0xaf, 0xfe, 0x10, 0x07, 0x84, 0x2e, 0xff, 0x90, 0x04, 0x84,
+  0x1d, 0xff, 0xb0, 0x07, 0x84, 0xcf, 0xfd, 0x10, 0x05, 0x80, 0x30, 0x42, 0x80, 0x70, 0x05, 0x80,
+  0x80, 0x42, 0x80, 0x30, 0x07, 0x80, 0x70, 0x42, 0x80, 0x40, 0x03, 0x80, 0x50, 0x42, 0x80, 0x60,
+  0x09, 0x84, 0xbf, 0xfe, 0x10, 0x3f, 0x3f, 0x3f, 0x27, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x03, 0x83,
+  0xef, 0xf7, 0x09, 0x80, 0x50, 0x42, 0x80, 0x10, 0x03, 0x83, 0x9f, 0xfc, 0x09, 0x83, 0xbf, 0xfb,
+  0x04, 0x80, 0x30, 0x42, 0x80, 0x30, 0x07, 0x80, 0x10, 0x42, 0x80, 0x50, 0x05, 0x83, 0xcf, 0xf9,
+  0x07, 0x83, 0x7f, 0xfd, 0x06, 0x84, 0x6f, 0xfe, 0x10, 0x06, 0x83, 0xdf, 0xf8, 0x06, 0x84, 0x1e,
+  0xff, 0x50, 0x05, 0x80, 0x30, 0x42, 0x80, 0x20, 0x07, 0x83, 0x9f, 0xfb, 0x05, 0x83, 0x9f, 0xfb,
+  0x08, 0x80, 0x30, 0x42, 0x80, 0x20, 0x03, 0x84, 0x1e, 0xff, 0x50, 0x09, 0x83, 0xcf, 0xf7, 0x03,
+  0x83, 0x5f, 0xfe, 0x0a, 0x83, 0x6f, 0xfd, 0x03, 0x83, 0xbf, 0xf8, 0x0a, 0x80, 0x10, 0x42, 0x83,
+  0x40, 0x02, 0x42, 0x80, 0x20, 0x0b, 0x89, 0x9f, 0xf9, 0x00, 0x7f, 0xfc, 0x0c, 0x89, 0x3f, 0xfe,
+  0x10, 0xdf, 0xf6, 0x0c, 0x88, 0x1c, 0xff, 0x64, 0xff, 0xe0, 0x0e, 0x87, 0x7f, 0xfc, 0x9f, 0xf9,
+  0x0e, 0x80, 0x10, 0x42, 0x83, 0xef, 0xf3, 0x0f, 0x80, 0xa0, 0x43, 0x80, 0xc0, 0x10, 0x80, 0x40,
+  0x43, 0x80, 0x70, 0x11, 0x80, 0xd0, 0x42, 0x80, 0x10, 0x11, 0x83, 0xaf, 0xfb, 0x11, 0x80, 0x10,
+  0x42, 0x80, 0x50, 0x11, 0x83, 0x7f, 0xfd, 0x11, 0x84, 0x1e, 0xff, 0x80, 0x11, 0x84, 0xaf, 0xfe,
+  0x10, 0x0d, 0x83, 0x8a, 0xbe, 0x42, 0x81, 0x81, 0x0d, 0x80, 0xc0, 0x44, 0x80, 0xa0, 0x0f, 0x85,
+  0xcf, 0xfe, 0xb5, 0x3f, 0x12, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x05, 0x4d, 0x82, 0x40, 0x10, 0x05,
+  0x4d, 0x80, 0x40, 0x07, 0x8a, 0x89, 0x99, 0x89, 0x98, 0x99, 0xa0, 0x42, 0x80, 0x40, 0x11, 0x83,
+  0xcf, 0xfc, 0x11, 0x84, 0xaf, 0xfe, 0x20, 0x10, 0x80, 0x60, 0x42, 0x80, 0x40, 0x10, 0x80, 0x30,
+  0x42, 0x80, 0x70, 0x10, 0x84, 0x1e, 0xfe, 0xb0, 0x11, 0x84, 0xcf, 0xfd, 0x10, 0x10, 0x84, 0x8f,
+  0xfe, 0x30, 0x10, 0x80, 0x50, 0x42, 0x80, 0x60, 0x10, 0x84, 0x2e, 0xff, 0x90, 0x11, 0x83, 0xdf,
+  0xfc, 0x11, 0x84, 0xaf, 0xfe, 0x20, 0x10, 0x80, 0x70, 0x42, 0x80, 0x40, 0x10, 0x80, 0x40, 0x42,
+  0x80, 0x70, 0x10, 0x84, 0x2e, 0xff, 0xa0, 0x08, 0x80, 0x10, 0x07, 0x80, 0x70, 0x42, 0x8b, 0xa9,
+  0x99, 0x99, 0x99, 0x99, 0x93, 0x06, 0x80, 0x60, 0x4d, 0x80, 0x40, 0x06, 0x80, 0x70, 0x4d, 0x82,
+  0x40, 0x10, 0x3f, 0x3f, 0x3f, 0x27, 0x3f, 0x80, 0x10, 0x3f, 0x2a, 0x86, 0x38, 0xcd, 0xef, 0xc0,
+  0x0e, 0x80, 0x60, 0x45, 0x80, 0xc0, 0x0d, 0x80, 0x10, 0x43, 0x83, 0xb8, 0x86, 0x0d, 0x80, 0x60,
+  0x42, 0x80, 0x30, 0x11, 0x83, 0x8f, 0xfc, 0x12, 0x83, 0xaf, 0xfa, 0x12, 0x83, 0xaf, 0xf9, 0x12,
+  0x83, 0xaf, 0xf9, 0x12, 0x83, 0xbf, 0xf9, 0x12, 0x83, 0xaf, 0xf9, 0x12, 0x83, 0xbf, 0xf9, 0x12,
+  0x83, 0xbf, 0xf9, 0x12, 0x83, 0xdf, 0xf7, 0x11, 0x80, 0x40, 0x42, 0x80, 0x40, 0x0f, 0x85, 0x26,
+  0xef, 0xfd, 0x0d, 0x80, 0x20, 0x45, 0x81, 0xb1, 0x0d, 0x80, 0x20, 0x44, 0x81, 0xb3, 0x0e, 0x84,
+  0x17, 0x8a, 0xe0, 0x42, 0x80, 0x60, 0x11, 0x81, 0x1a, 0x42, 0x80, 0x10, 0x11, 0x80, 0x10, 0x42,
+  0x80, 0x50, 0x12, 0x83, 0xdf, 0xf8, 0x12, 0x83, 0xbf, 0xf9, 0x12, 0x83, 0xaf, 0xf9, 0x12, 0x83,
+  0xbf, 0xf9, 0x12, 0x83, 0xaf, 0xf9, 0x12, 0x83, 0xbf, 0xf9, 0x12, 0x83, 0xaf, 0xf9, 0x12, 0x83,
+  0xaf, 0xfa, 0x12, 0x83, 0x8f, 0xfc, 0x12, 0x80, 0x60, 0x42, 0x80, 0x40, 0x11, 0x80, 0x10, 0x43,
+  0x83, 0xb9, 0x86, 0x0e, 0x80, 0x50, 0x45, 0x80, 0xc0, 0x0f, 0x86, 0x27, 0xbd, 0xef, 0xc0, 0x3f,
+  0x20, 0x3f, 0x3f, 0x29, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12,
+  0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12,
+  0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12,
+  0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12,
+  0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12,
+  0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12,
+  0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12,
+  0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12,
+  0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12, 0x83, 0xaf, 0xf5, 0x12,
+  0x83, 0x57, 0x73, 0x20, 0x3f, 0x3f, 0x23, 0x87, 0x1f, 0xfe, 0xdb, 0x61, 0x0e, 0x80, 0x20, 0x45,
+  0x81, 0xd2, 0x0d, 0x84, 0x18, 0x89, 0xd0, 0x42, 0x80, 0xa0, 0x12, 0x80, 0x90, 0x42, 0x80, 0x10,
+  0x11, 0x80, 0x20, 0x42, 0x80, 0x30, 0x12, 0x83, 0xef, 0xf4, 0x12, 0x83, 0xef, 0xf4, 0x12, 0x83,
+  0xef, 0xf4, 0x12, 0x83, 0xef, 0xf5, 0x12, 0x83, 0xef, 0xf5, 0x12, 0x83, 0xef, 0xf5, 0x12, 0x83,
+  0xdf, 0xf6, 0x12, 0x83, 0xcf, 0xf8, 0x12, 0x83, 0x9f, 0xfd, 0x12, 0x80, 0x30, 0x42, 0x82, 0xb5,
+  0x10, 0x10, 0x81, 0x4d, 0x44, 0x80, 0xc0, 0x03, 0x80, 0x10, 0x0a, 0x81, 0x5d, 0x43, 0x80, 0xc0,
+  0x0e, 0x80, 0xa0, 0x42, 0x83, 0xc9, 0x86, 0x0d, 0x80, 0x50, 0x42, 0x80, 0x60, 0x11, 0x83, 0xbf,
+  0xfb, 0x12, 0x83, 0xdf, 0xf7, 0x12, 0x83, 0xef, 0xf5, 0x12, 0x83, 0xdf, 0xf5, 0x12, 0x83, 0xef,
+  0xf5, 0x12, 0x83, 0xef, 0xf5, 0x12, 0x83, 0xef, 0xf5, 0x12, 0x83, 0xef, 0xf4, 0x12, 0x42, 0x80,
+  0x40, 0x11, 0x80, 0x20, 0x42, 0x80, 0x30, 0x11, 0x83, 0x9f, 0xfe, 0x0d, 0x84, 0x18, 0x8a, 0xc0,
+  0x42, 0x80, 0x90, 0x0d, 0x80, 0x10, 0x45, 0x81, 0xd1, 0x0d, 0x86, 0x2f, 0xfe, 0xda, 0x60, 0x3f,
+  0x28, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x29, 0x80, 0x10, 0x23, 0x87, 0x39, 0xde, 0xec, 0x94,
+  0x06, 0x82, 0x18, 0x20, 0x02, 0x81, 0x1a, 0x47, 0x89, 0xd7, 0x20, 0x01, 0x5d, 0xf2, 0x02, 0x80,
+  0x60, 0x4c, 0x80, 0xe0, 0x43, 0x80, 0x20, 0x02, 0x89, 0x7f, 0xa5, 0x10, 0x02, 0x6c, 0x47, 0x80,
+  0x70, 0x03, 0x81, 0x55, 0x07, 0x87, 0x38, 0xce, 0xec, 0x82, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f,
+  0x38,
+  };
+const uint32_t dejavu_sans_mono_36_rle_offsets[95] = {
+  0x00000000, 0x00000010, 0x00000074, 0x000000d5, 0x000001a8, 0x00000296,
+  0x00000373, 0x00000467, 0x0000049c, 0x00000532, 0x000005c5, 0x0000064a,
+  0x000006aa, 0x000006f3, 0x00000717, 0x00000747, 0x000007d7, 0x000008ee,
+  0x00000975, 0x00000a1a, 0x00000ad3, 0x00000bab, 0x00000c56, 0x00000d50,
+  0x00000de3, 0x00000ee6, 0x00000fd5, 0x0000101f, 0x00001082, 0x00001100,
+  0x00001137, 0x000011b8, 0x00001255, 0x00001383, 0x0000145e, 0x0000156d,
+  0x00001628, 0x00001720, 0x000017a3, 0x0000181d, 0x00001902, 0x00001a07,
+  0x00001a87, 0x00001b1f, 0x00001c1c, 0x00001cb8, 0x00001df9, 0x00001f34,
+  0x0000203f, 0x000020fb, 0x00002219, 0x00002338, 0x000023fb, 0x00002470,
+  0x000025a3, 0x00002689, 0x000027a7, 0x0000289a, 0x00002953, 0x000029f7,
+  0x00002a87, 0x00002b1f, 0x00002bb2, 0x00002c13, 0x00002c23, 0x00002c51,
+  0x00002d0b, 0x00002e05, 0x00002e9b, 0x00002f8c, 0x00003039, 0x000030c4,
+  0x000031bd, 0x00003294, 0x00003314, 0x000033a9, 0x0000348a, 0x00003515,
+  0x0000360f, 0x000036cc, 0x0000379b, 0x00003887, 0x00003973, 0x000039ee,
+  0x00003a8b, 0x00003b1e, 0x00003bda, 0x00003c86, 0x00003d60, 0x00003e19,
+  0x00003ee5, 0x00003f66, 0x00004011, 0x000040a4, 0x00004151,
+  };
+const unsigned int dejavu_sans_mono_36_rle_width = 23;
+const unsigned int dejavu_sans_mono_36_rle_height = 44;
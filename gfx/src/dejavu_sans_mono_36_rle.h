@@ -0,0 +1,6 @@
+// This file is automatically generated. Do not edit
+#include <stdint.h>
+extern const uint8_t dejavu_sans_mono_36_rle_data[];
+extern const uint32_t dejavu_sans_mono_36_rle_offsets[95];
+extern const unsigned int dejavu_sans_mono_36_rle_width;
+extern const unsigned int dejavu_sans_mono_36_rle_height;
@@ -0,0 +1,6 @@
+// This file is automatically generated. Do not edit
+#include <stdint.h>
+extern const uint16_t dejavu_sans_mono_72_atlas_pixels[];
+extern const uint32_t dejavu_sans_mono_72_atlas_offsets[95];
+extern const unsigned int dejavu_sans_mono_72_atlas_width;
+extern const unsigned int dejavu_sans_mono_72_atlas_height;
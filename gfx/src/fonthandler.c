@@ -25,8 +25,31 @@ struct _FontHandler
   unsigned int font_height;
   unsigned char *glyph_buffer;
   uint16_t *glyph_buffer_565;
+  const uint16_t *atlas_pixels; // NULL if not an atlas font
+  const uint32_t *atlas_offsets;
+  const uint8_t *rle_data; // NULL if not an RLE font
+  const uint32_t *rle_offsets;
+  uint16_t palette[16]; // RGB565 for each RLE coverage value
+  uint16_t *scale_buffer; // One row of a scaled glyph
+  unsigned int scale_buffer_scale; 
   };
 
+/*============================================================================
+ * RleSink 
+ * Where the RLE decoder sends its output. Runs are a coverage value and a 
+ *   count; literals are packed coverage values, two to a byte.
+ * =========================================================================*/
+typedef struct _RleSink
+  {
+  void (*run) (void *data, unsigned int coverage, unsigned int n);
+  void (*literal) (void *data, const uint8_t *packed, unsigned int n);
+  void *data;
+  } RleSink;
+
+// Size of the buffer used to convert literals to RGB565 on their way to
+//   the display
+#define FONTHANDLER_LITERAL_CHUNK 32
+
 /*============================================================================
  * DecoderContext 
  * This is used to carry the state of the JPEG decode process. PicoJPEG
@@ -65,11 +88,199 @@ static unsigned char fonthandler_pjpeg_callback (unsigned char *buf,
   return 0;
   }
 
+/* =======================================================================
+  fonthandler_atlas_lookup
+  Returns the start of the glyph for c in the atlas, or NULL if the 
+    atlas doesn't have it.
+ ======================================================================= */
+static const uint16_t *fonthandler_atlas_lookup (const FontHandler *self, 
+         int c)
+  {
+  if (c < 32 || c > 126) return NULL;
+  uint32_t offset = self->atlas_offsets[c - ' '];
+  if (offset == FONTHANDLER_NO_GLYPH) return NULL;
+  return self->atlas_pixels + offset;
+  }
+
+/* =======================================================================
+  fonthandler_get_atlas_glyph
+  Atlas fonts don't store intensities, so we recover an approximation
+    from the six-bit green component. 
+ ======================================================================= */
+static const unsigned char *fonthandler_get_atlas_glyph (FontHandler *self, 
+         int c)
+  {
+  unsigned int len = self->font_width * self->font_height;
+  if (!self->glyph_buffer)
+    self->glyph_buffer = malloc (len);
+  const uint16_t *glyph = fonthandler_atlas_lookup (self, c);
+  if (glyph)
+    {
+    for (unsigned int i = 0; i < len; i++)
+      {
+      unsigned int g = (glyph[i] >> 5) & 0x3F;
+      self->glyph_buffer[i] = (unsigned char)((g << 2) | (g >> 4));
+      }
+    }
+  else
+    memset (self->glyph_buffer, 0, len);
+  return self->glyph_buffer;
+  }
+
+/* =======================================================================
+  fonthandler_rle_lookup
+ ======================================================================= */
+static const uint8_t *fonthandler_rle_lookup (const FontHandler *self, 
+         int c)
+  {
+  if (c < 32 || c > 126) return NULL;
+  uint32_t offset = self->rle_offsets[c - ' '];
+  if (offset == FONTHANDLER_NO_GLYPH) return NULL;
+  return self->rle_data + offset;
+  }
+
+/* =======================================================================
+  fonthandler_rle_decode
+  Expand len pixels of RLE data into the sink. 
+ ======================================================================= */
+static void fonthandler_rle_decode (const uint8_t *p, unsigned int len, 
+         const RleSink *sink)
+  {
+  unsigned int done = 0;
+  while (done < len)
+    {
+    uint8_t op = *p++;
+    unsigned int n;
+    if (op & FONTHANDLER_RLE_LITERAL)
+      {
+      n = (op & 0x7Fu) + 1;
+      if (n > len - done) n = len - done; // Corrupt data
+      sink->literal (sink->data, p, n);
+      p += (n + 1) / 2;
+      }
+    else
+      {
+      n = (op & 0x3Fu) + 1;
+      if (n > len - done) n = len - done; 
+      sink->run (sink->data, (op & FONTHANDLER_RLE_SOLID) ? 15 : 0, n);
+      }
+    done += n;
+    }
+  }
+
+/* =======================================================================
+  fonthandler_nibble
+ ======================================================================= */
+static inline unsigned int fonthandler_nibble (const uint8_t *packed, 
+         unsigned int i)
+  {
+  return (i & 1) ? (packed[i >> 1] & 0x0Fu) : (unsigned int)(packed[i >> 1] >> 4);
+  }
+
+/* =======================================================================
+  RLE sinks for 8-bit intensity and RGB565 glyph buffers
+ ======================================================================= */
+typedef struct _BufferSink
+  {
+  const FontHandler *fh;
+  unsigned char *out8;
+  uint16_t *out565;
+  } BufferSink;
+
+static void fonthandler_buffer_run (void *data, unsigned int coverage, 
+         unsigned int n)
+  {
+  BufferSink *bs = data;
+  for (unsigned int i = 0; i < n; i++)
+    {
+    if (bs->out8) *bs->out8++ = (unsigned char)(coverage * 17);
+    else *bs->out565++ = bs->fh->palette[coverage]; 
+    }
+  }
+
+static void fonthandler_buffer_literal (void *data, const uint8_t *packed, 
+         unsigned int n)
+  {
+  BufferSink *bs = data;
+  for (unsigned int i = 0; i < n; i++)
+    {
+    unsigned int coverage = fonthandler_nibble (packed, i);
+    if (bs->out8) *bs->out8++ = (unsigned char)(coverage * 17);
+    else *bs->out565++ = bs->fh->palette[coverage]; 
+    }
+  }
+
+/* =======================================================================
+  RLE sink for the display. Runs are sent as repeated words, literals
+    are converted to RGB565 a chunk at a time.
+ ======================================================================= */
+typedef struct _DisplaySink
+  {
+  const FontHandler *fh;
+  const WSLCD *wslcd;
+  } DisplaySink;
+
+static void fonthandler_display_run (void *data, unsigned int coverage, 
+         unsigned int n)
+  {
+  DisplaySink *ds = data;
+  wslcd_stream_repeated (ds->wslcd, ds->fh->palette[coverage], (int)n);
+  }
+
+static void fonthandler_display_literal (void *data, const uint8_t *packed, 
+         unsigned int n)
+  {
+  DisplaySink *ds = data;
+  uint16_t chunk[FONTHANDLER_LITERAL_CHUNK];
+  unsigned int k = 0;
+  for (unsigned int i = 0; i < n; i++)
+    {
+    chunk[k++] = ds->fh->palette[fonthandler_nibble (packed, i)];
+    if (k == FONTHANDLER_LITERAL_CHUNK)
+      {
+      wslcd_stream_pixels (ds->wslcd, chunk, (int)k);
+      k = 0;
+      }
+    }
+  if (k) wslcd_stream_pixels (ds->wslcd, chunk, (int)k);
+  }
+
+/* =======================================================================
+  fonthandler_get_rle_glyph
+  Decode an RLE glyph into one of the glyph buffers. Only needed by
+    callers that want the glyph data itself -- fonthandler_draw_glyph
+    doesn't use a buffer.
+ ======================================================================= */
+static void fonthandler_get_rle_glyph (FontHandler *self, int c, 
+         unsigned char *out8, uint16_t *out565)
+  {
+  unsigned int len = self->font_width * self->font_height;
+  BufferSink bs = { self, out8, out565 };
+  const uint8_t *glyph = fonthandler_rle_lookup (self, c);
+  if (glyph)
+    {
+    RleSink sink = { fonthandler_buffer_run, fonthandler_buffer_literal, &bs };
+    fonthandler_rle_decode (glyph, len, &sink);
+    }
+  else
+    fonthandler_buffer_run (&bs, 0, len);
+  }
+
 /* =======================================================================
   fonthandler_get_glyph
  ======================================================================= */
 const unsigned char *fonthandler_get_glyph (FontHandler *self, int c)
   {
+  if (self->atlas_pixels)
+    return fonthandler_get_atlas_glyph (self, c);
+  if (self->rle_data)
+    {
+    if (!self->glyph_buffer)
+      self->glyph_buffer = malloc (self->font_width * self->font_height);
+    fonthandler_get_rle_glyph (self, c, self->glyph_buffer, NULL);
+    return self->glyph_buffer;
+    }
+
   memset (self->glyph_buffer, 0, self->font_height * self->font_width);
 
   if (c >= 32 && c <= 126)
@@ -164,6 +375,31 @@ static inline uint16_t fonthandler_rgb888_to_rgb565 (uint8_t r,
  ======================================================================= */
 const uint16_t *fonthandler_get_glyph_565 (FontHandler *self, int c)
   {
+  if (self->atlas_pixels)
+    {
+    const uint16_t *glyph = fonthandler_atlas_lookup (self, c);
+    if (glyph) return glyph;
+    // Not in the atlas -- return a blank glyph in the background colour,
+    //   which we take from the first pixel of the atlas. 
+    unsigned int len = self->font_width * self->font_height;
+    if (!self->glyph_buffer_565)
+      {
+      self->glyph_buffer_565 = malloc (len * sizeof (uint16_t));
+      for (unsigned int i = 0; i < len; i++)
+        self->glyph_buffer_565[i] = self->atlas_pixels[0];
+      }
+    return self->glyph_buffer_565;
+    }
+
+  if (self->rle_data)
+    {
+    if (!self->glyph_buffer_565)
+      self->glyph_buffer_565 = malloc (self->font_width * self->font_height
+        * sizeof (uint16_t));
+    fonthandler_get_rle_glyph (self, c, NULL, self->glyph_buffer_565);
+    return self->glyph_buffer_565;
+    }
+
   fonthandler_get_glyph (self, c);
   unsigned int len = self->font_width * self->font_height;
   for (unsigned int i = 0; i < len; i++)
@@ -174,6 +410,144 @@ const uint16_t *fonthandler_get_glyph_565 (FontHandler *self, int c)
   return self->glyph_buffer_565;
   }
 
+/* =======================================================================
+  fonthandler_draw_glyph
+ ======================================================================= */
+void fonthandler_draw_glyph (FontHandler *self, WSLCD *wslcd, int c, 
+         unsigned int x, unsigned int y)
+  {
+  if (self->rle_data)
+    {
+    unsigned int len = self->font_width * self->font_height;
+    DisplaySink ds = { self, wslcd };
+    wslcd_begin_window (wslcd, (uint16_t)x, (uint16_t)y, 
+      (uint16_t)self->font_width, (uint16_t)self->font_height);
+    const uint8_t *glyph = fonthandler_rle_lookup (self, c);
+    if (glyph)
+      {
+      RleSink sink = { fonthandler_display_run, 
+        fonthandler_display_literal, &ds };
+      fonthandler_rle_decode (glyph, len, &sink);
+      }
+    else
+      fonthandler_display_run (&ds, 0, len);
+    wslcd_end_window (wslcd);
+    return;
+    }
+
+  const uint16_t *glyph565 = fonthandler_get_glyph_565 (self, c);
+  wslcd_write_window (wslcd, glyph565, (uint16_t)self->font_width, 
+    (uint16_t)self->font_height, (uint16_t)x, (uint16_t)y);
+  }
+
+/* =======================================================================
+  RLE sink for scaled glyphs. Each source pixel is repeated scale times
+    into the row buffer and, when the row is complete, the row is sent
+    to the display scale times.
+ ======================================================================= */
+typedef struct _ScaleSink
+  {
+  const FontHandler *fh;
+  const WSLCD *wslcd;
+  unsigned int scale;
+  unsigned int col;
+  } ScaleSink;
+
+static void fonthandler_scale_pixel (ScaleSink *ss, uint16_t pixel)
+  {
+  uint16_t *p = ss->fh->scale_buffer + ss->col * ss->scale;
+  for (unsigned int k = 0; k < ss->scale; k++)
+    *p++ = pixel;
+  if (++ss->col == ss->fh->font_width)
+    {
+    int len = (int)(ss->fh->font_width * ss->scale);
+    for (unsigned int r = 0; r < ss->scale; r++)
+      wslcd_stream_pixels (ss->wslcd, ss->fh->scale_buffer, len);
+    ss->col = 0;
+    }
+  }
+
+static void fonthandler_scale_run (void *data, unsigned int coverage, 
+         unsigned int n)
+  {
+  ScaleSink *ss = data;
+  for (unsigned int i = 0; i < n; i++)
+    fonthandler_scale_pixel (ss, ss->fh->palette[coverage]);
+  }
+
+static void fonthandler_scale_literal (void *data, const uint8_t *packed, 
+         unsigned int n)
+  {
+  ScaleSink *ss = data;
+  for (unsigned int i = 0; i < n; i++)
+    fonthandler_scale_pixel (ss, 
+      ss->fh->palette[fonthandler_nibble (packed, i)]);
+  }
+
+/* =======================================================================
+  fonthandler_draw_glyph_scaled
+ ======================================================================= */
+void fonthandler_draw_glyph_scaled (FontHandler *self, WSLCD *wslcd, int c, 
+         unsigned int x, unsigned int y, unsigned int scale)
+  {
+  if (scale <= 1)
+    {
+    fonthandler_draw_glyph (self, wslcd, c, x, y);
+    return;
+    }
+
+  if (scale > self->scale_buffer_scale)
+    {
+    free (self->scale_buffer);
+    self->scale_buffer = malloc (self->font_width * scale 
+      * sizeof (uint16_t));
+    self->scale_buffer_scale = scale;
+    }
+
+  unsigned int len = self->font_width * self->font_height;
+  ScaleSink ss = { self, wslcd, scale, 0 };
+  wslcd_begin_window (wslcd, (uint16_t)x, (uint16_t)y, 
+    (uint16_t)(self->font_width * scale), 
+    (uint16_t)(self->font_height * scale));
+  if (self->rle_data)
+    {
+    const uint8_t *glyph = fonthandler_rle_lookup (self, c);
+    if (glyph)
+      {
+      RleSink sink = { fonthandler_scale_run, 
+        fonthandler_scale_literal, &ss };
+      fonthandler_rle_decode (glyph, len, &sink);
+      }
+    else
+      fonthandler_scale_run (&ss, 0, len);
+    }
+  else
+    {
+    const uint16_t *glyph565 = fonthandler_get_glyph_565 (self, c);
+    for (unsigned int i = 0; i < len; i++)
+      fonthandler_scale_pixel (&ss, glyph565[i]);
+    }
+  wslcd_end_window (wslcd);
+  }
+
+/* =======================================================================
+  fonthandler_set_colours
+  The palette interpolates between the background (coverage 0) and the
+    foreground (coverage 15), component by component.
+ ======================================================================= */
+void fonthandler_set_colours (FontHandler *self, uint16_t fg, uint16_t bg)
+  {
+  unsigned int fr = fg >> 11, fg6 = (fg >> 5) & 0x3F, fb = fg & 0x1F;
+  unsigned int br = bg >> 11, bg6 = (bg >> 5) & 0x3F, bb = bg & 0x1F;
+  for (unsigned int i = 0; i < 16; i++)
+    {
+    unsigned int r = (fr * i + br * (15 - i) + 7) / 15;
+    unsigned int g = (fg6 * i + bg6 * (15 - i) + 7) / 15;
+    unsigned int b = (fb * i + bb * (15 - i) + 7) / 15;
+    self->palette[i] = (uint16_t)(r << 11 | g << 5 | b);
+    }
+  }
+
 /* =======================================================================
   fonthandler_get_font_width
  ======================================================================= */
@@ -209,6 +583,42 @@ FontHandler *fonthandler_new (unsigned char *font_data[95],
   return self;
   }
 
+/* =======================================================================
+  fonthandler_new_atlas
+  The glyph buffers are only needed if somebody asks for a glyph that
+    isn't in the atlas, or for intensity values, so we allocate them
+    on demand.
+ ======================================================================= */
+FontHandler *fonthandler_new_atlas (const uint16_t *pixels, 
+     const uint32_t offsets[95], unsigned int font_width, 
+     unsigned int font_height)
+  {
+  FontHandler *self = malloc (sizeof (FontHandler));
+  memset (self, 0, sizeof (FontHandler));
+  self->atlas_pixels = pixels;
+  self->atlas_offsets = offsets;
+  self->font_width = font_width;
+  self->font_height = font_height;
+  return self;
+  }
+
+/* =======================================================================
+  fonthandler_new_rle
+ ======================================================================= */
+FontHandler *fonthandler_new_rle (const uint8_t *data, 
+     const uint32_t offsets[95], unsigned int font_width, 
+     unsigned int font_height)
+  {
+  FontHandler *self = malloc (sizeof (FontHandler));
+  memset (self, 0, sizeof (FontHandler));
+  self->rle_data = data;
+  self->rle_offsets = offsets;
+  self->font_width = font_width;
+  self->font_height = font_height;
+  fonthandler_set_colours (self, 0xFFFF, 0x0000);
+  return self;
+  }
+
 /* =======================================================================
   fonthandler_destroy
  ======================================================================= */
@@ -216,6 +626,7 @@ void fonthandler_destroy (FontHandler *self)
   {
   free (self->glyph_buffer_565);
   free (self->glyph_buffer);
+  free (self->scale_buffer);
   free (self);
   }
 
@@ -0,0 +1,37 @@
+/* =======================================================================
+
+  gfx/framestats.c
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+ ======================================================================= */
+#include <stdio.h>
+#include <gfx/framestats.h>
+
+/* =======================================================================
+  framestats_add
+ ======================================================================= */
+void framestats_add (FrameStats *self, uint32_t us)
+  {
+  self->frames++;
+  self->last_us = us;
+  self->total_us += us;
+  if (us > self->worst_us) self->worst_us = us;
+  }
+
+/* =======================================================================
+  framestats_print
+ ======================================================================= */
+void framestats_print (const FrameStats *self, const char *name,
+       uint32_t budget_us)
+  {
+  printf ("%s frames=%u\n", name, self->frames);
+  if (self->frames == 0) return;
+  unsigned long mean = (unsigned long)(self->total_us / self->frames);
+  printf ("%s last frame=%lu us\n", name, (unsigned long)self->last_us);
+  printf ("%s mean frame=%lu us (%lu.%02lu%% of %lu us)\n", name, mean, 
+    mean * 100 / budget_us, (mean * 10000 / budget_us) % 100, 
+    (unsigned long)budget_us);
+  printf ("%s worst frame=%lu us\n", name, (unsigned long)self->worst_us);
+  }
+
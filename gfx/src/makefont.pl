@@ -4,6 +4,9 @@
 # This utility generates C source and header files containing font data
 # in JPEG format. It uses ImageMagick and xsd.
 #
+# The JPEG fonts can be converted to pre-rendered RGB565 atlases, which
+# are larger but need no decoding, using tools/fontconv. 
+#
 # Copyright (c)2023 Kevin Boone, GPLv3.0
 #
 
@@ -181,8 +181,15 @@ static uint8 gValidQuantTables;
 static uint8 gTemFlag;
 #define PJPG_MAX_IN_BUF_SIZE 256
 static uint8 gInBuf[PJPG_MAX_IN_BUF_SIZE];
-static uint8 gInBufOfs;
-static uint8 gInBufLeft;
+// The next byte to decode, which is in gInBuf, or in the caller's buffer if 
+// the input comes from a pointer callback.
+static const uint8 *gInPtr;
+static uint16 gInBufLeft;
+static uint8 gInOwned; // gInPtr points into gInBuf
+// While chars that were stuffed back are read from gInBuf, the rest of the 
+// caller's buffer.
+static const uint8 *gSavedPtr;
+static uint16 gSavedLeft;
 
 static uint16 gBitBuf;
 static uint8 gBitsLeft;
@@ -217,6 +224,7 @@ static uint16 gNumMCUSRemainingX, gNumMCUSRemainingY;
 static uint8 gMCUOrg[6];
 
 static pjpeg_need_bytes_callback_t g_pNeedBytesCallback;
+static pjpeg_need_bytes_ptr_callback_t g_pNeedBytesPtrCallback;
 static void *g_pCallback_data;
 static uint8 gCallbackStatus;
 static uint8 gReduce;
@@ -225,11 +233,35 @@ static void fillInBuf(void)
 {
    unsigned char status;
 
-   // Reserve a few bytes at the beginning of the buffer for putting back ("stuffing") chars.
-   gInBufOfs = 4;
-   gInBufLeft = 0;
+   if (gSavedPtr)
+   {
+      // Go back to the caller's buffer, after the stuffed chars
+      gInPtr = gSavedPtr;
+      gInBufLeft = gSavedLeft;
+      gInOwned = 0;
+      gSavedPtr = (const uint8 *)0;
+      if (gInBufLeft)
+         return;
+   }
+
+   if (g_pNeedBytesPtrCallback)
+   {
+      // Decode straight from the caller's buffer
+      gInBufLeft = 0;
+      gInOwned = 0;
+      status = (*g_pNeedBytesPtrCallback)(&gInPtr, &gInBufLeft, g_pCallback_data);
+   }
+   else
+   {
+      uint8 n = 0;
+      
+      // Reserve a few bytes at the beginning of the buffer for putting back ("stuffing") chars.
+      gInPtr = gInBuf + 4;
+      gInOwned = 1;
 
-   status = (*g_pNeedBytesCallback)(gInBuf + gInBufOfs, PJPG_MAX_IN_BUF_SIZE - gInBufOfs, &gInBufLeft, g_pCallback_data);
+      status = (*g_pNeedBytesCallback)(gInBuf + 4, PJPG_MAX_IN_BUF_SIZE - 4, &n, g_pCallback_data);
+      gInBufLeft = n;
+   }
    if (status)
    {
       // The user provided need bytes callback has indicated an error, so record the error and continue trying to decode.
@@ -251,13 +283,23 @@ static PJPG_INLINE uint8 getChar(void)
    }
    
    gInBufLeft--;
-   return gInBuf[gInBufOfs++];
+   return *gInPtr++;
 }
 //------------------------------------------------------------------------------
 static PJPG_INLINE void stuffChar(uint8 i)
 {
-   gInBufOfs--;
-   gInBuf[gInBufOfs] = i;
+   if (!gInOwned)
+   {
+      // The caller's buffer can't be written, so the stuffed chars go at the 
+      // end of ours, and we come back to the caller's when they are used up.
+      gSavedPtr = gInPtr;
+      gSavedLeft = gInBufLeft;
+      gInPtr = gInBuf + PJPG_MAX_IN_BUF_SIZE;
+      gInBufLeft = 0;
+      gInOwned = 1;
+   }
+   gInPtr--;
+   gInBuf[gInPtr - gInBuf] = i;
    gInBufLeft++;
 }
 //------------------------------------------------------------------------------
@@ -954,8 +996,11 @@ static uint8 init(void)
    gValidHuffTables = 0;
    gValidQuantTables = 0;
    gTemFlag = 0;
-   gInBufOfs = 0;
+   gInPtr = gInBuf;
    gInBufLeft = 0;
+   gInOwned = 1;
+   gSavedPtr = (const uint8 *)0;
+   gSavedLeft = 0;
    gBitBuf = 0;
    gBitsLeft = 8;
 
@@ -2284,7 +2329,22 @@ unsigned char pjpeg_decode_mcu(void)
    return 0;
 }
 //------------------------------------------------------------------------------
+static unsigned char decodeInit(pjpeg_image_info_t *pInfo, void *pCallback_data, unsigned char reduce);
 unsigned char pjpeg_decode_init(pjpeg_image_info_t *pInfo, pjpeg_need_bytes_callback_t pNeed_bytes_callback, void *pCallback_data, unsigned char reduce)
+{
+   g_pNeedBytesCallback = pNeed_bytes_callback;
+   g_pNeedBytesPtrCallback = (pjpeg_need_bytes_ptr_callback_t)0;
+   return decodeInit(pInfo, pCallback_data, reduce);
+}
+//------------------------------------------------------------------------------
+unsigned char pjpeg_decode_init_ptr(pjpeg_image_info_t *pInfo, pjpeg_need_bytes_ptr_callback_t pNeed_bytes_ptr_callback, void *pCallback_data, unsigned char reduce)
+{
+   g_pNeedBytesCallback = (pjpeg_need_bytes_callback_t)0;
+   g_pNeedBytesPtrCallback = pNeed_bytes_ptr_callback;
+   return decodeInit(pInfo, pCallback_data, reduce);
+}
+//------------------------------------------------------------------------------
+static unsigned char decodeInit(pjpeg_image_info_t *pInfo, void *pCallback_data, unsigned char reduce)
 {
    uint8 status;
    
@@ -2294,7 +2354,6 @@ unsigned char pjpeg_decode_init(pjpeg_image_info_t *pInfo, pjpeg_need_bytes_call
    pInfo->m_MCUWidth = 0; pInfo->m_MCUHeight = 0;
    pInfo->m_pMCUBufR = (unsigned char*)0; pInfo->m_pMCUBufG = (unsigned char*)0; pInfo->m_pMCUBufB = (unsigned char*)0;
 
-   g_pNeedBytesCallback = pNeed_bytes_callback;
    g_pCallback_data = pCallback_data;
    gCallbackStatus = 0;
    gReduce = reduce;
@@ -16,13 +16,18 @@
 #include <ds3231/ds3231.h>
 #include <waveshare_lcd/waveshare_lcd.h>
 #include <files/files.h>
+#include <files/catalog.h>
 #include <sdcard/sdcard.h>
+#include <fsintf/diskcache.h>
 #include <gfx/gfxconsole.h>
 #include <gfx/clock.h>
+#include <gfx/framestats.h>
 #include <screens/photoclock.h>
+#include <screens/bigclock.h>
 #include <screens/settings.h>
 #include <klib/list.h>
 #include <log/log.h>
+#include <sched/sched.h>
 
 #if PICO_ON_DEVICE
 #include <hardware/i2c.h>
@@ -31,58 +36,200 @@
 #include "version.h"
 
 PhotoClock *photoclock = NULL;
-List *file_list;
+BigClock *bigclock = NULL;
+Sched *sched = NULL;
+DisplayMode display_mode = DISPLAY_MODE_PHOTO;
+Catalog *catalog;
+
+// Timers and event sources in the scheduler
+static int tick_timer = -1;
+static int tock_timer = -1;
+static int rtc_source = -1;
+static int rtc_watchdog_timer = -1;
+// True if the DS3231 interrupt is driving the clock
+static bool rtc_interrupts = false;
+
+// The longest command line 
+#define CMD_MAX_LINE 128
+
+// Everything the command interpreter needs, and the line being read
+typedef struct _CmdContext
+  {
+  GfxConsole *gfxconsole;
+  DS3231 *ds3231;
+  WSLCD *wslcd;
+  SDCard *sdcard;
+  const Settings *settings;
+  char line[CMD_MAX_LINE + 1];
+  unsigned int len;
+  } CmdContext;
 
 /* =======================================================================
   tick 
-  Called by the input handler at one-second intervals
+  Called by the scheduler at one-second intervals
  ======================================================================= */
-void tick (PhotoClock *photoclock)
+static void tick (void *data)
   {
-  photoclock_tick (photoclock);
+  (void)data;
+  if (display_mode == DISPLAY_MODE_BIGCLOCK)
+    bigclock_tick (bigclock);
+  else
+    photoclock_tick (photoclock);
   }
 
 /* =======================================================================
-   readline() is a crude function to read a line of text. The Pico SDK 
-     seems to implement gets(), etc., but they don't work for me. 
+  tock 
+  Called by the scheduler at the start of each minute, which is when
+    the photo changes, if it's time to change it.
  ======================================================================= */
-static char _getchar (PhotoClock *photoclock)
+static void tock (void *data)
   {
-  int c;
-  int jiffies = 0;
-  while ((c = getchar_timeout_us (0)) < 0) 
+  (void)data;
+  if (display_mode == DISPLAY_MODE_PHOTO)
+    photoclock_tock (photoclock);
+  }
+
+/* =======================================================================
+  schedule_tock 
+  (Re)start the once-a-minute timer, so that it fires just after the
+    RTC's minute changes.
+ ======================================================================= */
+static void schedule_tock (const DS3231 *ds3231)
+  {
+  if (rtc_interrupts) return; // The RTC tells us when the minute changes
+  int dummy, sec = 0;
+  ds3231_get_datetime (ds3231, &dummy, &dummy, &dummy, &dummy, &dummy, 
+    &sec);
+  if (sec < 0 || sec > 59) sec = 0;
+  sched_cancel_timer (sched, tock_timer);
+  tock_timer = sched_add_timer (sched, 
+    time_us_64() + (uint64_t)(60 - sec) * 1000000, 60 * 1000000, 
+    tock, NULL);
+  }
+
+/* =======================================================================
+  start_tick_timer 
+  (Re)start the once-a-second timer, one second from now
+ ======================================================================= */
+static void start_tick_timer (void)
+  {
+  sched_cancel_timer (sched, tick_timer);
+  tick_timer = sched_add_timer (sched, time_us_64() + 1000000, 1000000, 
+    tick, NULL);
+  }
+
+/* =======================================================================
+  rtc_interrupt
+  Called in interrupt context by the DS3231 driver
+ ======================================================================= */
+static void rtc_interrupt (void *data)
+  {
+  (void)data;
+  sched_signal (rtc_source);
+  }
+
+/* =======================================================================
+  rtc_event
+  Called by the scheduler after an interrupt from the DS3231, at the
+    start of each second or each minute, depending on CLOCK_INT_MODE
+ ======================================================================= */
+static void rtc_event (void *data)
+  {
+  DS3231 *ds3231 = data;
+  ds3231_service (ds3231);
+  if (CLOCK_INT_MODE == DS3231_INT_SQW_1HZ)
     {
-    sleep_ms (10);
-    //printf ("gpio=%d\n", gpio_get (WSLCD_TP_INT));
-    jiffies++;
-    if (jiffies == 100)
-      {
-      tick (photoclock);
-      jiffies = 0;
-      }
+    int dummy, sec;
+    ds3231_get_datetime (ds3231, &dummy, &dummy, &dummy, &dummy, &dummy, 
+      &sec);
+    if (sec == 0) tock (NULL);
+    tick (NULL);
+    }
+  else
+    {
+    // The seconds still come from the timer, but start them again in 
+    //   step with the minute
+    tock (NULL);
+    tick (NULL);
+    start_tick_timer ();
     }
-  return (char)c;
   }
 
-static char *readline (char *str, unsigned int L, PhotoClock *photoclock)
+/* =======================================================================
+  rtc_watchdog
+  If the interrupts stop -- or never start, because the INT/SQW pin
+    isn't connected -- go back to using the Pico's timer.
+ ======================================================================= */
+static void rtc_watchdog (void *data)
   {
-#if PICO_ON_DEVICE
-  int eol = '\r';
-#else
-  int eol = '\n';
-#endif
-  char u, *p;
-  for (p = str, u = _getchar (photoclock); 
-         u != eol && p-str < L; 
-         u = _getchar (photoclock)) 
+  static unsigned int last_interrupts = 0;
+  DS3231 *ds3231 = data;
+  DS3231Stats stats;
+  ds3231_get_stats (ds3231, &stats);
+  if (stats.interrupts == last_interrupts)
     {
-    *p++ = u;
-#if PICO_ON_DEVICE
-    putchar (u);
-#endif
+    printf ("No interrupts from the RTC; using the timer\n");
+    ds3231_enable_interrupt (ds3231, CLOCK_INT_GPIO, DS3231_INT_NONE, 
+      0, NULL, NULL);
+    rtc_interrupts = false;
+    sched_cancel_timer (sched, rtc_watchdog_timer);
+    start_tick_timer ();
+    schedule_tock (ds3231);
     }
-  *p = 0;  
-  return str;
+  last_interrupts = stats.interrupts;
+  }
+
+/* =======================================================================
+  start_clock
+  Start the tick and tock, from the DS3231 interrupt if CLOCK_INT_GPIO is
+    set and it works, or from the Pico's timer if not.
+ ======================================================================= */
+static void start_clock (DS3231 *ds3231)
+  {
+  if (CLOCK_INT_GPIO >= 0)
+    {
+    rtc_source = sched_add_source (sched, rtc_event, ds3231);
+    if (ds3231_enable_interrupt (ds3231, CLOCK_INT_GPIO, CLOCK_INT_MODE, 
+         CLOCK_RESYNC_SECS, rtc_interrupt, NULL) == 0)
+      {
+      rtc_interrupts = true;
+      uint32_t period = CLOCK_INT_MODE == DS3231_INT_SQW_1HZ ? 
+        5 * 1000000 : 65 * 1000000;
+      rtc_watchdog_timer = sched_add_timer (sched, time_us_64() + period, 
+        period, rtc_watchdog, ds3231);
+      }
+    }
+  if (!rtc_interrupts || CLOCK_INT_MODE == DS3231_INT_ALARM_MINUTE)
+    start_tick_timer ();
+  schedule_tock (ds3231);
+  }
+
+/* =======================================================================
+  idle
+  Called by the scheduler when there's nothing else to do. Draws the 
+    background photo, a slice at a time. 
+ ======================================================================= */
+static bool idle (void *data)
+  {
+  (void)data;
+  if (display_mode == DISPLAY_MODE_PHOTO 
+       && photoclock_render (photoclock, RENDER_SLICE_US))
+    return true;
+  // Look for more photos only when there's nothing else to do
+  return catalog_step (catalog, CATALOG_SLICE_US);
+  }
+
+/* =======================================================================
+  set_display_mode 
+  Switch to the specified screen, and draw it completely
+ ======================================================================= */
+static void set_display_mode (DisplayMode mode)
+  {
+  display_mode = mode;
+  if (display_mode == DISPLAY_MODE_BIGCLOCK)
+    bigclock_draw_all (bigclock);
+  else
+    photoclock_draw_all (photoclock);
   }
 
 /* =======================================================================
@@ -97,108 +244,311 @@ static void help (void)
   printf 
   ("help             -- show this\n");
   printf 
+  ("index            -- show progress of the search for photos\n");
+  printf 
+  ("jpegcopy {on|off} -- copy JPEG data to the decoder, or decode in place\n");
+  printf 
   ("list             -- list discovered filenames\n");
   printf 
+  ("mode [photo|bigclock] -- show or change the display mode\n");
+  printf 
   ("next             -- show next background in list\n");
   printf 
+  ("preview {on|off} -- draw photos' EXIF thumbnails while decoding\n");
+  printf 
+  ("sdcrc {hw|sw}    -- calculate SD CRCs by DMA sniffer or software\n");
+  printf 
+  ("sdinfo           -- show SD card mode and clock rate\n");
+  printf 
   ("show {filename}  -- show the image file (from 'list')\n");
   printf 
+  ("stats            -- show display timings\n");
+  printf 
   ("version          -- show program version\n");
   }
  
 /* =======================================================================
-  cmd_loop 
+  cmd_execute
  ======================================================================= */
-void cmd_loop (PhotoClock *photoclock, GfxConsole *gfxconsole, 
-        DS3231 *ds3231, WSLCD *wslcd, const Settings *settings)
+static void cmd_execute (const CmdContext *ctx, const char *str)
   {
-  bool stop = false;
-  const int L = 128;
-  char str[L + 1];
-  while (!stop)
+  DS3231 *ds3231 = ctx->ds3231;
+  const Settings *settings = ctx->settings;
+  if (strncmp (str, "set ", 4) == 0)
     {
-    printf ("> ");
-    readline (str, L, photoclock);
-    printf ("\n");
-    if (strncmp (str, "set ", 4) == 0)
-      {
-      // If the user enters 'set xxx...', read six numbers and use them
-      //   to set the date and time on the DS3231
-      int year, month, day, hour, min, sec;
-      if (sscanf (str + 4, "%d %d %d %d %d %d", 
-          &year, &month, &day, &hour, &min, &sec) == 6)
-        {
-        int ret = ds3231_set_datetime (ds3231, year, month, day, 
-           hour, min, sec);
-        if (ret != 0)
-          printf ("Failed to set date: %s\n", strerror (ret));
-        photoclock_draw_all (photoclock);
-        }
-      else
-        {
-        printf ("Enter six numbers: "
-                 "year month day hour min sec\n");
-        }
-      }
-    else if (strncmp (str, "get", 3) == 0)
-      {
-      // If the user enter 'get', print the current date, time, and
-      //   temperature from the DS3231.
-      int year, month, day, hour, min, sec;
-      ds3231_get_datetime (ds3231, &year, &month, &day, &hour, &min, &sec);
-      printf ("%d-%d-%d %02d:%02d:%02d\n", year, month, day,
-        hour, min, sec);
-      int t = ds3231_get_temp (ds3231);
-      // Temperature is in 'millicelcius', so we must divide by 1000
-      printf ("temp=%g deg. C\n", t / 1000.0);
-      }
-    else if (strncmp (str, "show ", 5) == 0)
+    // If the user enters 'set xxx...', read six numbers and use them
+    //   to set the date and time on the DS3231
+    int year, month, day, hour, min, sec;
+    if (sscanf (str + 4, "%d %d %d %d %d %d", 
+        &year, &month, &day, &hour, &min, &sec) == 6)
       {
-      files_show_jpeg (gfxconsole, wslcd, str + 5);
+      int ret = ds3231_set_datetime (ds3231, year, month, day, 
+         hour, min, sec);
+      if (ret != 0)
+        printf ("Failed to set date: %s\n", strerror (ret));
+      set_display_mode (display_mode);
+      schedule_tock (ds3231);
       }
-    else if (strncmp (str, "next", 4) == 0)
+    else
       {
-      photoclock_draw_next_background (photoclock);
+      printf ("Enter six numbers: "
+               "year month day hour min sec\n");
       }
-    else if (strncmp (str, "list", 4) == 0)
-      {
-      for (int i = 0; i < list_length (file_list); i++)
+    }
+  else if (strncmp (str, "get", 3) == 0)
+    {
+    // If the user enter 'get', print the current date, time, and
+    //   temperature from the DS3231.
+    int year, month, day, hour, min, sec;
+    ds3231_get_datetime (ds3231, &year, &month, &day, &hour, &min, &sec);
+    printf ("%d-%d-%d %02d:%02d:%02d\n", year, month, day,
+      hour, min, sec);
+    int t = ds3231_get_temp (ds3231);
+    // Temperature is in 'millicelcius', so we must divide by 1000
+    printf ("temp=%g deg. C\n", t / 1000.0);
+    }
+  else if (strncmp (str, "show ", 5) == 0)
+    {
+    display_mode = DISPLAY_MODE_PHOTO;
+    photoclock_show_file (photoclock, str + 5);
+    }
+  else if (strncmp (str, "next", 4) == 0)
+    {
+    photoclock_draw_next_background (photoclock);
+    }
+  else if (strncmp (str, "list", 4) == 0)
+    {
+    char file[CATALOG_MAX_PATH];
+    for (unsigned int i = 0; i < catalog_count (catalog); i++)
 	{
-	const char *file = list_get (file_list, i);
-	printf ("file: %s\n", file);
+	CatalogInfo info;
+	CatalogExtent extent;
+	if (catalog_get_photo (catalog, i, file, sizeof (file), &extent) != 0) 
+	  continue;
+	catalog_get_info (catalog, i, &info);
+	if (extent.size)
+	  printf ("file: %s @%lu", file, (unsigned long)extent.offset);
+	else
+	  printf ("file: %s", file);
+	if (info.width)
+	  printf (" %ux%u", info.width, info.height);
+	if (info.thumb_len)
+	  printf (" thumbnail");
+	printf ("\n");
 	}
-      }
-    else if (strncmp (str, "version", 7) == 0)
+    }
+  else if (strncmp (str, "index", 5) == 0)
+    {
+    CatalogProgress p;
+    catalog_get_progress (catalog, &p);
+    printf ("photos=%u, skipped=%u, can't show=%u, packs=%u\n", p.photos, 
+      p.skipped, p.unsupported, p.packs);
+    unsigned int checked = p.photos + p.unsupported;
+    if (checked)
+      printf ("header bytes read=%lu, %lu per file\n", 
+        (unsigned long)p.header_bytes, 
+        (unsigned long)(p.header_bytes / checked));
+    printf ("directories scanned=%u, waiting=%u\n", p.dirs_scanned, 
+      p.dirs_pending);
+    printf ("scan time=%lu ms, %s\n", (unsigned long)(p.scan_us / 1000),
+      p.done ? "complete" : "in progress");
+    const char *dir = catalog_get_scanning (catalog);
+    if (dir) printf ("scanning %s\n", dir);
+    printf ("index memory=%lu bytes\n", (unsigned long)p.index_bytes);
+    framestats_print (&p.lookups, "name lookup", 1000000);
+    printf ("lookups that searched the directory=%u\n", p.searches);
+    }
+  else if (strncmp (str, "mode", 4) == 0)
+    {
+    if (str[4] == ' ')
       {
-      printf (PROG_NAME " version %d.%d.%d\n", VERSION_MAJOR, VERSION_MINOR,
-         VERSION_MICRO);
-      printf ("Copyright (c)2023 Kevin Boone\n");
-      printf ("Released under the terms of the GNU Public Licence, v3.0\n");
+      DisplayMode mode;
+      if (settings_parse_display_mode (str + 5, &mode) == 0)
+        set_display_mode (mode);
+      else
+        printf ("Modes are 'photo' and 'bigclock'\n");
       }
-    else if (strncmp (str, "settings", 8) == 0)
+    printf ("mode=%s\n", settings_display_mode_name (display_mode));
+    }
+  else if (strncmp (str, "stats", 5) == 0)
+    {
+    framestats_print (photoclock_get_clock_stats (photoclock), "clock", 
+      1000000);
+    framestats_print (bigclock_get_stats (bigclock), "bigclock", 1000000);
+    unsigned int hits, misses;
+    photoclock_get_prefetch_stats (photoclock, &hits, &misses);
+    printf ("prefetch hits=%u, misses=%u\n", hits, misses);
+    printf ("jpeg input=%s\n", files_get_zero_copy () ? "in place" : "copied");
+    framestats_print (files_get_decode_stats (false), "photo from card",
+      1000000);
+    framestats_print (files_get_decode_stats (true), "photo from memory",
+      1000000);
+    printf ("thumbnail preview=%s\n", files_get_preview () ? "on" : "off");
+    framestats_print (files_get_preview_stats (), "photo preview", 1000000);
+    unsigned int contiguous, fragmented;
+    files_get_layout_stats (&contiguous, &fragmented);
+    printf ("photo files contiguous=%u, fragmented=%u\n", contiguous,
+      fragmented);
+    DiskCache *dc = disk_get_cache ();
+    if (dc)
       {
-/*
-    int error = settings_from_file (&settings, SETTINGS_FILE);
-    if (error)
+      const DiskCacheStats *ds = diskcache_get_stats (dc);
+      printf ("sector cache metadata hits=%u, misses=%u; "
+        "data hits=%u, misses=%u; uncached=%u\n", ds->meta_hits, 
+        ds->meta_misses, ds->data_hits, ds->data_misses, ds->uncached);
+      }
+    const FrameCacheStats *fc = photoclock_get_frame_cache_stats (photoclock);
+    if (fc)
+      printf ("frame cache hits=%u, misses=%u, writes=%u, evictions=%u, "
+        "frames=%u\n", fc->hits, fc->misses, fc->writes, fc->evictions,
+        fc->frames);
+    const FlashCacheStats *xc = photoclock_get_flash_cache_stats (photoclock);
+    if (xc)
+      printf ("flash cache hits=%u, misses=%u, writes=%u, evictions=%u, "
+        "photos=%u, %lu of %lu kB, sectors erased=%u, most erases=%u\n", 
+        xc->hits, xc->misses, xc->writes, xc->evictions, xc->photos, 
+        (unsigned long)(xc->used_bytes / 1024), 
+        (unsigned long)(xc->size_bytes / 1024), xc->erases, 
+        xc->most_erases);
+    DS3231Stats rtc_stats;
+    ds3231_get_stats (ds3231, &rtc_stats);
+    printf ("rtc interrupts=%s\n", rtc_interrupts ? "on" : "off");
+    printf ("rtc interrupt count=%u\n", rtc_stats.interrupts);
+    printf ("rtc resyncs=%u, last drift=%d s\n", rtc_stats.resyncs, 
+      rtc_stats.last_drift);
+    }
+  else if (strncmp (str, "sdinfo", 6) == 0)
+    {
+    SDCardInfo info;
+    sdcard_get_info (ctx->sdcard, &info);
+    printf ("type=%s\n", sdcard_type_to_string (info.type));
+    printf ("sectors=%llu\n", (unsigned long long)info.sectors);
+    printf ("mode=%s\n", info.high_speed ? "high-speed" : "default");
+    printf ("clock=%d Hz (requested %d Hz)\n", info.actual_baud_rate, 
+      info.baud_rate);
+    printf ("fallbacks=%u, crc errors=%u, timeouts=%u\n", info.fallbacks,
+      info.crc_errors, info.timeouts);
+    printf ("crc=%s, %u blocks (%u by sniffer), %lu us/block\n",
+      info.hw_crc ? "sniffer" : "software", info.crc_blocks, 
+      info.crc_hw_blocks, info.crc_blocks 
+        ? (unsigned long)(info.crc_us / info.crc_blocks) : 0UL);
+#if PICO_ON_DEVICE
+#else
+    SDEmu *emu = sdcard_get_emulator (ctx->sdcard);
+    if (emu)
       {
-      log_write (gfxconsole, "Couldn't read settings file: %sn", strerror (error)); 
+      const SDEmuStats *es = sdemu_get_stats (emu);
+      printf ("emulator: %u commands, %u sectors read, %u written, "
+        "%u faults\n", es->commands, es->sectors_read, es->sectors_written,
+        es->faults);
+      printf ("emulator: %llu bytes (%llu busy), %llu ms on the bus\n",
+        (unsigned long long)es->bytes, (unsigned long long)es->busy_bytes,
+        (unsigned long long)(es->bus_us / 1000));
       }
+#endif
+    }
+  else if (strncmp (str, "sdcrc ", 6) == 0)
+    {
+    // Switch between calculating SD CRCs in hardware and software,
+    //   so the timings in 'sdinfo' can be compared
+    if (strcmp (str + 6, "hw") == 0)
+      sdcard_set_hw_crc (ctx->sdcard, true);
+    else if (strcmp (str + 6, "sw") == 0)
+      sdcard_set_hw_crc (ctx->sdcard, false);
+    else
+      printf ("Enter 'sdcrc hw' or 'sdcrc sw'\n");
+    }
+  else if (strncmp (str, "jpegcopy ", 9) == 0)
+    {
+    // Switch between decoding JPEG data in place and copying it
+    //   first, so the decoding times in 'stats' can be compared
+    if (strcmp (str + 9, "on") == 0)
+      files_set_zero_copy (false);
+    else if (strcmp (str + 9, "off") == 0)
+      files_set_zero_copy (true);
+    else
+      printf ("Enter 'jpegcopy on' or 'jpegcopy off'\n");
+    }
+  else if (strncmp (str, "preview ", 8) == 0)
+    {
+    if (strcmp (str + 8, "on") == 0)
+      files_set_preview (true);
+    else if (strcmp (str + 8, "off") == 0)
+      files_set_preview (false);
+    else
+      printf ("Enter 'preview on' or 'preview off'\n");
     }
+  else if (strncmp (str, "version", 7) == 0)
+    {
+    printf (PROG_NAME " version %d.%d.%d\n", VERSION_MAJOR, VERSION_MINOR,
+       VERSION_MICRO);
+    printf ("Copyright (c)2023 Kevin Boone\n");
+    printf ("Released under the terms of the GNU Public Licence, v3.0\n");
+    }
+  else if (strncmp (str, "settings", 8) == 0)
+    {
+/*
+  int error = settings_from_file (&settings, SETTINGS_FILE);
+  if (error)
+    {
+    log_write (gfxconsole, "Couldn't read settings file: %sn", strerror (error)); 
+    }
+  }
 */
-    printf ("clock_x=%d\n", settings->clock_x);
-    printf ("clock_y=%d\n", settings->clock_y);
-    printf ("mins_per_background_change=%d\n", settings->mins_per_background_change);
-      }
-    else if (strncmp (str, "quit", 4) == 0)
+  printf ("clock_x=%d\n", settings->clock_x);
+  printf ("clock_y=%d\n", settings->clock_y);
+  printf ("mins_per_background_change=%d\n", settings->mins_per_background_change);
+  printf ("show_seconds=%d\n", settings->show_seconds);
+  printf ("prefetch_max_kb=%d\n", settings->prefetch_max_kb);
+  printf ("frame_cache_max=%d\n", settings->frame_cache_max);
+  printf ("flash_cache_max=%d\n", settings->flash_cache_max);
+  printf ("display_mode=%s\n", 
+    settings_display_mode_name (settings->display_mode));
+    }
+  else if (strncmp (str, "quit", 4) == 0)
+    {
+    sched_stop (sched);
+    }
+  else if (strncmp (str, "help", 4) == 0)
+    {
+    help();
+    }
+  else
+    printf ("Enter 'help' for commands\n");
+  }
+
+/* =======================================================================
+  input_ready
+  Called by the scheduler when there is input on stdin. Collects 
+    characters into a line, and executes it when the end-of-line 
+    arrives. Characters beyond the end of the buffer are dropped.
+ ======================================================================= */
+static void input_ready (void *data)
+  {
+  CmdContext *ctx = data;
+#if PICO_ON_DEVICE
+  int eol = '\r';
+#else
+  int eol = '\n';
+#endif
+  int c;
+  while ((c = getchar_timeout_us (0)) >= 0) 
+    {
+    if (c == eol)
       {
-      stop = true;
+      ctx->line[ctx->len] = 0;
+      printf ("\n");
+      cmd_execute (ctx, ctx->line);
+      ctx->len = 0;
+      printf ("> ");
       }
-    else if (strncmp (str, "help", 4) == 0)
+    else if (ctx->len < CMD_MAX_LINE)
       {
-      help();
+      ctx->line[ctx->len++] = (char)c;
+#if PICO_ON_DEVICE
+      putchar (c);
+#endif
       }
-    else
-      printf ("Enter 'help' for commands\n");
     }
   }
 
@@ -210,7 +560,7 @@ int main ()
   gpio_init (WSLCD_TP_INT);
   gpio_set_dir (WSLCD_TP_INT, GPIO_IN);
 
-  file_list = list_create (free);
+  catalog = catalog_new (JPEG_DIR, JPEG_PATTERN, PACK_PATTERN);
 
   stdio_init_all();
 
@@ -236,11 +586,35 @@ int main ()
   settings.mins_per_background_change = DEFAULT_MINS_PER_PHOTO;
   settings.clock_x = CLOCK_DEFAULT_X;
   settings.clock_y = CLOCK_DEFAULT_Y;
+  settings.display_mode = DISPLAY_MODE_PHOTO;
+  settings.show_seconds = 0;
+  settings.prefetch_max_kb = PREFETCH_MAX_KB;
+  settings.frame_cache_max = FRAME_CACHE_MAX_FRAMES;
+  settings.flash_cache_max = FLASH_CACHE_MAX_PHOTOS;
  
   // Initialze the SD card. Do this last, because it's the most likely
   //   to fail, and we want to see any error message.
   SDCard *sdcard = sdcard_new (SD_SPI, SD_DRIVE_STRENGTH, SD_CHIP_SELECT, 
    SD_MISO, SD_MOSI, SD_SCK, SD_BAUD);
+  sdcard_set_high_speed_baud (sdcard, SD_HIGH_SPEED_BAUD);
+  sdcard_set_hw_crc (sdcard, SD_HW_CRC);
+#if PICO_ON_DEVICE
+#else
+  if (HOST_SD_EMULATOR)
+    {
+    SDEmuConfig emu_config;
+    sdemu_config_defaults (&emu_config);
+    if (sdemu_config_parse (&emu_config, getenv ("PPC_SDEMU")) != 0)
+      log_write (gfxconsole, "Can't understand PPC_SDEMU\n");
+    const char *image = getenv ("PPC_SDIMAGE");
+    if (!image || !*image) image = HOST_SD_IMAGE;
+    SDEmu *emu = sdemu_new (image, &emu_config);
+    if (emu)
+      sdcard_attach_emulator (sdcard, emu);
+    else
+      log_write (gfxconsole, "Can't open %s\n", image);
+    }
+#endif
 
   sdcard_init (sdcard);
   SDError sderr = sdcard_insert_card (sdcard);
@@ -250,11 +624,17 @@ int main ()
     int ret = files_mount ();
     if (ret == 0)
       {
-      // Assuming that the SD initializes, get a list of matching
-      //   photo files into file_list.
-      log_write (gfxconsole, "Listing files... ");
-      files_list_dir (JPEG_DIR, JPEG_PATTERN, file_list);
-      log_write (gfxconsole, "found %d\n", list_length (file_list));
+      // Find the first few photos now, so there's something to show.
+      //   The rest are found in idle time, once the clock is running.
+      log_write (gfxconsole, "Finding photos... ");
+      CatalogProgress progress;
+      do
+        {
+        catalog_step (catalog, CATALOG_SLICE_US);
+        catalog_get_progress (catalog, &progress);
+        } while (!progress.done && progress.photos < CATALOG_START_PHOTOS);
+      log_write (gfxconsole, "found %u%s\n", progress.photos, 
+        progress.done ? "" : " so far");
       }
     else
       {
@@ -281,21 +661,36 @@ int main ()
   printf ("clock_y= %d\n", settings.clock_y);
   printf ("mins_per_background_change = %d\n", settings.mins_per_background_change);
 
-  // Create the main display, and draw it
-  photoclock = photoclock_new (&settings, wslcd, ds3231, file_list, gfxconsole);
-  photoclock_draw_all (photoclock);
+  // Create the displays, and draw the one selected in the settings
+  photoclock = photoclock_new (&settings, wslcd, ds3231, catalog, gfxconsole);
+  bigclock = bigclock_new (wslcd, ds3231);
+  set_display_mode (settings.display_mode);
 
-  // Process commands.
-  cmd_loop (photoclock, gfxconsole, ds3231, wslcd, &settings);
+  // Run the clock, and process commands, until 'quit'
+  sched = sched_new ();
+  CmdContext ctx;
+  memset (&ctx, 0, sizeof (ctx));
+  ctx.gfxconsole = gfxconsole;
+  ctx.ds3231 = ds3231;
+  ctx.wslcd = wslcd;
+  ctx.sdcard = sdcard;
+  ctx.settings = &settings;
+  sched_set_input (sched, input_ready, &ctx);
+  sched_set_idle (sched, idle, NULL);
+  start_clock (ds3231);
+  printf ("> ");
+  sched_run (sched);
 
   // In the Pico version, we never get here. But clean up anyway, so we
   //   can check for memory leaks in a Linux build.
   if (photoclock) photoclock_destroy (photoclock);
+  if (bigclock) bigclock_destroy (bigclock);
+  sched_destroy (sched);
   sdcard_destroy (sdcard);
   gfxconsole_destroy (gfxconsole);
   wslcd_destroy (wslcd);
   ds3231_destroy (ds3231);
-  if (file_list) list_destroy (file_list);
+  if (catalog) catalog_destroy (catalog);
   }
 
 
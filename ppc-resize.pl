@@ -8,8 +8,10 @@
 #   displayed on pico-photo-clock. The converted files are written to the
 #   specified directory -- which must exist -- keeping their original
 #   names.
-# Only files in landscape orientation are converted, unless 'keep_portrait'
-#   is set to non-zero. 
+# Files in portrait orientation are sized to 320x480, and the display rotates
+#   them (see PORTRAIT_ROTATION in config.h). Set 'keep_portrait' to zero
+#   to skip them instead. Images are auto-oriented first, so the camera's
+#   EXIF orientation is already applied to the pixels. 
 #
 # Copyright (c)2023 Kevin Boone, GPL v3.0
 
@@ -17,7 +19,7 @@ use strict;
 use File::Basename;
 
 my $argc = scalar (@ARGV);
-my $keep_portrait = 0;
+my $keep_portrait = 1;
 
 if ($argc < 2)
   {
@@ -37,15 +39,19 @@ for (my $i = 0; $i < $argc - 1; $i++)
   {
   my $arg = $ARGV[$i];
   my ($filename, $dir, $dummy) = fileparse ($arg, ""); 
-  my $fileinfo = `file \"$arg\"`;
-  $fileinfo =~ /, (\d+)x(\d+)/;
+  # Ask ImageMagick for the size, rather than 'file', because we need it after
+  #   the EXIF orientation has been applied
+  my $fileinfo = `convert \"$arg\" -auto-orient -format "%wx%h" info:`;
+  $fileinfo =~ /(\d+)x(\d+)/;
   my $width=$1;
   my $height=$2;
   if (($width > $height) or $keep_portrait)
     {
     printf ("${filename} is %dx%d\n", $width, $height);
+    my $size = ($width > $height) ? "480x320" : "320x480";
     my $cmd = 
-      sprintf ("convert \"%s\" -resize 480x320 $output_dir/%s", $arg, $filename); 
+      sprintf ("convert \"%s\" -auto-orient -resize $size $output_dir/%s", 
+        $arg, $filename); 
     system ($cmd);
     }
   else
@@ -0,0 +1,89 @@
+/*============================================================================
+ *
+ * sched/sched.h
+ *
+ * A small cooperative scheduler. Timers fire at absolute deadlines,
+ * measured by the microsecond timer, so the time taken by one callback
+ * does not make the others drift. Input from stdio, and anything that 
+ * can raise an interrupt, are other event sources. Between events the 
+ * core sleeps, rather than polling.
+ *
+ * All callbacks run in the thread that called sched_run, one at a
+ * time. A callback that takes a long time -- drawing a photo, for 
+ * example -- delays the others, but does not shift their deadlines. A 
+ * periodic timer that falls more than a period behind fires once, and 
+ * then skips to the next deadline that is still in the future.
+ *
+ * Copyright (c)2023 Kevin Boone, GPL v3.0
+ *
+ * ==========================================================================*/
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// The maximum number of timers that can exist at the same time
+#define SCHED_MAX_TIMERS 8
+// The maximum number of event sources, including stdio input
+#define SCHED_MAX_SOURCES 8
+
+struct _Sched;
+typedef struct _Sched Sched;
+
+typedef void (*SchedFn) (void *data);
+// An idle task returns true if it has more work to do
+typedef bool (*SchedIdleFn) (void *data);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Create the scheduler. There should be only one, because stdio 
+    input notification is global. */
+extern Sched *sched_new (void);
+
+extern void   sched_destroy (Sched *self);
+
+/** Add a timer that calls fn(data) first at the absolute time first_us,
+    as returned by time_us_64(), and then every period_us microseconds.
+    If period_us is zero, the timer fires once and is then removed.
+    Returns the timer's ID, or -1 if there are already SCHED_MAX_TIMERS
+    timers. */
+extern int    sched_add_timer (Sched *self, uint64_t first_us, 
+                uint32_t period_us, SchedFn fn, void *data);
+
+/** Remove a timer. It's not an error if the timer has already been
+    removed. */
+extern void   sched_cancel_timer (Sched *self, int id);
+
+/** Set the function to be called when characters are available on
+    stdin. The function should read all the characters that are 
+    available, using getchar_timeout_us(0). */
+extern void   sched_set_input (Sched *self, SchedFn fn, void *data);
+
+/** Add an event source. After sched_signal(id), fn(data) is called 
+    once from sched_run, however many times the source was signalled
+    in the meantime. Returns the source's ID, or -1 if there are already
+    SCHED_MAX_SOURCES sources. */
+extern int    sched_add_source (Sched *self, SchedFn fn, void *data);
+
+/** Signal an event source. This is safe to call from an interrupt 
+    handler, and wakes the core if it is sleeping. */
+extern void   sched_signal (int id);
+
+/** Set a function to be called when no timer is due and no event is
+    pending. It should do a small slice of work -- a few tens of
+    milliseconds -- and return true if there is more to do. The core
+    sleeps only when the idle task returns false. */
+extern void   sched_set_idle (Sched *self, SchedIdleFn fn, void *data);
+
+/** Dispatch events until sched_stop is called. */
+extern void   sched_run (Sched *self);
+
+/** Make sched_run return, after the current callback has finished. */
+extern void   sched_stop (Sched *self);
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -0,0 +1,282 @@
+/* =======================================================================
+
+  sched/sched.c
+
+  Each event source has a bit in a pending mask, which is set by 
+  sched_signal, usually from an interrupt handler, which also signals 
+  an event to wake the core. On the Pico, stdio raises an interrupt 
+  when input is available, so stdin is just source 0. The core waits 
+  for events, or for the next deadline, using WFE. On the host, we wait 
+  for input on stdin using poll(), with the next deadline as a timeout.
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+ ======================================================================= */
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <pico/stdlib.h>
+#include <sched/sched.h>
+#if PICO_ON_DEVICE
+#include <hardware/sync.h>
+#else
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+/* =======================================================================
+  SchedTimer 
+ ======================================================================= */
+typedef struct _SchedTimer
+  {
+  bool active;
+  uint64_t deadline;
+  uint32_t period;
+  SchedFn fn;
+  void *data;
+  } SchedTimer;
+
+/* =======================================================================
+  SchedSource 
+ ======================================================================= */
+typedef struct _SchedSource
+  {
+  SchedFn fn;
+  void *data;
+  } SchedSource;
+
+// Source 0 is stdin
+#define SCHED_SOURCE_INPUT 0
+
+/* =======================================================================
+  Opaque struct
+ ======================================================================= */
+struct _Sched
+  {
+  SchedTimer timers[SCHED_MAX_TIMERS];
+  SchedSource sources[SCHED_MAX_SOURCES];
+  SchedIdleFn idle_fn;
+  void *idle_data;
+  bool stop;
+  };
+
+// Set from interrupt handlers, so not part of the Sched. Input is 
+//   initially pending, in case characters arrived before we started.
+static volatile uint32_t sched_pending = 1u << SCHED_SOURCE_INPUT;
+
+#if PICO_ON_DEVICE
+/* =======================================================================
+  sched_chars_available
+  Called in interrupt context by stdio
+ ======================================================================= */
+static void sched_chars_available (void *param)
+  {
+  (void)param;
+  sched_signal (SCHED_SOURCE_INPUT);
+  }
+#endif
+
+/* =======================================================================
+  sched_signal
+ ======================================================================= */
+void sched_signal (int id)
+  {
+  sched_pending |= 1u << id;
+#if PICO_ON_DEVICE
+  __sev();
+#endif
+  }
+
+/* =======================================================================
+  sched_take_pending
+  Return the pending sources, and clear them
+ ======================================================================= */
+static uint32_t sched_take_pending (void)
+  {
+#if PICO_ON_DEVICE
+  uint32_t irq = save_and_disable_interrupts ();
+#endif
+  uint32_t pending = sched_pending;
+  sched_pending = 0;
+#if PICO_ON_DEVICE
+  restore_interrupts (irq);
+#endif
+  return pending;
+  }
+
+/* =======================================================================
+  sched_add_source
+ ======================================================================= */
+int sched_add_source (Sched *self, SchedFn fn, void *data)
+  {
+  for (int i = SCHED_SOURCE_INPUT + 1; i < SCHED_MAX_SOURCES; i++)
+    {
+    SchedSource *source = &self->sources[i];
+    if (source->fn) continue;
+    source->fn = fn;
+    source->data = data;
+    return i;
+    }
+  return -1;
+  }
+
+/* =======================================================================
+  sched_add_timer
+ ======================================================================= */
+int sched_add_timer (Sched *self, uint64_t first_us, uint32_t period_us, 
+      SchedFn fn, void *data)
+  {
+  for (int i = 0; i < SCHED_MAX_TIMERS; i++)
+    {
+    SchedTimer *t = &self->timers[i];
+    if (t->active) continue;
+    t->active = true;
+    t->deadline = first_us;
+    t->period = period_us;
+    t->fn = fn;
+    t->data = data;
+    return i;
+    }
+  return -1;
+  }
+
+/* =======================================================================
+  sched_cancel_timer
+ ======================================================================= */
+void sched_cancel_timer (Sched *self, int id)
+  {
+  if (id >= 0 && id < SCHED_MAX_TIMERS)
+    self->timers[id].active = false;
+  }
+
+/* =======================================================================
+  sched_set_input
+ ======================================================================= */
+void sched_set_input (Sched *self, SchedFn fn, void *data)
+  {
+  self->sources[SCHED_SOURCE_INPUT].fn = fn;
+  self->sources[SCHED_SOURCE_INPUT].data = data;
+  }
+
+/* =======================================================================
+  sched_set_idle
+ ======================================================================= */
+void sched_set_idle (Sched *self, SchedIdleFn fn, void *data)
+  {
+  self->idle_fn = fn;
+  self->idle_data = data;
+  }
+
+/* =======================================================================
+  sched_stop
+ ======================================================================= */
+void sched_stop (Sched *self)
+  {
+  self->stop = true;
+  }
+
+/* =======================================================================
+  sched_run_timers
+  Run every timer whose deadline has passed, and return the earliest
+    deadline that remains. 
+ ======================================================================= */
+static uint64_t sched_run_timers (Sched *self)
+  {
+  uint64_t now = time_us_64();
+  for (int i = 0; i < SCHED_MAX_TIMERS && !self->stop; i++)
+    {
+    SchedTimer *t = &self->timers[i];
+    if (!t->active || t->deadline > now) continue;
+    if (t->period == 0)
+      t->active = false;
+    else
+      {
+      t->deadline += t->period;
+      if (t->deadline <= now)
+        t->deadline += ((now - t->deadline) / t->period + 1) * t->period;
+      }
+    t->fn (t->data);
+    // The callback might have taken a while
+    now = time_us_64();
+    }
+
+  uint64_t next = UINT64_MAX;
+  for (int i = 0; i < SCHED_MAX_TIMERS; i++)
+    {
+    const SchedTimer *t = &self->timers[i];
+    if (t->active && t->deadline < next) next = t->deadline;
+    }
+  return next;
+  }
+
+/* =======================================================================
+  sched_wait
+  Sleep until the deadline, or until something happens
+ ======================================================================= */
+static void sched_wait (uint64_t deadline)
+  {
+  if (sched_pending) return;
+  uint64_t now = time_us_64();
+  if (deadline <= now) return;
+#if PICO_ON_DEVICE
+  best_effort_wfe_or_timeout (from_us_since_boot (deadline));
+#else
+  uint64_t wait_ms = (deadline - now + 999) / 1000;
+  if (wait_ms > 1000) wait_ms = 1000;
+  struct pollfd pfd = { STDIN_FILENO, POLLIN, 0 };
+  if (poll (&pfd, 1, (int)wait_ms) > 0)
+    sched_signal (SCHED_SOURCE_INPUT);
+#endif
+  }
+
+/* =======================================================================
+  sched_run
+ ======================================================================= */
+void sched_run (Sched *self)
+  {
+  self->stop = false;
+  while (!self->stop)
+    {
+    uint64_t next = sched_run_timers (self);
+    if (self->stop) break;
+    uint32_t pending = sched_take_pending ();
+    if (pending)
+      {
+      for (int i = 0; i < SCHED_MAX_SOURCES && !self->stop; i++)
+        {
+        const SchedSource *source = &self->sources[i];
+        if ((pending & (1u << i)) && source->fn) 
+          source->fn (source->data);
+        }
+      continue;
+      }
+    if (self->idle_fn && self->idle_fn (self->idle_data))
+      continue;
+    sched_wait (next);
+    }
+  }
+
+/* =======================================================================
+  sched_new
+ ======================================================================= */
+Sched *sched_new (void)
+  {
+  Sched *self = malloc (sizeof (Sched));
+  memset (self, 0, sizeof (Sched));
+#if PICO_ON_DEVICE
+  stdio_set_chars_available_callback (sched_chars_available, self);
+#endif
+  return self;
+  }
+
+/* =======================================================================
+  sched_destroy
+ ======================================================================= */
+void sched_destroy (Sched *self)
+  {
+#if PICO_ON_DEVICE
+  stdio_set_chars_available_callback (NULL, NULL);
+#endif
+  free (self);
+  }
+
@@ -0,0 +1,43 @@
+/*============================================================================
+ *
+ * screens/bigclock.h
+ *
+ * A full-screen clock, showing hours and minutes in very large digits,
+ * with the seconds underneath. The digits are the clock's 72-point glyphs,
+ * enlarged as they are sent to the display, so no extra font is needed. 
+ *
+ * Copyright (c)2023 Kevin Boone, GPL v3.0
+ *
+ * ==========================================================================*/
+#pragma once
+
+#include <stdint.h>
+#include <waveshare_lcd/waveshare_lcd.h>
+#include <ds3231/ds3231.h>
+#include <gfx/framestats.h>
+
+struct _BigClock;
+typedef struct _BigClock BigClock;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern BigClock    *bigclock_new (WSLCD *wslcd, const DS3231 *ds3231);
+extern void         bigclock_destroy (BigClock *self);
+
+/** Clear the screen and draw the whole clock. */
+extern void         bigclock_draw_all (BigClock *self);
+
+/** Call once a second. Reads the time, and redraws only the digits 
+    that have changed since the last frame. */
+extern void         bigclock_tick (BigClock *self);
+
+/** Timing of the once-a-second redraws, which must take well under 
+    a second. */
+extern const FrameStats *bigclock_get_stats (const BigClock *self);
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -7,11 +7,17 @@
  * ==========================================================================*/
 #pragma once
 
+#include <stdint.h>
+#include <stdbool.h>
 #include <waveshare_lcd/waveshare_lcd.h>
 #include <screens/settings.h>
 #include <ds3231/ds3231.h>
 #include <klib/list.h>
 #include <gfx/gfxconsole.h>
+#include <gfx/framestats.h>
+#include <files/framecache.h>
+#include <files/flashcache.h>
+#include <files/catalog.h>
 
 struct _PhotoClock;
 typedef struct _PhotoClock PhotoClock;
@@ -20,16 +26,49 @@ typedef struct _PhotoClock PhotoClock;
 extern "C" {
 #endif
 
+/** Create the photo clock, showing photos from the catalog. The 
+    catalog may still be scanning; photos it finds later are added 
+    to the shuffle. */
 extern PhotoClock  *photoclock_new (const Settings *settings, 
                        WSLCD *wslcd, const DS3231 *ds3231, 
-                       const List *file_list, GfxConsole *console);
+                       Catalog *catalog, GfxConsole *console);
 extern void         photoclock_destroy (PhotoClock *self);
+/** Start drawing the current or next background. The work is done by
+    photoclock_render, and the clock is drawn when it finishes. Any 
+    background already being drawn is abandoned. */
 extern void         photoclock_draw_current_background (PhotoClock *self);
 extern void         photoclock_draw_next_background (PhotoClock *self);
+
+/** Start drawing the specified file as the background. */
+extern void         photoclock_show_file (PhotoClock *self, 
+                       const char *file);
+
+/** Draw some more of the background, for about budget_us microseconds. 
+    When the background is complete, read some of the next photo 
+    into memory instead, if it is small enough, and then copy it to 
+    the flash cache. Returns true if there is more to do. */
+extern bool         photoclock_render (PhotoClock *self, 
+                       uint32_t budget_us);
+/** Call at the start of every minute. Changes the background when
+    it's time. */
 extern void         photoclock_tock (PhotoClock *self);
+/** Call every second, to update the clock. */
 extern void         photoclock_tick (PhotoClock *self);
 extern void         photoclock_draw_all (PhotoClock *self);
 
+/** Timing of the once-a-second clock updates. */
+extern const FrameStats *photoclock_get_clock_stats (const PhotoClock *self);
+/** Get the frame cache's statistics, or NULL if there is no cache. */
+extern const FrameCacheStats *photoclock_get_frame_cache_stats 
+                       (const PhotoClock *self);
+/** Get the flash cache's statistics, or NULL if there is no cache. */
+extern const FlashCacheStats *photoclock_get_flash_cache_stats 
+                       (const PhotoClock *self);
+/** Get the number of backgrounds that were, and were not, already in 
+    memory when they were needed. */
+extern void         photoclock_get_prefetch_stats (const PhotoClock *self,
+                       unsigned int *hits, unsigned int *misses);
+
 #ifdef __cplusplus
 }
 #endif
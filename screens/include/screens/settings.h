@@ -8,11 +8,24 @@
 
 #pragma once
 
+// What the display shows: photos with a small clock, or a large clock
+//   on its own
+typedef enum 
+  {
+  DISPLAY_MODE_PHOTO = 0,
+  DISPLAY_MODE_BIGCLOCK = 1
+  } DisplayMode;
+
 typedef struct _Settings
   {
   unsigned int mins_per_background_change;
   unsigned int clock_x; 
   unsigned int clock_y; 
+  DisplayMode display_mode;
+  unsigned int show_seconds; // Non-zero to show seconds in photo mode
+  unsigned int prefetch_max_kb; // Largest photo to read ahead; 0 = none
+  unsigned int frame_cache_max; // Decoded photos to keep; 0 = none
+  unsigned int flash_cache_max; // Photos to copy to flash; 0 = none
   } Settings;
 
 
@@ -22,6 +35,14 @@ extern "C" {
 
 extern int settings_from_file (Settings *settings, const char *file);
 
+/** Convert a display mode name ("photo" or "bigclock") to a DisplayMode.
+    Returns EINVAL if the name is not recognized. */
+extern int settings_parse_display_mode (const char *name, DisplayMode *mode);
+
+/** Return the name of a display mode, as accepted by 
+    settings_parse_display_mode. */
+extern const char *settings_display_mode_name (DisplayMode mode);
+
 #ifdef __cplusplus
 }
 #endif
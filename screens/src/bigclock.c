@@ -0,0 +1,144 @@
+/* =======================================================================
+
+  screens/bigclock.c
+
+  The layout is HH:MM at BIGCLOCK_SCALE times the size of the atlas
+  glyphs, centred on the screen, with SS at normal size underneath the
+  minutes. On the 480x320 panel this is 440x255 pixels.
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+ ======================================================================= */
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <pico/stdlib.h>
+#include <waveshare_lcd/waveshare_lcd.h>
+#include <screens/bigclock.h>
+#include <ds3231/ds3231.h>
+#include <gfx/fonthandler.h>
+#include "dejavu_sans_mono_72_atlas.h"
+
+// Enlargement of the hour and minute digits
+#define BIGCLOCK_SCALE 2
+
+/* =======================================================================
+  Opaque struct
+ ======================================================================= */
+struct _BigClock
+  {
+  WSLCD *wslcd;
+  const DS3231 *ds3231;
+  FontHandler *fh;
+  unsigned int font_width;
+  unsigned int font_height;
+  unsigned int x; // Top-left of the HH:MM line
+  unsigned int y;
+  char shown[9]; // HH:MM:SS as currently on screen, or empty
+  FrameStats stats;
+  };
+
+/* =======================================================================
+  bigclock_draw
+  Draw the characters of hhmmss that differ from what is on screen.
+ ======================================================================= */
+static void bigclock_draw (BigClock *self, const char *hhmmss)
+  {
+  unsigned int big_width = self->font_width * BIGCLOCK_SCALE;
+  for (unsigned int i = 0; i < 5; i++)
+    {
+    if (self->shown[i] == hhmmss[i]) continue;
+    fonthandler_draw_glyph_scaled (self->fh, self->wslcd, hhmmss[i], 
+      self->x + i * big_width, self->y, BIGCLOCK_SCALE);
+    }
+
+  // Seconds are right-aligned under the minutes
+  unsigned int sec_x = self->x + 5 * big_width - 2 * self->font_width;
+  unsigned int sec_y = self->y + self->font_height * BIGCLOCK_SCALE;
+  for (unsigned int i = 6; i < 8; i++)
+    {
+    if (self->shown[i] == hhmmss[i]) continue;
+    fonthandler_draw_glyph (self->fh, self->wslcd, hhmmss[i], 
+      sec_x + (i - 6) * self->font_width, sec_y);
+    }
+
+  memcpy (self->shown, hhmmss, sizeof (self->shown));
+  }
+
+/* =======================================================================
+  bigclock_frame
+  Read the clock and update the display, timing the whole operation.
+ ======================================================================= */
+static void bigclock_frame (BigClock *self)
+  {
+  uint64_t start = time_us_64();
+
+  int year, month, day, hour, min, sec;
+  ds3231_get_datetime (self->ds3231, &year, &month, &day, &hour, 
+    &min, &sec);
+  char hhmmss[9];
+  snprintf (hhmmss, sizeof (hhmmss), "%02d:%02d:%02d", hour, min, sec);
+  bigclock_draw (self, hhmmss);
+
+  framestats_add (&self->stats, (uint32_t)(time_us_64() - start));
+  }
+
+/* =======================================================================
+  bigclock_draw_all
+ ======================================================================= */
+void bigclock_draw_all (BigClock *self)
+  {
+  wslcd_clear (self->wslcd, 0);
+  memset (self->shown, 0, sizeof (self->shown));
+  bigclock_frame (self);
+  }
+
+/* =======================================================================
+  bigclock_tick
+ ======================================================================= */
+void bigclock_tick (BigClock *self)
+  {
+  bigclock_frame (self);
+  }
+
+/* =======================================================================
+  bigclock_get_stats
+ ======================================================================= */
+const FrameStats *bigclock_get_stats (const BigClock *self)
+  {
+  return &self->stats;
+  }
+
+/* =======================================================================
+  bigclock_new
+ ======================================================================= */
+BigClock *bigclock_new (WSLCD *wslcd, const DS3231 *ds3231)
+  {
+  BigClock *self = malloc (sizeof (BigClock));
+  memset (self, 0, sizeof (BigClock));
+  self->wslcd = wslcd;
+  self->ds3231 = ds3231;
+  self->fh = fonthandler_new_atlas (dejavu_sans_mono_72_atlas_pixels, 
+     dejavu_sans_mono_72_atlas_offsets, dejavu_sans_mono_72_atlas_width, 
+     dejavu_sans_mono_72_atlas_height);
+  self->font_width = fonthandler_get_font_width (self->fh);
+  self->font_height = fonthandler_get_font_height (self->fh);
+
+  unsigned int width = 5 * self->font_width * BIGCLOCK_SCALE;
+  unsigned int height = self->font_height * (BIGCLOCK_SCALE + 1);
+  unsigned int display_width = (unsigned)wslcd_get_width (wslcd);
+  unsigned int display_height = (unsigned)wslcd_get_height (wslcd);
+  self->x = width < display_width ? (display_width - width) / 2 : 0;
+  self->y = height < display_height ? (display_height - height) / 2 : 0;
+  return self;
+  }
+
+/* =======================================================================
+  bigclock_destroy
+ ======================================================================= */
+void bigclock_destroy (BigClock *self)
+  {
+  fonthandler_destroy (self->fh);
+  free (self);
+  }
+
@@ -8,18 +8,23 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <limits.h>
 #include <waveshare_lcd/waveshare_lcd.h>
 #include <screens/photoclock.h>
 #include <ds3231/ds3231.h>
 #include <gfx/fonthandler.h>
 #include <gfx/clock.h>
 #include <files/files.h>
+#include <files/catalog.h>
 #include <gfx/gfxconsole.h>
 #include <klib/list.h>
+#include <log/log.h>
+#include "config.h"
 //#include "courier_bold_72.h"
 //#include "courier_bold_36.h"
-#include "dejavu_sans_mono_72.h"
-#include "dejavu_sans_mono_36.h"
+#include "dejavu_sans_mono_72_atlas.h"
+//#include "dejavu_sans_mono_36.h"
+#include "dejavu_sans_mono_36_rle.h"
 
 /* =======================================================================
   Opaque struct
@@ -32,15 +37,27 @@ struct _PhotoClock
   FontHandler *small_fh;
   Clock *clock;
   unsigned int current_file;
-  unsigned int ticks;
   unsigned int mins_this_background;
-  const List *file_list;
+  Catalog *catalog;
   GfxConsole *console;
-  uint16_t *indexes;
-  unsigned int nfiles; // Number of photos
+  unsigned int nfiles; // Number of photos in this cycle of the shuffle
+  uint32_t seed; // Chooses the order of this cycle
+  uint32_t next_seed; // ... and of the next
+  bool started; // The photo at current_file has been shown
   const DS3231 *ds3231;
   unsigned int display_width;
   unsigned int display_height;
+  JpegJob *job; // The background being drawn, if any
+  Prefetch *prefetch; // The next background, being read into memory
+  Prefetch *job_data; // The prefetch the job is decoding, if any
+  unsigned int prefetch_tried; // Photo we last tried to prefetch
+  unsigned int prefetch_hits;
+  unsigned int prefetch_misses;
+  FrameCache *frame_cache; // NULL if there isn't one
+  FlashCache *flash_cache; // NULL if there isn't one
+  uint32_t prefetch_offset; // Of the photo in its file
+  bool prefetch_copied; // The prefetch is in flash, or can't be
+  unsigned int flash_shown; // Photos shown from flash without the card
   };
 
 /* =======================================================================
@@ -54,27 +71,326 @@ struct _PhotoClock
   }
 */
 
+/* =======================================================================
+  photoclock_cancel_render
+ ======================================================================= */
+static void photoclock_cancel_render (PhotoClock *self)
+  {
+  if (self->job)
+    {
+    files_jpeg_finish (self->job);
+    self->job = NULL;
+    }
+  if (self->job_data)
+    {
+    files_prefetch_free (self->job_data);
+    self->job_data = NULL;
+    }
+  }
+
+/* =======================================================================
+  photoclock_shuffle
+  The number, in the catalog, of the n'th of count photos, in the order
+    chosen by seed. Nothing is stored for each photo: the order is a 
+    permutation of the numbers up to the next power of two, made of 
+    steps that each map those numbers onto themselves one-to-one -- 
+    multiplying by an odd number, adding, and xor-ing the high bits 
+    into the low ones. Numbers that land outside the photos are put 
+    through it again until they land inside, which keeps it one-to-one
+    ('cycle walking'). Each pass has at least an even chance of landing
+    inside.
+ ======================================================================= */
+static unsigned int photoclock_shuffle (uint32_t seed, unsigned int count,
+        unsigned int n)
+  {
+  unsigned int bits = 0;
+  while (bits < 32 && (1u << bits) < count) bits++;
+  if (bits == 0) return 0;
+  uint32_t mask = bits < 32 ? (1u << bits) - 1 : 0xFFFFFFFF;
+  unsigned int shift = (bits + 1) / 2;
+  uint32_t x = n;
+  do
+    {
+    uint32_t key = seed;
+    for (int round = 0; round < 3; round++)
+      {
+      x = (x * 0x9E3779B1u + key) & mask;
+      x ^= x >> shift;
+      key = key * 1664525u + 1013904223u;
+      }
+    } while (x >= count);
+  return x;
+  }
+
+/* =======================================================================
+  photoclock_cycle_ends
+  Whether the photo after the current one starts a new cycle of the
+    shuffle. A cycle ends when all its photos have been shown, or when
+    the catalog has found as many photos again since it started. That
+    happens a few times while the catalog is being built, so photos 
+    found after the slideshow starts don't have to wait long.
+ ======================================================================= */
+static bool photoclock_cycle_ends (const PhotoClock *self)
+  {
+  return self->current_file + 1 >= self->nfiles
+    || catalog_count (self->catalog) >= 2 * self->nfiles;
+  }
+
+/* =======================================================================
+  photoclock_current_photo
+  The number, in the catalog, of the current photo
+ ======================================================================= */
+static unsigned int photoclock_current_photo (const PhotoClock *self)
+  {
+  return photoclock_shuffle (self->seed, self->nfiles, self->current_file);
+  }
+
+/* =======================================================================
+  photoclock_next_photo
+  The number, in the catalog, of the photo after the current one
+ ======================================================================= */
+static unsigned int photoclock_next_photo (const PhotoClock *self)
+  {
+  if (photoclock_cycle_ends (self))
+    return photoclock_shuffle (self->next_seed, 
+      catalog_count (self->catalog), 0);
+  return photoclock_shuffle (self->seed, self->nfiles, 
+    self->current_file + 1);
+  }
+
+/* =======================================================================
+  photoclock_get_path
+  Get the path of photo n in the catalog, into a buffer of 
+    CATALOG_MAX_PATH bytes, and where it is in that file. Returns 
+    false if there isn't one.
+ ======================================================================= */
+static bool photoclock_get_path (const PhotoClock *self, unsigned int n,
+        char *path, CatalogExtent *extent)
+  {
+  return catalog_get_photo (self->catalog, n, path, CATALOG_MAX_PATH, 
+    extent) == 0;
+  }
+
+/* =======================================================================
+  photoclock_add_new_photos
+  Until a photo has been shown, the shuffle takes in photos as the 
+    catalog finds them. After that, photos that the catalog finds join
+    the shuffle when the next cycle starts, because the order of a 
+    cycle depends on how many photos are in it.
+ ======================================================================= */
+static void photoclock_add_new_photos (PhotoClock *self)
+  {
+  if (!self->started) self->nfiles = catalog_count (self->catalog);
+  }
+
+/* =======================================================================
+  photoclock_next_cycle
+  Start the next cycle of the shuffle, in a new order, with all the 
+    photos found so far.
+ ======================================================================= */
+static void photoclock_next_cycle (PhotoClock *self)
+  {
+  self->current_file = 0;
+  self->nfiles = catalog_count (self->catalog);
+  self->seed = self->next_seed;
+  self->next_seed = (uint32_t)lrand48 ();
+  }
+
+/* =======================================================================
+  photoclock_copy_to_flash
+  Copy another sector of the prefetched photo to the flash cache, if
+    there is one. Returns true if there is more to copy.
+ ======================================================================= */
+static bool photoclock_copy_to_flash (PhotoClock *self)
+  {
+  if (!self->flash_cache || self->prefetch_copied) return false;
+  const char *path = files_prefetch_path (self->prefetch);
+  uint32_t len;
+  const uint8_t *data = files_prefetch_get (self->prefetch, path, 
+    self->prefetch_offset, &len);
+  if (data && flashcache_write_step (self->flash_cache, path, 
+       self->prefetch_offset, data, len, 
+       files_prefetch_checksum (self->prefetch)))
+    return true;
+  self->prefetch_copied = true;
+  return false;
+  }
+
+/* =======================================================================
+  photoclock_show_from_flash
+  Show the next of the photos in the flash cache, in turn, when there 
+    are no photos on the card, or the card can't be read. Returns false
+    if there are none.
+ ======================================================================= */
+static bool photoclock_show_from_flash (PhotoClock *self)
+  {
+  if (!self->flash_cache) return false;
+  unsigned int count = flashcache_count (self->flash_cache);
+  if (count == 0) return false;
+  unsigned int n = self->flash_shown++ % count;
+  uint32_t len;
+  const uint8_t *data = flashcache_get_nth (self->flash_cache, n, &len);
+  photoclock_cancel_render (self);
+  printf ("Setting background to photo %u in flash\n", n);
+  self->job = files_jpeg_open_mem (self->console, self->wslcd, data, len);
+  if (!self->job)
+    clock_draw_all (self->clock);
+  return true;
+  }
+
+/* =======================================================================
+  photoclock_prefetch
+  Read some more of the next photo into memory. Returns true if there is 
+    more to read.
+ ======================================================================= */
+static bool photoclock_prefetch (PhotoClock *self)
+  {
+  uint32_t max_size = self->settings->prefetch_max_kb * 1024;
+  photoclock_add_new_photos (self);
+  if (max_size == 0 || catalog_count (self->catalog) < 2) return false;
+
+  // Looking up a path means reading the card, so photos are compared
+  //   by number, and the path is only looked up to open a new prefetch
+  unsigned int photo = photoclock_next_photo (self);
+  if (self->prefetch && self->prefetch_tried != photo)
+    {
+    files_prefetch_free (self->prefetch);
+    self->prefetch = NULL;
+    }
+  if (!self->prefetch)
+    {
+    // Files that are too big are just read from the card when they're
+    //   needed. There's no point trying again, so there's nothing more
+    //   to do until the photo changes.
+    if (self->prefetch_tried == photo) return false;
+    self->prefetch_tried = photo;
+    char next[CATALOG_MAX_PATH];
+    CatalogExtent extent;
+    if (!photoclock_get_path (self, photo, next, &extent)) return false;
+    // A photo that's in flash won't need the card at all
+    if (self->flash_cache 
+         && flashcache_contains (self->flash_cache, next, extent.offset))
+      return false;
+    self->prefetch = files_prefetch_open_part (next, extent.offset, 
+      extent.size, max_size);
+    if (!self->prefetch) return false;
+    self->prefetch_offset = extent.offset;
+    self->prefetch_copied = false;
+    }
+  if (files_prefetch_step (self->prefetch, PREFETCH_CHUNK_BYTES))
+    return true;
+  return photoclock_copy_to_flash (self);
+  }
+
+/* =======================================================================
+  photoclock_show_photo
+  Start drawing the photo at offset in file, previewing its EXIF 
+    thumbnail if info says where it is. info may be NULL.
+ ======================================================================= */
+static void photoclock_show_photo (PhotoClock *self, const char *file,
+        uint32_t offset, const CatalogInfo *info)
+  {
+  photoclock_cancel_render (self);
+  uint32_t thumb_offset = info ? info->thumb_offset : 0;
+  uint32_t thumb_len = info ? info->thumb_len : 0;
+  uint32_t len;
+  const uint8_t *data = NULL;
+  if (self->frame_cache)
+    {
+    self->job = files_jpeg_open_cached (self->console, self->wslcd, 
+      self->frame_cache, file, offset);
+    if (self->job) return;
+    }
+  if (self->prefetch) 
+    data = files_prefetch_get (self->prefetch, file, offset, &len);
+  // A photo in flash is decoded where it is, like one in memory
+  bool from_flash = false;
+  if (!data && self->flash_cache)
+    {
+    data = flashcache_get (self->flash_cache, file, offset, &len);
+    from_flash = data != NULL;
+    }
+  if (from_flash)
+    {
+    self->job = files_jpeg_open_mem_preview (self->console, self->wslcd, 
+      data, len, thumb_offset, thumb_len);
+    }
+  else if (data)
+    {
+    // The Prefetch has to outlive the job that decodes it
+    self->job = files_jpeg_open_mem_preview (self->console, self->wslcd, 
+      data, len, thumb_offset, thumb_len);
+    self->job_data = self->prefetch;
+    self->prefetch = NULL;
+    self->prefetch_hits++;
+    }
+  else
+    {
+    self->job = files_jpeg_open_part (self->console, self->wslcd, file,
+      offset, thumb_offset, thumb_len);
+    if (self->settings->prefetch_max_kb) self->prefetch_misses++;
+    }
+  if (self->job && self->frame_cache)
+    files_jpeg_record (self->job, self->frame_cache, file, offset);
+  // If the file can't be drawn -- perhaps because the card has stopped
+  //   working -- show one from flash instead. If there isn't one, 
+  //   there's nothing to wait for.
+  if (!self->job && !photoclock_show_from_flash (self))
+    clock_draw_all (self->clock);
+  }
+
+/* =======================================================================
+  photoclock_show_file
+ ======================================================================= */
+void photoclock_show_file (PhotoClock *self, const char *file)
+  {
+  photoclock_show_photo (self, file, 0, NULL);
+  }
+
+/* =======================================================================
+  photoclock_render
+ ======================================================================= */
+bool photoclock_render (PhotoClock *self, uint32_t budget_us)
+  {
+  // Once the background is drawn, spare time is used for reading the
+  //   next one
+  if (!self->job) return photoclock_prefetch (self);
+  if (files_jpeg_step (self->job, UINT_MAX, budget_us))
+    return true;
+  photoclock_cancel_render (self);
+  // The photo will have been drawn over the clock
+  clock_draw_all (self->clock);
+  return false;
+  }
+
 /* =======================================================================
   photoclock_draw_current_background 
+  This only starts drawing the background -- photoclock_render
+    does the work.
  ======================================================================= */
 void photoclock_draw_current_background (PhotoClock *self)
   {
-  unsigned int l = (unsigned int)list_length (self->file_list);
-  if (l == 0)
-    wslcd_clear (self->wslcd, 0);
-  else
+  char file[CATALOG_MAX_PATH];
+  CatalogExtent extent;
+  photoclock_add_new_photos (self);
+  unsigned int photo = photoclock_current_photo (self);
+  if (self->nfiles == 0 || !photoclock_get_path (self, photo, file, &extent))
     {
-    if (self->current_file >= l)
-      wslcd_clear (self->wslcd, 0);
-    else
+    if (!photoclock_show_from_flash (self))
       {
-      int filenum = self->indexes[self->current_file];
-      const char *file = list_get (self->file_list, 
-        (int)filenum);
-      printf ("Setting background to %s\n", file);
-      files_show_jpeg (self->console, self->wslcd, file);
+      photoclock_cancel_render (self);
+      wslcd_clear (self->wslcd, 0);
+      clock_draw_all (self->clock);
       }
     }
+  else
+    {
+    printf ("Setting background to %s\n", file);
+    self->started = true;
+    CatalogInfo info;
+    catalog_get_info (self->catalog, photo, &info);
+    photoclock_show_photo (self, file, extent.offset, &info);
+    }
   }
 
 /* =======================================================================
@@ -82,16 +398,18 @@ void photoclock_draw_current_background (PhotoClock *self)
  ======================================================================= */
 void photoclock_draw_next_background (PhotoClock *self)
   {
-  unsigned int l = (unsigned int)list_length (self->file_list);
-  if (l > 0)
-    {
+  photoclock_add_new_photos (self);
+  if (photoclock_cycle_ends (self))
+    photoclock_next_cycle (self);
+  else
     self->current_file++;
-    if (self->current_file >= l)
-      self->current_file = 0;
+  if (self->nfiles > 0)
+    {
     photoclock_draw_current_background (self);
     printf ("Changing to background %d\n", self->current_file);
     }
-  clock_draw_all (self->clock);
+  else if (!photoclock_show_from_flash (self))
+    clock_draw_all (self->clock);
   }
 
 /* =======================================================================
@@ -105,8 +423,6 @@ void photoclock_tock (PhotoClock *self)
     self->mins_this_background = 0;
     photoclock_draw_next_background (self);
     }
-  else
-    clock_draw_all (self->clock);
   }
   
 /* =======================================================================
@@ -114,13 +430,12 @@ void photoclock_tock (PhotoClock *self)
  ======================================================================= */
 void photoclock_tick (PhotoClock *self)
   {
-  //clock_draw_seconds (self->clock);
-  self->ticks++;
-  if (self->ticks == 60)
-    {
-    self->ticks = 0;
-    photoclock_tock (self); 
-    }
+  // The time is read every second, so the minutes change when the RTC's
+  //   minutes change, even if the seconds are not shown. While a 
+  //   background is being drawn, the clock would only be drawn over; 
+  //   it is redrawn completely when the background is finished.
+  if (!self->job)
+    clock_update (self->clock);
   }
 
 /* =======================================================================
@@ -129,14 +444,51 @@ void photoclock_tick (PhotoClock *self)
 void photoclock_draw_all (PhotoClock *self)
   {
   photoclock_draw_current_background (self);
-  clock_draw_all (self->clock);
+  }
+
+/* =======================================================================
+  photoclock_get_clock_stats
+ ======================================================================= */
+const FrameStats *photoclock_get_clock_stats (const PhotoClock *self)
+  {
+  return clock_get_stats (self->clock);
+  }
+
+/* =======================================================================
+  photoclock_get_prefetch_stats
+ ======================================================================= */
+void photoclock_get_prefetch_stats (const PhotoClock *self, 
+        unsigned int *hits, unsigned int *misses)
+  {
+  *hits = self->prefetch_hits;
+  *misses = self->prefetch_misses;
+  }
+
+/* =======================================================================
+  photoclock_get_frame_cache_stats
+ ======================================================================= */
+const FrameCacheStats *photoclock_get_frame_cache_stats 
+        (const PhotoClock *self)
+  {
+  if (!self->frame_cache) return NULL;
+  return framecache_get_stats (self->frame_cache);
+  }
+
+/* =======================================================================
+  photoclock_get_flash_cache_stats
+ ======================================================================= */
+const FlashCacheStats *photoclock_get_flash_cache_stats 
+        (const PhotoClock *self)
+  {
+  if (!self->flash_cache) return NULL;
+  return flashcache_get_stats (self->flash_cache);
   }
 
 /* =======================================================================
   photoclock_new 
  ======================================================================= */
 PhotoClock *photoclock_new (const Settings *settings, WSLCD *wslcd,
-              const DS3231 *ds3231, const List *file_list, 
+              const DS3231 *ds3231, Catalog *catalog, 
               GfxConsole *console)
   {
   PhotoClock *self = malloc (sizeof (PhotoClock));
@@ -144,30 +496,66 @@ PhotoClock *photoclock_new (const Settings *settings, WSLCD *wslcd,
   self->console = console;
   self->wslcd = wslcd;
   self->settings = settings;
-  self->file_list = file_list;
+  self->catalog = catalog;
   self->current_file = 0;
-  self->ticks = 0;
+  self->prefetch_tried = UINT_MAX;
   self->mins_this_background = 0;
   self->ds3231 = ds3231;
 
+  if (settings->frame_cache_max > 0)
+    {
+    self->frame_cache = framecache_new (FRAME_CACHE_DIR, 
+      settings->frame_cache_max);
+    if (!self->frame_cache)
+      log_write (console, "Can't create frame cache " FRAME_CACHE_DIR "\n");
+    }
+
+#if FLASH_CACHE_KB
+  // The cache is opened even if no more photos are to be copied to it, 
+  //   so the photos already there can be shown if the card can't be 
+  //   read -- in which case, the settings won't have been read either
+  self->flash_cache = flashcache_new (FLASH_CACHE_KB, 
+    settings->flash_cache_max);
+  if (!self->flash_cache)
+    log_write (console, "Can't use the last %d kB of flash for photos\n",
+      FLASH_CACHE_KB);
+#endif
+
   self->display_width = (unsigned)wslcd_get_width (wslcd);
   self->display_height = (unsigned)wslcd_get_height (wslcd);
 
-  self->big_fh = fonthandler_new (dejavu_sans_mono_72_data, 
-     dejavu_sans_mono_72_length, dejavu_sans_mono_72_width, 
-     dejavu_sans_mono_72_height);
+  // The time digits come from a pre-rendered atlas in flash, which 
+  //   can be sent to the display without decoding. The atlas only has
+  //   the digits and the colon, because that's all the clock needs 
+  //   from the big font. It was generated using tools/fontconv from
+  //   dejavu_sans_mono_72.
+  self->big_fh = fonthandler_new_atlas (dejavu_sans_mono_72_atlas_pixels, 
+     dejavu_sans_mono_72_atlas_offsets, dejavu_sans_mono_72_atlas_width, 
+     dejavu_sans_mono_72_atlas_height);
+
+  //self->big_fh = fonthandler_new (dejavu_sans_mono_72_data, 
+  //   dejavu_sans_mono_72_length, dejavu_sans_mono_72_width, 
+  //   dejavu_sans_mono_72_height);
 
   //self->big_fh = fonthandler_new (courier_bold_72_data, 
   //   courier_bold_72_length, courier_bold_72_width, courier_bold_72_height);
 
-  self->small_fh = fonthandler_new (dejavu_sans_mono_36_data, 
-     dejavu_sans_mono_36_length, dejavu_sans_mono_36_width, 
-     dejavu_sans_mono_36_height);
+  // The date uses a run-length encoded font, which is about a third of
+  //   the size of the JPEG version, and is decoded as it is sent to
+  //   the display. It was generated using tools/fontconv -r.
+  self->small_fh = fonthandler_new_rle (dejavu_sans_mono_36_rle_data, 
+     dejavu_sans_mono_36_rle_offsets, dejavu_sans_mono_36_rle_width, 
+     dejavu_sans_mono_36_rle_height);
+
+  //self->small_fh = fonthandler_new (dejavu_sans_mono_36_data, 
+  //   dejavu_sans_mono_36_length, dejavu_sans_mono_36_width, 
+  //   dejavu_sans_mono_36_height);
 
   //self->small_fh = fonthandler_new (courier_bold_36_data, 
   //   courier_bold_36_length, courier_bold_36_width, courier_bold_36_height);
 
   self->clock = clock_new (wslcd, self->big_fh, self->small_fh, ds3231);
+  clock_set_show_seconds (self->clock, self->settings->show_seconds != 0);
 
   unsigned int clock_width, clock_height;
   clock_get_size (self->clock, &clock_width, &clock_height);
@@ -185,31 +573,14 @@ PhotoClock *photoclock_new (const Settings *settings, WSLCD *wslcd,
   clock_position_at (self->clock, clock_x, clock_y);
   //printf ("cw =%d ch = %d\n", clock_x, clock_y);
 
-  int nfiles = list_length (file_list);
-  self->nfiles = (unsigned)nfiles;
-
-  self->indexes = malloc ((size_t)nfiles * sizeof (uint16_t));
-  for (int i = 0; i < nfiles; i++)
-    {
-    self->indexes[i] = (uint16_t)(nfiles - i - 1);
-    }
-  
-
-  if (nfiles > 1) 
-    {
-    int a, b, c, d, e, f;
-    ds3231_get_datetime (self->ds3231, &a, 
-        &b, &c, &d, &e, &f);
-    srand48 (a + b + c + d + e + f);
-    int i;
-    for (i = nfiles - 1; i > 0; i--) 
-      {
-      int j = (int) (drand48() * (i + 1));
-      int t = self->indexes[j];
-      self->indexes[j] = self->indexes[i];
-      self->indexes[i] = (uint16_t)t;
-      }
-    }
+  // The shuffle is seeded from the time, and grows as the catalog
+  //   does
+  int a, b, c, d, e, f;
+  ds3231_get_datetime (self->ds3231, &a, &b, &c, &d, &e, &f);
+  srand48 (a + b + c + d + e + f);
+  self->seed = (uint32_t)lrand48 ();
+  self->next_seed = (uint32_t)lrand48 ();
+  photoclock_add_new_photos (self);
 
   return self;
   }
@@ -219,10 +590,13 @@ PhotoClock *photoclock_new (const Settings *settings, WSLCD *wslcd,
  ======================================================================= */
 void photoclock_destroy (PhotoClock *self)
   {
+  photoclock_cancel_render (self);
+  if (self->prefetch) files_prefetch_free (self->prefetch);
+  if (self->frame_cache) framecache_destroy (self->frame_cache);
+  if (self->flash_cache) flashcache_destroy (self->flash_cache);
   clock_destroy (self->clock);
   fonthandler_destroy (self->big_fh);
   fonthandler_destroy (self->small_fh);
-  free (self->indexes);
   free (self);
   }
 
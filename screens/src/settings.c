@@ -16,6 +16,32 @@
 #include <files/files.h>
 #include <screens/settings.h>
 
+/* =======================================================================
+  settings_parse_display_mode
+ ======================================================================= */
+int settings_parse_display_mode (const char *name, DisplayMode *mode)
+  {
+  if (strcmp (name, "photo") == 0)
+    *mode = DISPLAY_MODE_PHOTO;
+  else if (strcmp (name, "bigclock") == 0)
+    *mode = DISPLAY_MODE_BIGCLOCK;
+  else
+    return EINVAL;
+  return 0;
+  }
+
+/* =======================================================================
+  settings_display_mode_name
+ ======================================================================= */
+const char *settings_display_mode_name (DisplayMode mode)
+  {
+  switch (mode)
+    {
+    case DISPLAY_MODE_BIGCLOCK: return "bigclock";
+    default: return "photo";
+    }
+  }
+
 /* =======================================================================
   settings_fron_file
  ======================================================================= */
@@ -46,6 +72,16 @@ int settings_from_file (Settings *settings, const char *file)
 	      settings->clock_x = (unsigned int)atoi (value);
 	    else if (strcmp (key, "clock_y") == 0)
 	      settings->clock_y = (unsigned int)atoi (value);
+	    else if (strcmp (key, "show_seconds") == 0)
+	      settings->show_seconds = (unsigned int)atoi (value);
+	    else if (strcmp (key, "prefetch_max_kb") == 0)
+	      settings->prefetch_max_kb = (unsigned int)atoi (value);
+	    else if (strcmp (key, "frame_cache_max") == 0)
+	      settings->frame_cache_max = (unsigned int)atoi (value);
+	    else if (strcmp (key, "flash_cache_max") == 0)
+	      settings->flash_cache_max = (unsigned int)atoi (value);
+	    else if (strcmp (key, "display_mode") == 0)
+	      settings_parse_display_mode (value, &settings->display_mode);
 	    printf ("key=%s, val=%s\n", key, value);
 	    }
 	  }
@@ -0,0 +1,170 @@
+/* =======================================================================
+
+  pico-photo-clock
+
+  tests/fontcheck.c
+
+  A host check of the font handler's streaming path. Every glyph of
+  the run-length encoded and atlas fonts is drawn as the clock draws it
+  -- fonthandler_draw_glyph and fonthandler_draw_glyph_scaled, which
+  send pixels to the display as they are decoded -- into a simulated
+  display, and compared with the glyph that fonthandler_get_glyph_565
+  decodes into a buffer. The display functions here stand in for the
+  ones in the LCD driver, so the pixel stream can be captured.
+
+  Usage: fontcheck
+
+  Exits with status 0 if every glyph matches, or 1 if any doesn't.
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+ ======================================================================= */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <gfx/fonthandler.h>
+#include "dejavu_sans_mono_36_rle.h"
+#include "dejavu_sans_mono_72_atlas.h"
+
+#define FONTCHECK_MAX_SCALE 3
+#define FONTCHECK_MAX_PIXELS (72 * 72 * FONTCHECK_MAX_SCALE \
+          * FONTCHECK_MAX_SCALE)
+
+/* =======================================================================
+  The simulated display. Only the window being drawn is kept, as the
+    check draws one glyph at a time, always at the origin.
+ ======================================================================= */
+static uint16_t fontcheck_window[FONTCHECK_MAX_PIXELS];
+static unsigned int fontcheck_window_size; // Pixels in the window
+static unsigned int fontcheck_window_pos; // Pixels sent so far
+static bool fontcheck_overrun; // More pixels sent than the window holds
+
+static void fontcheck_put (uint16_t pixel)
+  {
+  if (fontcheck_window_pos < fontcheck_window_size)
+    fontcheck_window[fontcheck_window_pos++] = pixel;
+  else
+    fontcheck_overrun = true;
+  }
+
+void wslcd_begin_window (const WSLCD *self, uint16_t x, uint16_t y,
+         uint16_t w, uint16_t h)
+  {
+  (void)self; (void)x; (void)y;
+  fontcheck_window_size = (unsigned int)w * h;
+  if (fontcheck_window_size > FONTCHECK_MAX_PIXELS)
+    fontcheck_window_size = FONTCHECK_MAX_PIXELS;
+  fontcheck_window_pos = 0;
+  fontcheck_overrun = false;
+  }
+
+void wslcd_stream_pixels (const WSLCD *self, const uint16_t *buff, int len)
+  {
+  (void)self;
+  for (int i = 0; i < len; i++) fontcheck_put (buff[i]);
+  }
+
+void wslcd_stream_repeated (const WSLCD *self, uint16_t colour, int len)
+  {
+  (void)self;
+  for (int i = 0; i < len; i++) fontcheck_put (colour);
+  }
+
+void wslcd_end_window (const WSLCD *self)
+  {
+  (void)self;
+  }
+
+void wslcd_write_window (const WSLCD *self, const uint16_t *buffer,
+         uint16_t w, uint16_t h, uint16_t x, uint16_t y)
+  {
+  wslcd_begin_window (self, x, y, w, h);
+  wslcd_stream_pixels (self, buffer, (int)w * h);
+  wslcd_end_window (self);
+  }
+
+/* =======================================================================
+  fontcheck_glyph
+  Draw character c at the given scale, and compare what reached the
+    display with the buffered glyph, enlarged. Returns the number of
+    pixels that differ, or were missing.
+ ======================================================================= */
+static unsigned int fontcheck_glyph (FontHandler *fh, int c,
+         unsigned int scale)
+  {
+  unsigned int w = fonthandler_get_font_width (fh);
+  unsigned int h = fonthandler_get_font_height (fh);
+
+  if (scale == 1)
+    fonthandler_draw_glyph (fh, NULL, c, 0, 0);
+  else
+    fonthandler_draw_glyph_scaled (fh, NULL, c, 0, 0, scale);
+  unsigned int sent = fontcheck_window_pos;
+  const uint16_t *expected = fonthandler_get_glyph_565 (fh, c);
+
+  unsigned int bad = 0;
+  if (fontcheck_overrun || sent != w * h * scale * scale)
+    bad++;
+  for (unsigned int i = 0; i < sent; i++)
+    {
+    unsigned int x = (i % (w * scale)) / scale;
+    unsigned int y = (i / (w * scale)) / scale;
+    if (fontcheck_window[i] != expected[y * w + x]) bad++;
+    }
+  return bad;
+  }
+
+/* =======================================================================
+  fontcheck_font
+  Check every character, and one that is not in any font, at each scale.
+    Returns the number of glyphs that failed.
+ ======================================================================= */
+static unsigned int fontcheck_font (FontHandler *fh, const char *name)
+  {
+  unsigned int failed = 0, checked = 0;
+  for (unsigned int scale = 1; scale <= FONTCHECK_MAX_SCALE; scale++)
+    {
+    for (int c = 31; c <= 126; c++)
+      {
+      unsigned int bad = fontcheck_glyph (fh, c, scale);
+      checked++;
+      if (bad)
+        {
+        printf ("%s: character %d at scale %u: %u pixels differ\n",
+          name, c, scale, bad);
+        failed++;
+        }
+      }
+    }
+  printf ("%s: %u glyphs checked, %u failed\n", name, checked, failed);
+  return failed;
+  }
+
+/* =======================================================================
+  main
+ ======================================================================= */
+int main (void)
+  {
+  unsigned int failed = 0;
+
+  FontHandler *rle = fonthandler_new_rle (dejavu_sans_mono_36_rle_data,
+     dejavu_sans_mono_36_rle_offsets, dejavu_sans_mono_36_rle_width,
+     dejavu_sans_mono_36_rle_height);
+  failed += fontcheck_font (rle, "rle");
+  // Colours that aren't black and white, so every palette entry is
+  //   different
+  fonthandler_set_colours (rle, 0xFFE0, 0x0010);
+  failed += fontcheck_font (rle, "rle, yellow on blue");
+  fonthandler_destroy (rle);
+
+  FontHandler *atlas = fonthandler_new_atlas
+     (dejavu_sans_mono_72_atlas_pixels, dejavu_sans_mono_72_atlas_offsets,
+     dejavu_sans_mono_72_atlas_width, dejavu_sans_mono_72_atlas_height);
+  failed += fontcheck_font (atlas, "atlas");
+  fonthandler_destroy (atlas);
+
+  return failed ? 1 : 0;
+  }
+
@@ -0,0 +1,342 @@
+/* =======================================================================
+
+  pico-photo-clock
+
+  tests/sdemucheck.c
+
+  A host check of the SD card driver, running against the emulated card
+  in sdcard/sdemu.h. The card is initialized, sectors are written and
+  read back singly (CMD24, CMD17) and in runs (CMD25, CMD18), then 
+  read asynchronously, to see that the sectors arrive one at a time while
+  the caller is doing something else, and then each kind of fault the
+  emulator can inject is tried, to see that the driver retries, lowers
+  the clock, or gives up, as it should.
+
+  The card is backed by a temporary image file, which is deleted at
+  the end.
+
+  Usage: sdemucheck
+
+  Exits with status 0 if every check passes, or 1 if any fails.
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+ ======================================================================= */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <pico/stdlib.h>
+#include <sdcard/sdcard.h>
+#include <sdcard/sdemu.h>
+#include "config.h"
+
+// The size of the emulated card, in sectors
+#define SDEMUCHECK_SECTORS 2048
+// The longest run of sectors read or written at once
+#define SDEMUCHECK_MAX_RUN 16
+
+static char sdemucheck_image[] = "/tmp/sdemucheck-XXXXXX";
+static unsigned int sdemucheck_failed;
+
+/* =======================================================================
+  sdemucheck_expect
+  Report one check
+ ======================================================================= */
+static void sdemucheck_expect (bool ok, const char *what)
+  {
+  printf ("%s: %s\n", ok ? "ok" : "FAILED", what);
+  if (!ok) sdemucheck_failed++;
+  }
+
+/* =======================================================================
+  sdemucheck_fill
+  Fill count sectors with a pattern that depends on the sector number
+    and a seed, so that every write is different.
+ ======================================================================= */
+static void sdemucheck_fill (uint8_t *buff, uint32_t start, uint32_t count,
+         uint8_t seed)
+  {
+  for (uint32_t s = 0; s < count; s++)
+    for (unsigned int i = 0; i < 512; i++)
+      buff[s * 512 + i] = (uint8_t)((start + s) * 7 + i + seed);
+  }
+
+/* =======================================================================
+  sdemucheck_open
+  Create an emulated card from a configuration string, in the form of
+    PPC_SDEMU, attach it to a new SDCard, and initialize the card. Sets
+    err to the result of sdcard_insert_card.
+ ======================================================================= */
+static SDCard *sdemucheck_open (const char *spec, SDEmu **emu, SDError *err)
+  {
+  SDEmuConfig config;
+  sdemu_config_defaults (&config);
+  sdemu_config_parse (&config, spec);
+  *emu = sdemu_new (sdemucheck_image, &config);
+  if (!*emu)
+    {
+    fprintf (stderr, "Can't open %s\n", sdemucheck_image);
+    exit (1);
+    }
+  SDCard *sdcard = sdcard_new (SD_SPI, SD_DRIVE_STRENGTH, SD_CHIP_SELECT,
+   SD_MISO, SD_MOSI, SD_SCK, SD_BAUD);
+  sdcard_set_high_speed_baud (sdcard, SD_HIGH_SPEED_BAUD);
+  sdcard_attach_emulator (sdcard, *emu);
+  sdcard_init (sdcard);
+  *err = sdcard_insert_card (sdcard);
+  return sdcard;
+  }
+
+static void sdemucheck_close (SDCard *sdcard, SDEmu *emu)
+  {
+  sdcard_destroy (sdcard);
+  sdemu_destroy (emu);
+  }
+
+/* =======================================================================
+  sdemucheck_round_trip
+  Write count sectors at start, read them back, and check them. Returns
+    true if the data came back unchanged.
+ ======================================================================= */
+static bool sdemucheck_round_trip (SDCard *sdcard, uint32_t start,
+         uint32_t count, uint8_t seed)
+  {
+  static uint8_t out[SDEMUCHECK_MAX_RUN * 512];
+  static uint8_t in[SDEMUCHECK_MAX_RUN * 512];
+  sdemucheck_fill (out, start, count, seed);
+  memset (in, 0, sizeof (in));
+  if (sdcard_write_sectors (sdcard, out, start, count) != 0) return false;
+  if (sdcard_read_sectors (sdcard, in, start, count) != 0) return false;
+  return memcmp (in, out, count * 512) == 0;
+  }
+
+/* =======================================================================
+  sdemucheck_basic
+  Initialization, and single- and multi-block transfers, on a card
+    that doesn't misbehave.
+ ======================================================================= */
+static void sdemucheck_basic (void)
+  {
+  SDEmu *emu;
+  SDError err;
+  SDCard *sdcard = sdemucheck_open ("", &emu, &err);
+  SDCardInfo info;
+  sdcard_get_info (sdcard, &info);
+  sdemucheck_expect (err == 0, "card initializes");
+  sdemucheck_expect (info.type == SDCARD_V2HC, "card is SDHC");
+  sdemucheck_expect (info.sectors == SDEMUCHECK_SECTORS,
+    "card size matches the image");
+  sdemucheck_expect (info.high_speed
+    && info.baud_rate == SD_HIGH_SPEED_BAUD,
+    "card switches to high-speed mode");
+
+  const SDEmuStats *stats = sdemu_get_stats (emu);
+  unsigned int written = stats->sectors_written;
+  unsigned int read = stats->sectors_read;
+  sdemucheck_expect (sdemucheck_round_trip (sdcard, 5, 1, 1),
+    "single sector written (CMD24) and read (CMD17)");
+  sdemucheck_expect (sdemucheck_round_trip (sdcard, 100,
+    SDEMUCHECK_MAX_RUN, 2),
+    "run of sectors written (CMD25) and read (CMD18)");
+  // A card may start on the sector after the end of a multi-block read
+  //   before it sees the stop command, so more may be read than asked for
+  sdemucheck_expect (stats->sectors_written - written
+    == 1 + SDEMUCHECK_MAX_RUN && stats->sectors_read - read
+    >= 1 + SDEMUCHECK_MAX_RUN, "card wrote each sector once");
+  // A command after a multi-block write only works if the write was
+  //   ended properly
+  sdemucheck_expect (sdemucheck_round_trip (sdcard, SDEMUCHECK_SECTORS - 1,
+    1, 3), "last sector written and read");
+
+  uint8_t buff[512];
+  sdemucheck_expect (sdcard_read_sectors (sdcard, buff,
+    SDEMUCHECK_SECTORS, 1) != 0, "read beyond the card fails");
+
+  sdcard_get_info (sdcard, &info);
+  sdemucheck_expect (info.fallbacks == 0 && info.crc_errors == 0
+    && info.timeouts == 0, "no errors counted");
+  sdemucheck_close (sdcard, emu);
+
+  // The data should have reached the image
+  FILE *f = fopen (sdemucheck_image, "rb");
+  uint8_t expected[512];
+  sdemucheck_fill (expected, 5, 1, 1);
+  bool ok = f && fseek (f, 5 * 512, SEEK_SET) == 0
+    && fread (buff, 1, 512, f) == 512 && memcmp (buff, expected, 512) == 0;
+  if (f) fclose (f);
+  sdemucheck_expect (ok, "written data is in the image");
+  }
+
+/* =======================================================================
+  sdemucheck_async
+  An asynchronous read, with sdcard_read_begin, etc. The emulated card
+    takes a while to find each sector, so sdcard_read_wait should say
+    SD_ERR_BUSY a few times before each sector arrives, and the caller
+    does its own work in the meantime.
+ ======================================================================= */
+static void sdemucheck_async (void)
+  {
+  SDEmu *emu;
+  SDError err;
+  SDCard *sdcard = sdemucheck_open ("read_latency=200", &emu, &err);
+  static uint8_t expected[SDEMUCHECK_MAX_RUN * 512];
+  static uint8_t buff[SDCARD_READ_QUEUE][512];
+  const uint32_t start = 800;
+  sdemucheck_fill (expected, start, SDEMUCHECK_MAX_RUN, 7);
+  sdemucheck_expect (err == 0 && sdcard_write_sectors (sdcard, expected,
+    start, SDEMUCHECK_MAX_RUN) == 0, "sectors written for async read");
+
+  err = sdcard_read_begin (sdcard, start, SDEMUCHECK_MAX_RUN);
+  sdemucheck_expect (err == 0, "async read begins");
+  uint32_t queued = 0;
+  for (int i = 0; i < SDCARD_READ_QUEUE && err == 0; i++, queued++)
+    err = sdcard_read_queue (sdcard, buff[i]);
+  sdemucheck_expect (err == 0 
+    && sdcard_read_queue (sdcard, buff[0]) == SD_ERR_PARAMETER,
+    "no more than SDCARD_READ_QUEUE buffers can be queued");
+
+  // "Work" is just counting, here
+  uint32_t done = 0;
+  bool in_order = true, intact = true, overlapped = true;
+  while (done < SDEMUCHECK_MAX_RUN && err == 0)
+    {
+    unsigned int work = 0;
+    uint8_t *sector;
+    while ((err = sdcard_read_wait (sdcard, &sector)) == SD_ERR_BUSY)
+      work++;
+    if (err != 0) break;
+    if (work == 0) overlapped = false;
+    if (sector != buff[done % SDCARD_READ_QUEUE]) in_order = false;
+    if (memcmp (sector, expected + done * 512, 512) != 0) intact = false;
+    done++;
+    if (queued < SDEMUCHECK_MAX_RUN)
+      {
+      err = sdcard_read_queue (sdcard, sector);
+      queued++;
+      }
+    }
+  SDError end_err = sdcard_read_end (sdcard);
+  sdemucheck_expect (err == 0 && end_err == 0 
+    && done == SDEMUCHECK_MAX_RUN, "async read completes");
+  sdemucheck_expect (overlapped, 
+    "... each sector is not ready until the caller has done some work");
+  sdemucheck_expect (in_order, "... sectors arrive in the order queued");
+  sdemucheck_expect (intact, "... and the data is intact");
+  sdemucheck_expect (sdemucheck_round_trip (sdcard, start, 1, 8),
+    "card takes the next command after an async read");
+
+  // Abandoning a read part-way must leave the card usable
+  err = sdcard_read_begin (sdcard, start, SDEMUCHECK_MAX_RUN);
+  uint8_t *sector;
+  if (err == 0) err = sdcard_read_queue (sdcard, buff[0]);
+  if (err == 0)
+    {
+    do
+      err = sdcard_read_wait (sdcard, &sector);
+    while (err == SD_ERR_BUSY);
+    }
+  sdcard_read_end (sdcard);
+  sdemucheck_expect (err == 0 && sdemucheck_round_trip (sdcard, start, 1, 9),
+    "card recovers from an abandoned async read");
+  sdemucheck_close (sdcard, emu);
+  }
+
+/* =======================================================================
+  sdemucheck_faults
+  Each kind of fault, one card at a time
+ ======================================================================= */
+static void sdemucheck_faults (void)
+  {
+  SDEmu *emu;
+  SDError err;
+  SDCardInfo info;
+  uint8_t buff[SDEMUCHECK_MAX_RUN * 512];
+
+  // A card that never answers, as if there were none. This should fail
+  //   without lowering the clock.
+  SDCard *sdcard = sdemucheck_open ("no_response=1", &emu, &err);
+  sdcard_get_info (sdcard, &info);
+  sdemucheck_expect (err != 0, "card that doesn't answer is not initialized");
+  sdemucheck_expect (info.fallbacks == 0,
+    "... and the clock is not lowered");
+  sdemucheck_close (sdcard, emu);
+
+  // Every second sector read has a bad CRC. The read is retried at a 
+  //   lower rate, and the data arrives intact.
+  sdcard = sdemucheck_open ("crc_error=2", &emu, &err);
+  sdemucheck_expect (err == 0 && sdemucheck_round_trip (sdcard, 200, 1, 4)
+    && sdemucheck_round_trip (sdcard, 201, 1, 4),
+    "reads with CRC errors are retried");
+  sdcard_get_info (sdcard, &info);
+  sdemucheck_expect (info.crc_errors == 1 && info.fallbacks == 1,
+    "... and the clock is lowered");
+  sdemucheck_close (sdcard, emu);
+
+  // A card that corrupts data above 25 MHz should end up at the
+  //   default-speed rate
+  sdcard = sdemucheck_open ("max_baud=25000000", &emu, &err);
+  sdemucheck_expect (err == 0 && sdemucheck_round_trip (sdcard, 300,
+    SDEMUCHECK_MAX_RUN, 5), "card that is too slow for high speed works");
+  sdcard_get_info (sdcard, &info);
+  sdemucheck_expect (info.fallbacks == 1 && info.baud_rate == SD_BAUD,
+    "... at the default-speed rate");
+  sdemucheck_close (sdcard, emu);
+
+  // Every second sector written is rejected. The rejection is a CRC
+  //   error, so the write is retried at a lower rate.
+  sdcard = sdemucheck_open ("write_reject=2", &emu, &err);
+  sdemucheck_expect (err == 0 && sdemucheck_round_trip (sdcard, 400, 1, 6)
+    && sdemucheck_round_trip (sdcard, 401, 1, 6),
+    "rejected writes are retried");
+  sdcard_get_info (sdcard, &info);
+  sdemucheck_expect (info.fallbacks == 1, "... and the clock is lowered");
+  sdemucheck_close (sdcard, emu);
+
+  // Every second sector read never arrives. The first timeout comes
+  //   after a read has worked at the high-speed rate, so it is retried
+  //   at the default rate; the next is not retried.
+  sdcard = sdemucheck_open ("read_timeout=2", &emu, &err);
+  bool ok = err == 0 && sdcard_read_sectors (sdcard, buff, 500, 1) == 0
+    && sdcard_read_sectors (sdcard, buff, 501, 1) == 0;
+  sdcard_get_info (sdcard, &info);
+  sdemucheck_expect (ok && info.timeouts == 1 && info.fallbacks == 1
+    && info.baud_rate == SD_BAUD,
+    "read that times out at high speed is retried at the default rate");
+  err = sdcard_read_sectors (sdcard, buff, 502, 1);
+  sdcard_get_info (sdcard, &info);
+  sdemucheck_expect (err == SD_ERR_NO_RESPONSE && info.timeouts == 2
+    && info.fallbacks == 1,
+    "read that times out at the default rate fails");
+  // A multi-block read that stalls part way must leave the card able
+  //   to take the next command
+  err = sdcard_read_sectors (sdcard, buff, 600, 3);
+  sdemucheck_expect (sdcard_read_sectors (sdcard, buff, 700, 1) == 0,
+    "card recovers from a stalled multi-block read");
+  sdemucheck_close (sdcard, emu);
+  }
+
+/* =======================================================================
+  main
+ ======================================================================= */
+int main (void)
+  {
+  int fd = mkstemp (sdemucheck_image);
+  if (fd < 0 || ftruncate (fd, SDEMUCHECK_SECTORS * 512) != 0)
+    {
+    fprintf (stderr, "Can't create %s\n", sdemucheck_image);
+    return 1;
+    }
+  close (fd);
+
+  sdemucheck_basic ();
+  sdemucheck_async ();
+  sdemucheck_faults ();
+
+  unlink (sdemucheck_image);
+  printf ("%u checks failed\n", sdemucheck_failed);
+  return sdemucheck_failed ? 1 : 0;
+  }
+
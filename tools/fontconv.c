@@ -0,0 +1,402 @@
+/* =======================================================================
+
+  pico-photo-clock
+
+  tools/fontconv.c
+
+  A host utility that converts one of the JPEG fonts generated by
+  makefont.pl into a pre-rendered glyph atlas, for use with
+  fonthandler_new_atlas(). Each glyph is decoded using the same code as
+  the Pico uses, blended between a foreground and a background colour,
+  and written out as RGB565. The atlas is an array of const data, so it
+  ends up in flash, from where the clock can DMA it straight to the
+  display.
+
+  With -r, it writes a run-length encoded font instead, for use with
+  fonthandler_new_rle(). Glyphs are stored as 4-bit coverage values, 
+  with runs of background and foreground pixels collapsed to a single 
+  byte; the colours are set at run time, so -f and -b are ignored. The
+  encoded font is decoded again, using the same code as the Pico, and
+  compared with the original glyphs; fontconv fails if they differ.
+
+  Usage: fontconv [-r] [-c chars] [-f rrggbb] [-b rrggbb] 
+                    {font} {output_name}
+
+  For example
+
+    fontconv -c 0123456789: dejavu_sans_mono_72 dejavu_sans_mono_72_atlas
+
+  writes dejavu_sans_mono_72_atlas.c and dejavu_sans_mono_72_atlas.h,
+  containing only the characters needed by the clock. A full atlas of
+  a 72-point font is about 700kB, so it's best to be selective. An RLE
+  font is small enough to hold the full character set:
+
+    fontconv -r dejavu_sans_mono_36 dejavu_sans_mono_36_rle
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+ ======================================================================= */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <gfx/fonthandler.h>
+#include "courier_bold_36.h"
+#include "courier_bold_72.h"
+#include "dejavu_sans_mono_36.h"
+#include "dejavu_sans_mono_72.h"
+
+/* =======================================================================
+  The JPEG fonts we know about.
+ ======================================================================= */
+typedef struct _FontconvFont
+  {
+  const char *name;
+  unsigned char **data;
+  unsigned int **length;
+  unsigned int *width;
+  unsigned int *height;
+  } FontconvFont;
+
+static const FontconvFont fonts[] =
+  {
+  { "courier_bold_36", courier_bold_36_data, courier_bold_36_length,
+    &courier_bold_36_width, &courier_bold_36_height },
+  { "courier_bold_72", courier_bold_72_data, courier_bold_72_length,
+    &courier_bold_72_width, &courier_bold_72_height },
+  { "dejavu_sans_mono_36", dejavu_sans_mono_36_data,
+    dejavu_sans_mono_36_length, &dejavu_sans_mono_36_width,
+    &dejavu_sans_mono_36_height },
+  { "dejavu_sans_mono_72", dejavu_sans_mono_72_data,
+    dejavu_sans_mono_72_length, &dejavu_sans_mono_72_width,
+    &dejavu_sans_mono_72_height },
+  { NULL, NULL, NULL, NULL, NULL }
+  };
+
+/* =======================================================================
+  fontconv_blend
+  Mix the foreground and background colours (RGB888) in the proportion
+    given by the glyph intensity, and convert to RGB565.
+ ======================================================================= */
+static uint16_t fontconv_blend (uint32_t fg, uint32_t bg, unsigned int i)
+  {
+  unsigned int c[3];
+  for (int k = 0; k < 3; k++)
+    {
+    unsigned int f = (fg >> (16 - 8 * k)) & 0xFF;
+    unsigned int b = (bg >> (16 - 8 * k)) & 0xFF;
+    c[k] = (f * i + b * (255 - i) + 127) / 255;
+    }
+  return (uint16_t)(((c[0] & 0xF8) << 8) | ((c[1] & 0xFC) << 3)
+    | (c[2] >> 3));
+  }
+
+/* =======================================================================
+  fontconv_write_header
+ ======================================================================= */
+static int fontconv_write_header (const char *out, int rle)
+  {
+  char path[256];
+  snprintf (path, sizeof (path), "%s.h", out);
+  FILE *f = fopen (path, "w");
+  if (!f)
+    {
+    fprintf (stderr, "Can't open %s for writing\n", path);
+    return 1;
+    }
+  fprintf (f, "// This file is automatically generated. Do not edit\n");
+  fprintf (f, "#include <stdint.h>\n");
+  if (rle)
+    fprintf (f, "extern const uint8_t %s_data[];\n", out);
+  else
+    fprintf (f, "extern const uint16_t %s_pixels[];\n", out);
+  fprintf (f, "extern const uint32_t %s_offsets[95];\n", out);
+  fprintf (f, "extern const unsigned int %s_width;\n", out);
+  fprintf (f, "extern const unsigned int %s_height;\n", out);
+  fclose (f);
+  return 0;
+  }
+
+/* =======================================================================
+  fontconv_write_atlas
+ ======================================================================= */
+static int fontconv_write_atlas (const FontconvFont *font, const char *chars,
+              uint32_t fg, uint32_t bg, const char *out)
+  {
+  char path[256];
+  snprintf (path, sizeof (path), "%s.c", out);
+  FILE *f = fopen (path, "w");
+  if (!f)
+    {
+    fprintf (stderr, "Can't open %s for writing\n", path);
+    return 1;
+    }
+
+  unsigned int w = *font->width;
+  unsigned int h = *font->height;
+  FontHandler *fh = fonthandler_new (font->data, font->length, w, h);
+
+  uint32_t offsets[95];
+  uint32_t next = 0;
+
+  fprintf (f, "// This file is automatically generated. Do not edit\n");
+  fprintf (f, "// Generated by fontconv from %s, foreground %06X, "
+              "background %06X\n", font->name, fg, bg);
+  fprintf (f, "#include \"%s.h\"\n", out);
+  fprintf (f, "const uint16_t %s_pixels[] = {", out);
+
+  int column = 0;
+  for (int c = 32; c <= 126; c++)
+    {
+    offsets[c - 32] = FONTHANDLER_NO_GLYPH;
+    if (chars && !strchr (chars, c)) continue;
+    offsets[c - 32] = next;
+    const unsigned char *glyph = fonthandler_get_glyph (fh, c);
+    for (unsigned int i = 0; i < w * h; i++)
+      {
+      if (column == 0) fprintf (f, "\n ");
+      fprintf (f, " 0x%04x,", fontconv_blend (fg, bg, glyph[i]));
+      column = (column + 1) % 12;
+      }
+    next += w * h;
+    }
+  fprintf (f, "\n  };\n");
+
+  fprintf (f, "const uint32_t %s_offsets[95] = {", out);
+  for (int i = 0; i < 95; i++)
+    {
+    if (i % 6 == 0) fprintf (f, "\n ");
+    fprintf (f, " 0x%08x,", offsets[i]);
+    }
+  fprintf (f, "\n  };\n");
+
+  fprintf (f, "const unsigned int %s_width = %u;\n", out, w);
+  fprintf (f, "const unsigned int %s_height = %u;\n", out, h);
+  fclose (f);
+
+  fonthandler_destroy (fh);
+  printf ("%s: %u glyphs, %u bytes\n", path, next / (w * h),
+    next * (unsigned int)sizeof (uint16_t));
+  return 0;
+  }
+
+/* =======================================================================
+  fontconv_coverage
+  Quantize a glyph intensity to the 4-bit coverage stored in RLE fonts
+ ======================================================================= */
+static unsigned int fontconv_coverage (unsigned char intensity)
+  {
+  return (intensity * 15u + 127) / 255;
+  }
+
+/* =======================================================================
+  fontconv_run_length
+  The number of pixels from q[i] that have the same coverage as q[i]
+ ======================================================================= */
+static unsigned int fontconv_run_length (const uint8_t *q, unsigned int i, 
+         unsigned int len)
+  {
+  unsigned int n = 1;
+  while (i + n < len && q[i + n] == q[i]) n++;
+  return n;
+  }
+
+/* =======================================================================
+  fontconv_encode_glyph
+  Encode len coverage values into out, which must be big enough for the
+    worst case (all literals). Returns the number of bytes written. Runs
+    of blank or solid pixels shorter than three are left in literals, 
+    where they cost less than starting a new op.
+ ======================================================================= */
+static unsigned int fontconv_encode_glyph (const uint8_t *q, unsigned int len,
+         uint8_t *out)
+  {
+  unsigned int i = 0, o = 0;
+  while (i < len)
+    {
+    unsigned int run = fontconv_run_length (q, i, len);
+    if ((q[i] == 0 || q[i] == 15) && run >= 3)
+      {
+      if (run > FONTHANDLER_RLE_MAX_RUN) run = FONTHANDLER_RLE_MAX_RUN;
+      out[o++] = (uint8_t)((q[i] ? FONTHANDLER_RLE_SOLID 
+        : FONTHANDLER_RLE_BLANK) | (run - 1));
+      i += run;
+      continue;
+      }
+
+    unsigned int n = 0;
+    while (i + n < len && n < FONTHANDLER_RLE_MAX_LITERAL)
+      {
+      unsigned int j = i + n;
+      if ((q[j] == 0 || q[j] == 15) && fontconv_run_length (q, j, len) >= 3)
+        break;
+      n++;
+      }
+    out[o++] = (uint8_t)(FONTHANDLER_RLE_LITERAL | (n - 1));
+    for (unsigned int k = 0; k < n; k += 2)
+      {
+      uint8_t hi = q[i + k];
+      uint8_t lo = (k + 1 < n) ? q[i + k + 1] : 0;
+      out[o++] = (uint8_t)(hi << 4 | lo);
+      }
+    i += n;
+    }
+  return o;
+  }
+
+/* =======================================================================
+  fontconv_write_rle
+ ======================================================================= */
+static int fontconv_write_rle (const FontconvFont *font, const char *chars,
+              const char *out)
+  {
+  unsigned int w = *font->width;
+  unsigned int h = *font->height;
+  FontHandler *fh = fonthandler_new (font->data, font->length, w, h);
+
+  // Worst case: one op byte per 128 pixels, plus half a byte per pixel
+  uint8_t *data = malloc (95 * (w * h + w * h / 2 + 2));
+  uint8_t *q = malloc (w * h);
+  uint32_t offsets[95];
+  uint32_t next = 0;
+  unsigned int jpeg_bytes = 0;
+
+  for (int c = 32; c <= 126; c++)
+    {
+    offsets[c - 32] = FONTHANDLER_NO_GLYPH;
+    if (chars && !strchr (chars, c)) continue;
+    offsets[c - 32] = next;
+    jpeg_bytes += *font->length[c - 32];
+    const unsigned char *glyph = fonthandler_get_glyph (fh, c);
+    for (unsigned int i = 0; i < w * h; i++)
+      q[i] = (uint8_t)fontconv_coverage (glyph[i]);
+    next += fontconv_encode_glyph (q, w * h, data + next);
+    }
+
+  // Decode everything again and check that it matches the quantized 
+  //   original, pixel for pixel 
+  int errors = 0;
+  FontHandler *check = fonthandler_new_rle (data, offsets, w, h);
+  for (int c = 32; c <= 126; c++)
+    {
+    if (offsets[c - 32] == FONTHANDLER_NO_GLYPH) continue;
+    const unsigned char *glyph = fonthandler_get_glyph (fh, c);
+    const unsigned char *decoded = fonthandler_get_glyph (check, c);
+    for (unsigned int i = 0; i < w * h; i++)
+      {
+      if (decoded[i] != fontconv_coverage (glyph[i]) * 17)
+        {
+        fprintf (stderr, "Mismatch in '%c' at pixel %u\n", c, i);
+        errors++;
+        break;
+        }
+      }
+    }
+  fonthandler_destroy (check);
+  fonthandler_destroy (fh);
+  free (q);
+
+  if (errors)
+    {
+    free (data);
+    return 1;
+    }
+
+  char path[256];
+  snprintf (path, sizeof (path), "%s.c", out);
+  FILE *f = fopen (path, "w");
+  if (!f)
+    {
+    fprintf (stderr, "Can't open %s for writing\n", path);
+    free (data);
+    return 1;
+    }
+
+  fprintf (f, "// This file is automatically generated. Do not edit\n");
+  fprintf (f, "// Generated by fontconv -r from %s\n", font->name);
+  fprintf (f, "#include \"%s.h\"\n", out);
+  fprintf (f, "const uint8_t %s_data[] = {", out);
+  for (uint32_t i = 0; i < next; i++)
+    {
+    if (i % 16 == 0) fprintf (f, "\n ");
+    fprintf (f, " 0x%02x,", data[i]);
+    }
+  fprintf (f, "\n  };\n");
+
+  fprintf (f, "const uint32_t %s_offsets[95] = {", out);
+  for (int i = 0; i < 95; i++)
+    {
+    if (i % 6 == 0) fprintf (f, "\n ");
+    fprintf (f, " 0x%08x,", offsets[i]);
+    }
+  fprintf (f, "\n  };\n");
+
+  fprintf (f, "const unsigned int %s_width = %u;\n", out, w);
+  fprintf (f, "const unsigned int %s_height = %u;\n", out, h);
+  fclose (f);
+  free (data);
+
+  printf ("%s: %u bytes of RLE data (JPEG: %u bytes), verified\n", path,
+    next, jpeg_bytes);
+  return 0;
+  }
+
+/* =======================================================================
+  usage
+ ======================================================================= */
+static void usage (const char *argv0)
+  {
+  fprintf (stderr, "Usage: %s [-r] [-c chars] [-f rrggbb] [-b rrggbb] "
+    "{font} {output_name}\n", argv0);
+  fprintf (stderr, "Fonts:");
+  for (const FontconvFont *font = fonts; font->name; font++)
+    fprintf (stderr, " %s", font->name);
+  fprintf (stderr, "\n");
+  }
+
+/* =======================================================================
+  main
+ ======================================================================= */
+int main (int argc, char **argv)
+  {
+  const char *chars = NULL;
+  uint32_t fg = 0xFFFFFF;
+  uint32_t bg = 0x000000;
+  int rle = 0;
+  int opt;
+  while ((opt = getopt (argc, argv, "rc:f:b:")) != -1)
+    {
+    switch (opt)
+      {
+      case 'r': rle = 1; break;
+      case 'c': chars = optarg; break;
+      case 'f': fg = (uint32_t)strtoul (optarg, NULL, 16); break;
+      case 'b': bg = (uint32_t)strtoul (optarg, NULL, 16); break;
+      default: usage (argv[0]); return 1;
+      }
+    }
+
+  if (argc - optind != 2)
+    {
+    usage (argv[0]);
+    return 1;
+    }
+
+  const FontconvFont *font = fonts;
+  while (font->name && strcmp (font->name, argv[optind]) != 0)
+    font++;
+  if (!font->name)
+    {
+    fprintf (stderr, "Unknown font: %s\n", argv[optind]);
+    usage (argv[0]);
+    return 1;
+    }
+
+  const char *out = argv[optind + 1];
+  if (fontconv_write_header (out, rle)) return 1;
+  if (rle)
+    return fontconv_write_rle (font, chars, out);
+  return fontconv_write_atlas (font, chars, fg, bg, out);
+  }
+
@@ -0,0 +1,323 @@
+/* =======================================================================
+
+  pico-photo-clock
+
+  tools/ppcbench.c
+
+  A host utility that runs the clock's start-up against SD card images
+  -- usually ones made by tools/ppcimage -- and reports how long each
+  stage takes, and how much memory the program has allocated, so that
+  the cost of a big photo collection can be tracked as the code
+  changes. The stages are those of main():
+
+    mount     initialize the card and mount the file system
+    find      find the first CATALOG_START_PHOTOS photos
+    settings  read the settings file
+    clock     create the photo clock
+    first     draw the first photo, and read the next one ahead
+    catalog   find the rest of the photos, as the idle task does
+    next      show the next photo, which shuffles the whole catalog
+
+  Times are measured on the host, so they are only useful for
+  comparing one image, or one build, with another. If HOST_SD_EMULATOR
+  is set in config.h, the emulated card's estimate of the time the
+  SD bus would have taken on the Pico is reported too. Memory is
+  counted by wrapping malloc() and friends, and is what the Pico's
+  heap would have to hold, give or take the allocator's overheads;
+  'peak' is the most that was allocated at any one time.
+
+  The host display driver's messages are mixed in with the output; the
+  results are printed together, at the end.
+
+  Usage: ppcbench {image...}
+
+  For example
+
+    ppcimage -n 10000 /tmp/10k.img
+    ppcimage -x -n 10000 /tmp/10k-exfat.img
+    ppcbench /tmp/10k.img /tmp/10k-exfat.img
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+ ======================================================================= */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <malloc.h>
+#include <pico/stdlib.h>
+#include <ds3231/ds3231.h>
+#include <waveshare_lcd/waveshare_lcd.h>
+#include <files/files.h>
+#include <files/catalog.h>
+#include <sdcard/sdcard.h>
+#include <sdcard/sdemu.h>
+#include <gfx/gfxconsole.h>
+#include <screens/photoclock.h>
+#include <screens/settings.h>
+#include "config.h"
+
+/* =======================================================================
+  The heap, as seen through the wrappers below
+ ======================================================================= */
+static size_t heap_now;
+static size_t heap_peak;
+
+extern void *__real_malloc (size_t size);
+extern void *__real_calloc (size_t n, size_t size);
+extern void *__real_realloc (void *p, size_t size);
+extern void __real_free (void *p);
+
+/* =======================================================================
+  ppcbench_alloc
+  Count a block that has just been allocated. The peak includes any
+    block that realloc() is about to free, as it would on the Pico if
+    the block can't grow where it is.
+ ======================================================================= */
+static void ppcbench_alloc (void *p, size_t old)
+  {
+  if (!p) return;
+  heap_now += malloc_usable_size (p);
+  if (heap_now > heap_peak) heap_peak = heap_now;
+  heap_now -= old;
+  }
+
+void *__wrap_malloc (size_t size)
+  {
+  void *p = __real_malloc (size);
+  ppcbench_alloc (p, 0);
+  return p;
+  }
+
+void *__wrap_calloc (size_t n, size_t size)
+  {
+  void *p = __real_calloc (n, size);
+  ppcbench_alloc (p, 0);
+  return p;
+  }
+
+void *__wrap_realloc (void *p, size_t size)
+  {
+  size_t old = p ? malloc_usable_size (p) : 0;
+  void *q = __real_realloc (p, size);
+  // If it fails, the old block is still there
+  ppcbench_alloc (q, q ? old : 0);
+  return q;
+  }
+
+void __wrap_free (void *p)
+  {
+  if (p) heap_now -= malloc_usable_size (p);
+  __real_free (p);
+  }
+
+/* =======================================================================
+  The stages, and what was measured in each
+ ======================================================================= */
+typedef enum
+  {
+  STAGE_MOUNT = 0,
+  STAGE_FIND,
+  STAGE_SETTINGS,
+  STAGE_CLOCK,
+  STAGE_FIRST,
+  STAGE_CATALOG,
+  STAGE_NEXT,
+  STAGES
+  } PpcbenchStage;
+
+static const char *stage_names[STAGES] =
+  { "mount", "find", "settings", "clock", "first", "catalog", "next" };
+
+typedef struct _PpcbenchResult
+  {
+  uint64_t us[STAGES];
+  size_t heap[STAGES]; // Allocated at the end of each stage
+  uint64_t bus_us[STAGES]; // Estimated SD bus time, if emulated
+  size_t peak;
+  unsigned int photos;
+  size_t index_bytes;
+  bool ok;
+  } PpcbenchResult;
+
+/* =======================================================================
+  ppcbench_bus_us
+  The emulated card's estimate of the SD bus time so far, or zero
+ ======================================================================= */
+static uint64_t ppcbench_bus_us (const SDCard *sdcard)
+  {
+#if HOST_SD_EMULATOR
+  SDEmu *emu = sdcard_get_emulator (sdcard);
+  if (emu) return sdemu_get_stats (emu)->bus_us;
+#else
+  (void)sdcard;
+#endif
+  return 0;
+  }
+
+/* =======================================================================
+  ppcbench_run
+  Go through the start-up with one image
+ ======================================================================= */
+static void ppcbench_run (const char *image, WSLCD *wslcd,
+        const DS3231 *ds3231, GfxConsole *console, PpcbenchResult *r)
+  {
+  memset (r, 0, sizeof (PpcbenchResult));
+  setenv ("PPC_SDIMAGE", image, 1);
+  size_t base = heap_now;
+  heap_peak = heap_now;
+  int stage = STAGE_MOUNT;
+  uint64_t bus_start = 0;
+  uint64_t start = time_us_64 ();
+
+  // Each stage's figures are taken when the next one starts
+#define PPCBENCH_NEXT(s) \
+    do { \
+    uint64_t now = time_us_64 (); \
+    r->us[stage] = now - start; \
+    r->heap[stage] = heap_now - base; \
+    r->bus_us[stage] = ppcbench_bus_us (sdcard) - bus_start; \
+    bus_start = ppcbench_bus_us (sdcard); \
+    start = time_us_64 (); \
+    stage = s; \
+    } while (0)
+
+  SDCard *sdcard = sdcard_new (SD_SPI, SD_DRIVE_STRENGTH, SD_CHIP_SELECT,
+   SD_MISO, SD_MOSI, SD_SCK, SD_BAUD);
+  sdcard_set_high_speed_baud (sdcard, SD_HIGH_SPEED_BAUD);
+#if HOST_SD_EMULATOR
+  SDEmuConfig emu_config;
+  sdemu_config_defaults (&emu_config);
+  sdemu_config_parse (&emu_config, getenv ("PPC_SDEMU"));
+  SDEmu *emu = sdemu_new (image, &emu_config);
+  if (!emu)
+    {
+    fprintf (stderr, "Can't open %s\n", image);
+    sdcard_destroy (sdcard);
+    return;
+    }
+  sdcard_attach_emulator (sdcard, emu);
+#endif
+  sdcard_init (sdcard);
+  if (sdcard_insert_card (sdcard) != 0 || files_mount () != 0)
+    {
+    fprintf (stderr, "Can't mount %s\n", image);
+    goto done;
+    }
+
+  PPCBENCH_NEXT (STAGE_FIND);
+  Catalog *catalog = catalog_new (JPEG_DIR, JPEG_PATTERN, PACK_PATTERN);
+  CatalogProgress progress;
+  do
+    {
+    catalog_step (catalog, CATALOG_SLICE_US);
+    catalog_get_progress (catalog, &progress);
+    } while (!progress.done && progress.photos < CATALOG_START_PHOTOS);
+
+  PPCBENCH_NEXT (STAGE_SETTINGS);
+  Settings settings;
+  memset (&settings, 0, sizeof (settings));
+  settings.mins_per_background_change = DEFAULT_MINS_PER_PHOTO;
+  settings.clock_x = CLOCK_DEFAULT_X;
+  settings.clock_y = CLOCK_DEFAULT_Y;
+  settings.display_mode = DISPLAY_MODE_PHOTO;
+  settings.prefetch_max_kb = PREFETCH_MAX_KB;
+  settings.frame_cache_max = FRAME_CACHE_MAX_FRAMES;
+  settings.flash_cache_max = FLASH_CACHE_MAX_PHOTOS;
+  settings_from_file (&settings, SETTINGS_FILE);
+
+  PPCBENCH_NEXT (STAGE_CLOCK);
+  PhotoClock *photoclock = photoclock_new (&settings, wslcd, ds3231,
+    catalog, console);
+
+  PPCBENCH_NEXT (STAGE_FIRST);
+  photoclock_draw_all (photoclock);
+  while (photoclock_render (photoclock, RENDER_SLICE_US));
+
+  PPCBENCH_NEXT (STAGE_CATALOG);
+  while (catalog_step (catalog, CATALOG_SLICE_US));
+
+  PPCBENCH_NEXT (STAGE_NEXT);
+  photoclock_draw_next_background (photoclock);
+  while (photoclock_render (photoclock, RENDER_SLICE_US));
+
+  PPCBENCH_NEXT (STAGES);
+  catalog_get_progress (catalog, &progress);
+  r->photos = progress.photos;
+  r->index_bytes = progress.index_bytes;
+  r->peak = heap_peak - base;
+  r->ok = true;
+
+  photoclock_destroy (photoclock);
+  catalog_destroy (catalog);
+done:
+  sdcard_destroy (sdcard);
+#if HOST_SD_EMULATOR
+  sdemu_destroy (emu);
+#endif
+  }
+
+/* =======================================================================
+  main
+ ======================================================================= */
+int main (int argc, char **argv)
+  {
+  if (argc < 2)
+    {
+    fprintf (stderr, "Usage: %s {image...}\n", argv[0]);
+    return 1;
+    }
+
+  stdio_init_all ();
+  DS3231 *ds3231 = ds3231_new (CLOCK_I2C_DEV, CLOCK_SDA,
+   CLOCK_SCL, CLOCK_I2C_BAUD);
+  WSLCD *wslcd = wslcd_new (WSLCD_SPI, WSLCD_CS, WSLCD_MISO, WSLCD_MOSI,
+    WSLCD_SCK, WSLCD_RST, WSLCD_DC, WSLCD_BL, WSLCD_BAUD,
+    WSLCD_SCAN_LANDSCAPE);
+  wslcd_init (wslcd);
+  GfxConsole *console = gfxconsole_new (wslcd);
+  gfxconsole_init (console);
+
+  int nimages = argc - 1;
+  PpcbenchResult *results = calloc ((size_t)nimages,
+    sizeof (PpcbenchResult));
+  if (!results) return 1;
+  for (int i = 0; i < nimages; i++)
+    ppcbench_run (argv[i + 1], wslcd, ds3231, console, &results[i]);
+
+  int failed = 0;
+  for (int i = 0; i < nimages; i++)
+    {
+    const PpcbenchResult *r = &results[i];
+    printf ("\n%s: ", argv[i + 1]);
+    if (!r->ok)
+      {
+      printf ("failed\n");
+      failed++;
+      continue;
+      }
+    printf ("%u photos, index %lu bytes, peak heap %lu bytes\n", r->photos,
+      (unsigned long)r->index_bytes, (unsigned long)r->peak);
+    printf ("  %-9s %10s %12s", "stage", "time ms", "heap bytes");
+    if (HOST_SD_EMULATOR) printf (" %12s", "SD bus ms");
+    printf ("\n");
+    uint64_t total = 0;
+    for (int s = 0; s < STAGES; s++)
+      {
+      total += r->us[s];
+      printf ("  %-9s %10.1f %12lu", stage_names[s],
+        (double)r->us[s] / 1000.0, (unsigned long)r->heap[s]);
+      if (HOST_SD_EMULATOR)
+        printf (" %12.1f", (double)r->bus_us[s] / 1000.0);
+      printf ("\n");
+      }
+    printf ("  %-9s %10.1f\n", "total", (double)total / 1000.0);
+    }
+
+  free (results);
+  gfxconsole_destroy (console);
+  wslcd_destroy (wslcd);
+  ds3231_destroy (ds3231);
+  return failed ? 1 : 0;
+  }
+
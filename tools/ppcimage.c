@@ -0,0 +1,443 @@
+/* =======================================================================
+
+  pico-photo-clock
+
+  tools/ppcimage.c
+
+  A host utility that makes SD card images for testing: a FAT32 or exFAT
+  volume, formatted using the same FatFs as the clock, holding any
+  number of photos in albums. The host build of the clock reads the
+  image named by HOST_SD_IMAGE, or by the environment variable
+  PPC_SDIMAGE, and tools/ppcbench measures the start-up against one.
+
+  The photos are copies of the JPEG files given, in turn, or if none
+  are given, synthetic ones: flat grey 480x320 baseline JPEGs, which
+  the clock can decode, padded out to -k kilobytes. The padding is
+  never written, so even an image with 50,000 photos takes little
+  space on the host's disk, and little time to make.
+
+  With -f, each photo is broken into one fragment per cluster, by
+  growing a spacer file in step with it, and deleting the spacer
+  afterwards. This is the worst case for the clock, which then has to
+  follow the FAT chain through each photo.
+
+  Usage: ppcimage [-x] [-f] [-n photos] [-a per_album] [-k kbytes]
+                    [-s megabytes] {image} [file.jpg...]
+
+  For example
+
+    ppcimage -n 10000 /tmp/10k.img
+    ppcimage -x -f -n 50000 /tmp/50k-exfat-frag.img
+
+  -x makes exFAT rather than FAT32. Photos are put in albums of -a
+  photos (default 1000) under /albums, or in the root directory if -a
+  is 0. The image is made big enough for the photos unless -s says
+  otherwise. An existing image is overwritten.
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+ ======================================================================= */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <ff.h>
+#include <diskio.h>
+
+// The size of the synthetic photos
+#define PPCIMAGE_WIDTH 480
+#define PPCIMAGE_HEIGHT 320
+
+// Room for the file system's own structures, on top of the photos
+#define PPCIMAGE_SPARE_MB 64
+
+// Clusters are never bigger than this, so an image sized with it has
+//   room for the photos whatever FatFs chooses
+#define PPCIMAGE_MAX_CLUSTER (128 * 1024)
+
+/* =======================================================================
+  A photo to copy onto the image
+ ======================================================================= */
+typedef struct _PpcimagePhoto
+  {
+  uint8_t *data;
+  UINT len;
+  } PpcimagePhoto;
+
+/* =======================================================================
+  The image. FatFs reads and writes it through the disk_xxx functions
+    below, which are much simpler than the clock's: there's no cache,
+    and no emulated card, whatever config.h says.
+ ======================================================================= */
+static int image_fd = -1;
+
+DSTATUS disk_initialize (BYTE pdrv)
+  {
+  (void)pdrv;
+  return image_fd >= 0 ? 0 : STA_NOINIT;
+  }
+
+DSTATUS disk_status (BYTE pdrv)
+  {
+  (void)pdrv;
+  return image_fd >= 0 ? 0 : STA_NOINIT;
+  }
+
+DRESULT disk_read (BYTE pdrv, BYTE *buff, LBA_t sector, UINT count)
+  {
+  (void)pdrv;
+  ssize_t n = (ssize_t)count * FF_MAX_SS;
+  return pread (image_fd, buff, (size_t)n, (off_t)sector * FF_MAX_SS) == n
+    ? RES_OK : RES_ERROR;
+  }
+
+DRESULT disk_write (BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count)
+  {
+  (void)pdrv;
+  ssize_t n = (ssize_t)count * FF_MAX_SS;
+  return pwrite (image_fd, buff, (size_t)n, (off_t)sector * FF_MAX_SS) == n
+    ? RES_OK : RES_ERROR;
+  }
+
+DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void *buff)
+  {
+  (void)pdrv;
+  struct stat st;
+  switch (cmd)
+    {
+    case CTRL_SYNC:
+      return RES_OK;
+    case GET_SECTOR_COUNT:
+      // f_mkfs needs the size of the image
+      if (fstat (image_fd, &st) != 0) return RES_ERROR;
+      *(LBA_t *)buff = (LBA_t)st.st_size / FF_MAX_SS;
+      return RES_OK;
+    case GET_BLOCK_SIZE:
+      *(DWORD *)buff = 1; // Unknown
+      return RES_OK;
+    default:
+      return RES_PARERR;
+    }
+  }
+
+DWORD get_fattime (void)
+  {
+  // 1 January 2023
+  return (DWORD)(2023 - 1980) << 25 | 1 << 21 | 1 << 16;
+  }
+
+/* =======================================================================
+  ppcimage_put16
+  Append a big-endian 16-bit number, as JPEG markers use
+ ======================================================================= */
+static uint8_t *ppcimage_put16 (uint8_t *p, unsigned int v)
+  {
+  *p++ = (uint8_t)(v >> 8);
+  *p++ = (uint8_t)v;
+  return p;
+  }
+
+/* =======================================================================
+  ppcimage_synthetic
+  Make a flat grey baseline JPEG, H2V2, in which every block has only
+    a DC coefficient of zero. With one-symbol Huffman tables, each
+    block is two zero bits. The caller frees the data.
+ ======================================================================= */
+static void ppcimage_synthetic (PpcimagePhoto *photo)
+  {
+  unsigned int mcus = ((PPCIMAGE_WIDTH + 15) / 16)
+    * ((PPCIMAGE_HEIGHT + 15) / 16);
+  unsigned int scan = (mcus * 6 * 2 + 7) / 8;
+  photo->data = calloc (1, 256 + scan);
+  if (!photo->data)
+    {
+    fprintf (stderr, "Out of memory\n");
+    exit (1);
+    }
+  uint8_t *p = photo->data;
+
+  *p++ = 0xFF; *p++ = 0xD8;
+
+  // One quantization table, which doesn't matter, since every
+  //   coefficient is zero
+  *p++ = 0xFF; *p++ = 0xDB;
+  p = ppcimage_put16 (p, 2 + 65);
+  *p++ = 0;
+  for (int i = 0; i < 64; i++) *p++ = 1;
+
+  *p++ = 0xFF; *p++ = 0xC0;
+  p = ppcimage_put16 (p, 8 + 3 * 3);
+  *p++ = 8;
+  p = ppcimage_put16 (p, PPCIMAGE_HEIGHT);
+  p = ppcimage_put16 (p, PPCIMAGE_WIDTH);
+  *p++ = 3;
+  *p++ = 1; *p++ = 0x22; *p++ = 0;
+  *p++ = 2; *p++ = 0x11; *p++ = 0;
+  *p++ = 3; *p++ = 0x11; *p++ = 0;
+
+  // DC table 0 and AC table 0, each with one one-bit code: a DC
+  //   difference of zero, and end-of-block
+  for (int ac = 0; ac <= 1; ac++)
+    {
+    *p++ = 0xFF; *p++ = 0xC4;
+    p = ppcimage_put16 (p, 2 + 1 + 16 + 1);
+    *p++ = (uint8_t)(ac << 4);
+    *p++ = 1;
+    for (int i = 1; i < 16; i++) *p++ = 0;
+    *p++ = 0;
+    }
+
+  *p++ = 0xFF; *p++ = 0xDA;
+  p = ppcimage_put16 (p, 6 + 2 * 3);
+  *p++ = 3;
+  *p++ = 1; *p++ = 0x00;
+  *p++ = 2; *p++ = 0x00;
+  *p++ = 3; *p++ = 0x00;
+  *p++ = 0; *p++ = 63; *p++ = 0;
+
+  // The scan is all zero bits, padded with one bits to a whole byte
+  memset (p, 0, scan);
+  unsigned int bits = mcus * 6 * 2;
+  if (bits % 8) p[scan - 1] = (uint8_t)(0xFF >> (bits % 8));
+  p += scan;
+
+  *p++ = 0xFF; *p++ = 0xD9;
+  photo->len = (UINT)(p - photo->data);
+  }
+
+/* =======================================================================
+  ppcimage_load
+  Read a whole file into memory
+ ======================================================================= */
+static bool ppcimage_load (const char *path, PpcimagePhoto *photo)
+  {
+  FILE *f = fopen (path, "rb");
+  if (!f) return false;
+  bool ok = false;
+  if (fseek (f, 0, SEEK_END) == 0)
+    {
+    long size = ftell (f);
+    if (size > 0 && size < 0x7FFFFFFF && fseek (f, 0, SEEK_SET) == 0)
+      {
+      photo->len = (UINT)size;
+      photo->data = malloc (photo->len);
+      if (photo->data)
+        {
+        ok = fread (photo->data, 1, photo->len, f) == photo->len;
+        if (!ok) free (photo->data);
+        }
+      }
+    }
+  fclose (f);
+  return ok;
+  }
+
+/* =======================================================================
+  ppcimage_write
+  Write a photo, padded out to size bytes. The padding is made by
+    seeking past the end of the file, which allocates clusters without
+    writing them. If spacer is not NULL, it is grown by a cluster after
+    each cluster of the photo, so the photo is in pieces.
+ ======================================================================= */
+static FRESULT ppcimage_write (const char *path, const PpcimagePhoto *photo,
+        FSIZE_t size, FIL *spacer, FSIZE_t cluster)
+  {
+  FIL fp;
+  FRESULT fr = f_open (&fp, path, FA_WRITE | FA_CREATE_ALWAYS);
+  if (fr != FR_OK) return fr;
+  if (size < photo->len) size = photo->len;
+
+  FSIZE_t pos = 0;
+  FSIZE_t step = spacer ? cluster : size;
+  while (fr == FR_OK && pos < size)
+    {
+    FSIZE_t end = pos + step < size ? pos + step : size;
+    if (pos < photo->len)
+      {
+      UINT n = (UINT)((end < photo->len ? end : photo->len) - pos);
+      UINT bw;
+      fr = f_write (&fp, photo->data + pos, n, &bw);
+      if (fr == FR_OK && bw != n) fr = FR_DENIED;
+      }
+    if (fr == FR_OK && f_tell (&fp) < end)
+      {
+      fr = f_lseek (&fp, end);
+      if (fr == FR_OK && f_tell (&fp) != end) fr = FR_DENIED;
+      }
+    if (fr == FR_OK && spacer)
+      fr = f_lseek (spacer, f_size (spacer) + cluster);
+    pos = end;
+    }
+
+  FRESULT fr2 = f_close (&fp);
+  return fr != FR_OK ? fr : fr2;
+  }
+
+/* =======================================================================
+  usage
+ ======================================================================= */
+static void usage (const char *argv0)
+  {
+  fprintf (stderr, "Usage: %s [-x] [-f] [-n photos] [-a per_album] "
+    "[-k kbytes] [-s megabytes] {image} [file.jpg...]\n", argv0);
+  }
+
+/* =======================================================================
+  main
+ ======================================================================= */
+int main (int argc, char **argv)
+  {
+  bool exfat = false;
+  bool fragment = false;
+  unsigned int count = 1000;
+  unsigned int per_album = 1000;
+  unsigned int kbytes = 64;
+  unsigned int megabytes = 0;
+  int opt;
+  while ((opt = getopt (argc, argv, "xfn:a:k:s:")) != -1)
+    {
+    switch (opt)
+      {
+      case 'x': exfat = true; break;
+      case 'f': fragment = true; break;
+      case 'n': count = (unsigned int)strtoul (optarg, NULL, 10); break;
+      case 'a': per_album = (unsigned int)strtoul (optarg, NULL, 10); break;
+      case 'k': kbytes = (unsigned int)strtoul (optarg, NULL, 10); break;
+      case 's': megabytes = (unsigned int)strtoul (optarg, NULL, 10); break;
+      default: usage (argv[0]); return 1;
+      }
+    }
+
+  if (argc - optind < 1)
+    {
+    usage (argv[0]);
+    return 1;
+    }
+  const char *image = argv[optind];
+
+  // The photos to copy, or one synthetic one
+  int nphotos = argc - optind - 1;
+  PpcimagePhoto *photos = calloc ((size_t)(nphotos ? nphotos : 1),
+    sizeof (PpcimagePhoto));
+  if (!photos)
+    {
+    fprintf (stderr, "Out of memory\n");
+    return 1;
+    }
+  FSIZE_t largest = 0;
+  for (int i = 0; i < nphotos; i++)
+    {
+    if (!ppcimage_load (argv[optind + 1 + i], &photos[i]))
+      {
+      fprintf (stderr, "Can't read %s\n", argv[optind + 1 + i]);
+      return 1;
+      }
+    if (photos[i].len > largest) largest = photos[i].len;
+    }
+  FSIZE_t pad = 0;
+  if (nphotos == 0)
+    {
+    ppcimage_synthetic (&photos[0]);
+    nphotos = 1;
+    pad = (FSIZE_t)kbytes * 1024;
+    largest = pad > photos[0].len ? pad : photos[0].len;
+    }
+
+  if (megabytes == 0)
+    {
+    // Each photo takes a whole number of clusters, and a fragmented
+    //   one needs as much again for the spacer while it's written
+    uint64_t per_photo = (largest + PPCIMAGE_MAX_CLUSTER - 1)
+      / PPCIMAGE_MAX_CLUSTER * PPCIMAGE_MAX_CLUSTER;
+    if (fragment) per_photo *= 2;
+    megabytes = (unsigned int)(per_photo * count / (1024 * 1024))
+      + PPCIMAGE_SPARE_MB;
+    }
+
+  // Make an empty image of the right size. It's sparse, so only what
+  //   FatFs writes takes space on disk.
+  image_fd = open (image, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (image_fd < 0 
+       || ftruncate (image_fd, (off_t)megabytes * 1024 * 1024) != 0)
+    {
+    fprintf (stderr, "Can't create %s\n", image);
+    return 1;
+    }
+
+  static BYTE work[FF_MAX_SS * 64];
+  MKFS_PARM parm;
+  memset (&parm, 0, sizeof (parm));
+  parm.fmt = exfat ? FM_EXFAT : FM_FAT32;
+  FRESULT fr = f_mkfs ("0:", &parm, work, sizeof (work));
+  if (fr != FR_OK)
+    {
+    fprintf (stderr, "Can't format %s as %s, %u MB: FatFs error %d\n",
+      image, exfat ? "exFAT" : "FAT32", megabytes, fr);
+    return 1;
+    }
+
+  static FATFS fatfs;
+  fr = f_mount (&fatfs, "0:", 1);
+  if (fr != FR_OK)
+    {
+    fprintf (stderr, "Can't mount %s: FatFs error %d\n", image, fr);
+    return 1;
+    }
+  FSIZE_t cluster = (FSIZE_t)fatfs.csize * FF_MAX_SS;
+
+  FIL spacer;
+  if (fragment)
+    {
+    fr = f_open (&spacer, "/spacer", FA_WRITE | FA_CREATE_ALWAYS);
+    if (fr != FR_OK)
+      {
+      fprintf (stderr, "Can't make the spacer file: FatFs error %d\n", fr);
+      return 1;
+      }
+    }
+
+  if (per_album) f_mkdir ("/albums");
+  unsigned int albums = 0;
+  for (unsigned int n = 0; n < count && fr == FR_OK; n++)
+    {
+    char path[64];
+    if (per_album)
+      {
+      if (n % per_album == 0)
+        {
+        snprintf (path, sizeof (path), "/albums/%04u", ++albums);
+        fr = f_mkdir (path);
+        if (fr != FR_OK) break;
+        }
+      snprintf (path, sizeof (path), "/albums/%04u/photo%05u.jpg", albums,
+        n + 1);
+      }
+    else
+      snprintf (path, sizeof (path), "/photo%05u.jpg", n + 1);
+    fr = ppcimage_write (path, &photos[n % (unsigned int)nphotos], pad,
+      fragment ? &spacer : NULL, cluster);
+    if (fr != FR_OK)
+      fprintf (stderr, "Can't write %s: FatFs error %d\n", path, fr);
+    }
+
+  if (fragment)
+    {
+    f_close (&spacer);
+    f_unlink ("/spacer");
+    }
+  f_unmount ("0:");
+  close (image_fd);
+
+  if (fr != FR_OK) return 1;
+  printf ("%s: %s, %u MB, %lu-byte clusters, %u photos%s, "
+    "%u albums\n", image, exfat ? "exFAT" : "FAT32", megabytes,
+    (unsigned long)cluster, count, fragment ? " (fragmented)" : "", albums);
+  for (int i = 0; i < nphotos; i++) free (photos[i].data);
+  free (photos);
+  return 0;
+  }
+
@@ -0,0 +1,282 @@
+/* =======================================================================
+
+  pico-photo-clock
+
+  tools/ppcpack.c
+
+  A host utility that gathers JPEG files into a pack -- one file with an
+  index at the start -- in the format described in files/pack.h. Each
+  photo's header is read using the same code as the Pico uses, and
+  photos that the Pico can't show, or that are bigger than
+  JPEG_MAX_SIZE, are left out, with a message. The photos themselves
+  are copied unchanged, each starting on a sector boundary.
+
+  Usage: ppcpack [-q] {output.ppk} {file.jpg...}
+
+  For example
+
+    cd ~/Pictures/holiday
+    ppcpack /media/sdcard/holiday.ppk *.jpg
+
+  A pack is best written to a freshly-formatted card, or one with plenty
+  of free space, so that it isn't fragmented. Photos keep their order,
+  but the clock shuffles them anyway.
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+ ======================================================================= */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <files/jpeghdr.h>
+#include <files/pack.h>
+#include "config.h"
+
+/* =======================================================================
+  A photo read into memory, for the header parser.
+ ======================================================================= */
+typedef struct _PpcpackPhoto
+  {
+  uint8_t *data;
+  uint32_t len;
+  } PpcpackPhoto;
+
+/* =======================================================================
+  ppcpack_read
+  The jpeghdr read function, for a photo in memory.
+ ======================================================================= */
+static uint32_t ppcpack_read (void *data, uint32_t offset, uint8_t *buf,
+        uint32_t len)
+  {
+  const PpcpackPhoto *photo = data;
+  if (offset >= photo->len) return 0;
+  if (len > photo->len - offset) len = photo->len - offset;
+  memcpy (buf, photo->data + offset, len);
+  return len;
+  }
+
+/* =======================================================================
+  ppcpack_load
+  Read a whole file into memory. Returns false if it can't be read, or
+    is too big for a pack.
+ ======================================================================= */
+static bool ppcpack_load (const char *path, PpcpackPhoto *photo)
+  {
+  FILE *f = fopen (path, "rb");
+  if (!f) return false;
+  bool ok = false;
+  if (fseek (f, 0, SEEK_END) == 0)
+    {
+    long size = ftell (f);
+    if (size > 0 && size < 0x7FFFFFFF && fseek (f, 0, SEEK_SET) == 0)
+      {
+      photo->len = (uint32_t)size;
+      photo->data = malloc (photo->len);
+      if (photo->data)
+        {
+        ok = fread (photo->data, 1, photo->len, f) == photo->len;
+        if (!ok) free (photo->data);
+        }
+      }
+    }
+  fclose (f);
+  return ok;
+  }
+
+/* =======================================================================
+  ppcpack_check
+  Parse a photo's header and fill in the parts of its index entry that
+    come from it. Returns NULL if the Pico can show the photo, or else
+    the reason it can't.
+ ======================================================================= */
+static const char *ppcpack_check (PpcpackPhoto *photo, PackEntry *entry)
+  {
+  JpegHeader hdr;
+  if (jpeghdr_parse (ppcpack_read, photo, &hdr) != 0)
+    return "not a JPEG file";
+  const char *why = jpeghdr_unsupported (&hdr);
+  if (why) return why;
+#if JPEG_MAX_SIZE
+  if (hdr.width > JPEG_MAX_SIZE || hdr.height > JPEG_MAX_SIZE)
+    return "too big";
+#endif
+  entry->width = (uint16_t)hdr.width;
+  entry->height = (uint16_t)hdr.height;
+  entry->restart_interval = (uint16_t)hdr.restart_interval;
+  entry->sampling = (uint8_t)hdr.sampling;
+  entry->orientation = (uint8_t)hdr.orientation;
+  // The index has 16 bits for the thumbnail's size; a thumbnail bigger
+  //   than that would be slower to show than the photo anyway
+  if (hdr.thumb_len && hdr.thumb_len <= 0xFFFF)
+    {
+    entry->thumb_offset = hdr.thumb_offset;
+    entry->thumb_len = (uint16_t)hdr.thumb_len;
+    }
+  return NULL;
+  }
+
+/* =======================================================================
+  ppcpack_basename
+ ======================================================================= */
+static const char *ppcpack_basename (const char *path)
+  {
+  const char *slash = strrchr (path, '/');
+  return slash ? slash + 1 : path;
+  }
+
+/* =======================================================================
+  ppcpack_pad
+  Write zeros up to the next multiple of PACK_ALIGN. Returns the new
+    offset.
+ ======================================================================= */
+static uint32_t ppcpack_pad (FILE *f, uint32_t offset)
+  {
+  static const uint8_t zeros[PACK_ALIGN];
+  uint32_t pad = (PACK_ALIGN - offset % PACK_ALIGN) % PACK_ALIGN;
+  fwrite (zeros, 1, pad, f);
+  return offset + pad;
+  }
+
+/* =======================================================================
+  usage
+ ======================================================================= */
+static void usage (const char *argv0)
+  {
+  fprintf (stderr, "Usage: %s [-q] {output.ppk} {file.jpg...}\n", argv0);
+  }
+
+/* =======================================================================
+  main
+ ======================================================================= */
+int main (int argc, char **argv)
+  {
+  bool quiet = false;
+  int opt;
+  while ((opt = getopt (argc, argv, "q")) != -1)
+    {
+    switch (opt)
+      {
+      case 'q': quiet = true; break;
+      default: usage (argv[0]); return 1;
+      }
+    }
+
+  if (argc - optind < 2)
+    {
+    usage (argv[0]);
+    return 1;
+    }
+
+  const char *out = argv[optind];
+  int nfiles = argc - optind - 1;
+  char **files = argv + optind + 1;
+
+  // First pass: check every photo, and work out where it will go, so
+  //   the index can be written before the photos
+  PackEntry *entries = calloc ((size_t)nfiles, sizeof (PackEntry));
+  int *sources = calloc ((size_t)nfiles, sizeof (int));
+  if (!entries || !sources)
+    {
+    fprintf (stderr, "Out of memory\n");
+    return 1;
+    }
+
+  uint32_t count = 0;
+  unsigned int left_out = 0;
+  for (int i = 0; i < nfiles; i++)
+    {
+    PpcpackPhoto photo;
+    if (!ppcpack_load (files[i], &photo))
+      {
+      fprintf (stderr, "Can't read %s\n", files[i]);
+      left_out++;
+      continue;
+      }
+    PackEntry *entry = &entries[count];
+    memset (entry, 0, sizeof (PackEntry));
+    const char *why = ppcpack_check (&photo, entry);
+    free (photo.data);
+    if (why)
+      {
+      fprintf (stderr, "Leaving out %s: %s\n", files[i], why);
+      left_out++;
+      continue;
+      }
+    entry->size = photo.len;
+    entry->name_hash = pack_hash (ppcpack_basename (files[i]));
+    sources[count++] = i;
+    }
+
+  if (count == 0)
+    {
+    fprintf (stderr, "No photos to pack\n");
+    return 1;
+    }
+
+  uint64_t offset = pack_data_offset (count);
+  for (uint32_t n = 0; n < count; n++)
+    {
+    entries[n].offset = (uint32_t)offset;
+    offset += entries[n].size;
+    offset = (offset + PACK_ALIGN - 1) / PACK_ALIGN * PACK_ALIGN;
+    if (offset > 0xFFFFFFFFu)
+      {
+      fprintf (stderr, "The photos are too big for one pack\n");
+      return 1;
+      }
+    }
+
+  FILE *f = fopen (out, "wb");
+  if (!f)
+    {
+    fprintf (stderr, "Can't open %s for writing\n", out);
+    return 1;
+    }
+
+  uint8_t buf[PACK_ENTRY_SIZE];
+  pack_encode_header (buf, count);
+  fwrite (buf, 1, PACK_HEADER_SIZE, f);
+  for (uint32_t n = 0; n < count; n++)
+    {
+    pack_encode_entry (buf, &entries[n]);
+    fwrite (buf, 1, PACK_ENTRY_SIZE, f);
+    }
+  uint32_t pos = ppcpack_pad (f, PACK_HEADER_SIZE + count * PACK_ENTRY_SIZE);
+
+  // Second pass: copy the photos
+  for (uint32_t n = 0; n < count; n++)
+    {
+    const char *file = files[sources[n]];
+    PpcpackPhoto photo;
+    if (!ppcpack_load (file, &photo) || photo.len != entries[n].size)
+      {
+      fprintf (stderr, "%s changed while it was being packed\n", file);
+      fclose (f);
+      remove (out);
+      return 1;
+      }
+    fwrite (photo.data, 1, photo.len, f);
+    free (photo.data);
+    pos = ppcpack_pad (f, pos + entries[n].size);
+    if (!quiet)
+      printf ("%s: %ux%u, %u bytes at %u\n", file, entries[n].width,
+        entries[n].height, entries[n].size, entries[n].offset);
+    }
+
+  if (fclose (f) != 0)
+    {
+    fprintf (stderr, "Can't write %s\n", out);
+    remove (out);
+    return 1;
+    }
+
+  printf ("%s: %u photos, %u bytes, %u left out\n", out, count, pos,
+    left_out);
+  free (entries);
+  free (sources);
+  return 0;
+  }
+
@@ -0,0 +1,1159 @@
+/* =======================================================================
+
+  pico-photo-clock
+
+  tools/ppcprep.c
+
+  A host utility that prepares photos for the clock, in one pass,
+  without ImageMagick. Each photo is decoded using the same picojpeg as
+  the Pico uses, turned upright according to its EXIF orientation,
+  scaled and cropped to fill the panel -- 480x320, or 320x480 for
+  portrait photos, which the panel rotates -- and written as a baseline
+  JPEG in the form the Pico decodes fastest:
+
+  - Chroma sampled H2V2 by default, which halves the number of blocks
+    to decode compared with H1V1, and makes the file smaller. -s h1v1
+    keeps full colour resolution, at about twice the decoding time.
+  - A restart marker every -r rows of MCUs (default 1), so a damaged
+    sector spoils one strip of the photo rather than the rest of it.
+  - No metadata, except a small EXIF thumbnail (-t, default 120 pixels
+    wide), which the clock draws as a preview while the photo decodes.
+  - At most -k kilobytes (default PREFETCH_MAX_KB), so the clock can
+    read the whole photo into memory ahead of time; the quality is
+    reduced, in steps, until the photo fits.
+
+  Each output file is decoded again with picojpeg and its header
+  checked with the catalog's parser, so a photo that ppcprep writes
+  is one the clock can show. ppcprep reports the size and quality of
+  each, and a rough estimate of how long the Pico will take to read
+  and decode it; the clock's 'stats' command gives the real figures.
+
+  Only baseline JPEGs can be read, since that's all picojpeg handles;
+  progressive ones need converting some other way first.
+
+  Usage: ppcprep [-l] [-s h2v2|h1v1] [-q quality] [-r rows]
+                   [-t width] [-k kbytes] {files...} {directory}
+
+  For example
+
+    ppcprep ~/Pictures/holiday/IMG_*.jpg /media/sdcard/holiday
+
+  The output files are written to the directory, which must exist,
+  with their original names. With -l, portrait photos are skipped.
+
+  Copyright (c)2023 Kevin Boone, GPLv3.0
+
+ ======================================================================= */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <math.h>
+#include <unistd.h>
+#include <gfx/picojpeg.h>
+#include <files/jpeghdr.h>
+#include "config.h"
+
+// The panel
+#define PPCPREP_WIDTH 480
+#define PPCPREP_HEIGHT 320
+
+// Quality is stepped down by this much at a time until the photo fits
+//   in the size limit, but not below PPCPREP_MIN_QUALITY
+#define PPCPREP_QUALITY_STEP 5
+#define PPCPREP_MIN_QUALITY 40
+
+// Rough costs of reading and decoding a photo on a Pico at 125MHz, for
+//   the estimate: each 8x8 block that is decoded, each pixel that is
+//   colour-converted, each byte of entropy-coded data, and each
+//   kilobyte read from the card at SD_HIGH_SPEED_BAUD.
+#define PPCPREP_NS_PER_BLOCK 25000
+#define PPCPREP_NS_PER_PIXEL 300
+#define PPCPREP_NS_PER_BYTE 800
+#define PPCPREP_US_PER_KB 330
+
+typedef enum
+  {
+  PPCPREP_H2V2 = 0,
+  PPCPREP_H1V1
+  } PpcprepSampling;
+
+/* =======================================================================
+  An RGB image, three bytes per pixel
+ ======================================================================= */
+typedef struct _PpcprepImage
+  {
+  int width;
+  int height;
+  uint8_t *rgb;
+  } PpcprepImage;
+
+/* =======================================================================
+  A growing buffer of output bytes
+ ======================================================================= */
+typedef struct _PpcprepBuf
+  {
+  uint8_t *data;
+  size_t len;
+  size_t size;
+  } PpcprepBuf;
+
+/* =======================================================================
+  A JPEG in memory, for picojpeg and the header parser
+ ======================================================================= */
+typedef struct _PpcprepSource
+  {
+  const uint8_t *data;
+  uint32_t len;
+  uint32_t pos;
+  } PpcprepSource;
+
+/* =======================================================================
+  What the encoder needs to know
+ ======================================================================= */
+typedef struct _PpcprepOptions
+  {
+  PpcprepSampling sampling;
+  int quality;
+  int restart_rows;
+  int thumb_width;
+  uint32_t max_bytes;
+  bool landscape_only;
+  } PpcprepOptions;
+
+/* =======================================================================
+  The tables from Annex K of the JPEG standard. The quantization tables
+    are in natural order, and are scaled by the quality.
+ ======================================================================= */
+static const uint8_t zigzag[64] =
+  {
+   0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+  12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+  35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+  58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+  };
+
+static const uint8_t quant_luma[64] =
+  {
+  16, 11, 10, 16,  24,  40,  51,  61,
+  12, 12, 14, 19,  26,  58,  60,  55,
+  14, 13, 16, 24,  40,  57,  69,  56,
+  14, 17, 22, 29,  51,  87,  80,  62,
+  18, 22, 37, 56,  68, 109, 103,  77,
+  24, 35, 55, 64,  81, 104, 113,  92,
+  49, 64, 78, 87, 103, 121, 120, 101,
+  72, 92, 95, 98, 112, 100, 103,  99
+  };
+
+static const uint8_t quant_chroma[64] =
+  {
+  17, 18, 24, 47, 99, 99, 99, 99,
+  18, 21, 26, 66, 99, 99, 99, 99,
+  24, 26, 56, 99, 99, 99, 99, 99,
+  47, 66, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99
+  };
+
+static const uint8_t dc_luma_bits[16] =
+  { 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 };
+static const uint8_t dc_chroma_bits[16] =
+  { 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0 };
+static const uint8_t dc_values[12] =
+  { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+static const uint8_t ac_luma_bits[16] =
+  { 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d };
+static const uint8_t ac_luma_values[162] =
+  {
+  0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12,
+  0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+  0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08,
+  0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0,
+  0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16,
+  0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28,
+  0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+  0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+  0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+  0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+  0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+  0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+  0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98,
+  0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+  0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6,
+  0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5,
+  0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4,
+  0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2,
+  0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea,
+  0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+  0xf9, 0xfa
+  };
+
+static const uint8_t ac_chroma_bits[16] =
+  { 0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77 };
+static const uint8_t ac_chroma_values[162] =
+  {
+  0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21,
+  0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71,
+  0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91,
+  0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0,
+  0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34,
+  0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26,
+  0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38,
+  0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+  0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+  0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+  0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+  0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+  0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96,
+  0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5,
+  0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4,
+  0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3,
+  0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2,
+  0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda,
+  0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9,
+  0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8,
+  0xf9, 0xfa
+  };
+
+/* =======================================================================
+  A Huffman table, as the code and its length for each symbol
+ ======================================================================= */
+typedef struct _PpcprepHuff
+  {
+  uint16_t code[256];
+  uint8_t size[256];
+  } PpcprepHuff;
+
+/* =======================================================================
+  The state of the entropy coder
+ ======================================================================= */
+typedef struct _PpcprepBits
+  {
+  PpcprepBuf *buf;
+  uint32_t acc;
+  int n;
+  } PpcprepBits;
+
+/* =======================================================================
+  ppcprep_put, ppcprep_put16
+  Append bytes to the output buffer
+ ======================================================================= */
+static void ppcprep_put (PpcprepBuf *buf, uint8_t b)
+  {
+  if (buf->len == buf->size)
+    {
+    buf->size = buf->size ? buf->size * 2 : 65536;
+    buf->data = realloc (buf->data, buf->size);
+    if (!buf->data)
+      {
+      fprintf (stderr, "Out of memory\n");
+      exit (1);
+      }
+    }
+  buf->data[buf->len++] = b;
+  }
+
+static void ppcprep_put16 (PpcprepBuf *buf, unsigned int v)
+  {
+  ppcprep_put (buf, (uint8_t)(v >> 8));
+  ppcprep_put (buf, (uint8_t)v);
+  }
+
+static void ppcprep_put_le16 (PpcprepBuf *buf, unsigned int v)
+  {
+  ppcprep_put (buf, (uint8_t)v);
+  ppcprep_put (buf, (uint8_t)(v >> 8));
+  }
+
+static void ppcprep_put_le32 (PpcprepBuf *buf, uint32_t v)
+  {
+  ppcprep_put_le16 (buf, v & 0xFFFF);
+  ppcprep_put_le16 (buf, v >> 16);
+  }
+
+/* =======================================================================
+  ppcprep_put_bits
+  Append the low size bits of code to the entropy-coded data, stuffing
+    a zero after each 0xFF byte.
+ ======================================================================= */
+static void ppcprep_put_bits (PpcprepBits *bits, uint32_t code, int size)
+  {
+  bits->acc = (bits->acc << size) | (code & ((1u << size) - 1));
+  bits->n += size;
+  while (bits->n >= 8)
+    {
+    uint8_t b = (uint8_t)(bits->acc >> (bits->n - 8));
+    ppcprep_put (bits->buf, b);
+    if (b == 0xFF) ppcprep_put (bits->buf, 0);
+    bits->n -= 8;
+    }
+  bits->acc &= (1u << bits->n) - 1;
+  }
+
+/* =======================================================================
+  ppcprep_flush_bits
+  Pad the entropy-coded data to a whole byte with one bits, as the
+    standard requires before a marker.
+ ======================================================================= */
+static void ppcprep_flush_bits (PpcprepBits *bits)
+  {
+  int pad = (8 - bits->n % 8) % 8;
+  ppcprep_put_bits (bits, 0x7F, pad);
+  }
+
+/* =======================================================================
+  ppcprep_make_huff
+  Work out the codes for a table given as the number of codes of each
+    length, and the symbols in order (Annex C of the standard)
+ ======================================================================= */
+static void ppcprep_make_huff (const uint8_t *bits, const uint8_t *values,
+        PpcprepHuff *huff)
+  {
+  memset (huff, 0, sizeof (PpcprepHuff));
+  unsigned int code = 0;
+  int k = 0;
+  for (int len = 1; len <= 16; len++)
+    {
+    for (int i = 0; i < bits[len - 1]; i++)
+      {
+      huff->code[values[k]] = (uint16_t)code++;
+      huff->size[values[k]] = (uint8_t)len;
+      k++;
+      }
+    code <<= 1;
+    }
+  }
+
+/* =======================================================================
+  ppcprep_put_dht
+  Write one Huffman table to a DHT segment
+ ======================================================================= */
+static void ppcprep_put_dht (PpcprepBuf *buf, int id, const uint8_t *bits,
+        const uint8_t *values)
+  {
+  int count = 0;
+  for (int i = 0; i < 16; i++) count += bits[i];
+  ppcprep_put (buf, 0xFF);
+  ppcprep_put (buf, 0xC4);
+  ppcprep_put16 (buf, (unsigned int)(2 + 1 + 16 + count));
+  ppcprep_put (buf, (uint8_t)id);
+  for (int i = 0; i < 16; i++) ppcprep_put (buf, bits[i]);
+  for (int i = 0; i < count; i++) ppcprep_put (buf, values[i]);
+  }
+
+/* =======================================================================
+  ppcprep_scale_quant
+  Scale a quantization table by quality, 1-100, as libjpeg does
+ ======================================================================= */
+static void ppcprep_scale_quant (const uint8_t *base, int quality,
+        uint8_t *q)
+  {
+  int scale = quality < 50 ? 5000 / quality : 200 - quality * 2;
+  for (int i = 0; i < 64; i++)
+    {
+    int v = (base[i] * scale + 50) / 100;
+    if (v < 1) v = 1;
+    if (v > 255) v = 255;
+    q[i] = (uint8_t)v;
+    }
+  }
+
+/* =======================================================================
+  ppcprep_fdct
+  Forward DCT of one 8x8 block of level-shifted samples, quantized and
+    put in zig-zag order
+ ======================================================================= */
+static void ppcprep_fdct (const float *in, const uint8_t *q, int *out)
+  {
+  static float c[8][8];
+  static bool ready = false;
+  if (!ready)
+    {
+    for (int u = 0; u < 8; u++)
+      for (int x = 0; x < 8; x++)
+        c[u][x] = (float)((u == 0 ? M_SQRT1_2 : 1.0) / 2.0
+          * cos ((2 * x + 1) * u * M_PI / 16.0));
+    ready = true;
+    }
+
+  float tmp[64];
+  for (int y = 0; y < 8; y++)
+    for (int u = 0; u < 8; u++)
+      {
+      float s = 0;
+      for (int x = 0; x < 8; x++) s += c[u][x] * in[y * 8 + x];
+      tmp[y * 8 + u] = s;
+      }
+  float coef[64];
+  for (int u = 0; u < 8; u++)
+    for (int v = 0; v < 8; v++)
+      {
+      float s = 0;
+      for (int y = 0; y < 8; y++) s += c[v][y] * tmp[y * 8 + u];
+      coef[v * 8 + u] = s;
+      }
+
+  for (int i = 0; i < 64; i++)
+    {
+    int n = zigzag[i];
+    int v = (int)lroundf (coef[n] / q[n]);
+    // The standard tables only go up to ten bits for AC coefficients
+    if (v > 1023) v = 1023; else if (v < -1023) v = -1023;
+    out[i] = v;
+    }
+  }
+
+/* =======================================================================
+  ppcprep_category
+  The number of bits needed for the magnitude of v
+ ======================================================================= */
+static int ppcprep_category (int v)
+  {
+  if (v < 0) v = -v;
+  int n = 0;
+  while (v) { n++; v >>= 1; }
+  return n;
+  }
+
+/* =======================================================================
+  ppcprep_encode_block
+  Entropy-code one block, updating the component's DC prediction
+ ======================================================================= */
+static void ppcprep_encode_block (PpcprepBits *bits, const int *zz,
+        int *pred, const PpcprepHuff *dc, const PpcprepHuff *ac)
+  {
+  int diff = zz[0] - *pred;
+  *pred = zz[0];
+  int cat = ppcprep_category (diff);
+  ppcprep_put_bits (bits, dc->code[cat], dc->size[cat]);
+  if (cat)
+    ppcprep_put_bits (bits, (uint32_t)(diff < 0 ? diff - 1 : diff), cat);
+
+  int run = 0;
+  for (int i = 1; i < 64; i++)
+    {
+    if (zz[i] == 0)
+      {
+      run++;
+      continue;
+      }
+    while (run > 15)
+      {
+      ppcprep_put_bits (bits, ac->code[0xF0], ac->size[0xF0]);
+      run -= 16;
+      }
+    cat = ppcprep_category (zz[i]);
+    int sym = run << 4 | cat;
+    ppcprep_put_bits (bits, ac->code[sym], ac->size[sym]);
+    ppcprep_put_bits (bits, (uint32_t)(zz[i] < 0 ? zz[i] - 1 : zz[i]), cat);
+    run = 0;
+    }
+  if (run) ppcprep_put_bits (bits, ac->code[0], ac->size[0]);
+  }
+
+/* =======================================================================
+  ppcprep_plane_block
+  Copy the 8x8 block at x, y of a plane, replicating the edge pixels
+    beyond its width and height, and level-shift it
+ ======================================================================= */
+static void ppcprep_plane_block (const float *plane, int w, int h, int x,
+        int y, float *block)
+  {
+  for (int j = 0; j < 8; j++)
+    {
+    int sy = y + j < h ? y + j : h - 1;
+    for (int i = 0; i < 8; i++)
+      {
+      int sx = x + i < w ? x + i : w - 1;
+      block[j * 8 + i] = plane[sy * w + sx] - 128.0f;
+      }
+    }
+  }
+
+/* =======================================================================
+  ppcprep_encode
+  Write a complete baseline JPEG of image to buf. If thumb is not NULL,
+    it is included in an EXIF block, and is the only metadata.
+ ======================================================================= */
+static void ppcprep_encode (const PpcprepImage *image,
+        PpcprepSampling sampling, int quality, int restart_rows,
+        const PpcprepBuf *thumb, PpcprepBuf *buf)
+  {
+  int w = image->width, h = image->height;
+  int mcu = sampling == PPCPREP_H2V2 ? 16 : 8;
+  int mcus_per_row = (w + mcu - 1) / mcu;
+  int mcu_rows = (h + mcu - 1) / mcu;
+  int restart = mcus_per_row * restart_rows;
+  if (restart > 0xFFFF) restart = 0;
+
+  uint8_t ql[64], qc[64];
+  ppcprep_scale_quant (quant_luma, quality, ql);
+  ppcprep_scale_quant (quant_chroma, quality, qc);
+
+  // Convert to YCbCr, as JFIF does, and average the chroma over 2x2
+  //   pixels for H2V2
+  int cw = sampling == PPCPREP_H2V2 ? (w + 1) / 2 : w;
+  int ch = sampling == PPCPREP_H2V2 ? (h + 1) / 2 : h;
+  float *py = malloc ((size_t)(w * h) * sizeof (float));
+  float *pcb = calloc ((size_t)(cw * ch), sizeof (float));
+  float *pcr = calloc ((size_t)(cw * ch), sizeof (float));
+  float *count = calloc ((size_t)(cw * ch), sizeof (float));
+  if (!py || !pcb || !pcr || !count)
+    {
+    fprintf (stderr, "Out of memory\n");
+    exit (1);
+    }
+  for (int y = 0; y < h; y++)
+    for (int x = 0; x < w; x++)
+      {
+      const uint8_t *p = image->rgb + (y * w + x) * 3;
+      float r = p[0], g = p[1], b = p[2];
+      py[y * w + x] = 0.299f * r + 0.587f * g + 0.114f * b;
+      int c = sampling == PPCPREP_H2V2 ? (y / 2) * cw + x / 2 : y * w + x;
+      pcb[c] += -0.168736f * r - 0.331264f * g + 0.5f * b + 128.0f;
+      pcr[c] += 0.5f * r - 0.418688f * g - 0.081312f * b + 128.0f;
+      count[c] += 1.0f;
+      }
+  for (int i = 0; i < cw * ch; i++)
+    {
+    pcb[i] /= count[i];
+    pcr[i] /= count[i];
+    }
+  free (count);
+
+  // Headers
+  ppcprep_put (buf, 0xFF);
+  ppcprep_put (buf, 0xD8);
+
+  if (thumb)
+    {
+    // APP1, with a TIFF header, an empty IFD0, and an IFD1 that says
+    //   where the thumbnail is
+    uint32_t tiff_len = 8 + 6 + 2 + 3 * 12 + 4 + (uint32_t)thumb->len;
+    ppcprep_put (buf, 0xFF);
+    ppcprep_put (buf, 0xE1);
+    ppcprep_put16 (buf, 2 + 6 + tiff_len);
+    const char *exif = "Exif";
+    for (int i = 0; i < 6; i++)
+      ppcprep_put (buf, i < 4 ? (uint8_t)exif[i] : 0);
+    ppcprep_put (buf, 'I');
+    ppcprep_put (buf, 'I');
+    ppcprep_put_le16 (buf, 42);
+    ppcprep_put_le32 (buf, 8);
+    ppcprep_put_le16 (buf, 0); // IFD0: no entries
+    ppcprep_put_le32 (buf, 14); // IFD1
+    ppcprep_put_le16 (buf, 3);
+    ppcprep_put_le16 (buf, 0x0103); // Compression: JPEG
+    ppcprep_put_le16 (buf, 3);
+    ppcprep_put_le32 (buf, 1);
+    ppcprep_put_le32 (buf, 6);
+    ppcprep_put_le16 (buf, 0x0201); // Thumbnail offset
+    ppcprep_put_le16 (buf, 4);
+    ppcprep_put_le32 (buf, 1);
+    ppcprep_put_le32 (buf, 14 + 2 + 3 * 12 + 4);
+    ppcprep_put_le16 (buf, 0x0202); // Thumbnail length
+    ppcprep_put_le16 (buf, 4);
+    ppcprep_put_le32 (buf, 1);
+    ppcprep_put_le32 (buf, (uint32_t)thumb->len);
+    ppcprep_put_le32 (buf, 0); // No more IFDs
+    for (size_t i = 0; i < thumb->len; i++)
+      ppcprep_put (buf, thumb->data[i]);
+    }
+
+  ppcprep_put (buf, 0xFF);
+  ppcprep_put (buf, 0xDB);
+  ppcprep_put16 (buf, 2 + 2 * 65);
+  ppcprep_put (buf, 0);
+  for (int i = 0; i < 64; i++) ppcprep_put (buf, ql[zigzag[i]]);
+  ppcprep_put (buf, 1);
+  for (int i = 0; i < 64; i++) ppcprep_put (buf, qc[zigzag[i]]);
+
+  ppcprep_put (buf, 0xFF);
+  ppcprep_put (buf, 0xC0);
+  ppcprep_put16 (buf, 8 + 3 * 3);
+  ppcprep_put (buf, 8);
+  ppcprep_put16 (buf, (unsigned int)h);
+  ppcprep_put16 (buf, (unsigned int)w);
+  ppcprep_put (buf, 3);
+  ppcprep_put (buf, 1);
+  ppcprep_put (buf, sampling == PPCPREP_H2V2 ? 0x22 : 0x11);
+  ppcprep_put (buf, 0);
+  for (uint8_t c = 2; c <= 3; c++)
+    {
+    ppcprep_put (buf, c);
+    ppcprep_put (buf, 0x11);
+    ppcprep_put (buf, 1);
+    }
+
+  ppcprep_put_dht (buf, 0x00, dc_luma_bits, dc_values);
+  ppcprep_put_dht (buf, 0x10, ac_luma_bits, ac_luma_values);
+  ppcprep_put_dht (buf, 0x01, dc_chroma_bits, dc_values);
+  ppcprep_put_dht (buf, 0x11, ac_chroma_bits, ac_chroma_values);
+
+  if (restart)
+    {
+    ppcprep_put (buf, 0xFF);
+    ppcprep_put (buf, 0xDD);
+    ppcprep_put16 (buf, 4);
+    ppcprep_put16 (buf, (unsigned int)restart);
+    }
+
+  ppcprep_put (buf, 0xFF);
+  ppcprep_put (buf, 0xDA);
+  ppcprep_put16 (buf, 6 + 2 * 3);
+  ppcprep_put (buf, 3);
+  ppcprep_put (buf, 1);
+  ppcprep_put (buf, 0x00);
+  ppcprep_put (buf, 2);
+  ppcprep_put (buf, 0x11);
+  ppcprep_put (buf, 3);
+  ppcprep_put (buf, 0x11);
+  ppcprep_put (buf, 0);
+  ppcprep_put (buf, 63);
+  ppcprep_put (buf, 0);
+
+  // The scan
+  PpcprepHuff dcl, acl, dcc, acc;
+  ppcprep_make_huff (dc_luma_bits, dc_values, &dcl);
+  ppcprep_make_huff (ac_luma_bits, ac_luma_values, &acl);
+  ppcprep_make_huff (dc_chroma_bits, dc_values, &dcc);
+  ppcprep_make_huff (ac_chroma_bits, ac_chroma_values, &acc);
+
+  PpcprepBits bits = { buf, 0, 0 };
+  int pred[3] = { 0, 0, 0 };
+  int n = 0, rst = 0;
+  float block[64];
+  int zz[64];
+  for (int my = 0; my < mcu_rows; my++)
+    for (int mx = 0; mx < mcus_per_row; mx++)
+      {
+      if (restart && n == restart)
+        {
+        ppcprep_flush_bits (&bits);
+        ppcprep_put (buf, 0xFF);
+        ppcprep_put (buf, (uint8_t)(0xD0 + rst));
+        rst = (rst + 1) & 7;
+        pred[0] = pred[1] = pred[2] = 0;
+        n = 0;
+        }
+      n++;
+
+      for (int by = 0; by < mcu; by += 8)
+        for (int bx = 0; bx < mcu; bx += 8)
+          {
+          ppcprep_plane_block (py, w, h, mx * mcu + bx, my * mcu + by,
+            block);
+          ppcprep_fdct (block, ql, zz);
+          ppcprep_encode_block (&bits, zz, &pred[0], &dcl, &acl);
+          }
+      ppcprep_plane_block (pcb, cw, ch, mx * 8, my * 8, block);
+      ppcprep_fdct (block, qc, zz);
+      ppcprep_encode_block (&bits, zz, &pred[1], &dcc, &acc);
+      ppcprep_plane_block (pcr, cw, ch, mx * 8, my * 8, block);
+      ppcprep_fdct (block, qc, zz);
+      ppcprep_encode_block (&bits, zz, &pred[2], &dcc, &acc);
+      }
+  ppcprep_flush_bits (&bits);
+  ppcprep_put (buf, 0xFF);
+  ppcprep_put (buf, 0xD9);
+
+  free (py);
+  free (pcb);
+  free (pcr);
+  }
+
+/* =======================================================================
+  ppcprep_need_bytes
+  picojpeg's input callback: the decoder reads the data where it is
+ ======================================================================= */
+static unsigned char ppcprep_need_bytes (const unsigned char **buf,
+        unsigned short *bytes_available, void *data)
+  {
+  PpcprepSource *src = data;
+  uint32_t n = src->len - src->pos;
+  if (n > USHRT_MAX) n = USHRT_MAX;
+  *buf = src->data + src->pos;
+  src->pos += n;
+  *bytes_available = (unsigned short)n;
+  return 0;
+  }
+
+/* =======================================================================
+  ppcprep_hdr_read
+  The header parser's read function
+ ======================================================================= */
+static uint32_t ppcprep_hdr_read (void *data, uint32_t offset,
+        uint8_t *buf, uint32_t len)
+  {
+  const PpcprepSource *src = data;
+  if (offset >= src->len) return 0;
+  if (len > src->len - offset) len = src->len - offset;
+  memcpy (buf, src->data + offset, len);
+  return len;
+  }
+
+/* =======================================================================
+  ppcprep_decode
+  Decode a JPEG in memory with picojpeg. Returns picojpeg's error code,
+    or zero on success. If info is not NULL, the decoder's view of the
+    image is copied there.
+ ======================================================================= */
+static int ppcprep_decode (const uint8_t *data, uint32_t len,
+        PpcprepImage *image, pjpeg_image_info_t *info_out)
+  {
+  PpcprepSource src = { data, len, 0 };
+  pjpeg_image_info_t info;
+  unsigned char status = pjpeg_decode_init_ptr (&info, ppcprep_need_bytes,
+    &src, 0);
+  if (status) return status;
+  if (info_out) *info_out = info;
+
+  int w = info.m_width, h = info.m_height;
+  image->width = w;
+  image->height = h;
+  image->rgb = malloc ((size_t)(w * h) * 3);
+  if (!image->rgb) return PJPG_NOTENOUGHMEM;
+
+  for (int mcu_y = 0; mcu_y < info.m_MCUSPerCol; mcu_y++)
+    for (int mcu_x = 0; mcu_x < info.m_MCUSPerRow; mcu_x++)
+      {
+      status = pjpeg_decode_mcu ();
+      if (status)
+        {
+        free (image->rgb);
+        image->rgb = NULL;
+        return status;
+        }
+      for (int by = 0; by < info.m_MCUHeight; by += 8)
+        for (int bx = 0; bx < info.m_MCUWidth; bx += 8)
+          {
+          int src_ofs = bx * 8 + by * 16;
+          for (int y = 0; y < 8; y++)
+            {
+            int iy = mcu_y * info.m_MCUHeight + by + y;
+            if (iy >= h) break;
+            for (int x = 0; x < 8; x++)
+              {
+              int ix = mcu_x * info.m_MCUWidth + bx + x;
+              if (ix >= w) break;
+              int i = src_ofs + y * 8 + x;
+              uint8_t *p = image->rgb + (iy * w + ix) * 3;
+              if (info.m_scanType == PJPG_GRAYSCALE)
+                p[0] = p[1] = p[2] = info.m_pMCUBufR[i];
+              else
+                {
+                p[0] = info.m_pMCUBufR[i];
+                p[1] = info.m_pMCUBufG[i];
+                p[2] = info.m_pMCUBufB[i];
+                }
+              }
+            }
+          }
+      }
+  return 0;
+  }
+
+/* =======================================================================
+  ppcprep_orient
+  Turn an image upright, according to its EXIF orientation
+ ======================================================================= */
+static void ppcprep_orient (PpcprepImage *image, int orientation)
+  {
+  if (orientation < 2 || orientation > 8) return;
+  int w = image->width, h = image->height;
+  bool swap = orientation >= 5;
+  int ow = swap ? h : w, oh = swap ? w : h;
+  uint8_t *out = malloc ((size_t)(w * h) * 3);
+  if (!out) return;
+  for (int y = 0; y < oh; y++)
+    for (int x = 0; x < ow; x++)
+      {
+      int sx, sy;
+      switch (orientation)
+        {
+        case 2: sx = w - 1 - x; sy = y; break;
+        case 3: sx = w - 1 - x; sy = h - 1 - y; break;
+        case 4: sx = x; sy = h - 1 - y; break;
+        case 5: sx = y; sy = x; break;
+        case 6: sx = y; sy = h - 1 - x; break;
+        case 7: sx = w - 1 - y; sy = h - 1 - x; break;
+        default: sx = w - 1 - y; sy = x; break;
+        }
+      memcpy (out + (y * ow + x) * 3, image->rgb + (sy * w + sx) * 3, 3);
+      }
+  free (image->rgb);
+  image->rgb = out;
+  image->width = ow;
+  image->height = oh;
+  }
+
+/* =======================================================================
+  ppcprep_resample
+  Resample one line of out_len pixels from in_len, starting at start
+    and stepping by step source pixels for each output pixel. Each
+    output pixel is the average of the source pixels it covers; when
+    enlarging, it covers at least one source pixel, which makes this a
+    linear interpolation.
+ ======================================================================= */
+static void ppcprep_resample (const float *in, size_t in_step, int in_len,
+        float *out, size_t out_step, int out_len, double start,
+        double step)
+  {
+  for (int d = 0; d < out_len; d++)
+    {
+    double a = start + d * step, b = a + step;
+    if (step < 1.0)
+      {
+      a = start + (d + 0.5) * step - 0.5;
+      b = a + 1.0;
+      }
+    if (a < 0) a = 0;
+    if (b > in_len) b = in_len;
+    double sum[3] = { 0, 0, 0 }, total = 0;
+    for (int i = (int)a; i < b; i++)
+      {
+      double wgt = (i + 1 < b ? i + 1 : b) - (i > a ? i : a);
+      if (wgt <= 0) continue;
+      for (size_t c = 0; c < 3; c++) 
+        sum[c] += wgt * in[(size_t)i * in_step + c];
+      total += wgt;
+      }
+    for (size_t c = 0; c < 3; c++)
+      out[(size_t)d * out_step + c] = total > 0 
+        ? (float)(sum[c] / total) : 0;
+    }
+  }
+
+/* =======================================================================
+  ppcprep_resize
+  Scale image to fill width x height, cropping whatever is left over
+    equally from both sides
+ ======================================================================= */
+static void ppcprep_resize (const PpcprepImage *in, int width, int height,
+        PpcprepImage *out)
+  {
+  int w = in->width, h = in->height;
+  double scale = (double)width / w;
+  if ((double)height / h > scale) scale = (double)height / h;
+  double x0 = (w - width / scale) / 2;
+  double y0 = (h - height / scale) / 2;
+
+  float *src = malloc ((size_t)(w * h) * 3 * sizeof (float));
+  float *tmp = malloc ((size_t)(width * h) * 3 * sizeof (float));
+  float *dst = malloc ((size_t)(width * height) * 3 * sizeof (float));
+  out->rgb = malloc ((size_t)(width * height) * 3);
+  if (!src || !tmp || !dst || !out->rgb)
+    {
+    fprintf (stderr, "Out of memory\n");
+    exit (1);
+    }
+  for (size_t i = 0; i < (size_t)(w * h) * 3; i++) src[i] = in->rgb[i];
+  for (int y = 0; y < h; y++)
+    ppcprep_resample (src + (size_t)(y * w) * 3, 3, w,
+      tmp + (size_t)(y * width) * 3, 3, width, x0, 1.0 / scale);
+  for (int x = 0; x < width; x++)
+    ppcprep_resample (tmp + (size_t)x * 3, (size_t)width * 3, h,
+      dst + (size_t)x * 3, (size_t)width * 3, height, y0, 1.0 / scale);
+  for (size_t i = 0; i < (size_t)(width * height) * 3; i++)
+    out->rgb[i] = (uint8_t)lroundf (dst[i] < 0 ? 0 : dst[i] > 255 ? 255
+      : dst[i]);
+  out->width = width;
+  out->height = height;
+  free (src);
+  free (tmp);
+  free (dst);
+  }
+
+/* =======================================================================
+  ppcprep_psnr
+  The peak signal-to-noise ratio between two images of the same size
+ ======================================================================= */
+static double ppcprep_psnr (const PpcprepImage *a, const PpcprepImage *b)
+  {
+  double sum = 0;
+  size_t n = (size_t)(a->width * a->height) * 3;
+  for (size_t i = 0; i < n; i++)
+    {
+    double d = (double)a->rgb[i] - b->rgb[i];
+    sum += d * d;
+    }
+  if (sum == 0) return 99.0;
+  return 10.0 * log10 (255.0 * 255.0 * (double)n / sum);
+  }
+
+/* =======================================================================
+  ppcprep_estimate_ms
+  Roughly how long the Pico will take to read and decode a photo
+ ======================================================================= */
+static unsigned int ppcprep_estimate_ms (const pjpeg_image_info_t *info,
+        uint32_t file_len, uint32_t thumb_len)
+  {
+  int blocks_per_mcu;
+  switch (info->m_scanType)
+    {
+    case PJPG_GRAYSCALE: blocks_per_mcu = 1; break;
+    case PJPG_YH1V1: blocks_per_mcu = 3; break;
+    case PJPG_YH2V1: case PJPG_YH1V2: blocks_per_mcu = 4; break;
+    default: blocks_per_mcu = 6; break;
+    }
+  uint64_t blocks = (uint64_t)(info->m_MCUSPerRow * info->m_MCUSPerCol)
+    * (uint64_t)blocks_per_mcu;
+  uint64_t pixels = (uint64_t)(info->m_width * info->m_height);
+  uint64_t ns = blocks * PPCPREP_NS_PER_BLOCK
+    + pixels * PPCPREP_NS_PER_PIXEL
+    + (uint64_t)(file_len - thumb_len) * PPCPREP_NS_PER_BYTE
+    + (uint64_t)file_len * PPCPREP_US_PER_KB * 1000 / 1024;
+  return (unsigned int)(ns / 1000000);
+  }
+
+/* =======================================================================
+  ppcprep_load
+  Read a whole file into memory
+ ======================================================================= */
+static uint8_t *ppcprep_load (const char *path, uint32_t *len)
+  {
+  FILE *f = fopen (path, "rb");
+  if (!f) return NULL;
+  uint8_t *data = NULL;
+  if (fseek (f, 0, SEEK_END) == 0)
+    {
+    long size = ftell (f);
+    if (size > 0 && size < 0x7FFFFFFF && fseek (f, 0, SEEK_SET) == 0)
+      {
+      data = malloc ((size_t)size);
+      if (data && fread (data, 1, (size_t)size, f) != (size_t)size)
+        {
+        free (data);
+        data = NULL;
+        }
+      *len = (uint32_t)size;
+      }
+    }
+  fclose (f);
+  return data;
+  }
+
+/* =======================================================================
+  ppcprep_process
+  Prepare one photo. Returns 0 if it was written, 1 if it was skipped,
+    or -1 if something went wrong.
+ ======================================================================= */
+static int ppcprep_process (const char *file, const char *dir,
+        const PpcprepOptions *options)
+  {
+  const char *slash = strrchr (file, '/');
+  const char *name = slash ? slash + 1 : file;
+
+  uint32_t len;
+  uint8_t *data = ppcprep_load (file, &len);
+  if (!data)
+    {
+    fprintf (stderr, "Can't read %s\n", file);
+    return -1;
+    }
+
+  PpcprepSource src = { data, len, 0 };
+  JpegHeader hdr;
+  if (jpeghdr_parse (ppcprep_hdr_read, &src, &hdr) != 0)
+    {
+    fprintf (stderr, "%s: not a JPEG file\n", file);
+    free (data);
+    return -1;
+    }
+  if (hdr.progressive || hdr.sof != 0xC0)
+    {
+    fprintf (stderr, "%s: only baseline JPEGs can be read\n", file);
+    free (data);
+    return -1;
+    }
+
+  PpcprepImage image;
+  int status = ppcprep_decode (data, len, &image, NULL);
+  free (data);
+  if (status)
+    {
+    fprintf (stderr, "%s: can't decode, picojpeg error %d\n", file, status);
+    return -1;
+    }
+  ppcprep_orient (&image, hdr.orientation);
+
+  bool portrait = image.height > image.width;
+  if (portrait && options->landscape_only)
+    {
+    printf ("Skipping %s: portrait layout\n", file);
+    free (image.rgb);
+    return 1;
+    }
+
+  PpcprepImage panel;
+  ppcprep_resize (&image, portrait ? PPCPREP_HEIGHT : PPCPREP_WIDTH,
+    portrait ? PPCPREP_WIDTH : PPCPREP_HEIGHT, &panel);
+  free (image.rgb);
+
+  PpcprepBuf thumb = { NULL, 0, 0 };
+  if (options->thumb_width > 0)
+    {
+    PpcprepImage small;
+    int tw = options->thumb_width;
+    int th = (tw * panel.height + panel.width / 2) / panel.width;
+    ppcprep_resize (&panel, tw, th, &small);
+    ppcprep_encode (&small, PPCPREP_H2V2, 75, 0, NULL, &thumb);
+    free (small.rgb);
+    // The thumbnail has to fit in the EXIF block, and in the 16 bits
+    //   the catalog keeps for its size
+    if (thumb.len > 60000) thumb.len = 0;
+    }
+
+  // Lower the quality until the photo fits in the limit
+  PpcprepBuf out = { NULL, 0, 0 };
+  int quality = options->quality;
+  for (;;)
+    {
+    out.len = 0;
+    ppcprep_encode (&panel, options->sampling, quality,
+      options->restart_rows, thumb.len ? &thumb : NULL, &out);
+    if (!options->max_bytes || out.len <= options->max_bytes
+         || quality <= PPCPREP_MIN_QUALITY)
+      break;
+    quality -= PPCPREP_QUALITY_STEP;
+    if (quality < PPCPREP_MIN_QUALITY) quality = PPCPREP_MIN_QUALITY;
+    }
+
+  // Check that the clock will be able to show it
+  int ret = 0;
+  src.data = out.data;
+  src.len = (uint32_t)out.len;
+  src.pos = 0;
+  const char *why = NULL;
+  if (jpeghdr_parse (ppcprep_hdr_read, &src, &hdr) != 0)
+    why = "the header can't be parsed";
+  else
+    why = jpeghdr_unsupported (&hdr);
+  PpcprepImage check = { 0, 0, NULL };
+  pjpeg_image_info_t info;
+  if (!why && ppcprep_decode (out.data, (uint32_t)out.len, &check, &info))
+    why = "picojpeg can't decode it";
+  if (!why && (check.width != panel.width || check.height != panel.height))
+    why = "picojpeg gets the wrong size";
+  if (why)
+    {
+    fprintf (stderr, "%s: the output is no good: %s\n", file, why);
+    ret = -1;
+    }
+  else
+    {
+    char path[PATH_MAX];
+    snprintf (path, sizeof (path), "%s/%s", dir, name);
+    FILE *f = fopen (path, "wb");
+    if (!f || fwrite (out.data, 1, out.len, f) != out.len)
+      {
+      fprintf (stderr, "Can't write %s\n", path);
+      ret = -1;
+      }
+    if (f && fclose (f) != 0 && ret == 0)
+      {
+      fprintf (stderr, "Can't write %s\n", path);
+      ret = -1;
+      }
+    if (ret == 0)
+      {
+      printf ("%s: %dx%d %s, quality %d, %lu bytes", path, panel.width,
+        panel.height, options->sampling == PPCPREP_H2V2 ? "H2V2" : "H1V1",
+        quality, (unsigned long)out.len);
+      if (hdr.thumb_len)
+        printf (" (thumbnail %lu)", (unsigned long)hdr.thumb_len);
+      if (options->max_bytes && out.len > options->max_bytes)
+        printf (", too big to prefetch");
+      printf (", PSNR %.1f dB, about %u ms on the Pico\n",
+        ppcprep_psnr (&panel, &check),
+        ppcprep_estimate_ms (&info, (uint32_t)out.len, hdr.thumb_len));
+      }
+    }
+
+  free (check.rgb);
+  free (panel.rgb);
+  free (thumb.data);
+  free (out.data);
+  return ret;
+  }
+
+/* =======================================================================
+  usage
+ ======================================================================= */
+static void usage (const char *argv0)
+  {
+  fprintf (stderr, "Usage: %s [-l] [-s h2v2|h1v1] [-q quality] [-r rows] "
+    "[-t width] [-k kbytes] {files...} {directory}\n", argv0);
+  }
+
+/* =======================================================================
+  main
+ ======================================================================= */
+int main (int argc, char **argv)
+  {
+  PpcprepOptions options;
+  options.sampling = PPCPREP_H2V2;
+  options.quality = 85;
+  options.restart_rows = 1;
+  options.thumb_width = 120;
+  options.max_bytes = PREFETCH_MAX_KB * 1024;
+  options.landscape_only = false;
+
+  int opt;
+  while ((opt = getopt (argc, argv, "ls:q:r:t:k:")) != -1)
+    {
+    switch (opt)
+      {
+      case 'l': options.landscape_only = true; break;
+      case 's':
+        if (strcmp (optarg, "h2v2") == 0)
+          options.sampling = PPCPREP_H2V2;
+        else if (strcmp (optarg, "h1v1") == 0)
+          options.sampling = PPCPREP_H1V1;
+        else
+          {
+          usage (argv[0]);
+          return 1;
+          }
+        break;
+      case 'q': options.quality = atoi (optarg); break;
+      case 'r': options.restart_rows = atoi (optarg); break;
+      case 't': options.thumb_width = atoi (optarg); break;
+      case 'k': options.max_bytes = (uint32_t)atoi (optarg) * 1024; break;
+      default: usage (argv[0]); return 1;
+      }
+    }
+
+  // Above 95 or so, coefficients can be too big for the standard
+  //   Huffman tables
+  if (options.quality < 1) options.quality = 1;
+  if (options.quality > 95) options.quality = 95;
+  if (options.restart_rows < 0) options.restart_rows = 0;
+  if (options.thumb_width > PPCPREP_WIDTH / 2)
+    options.thumb_width = PPCPREP_WIDTH / 2;
+
+  if (argc - optind < 2)
+    {
+    usage (argv[0]);
+    return 1;
+    }
+
+  const char *dir = argv[argc - 1];
+  unsigned int written = 0, skipped = 0, failed = 0;
+  for (int i = optind; i < argc - 1; i++)
+    {
+    int ret = ppcprep_process (argv[i], dir, &options);
+    if (ret == 0) written++;
+    else if (ret > 0) skipped++;
+    else failed++;
+    }
+
+  printf ("%u written, %u skipped, %u failed\n", written, skipped, failed);
+  return failed ? 1 : 0;
+  }
+